@@ -1,18 +1,49 @@
 #pragma once
 
+#include <cstring>
 #include <string>
 
-std::string stringjoin(const std::string& sep) {
-  return "";
+// stringjoin(sep, args...) --- args are std::strings, C strings or chars.
+// The result size is calculated first, so there's exactly one allocation.
+
+namespace stringjoin_detail {
+
+  struct piece {
+    const char* ptr;
+    size_t len;
+
+    piece(const std::string& s) : ptr(s.data()), len(s.size()) {}
+    piece(const char* s) : ptr(s), len(strlen(s)) {}
+    piece(const char& c) : ptr(&c), len(1) {}
+  };
+
 }
 
-template <typename T>
-std::string stringjoin(const std::string& sep, const T& v) {
-  return v;
+inline std::string stringjoin(const std::string& sep) {
+  (void)sep;
+  return "";
 }
 
 template <typename T, typename... TA>
-std::string stringjoin(const std::string& sep, const T& v, TA... args) {
-  return v + sep + stringjoin(sep, args...);
-}
+std::string stringjoin(const std::string& sep, const T& v, const TA&... args) {
+  using stringjoin_detail::piece;
+
+  const piece pieces[] = {piece(v), piece(args)...};
+  const size_t n = sizeof(pieces) / sizeof(pieces[0]);
+
+  size_t len = (n - 1) * sep.size();
+  for (size_t i=0; i < n; i++) {
+    len += pieces[i].len;
+  }
 
+  std::string res;
+  res.reserve(len);
+
+  res.append(pieces[0].ptr, pieces[0].len);
+  for (size_t i=1; i < n; i++) {
+    res.append(sep);
+    res.append(pieces[i].ptr, pieces[i].len);
+  }
+
+  return res;
+}
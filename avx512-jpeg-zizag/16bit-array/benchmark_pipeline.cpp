@@ -0,0 +1,83 @@
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+#include "pipeline_all.cpp"
+
+class BenchmarkPipeline {
+    std::vector<uint8_t> pixels;
+    std::vector<int16_t> coefs;
+    GrayImage img;
+    QuantTable q;
+
+public:
+    BenchmarkPipeline(int width, int height, int quality)
+        : q(jpeg_luminance_table, quality) {
+
+        img.width  = width;
+        img.height = height;
+        img.stride = width;
+        pixels.resize(img.stride * height);
+        coefs.resize(img.blocks() * 64);
+        img.data   = pixels.data();
+
+        uint32_t seed = 1;
+        for (int y=0; y < height; y++) {
+            for (int x=0; x < width; x++) {
+                seed = seed * 1103515245 + 12345;
+                pixels[y * img.stride + x] = (x + 2*y + (seed >> 28)) & 0xff;
+            }
+        }
+
+        jpeg_forward_image_scalar(img, q, coefs.data());
+    }
+
+public:
+    void run(int repeat) {
+        printf("image %d x %d (%d blocks), best of %d runs\n", img.width, img.height, img.blocks(), repeat);
+
+        test("scalar forward", repeat, [this]{ jpeg_forward_image_scalar(img, q, coefs.data()); });
+        test("scalar inverse", repeat, [this]{ jpeg_inverse_image_scalar(coefs.data(), q, img); });
+#ifdef HAVE_AVX2
+        test("AVX2 forward", repeat, [this]{ jpeg_forward_image_avx2(img, q, coefs.data()); });
+        test("AVX2 inverse", repeat, [this]{ jpeg_inverse_image_avx2(coefs.data(), q, img); });
+#endif
+#ifdef HAVE_AVX512F
+        test("AVX512F forward", repeat, [this]{ jpeg_forward_image_avx512(img, q, coefs.data()); });
+        test("AVX512F inverse", repeat, [this]{ jpeg_inverse_image_avx512(coefs.data(), q, img); });
+#endif
+    }
+
+private:
+    template <typename FUN>
+    void test(const char* name, int repeat, FUN fun) {
+        typedef std::chrono::steady_clock clock;
+
+        double best = 1e30;
+        for (int i=0; i < repeat; i++) {
+            const auto t1 = clock::now();
+            fun();
+            const auto t2 = clock::now();
+
+            const double t = std::chrono::duration<double>(t2 - t1).count();
+            if (t < best)
+                best = t;
+        }
+
+        printf("%-30s\t: %8.3f ms %8.2f Mblocks/s\n", name, best * 1000.0, img.blocks() / best / 1e6);
+    }
+};
+
+int main(int argc, char* argv[]) {
+
+    const int repeat  = (argc > 1) ? atoi(argv[1]) : 20;
+    const int quality = (argc > 2) ? atoi(argv[2]) : 75;
+
+    const int sizes[][2] = {{1920, 1080}, {3840, 2160}};
+    for (size_t i=0; i < sizeof(sizes)/sizeof(sizes[0]); i++) {
+        BenchmarkPipeline bench(sizes[i][0], sizes[i][1], quality);
+        bench.run(repeat);
+    }
+
+    return 0;
+}
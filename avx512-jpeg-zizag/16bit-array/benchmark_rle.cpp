@@ -0,0 +1,92 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <vector>
+#include "rle_all.cpp"
+
+class BenchmarkRle {
+    std::vector<int16_t>    coefs;
+    std::vector<JpegSymbol> symbols;
+    size_t count;
+
+    typedef size_t (*RleFunction)(const int16_t* blocks, size_t count, JpegSymbol* out);
+
+public:
+    // coefficients of a 4K image, quantized with the given quality
+    BenchmarkRle(int quality) {
+        GrayImage img;
+        std::vector<uint8_t> pixels(3840 * 2160);
+        img.data   = pixels.data();
+        img.stride = 3840;
+        img.width  = 3840;
+        img.height = 2160;
+
+        uint32_t seed = 1;
+        for (int y=0; y < img.height; y++) {
+            for (int x=0; x < img.width; x++) {
+                seed = seed * 1103515245 + 12345;
+                const double v = 128 + 60 * sin(x / 37.0) * cos(y / 23.0) + 40 * sin((x + y) / 7.0);
+                pixels[y * img.stride + x] = int(v) + (seed >> 29);
+            }
+        }
+
+        count = img.blocks();
+        coefs.resize(count * 64);
+        symbols.resize(count * jpeg::MAX_SYMBOLS);
+
+        jpeg_forward_image_scalar(img, QuantTable(jpeg_luminance_table, quality), coefs.data());
+    }
+
+public:
+    void run(int quality, int repeat) {
+        const size_t n = jpeg_rle_scalar(coefs.data(), count, symbols.data());
+        printf("quality %d: %zu blocks, %zu symbols (%0.2f per block), best of %d runs\n",
+               quality, count, n, double(n) / count, repeat);
+
+        test("scalar",                  jpeg_rle_scalar, repeat);
+        test("scalar (tzcnt)",          jpeg_rle_scalar_tzcnt, repeat);
+#ifdef HAVE_AVX2
+        test("AVX2 (tzcnt)",            jpeg_rle_avx2, repeat);
+#endif
+#ifdef HAVE_AVX512BW
+        test("AVX512BW (tzcnt)",        jpeg_rle_avx512bw, repeat);
+#endif
+#ifdef HAVE_AVX512VBMI2
+        test("AVX512VBMI2 (compress)",  jpeg_rle_avx512vbmi2, repeat);
+#endif
+    }
+
+private:
+    void test(const char* name, RleFunction rle, int repeat) {
+        typedef std::chrono::steady_clock clock;
+
+        double best = 1e30;
+        size_t n = 0;
+        for (int i=0; i < repeat; i++) {
+            const auto t1 = clock::now();
+            n = rle(coefs.data(), count, symbols.data());
+            const auto t2 = clock::now();
+
+            const double t = std::chrono::duration<double>(t2 - t1).count();
+            if (t < best)
+                best = t;
+        }
+
+        printf("%-30s\t: %8.3f ms %8.2f Msymbols/s %8.2f Mblocks/s\n",
+               name, best * 1000.0, n / best / 1e6, count / best / 1e6);
+    }
+};
+
+int main(int argc, char* argv[]) {
+
+    const int repeat = (argc > 1) ? atoi(argv[1]) : 20;
+
+    const int qualities[] = {50, 75, 90};
+    for (size_t i=0; i < sizeof(qualities)/sizeof(qualities[0]); i++) {
+        BenchmarkRle bench(qualities[i]);
+        bench.run(qualities[i], repeat);
+    }
+
+    return 0;
+}
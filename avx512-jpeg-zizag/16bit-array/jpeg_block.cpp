@@ -0,0 +1,390 @@
+#include <cstdint>
+#include <cstddef>
+
+/*
+    JPEG block pipeline: 8x8 blocks of 8-bit gray image -> forward DCT ->
+    quantization -> zigzag (and the way back).
+
+    DCT is the accurate integer algorithm from IJG libjpeg (jfdctint.c,
+    jidctint.c): Loeffler-Ligtenberg-Moschytz with 13-bit constants, the
+    forward transform yields coefficients scaled by 8.
+
+    Quantization divides by 8*Q with rounding to nearest (ties away from
+    zero); SIMD code multiplies by reciprocals, which is exact for all
+    dividends below 2^15 (see QuantTable).
+
+    Scalar code below is the reference.  SIMD code (jpeg_block_avx2.cpp,
+    jpeg_block_avx512.cpp) processes batches of 16 blocks transposed to
+    "structure of arrays": a vector keeps the same coefficient of all blocks,
+    thus the algorithm is executed exactly as scalar, just on vectors.
+*/
+
+namespace jpeg {
+
+    const int CONST_BITS = 13;
+    const int PASS1_BITS = 2;
+
+    const int32_t FIX_0_298631336 = 2446;
+    const int32_t FIX_0_390180644 = 3196;
+    const int32_t FIX_0_541196100 = 4433;
+    const int32_t FIX_0_765366865 = 6270;
+    const int32_t FIX_0_899976223 = 7373;
+    const int32_t FIX_1_175875602 = 9633;
+    const int32_t FIX_1_501321110 = 12299;
+    const int32_t FIX_1_847759065 = 15137;
+    const int32_t FIX_1_961570560 = 16069;
+    const int32_t FIX_2_053119869 = 16819;
+    const int32_t FIX_2_562915447 = 20995;
+    const int32_t FIX_3_072711026 = 25172;
+
+    const int BATCH = 16; // blocks processed by SIMD code at once
+
+} // namespace jpeg
+
+
+struct GrayImage {
+    uint8_t* data;
+    size_t   stride;
+    int      width;     // multiple of 8
+    int      height;    // multiple of 8
+
+    int blocks() const {
+        return (width / 8) * (height / 8);
+    }
+};
+
+
+// Luminance table from JPEG standard (Annex K), natural order
+const uint8_t jpeg_luminance_table[64] = {
+    16,  11,  10,  16,  24,  40,  51,  61,
+    12,  12,  14,  19,  26,  58,  60,  55,
+    14,  13,  16,  24,  40,  57,  69,  56,
+    14,  17,  22,  29,  51,  87,  80,  62,
+    18,  22,  37,  56,  68, 109, 103,  77,
+    24,  35,  55,  64,  81, 104, 113,  92,
+    49,  64,  78,  87, 103, 121, 120, 101,
+    72,  92,  95,  98, 112, 100, 103,  99
+};
+
+
+class QuantTable {
+public:
+    // all arrays in natural order
+    uint16_t quant[64];         // Q
+    uint16_t divisor[64];       // 8*Q --- DCT output is scaled by 8
+    uint32_t reciprocal[64];
+    uint32_t shift[64];
+
+public:
+    // quality 1..100, like libjpeg's jpeg_quality_scaling
+    QuantTable(const uint8_t* base, int quality) {
+        if (quality < 1)   quality = 1;
+        if (quality > 100) quality = 100;
+
+        const int scale = (quality < 50) ? 5000 / quality : 200 - 2*quality;
+        for (int i=0; i < 64; i++) {
+            int q = (base[i] * scale + 50) / 100;
+            if (q < 1)   q = 1;
+            if (q > 255) q = 255;
+
+            set(i, q);
+        }
+    }
+
+    void set(int i, int q) {
+        quant[i]   = q;
+        divisor[i] = 8 * q;
+
+        // n / d == (n * reciprocal) >> shift for n < 2^15:
+        // shift = 15 + ceil(log2(d)), reciprocal = floor(2^shift / d) + 1
+        int log2 = 0;
+        while ((1u << log2) < divisor[i])
+            log2 += 1;
+
+        shift[i]      = 15 + log2;
+        reciprocal[i] = (uint32_t)((1ull << shift[i]) / divisor[i] + 1);
+    }
+};
+
+
+// x / d rounded to nearest, ties away from zero
+inline int16_t jpeg_quantize_scalar(int32_t x, const QuantTable& q, int k) {
+    const int32_t d = q.divisor[k];
+    if (x < 0)
+        return -((-x + d/2) / d);
+    else
+        return (x + d/2) / d;
+}
+
+
+// descale with rounding
+inline int32_t jpeg_descale(int32_t x, int n) {
+    return (x + (1 << (n - 1))) >> n;
+}
+
+
+// out: 64 coefficients in natural order, scaled by 8
+void jpeg_fdct_islow(const uint8_t* pixels, size_t stride, int32_t* out) {
+    using namespace jpeg;
+
+    int32_t* p = out;
+    for (int row=0; row < 8; row++, p += 8) {
+        const uint8_t* r = pixels + row * stride;
+        int32_t d[8];
+        for (int i=0; i < 8; i++)
+            d[i] = int32_t(r[i]) - 128;
+
+        const int32_t tmp0 = d[0] + d[7];
+        int32_t       tmp7 = d[0] - d[7];
+        const int32_t tmp1 = d[1] + d[6];
+        int32_t       tmp6 = d[1] - d[6];
+        const int32_t tmp2 = d[2] + d[5];
+        int32_t       tmp5 = d[2] - d[5];
+        const int32_t tmp3 = d[3] + d[4];
+        int32_t       tmp4 = d[3] - d[4];
+
+        const int32_t tmp10 = tmp0 + tmp3;
+        const int32_t tmp13 = tmp0 - tmp3;
+        const int32_t tmp11 = tmp1 + tmp2;
+        const int32_t tmp12 = tmp1 - tmp2;
+
+        p[0] = (tmp10 + tmp11) << PASS1_BITS;
+        p[4] = (tmp10 - tmp11) << PASS1_BITS;
+
+        int32_t z1 = (tmp12 + tmp13) * FIX_0_541196100;
+        p[2] = jpeg_descale(z1 + tmp13 * FIX_0_765366865, CONST_BITS - PASS1_BITS);
+        p[6] = jpeg_descale(z1 - tmp12 * FIX_1_847759065, CONST_BITS - PASS1_BITS);
+
+        z1 = tmp4 + tmp7;
+        int32_t z2 = tmp5 + tmp6;
+        int32_t z3 = tmp4 + tmp6;
+        int32_t z4 = tmp5 + tmp7;
+        const int32_t z5 = (z3 + z4) * FIX_1_175875602;
+
+        tmp4 *= FIX_0_298631336;
+        tmp5 *= FIX_2_053119869;
+        tmp6 *= FIX_3_072711026;
+        tmp7 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 *= -FIX_1_961570560;
+        z4 *= -FIX_0_390180644;
+
+        z3 += z5;
+        z4 += z5;
+
+        p[7] = jpeg_descale(tmp4 + z1 + z3, CONST_BITS - PASS1_BITS);
+        p[5] = jpeg_descale(tmp5 + z2 + z4, CONST_BITS - PASS1_BITS);
+        p[3] = jpeg_descale(tmp6 + z2 + z3, CONST_BITS - PASS1_BITS);
+        p[1] = jpeg_descale(tmp7 + z1 + z4, CONST_BITS - PASS1_BITS);
+    }
+
+    for (int col=0; col < 8; col++) {
+        int32_t* c = out + col;
+
+        const int32_t tmp0 = c[8*0] + c[8*7];
+        int32_t       tmp7 = c[8*0] - c[8*7];
+        const int32_t tmp1 = c[8*1] + c[8*6];
+        int32_t       tmp6 = c[8*1] - c[8*6];
+        const int32_t tmp2 = c[8*2] + c[8*5];
+        int32_t       tmp5 = c[8*2] - c[8*5];
+        const int32_t tmp3 = c[8*3] + c[8*4];
+        int32_t       tmp4 = c[8*3] - c[8*4];
+
+        const int32_t tmp10 = tmp0 + tmp3;
+        const int32_t tmp13 = tmp0 - tmp3;
+        const int32_t tmp11 = tmp1 + tmp2;
+        const int32_t tmp12 = tmp1 - tmp2;
+
+        c[8*0] = jpeg_descale(tmp10 + tmp11, PASS1_BITS);
+        c[8*4] = jpeg_descale(tmp10 - tmp11, PASS1_BITS);
+
+        int32_t z1 = (tmp12 + tmp13) * FIX_0_541196100;
+        c[8*2] = jpeg_descale(z1 + tmp13 * FIX_0_765366865, CONST_BITS + PASS1_BITS);
+        c[8*6] = jpeg_descale(z1 - tmp12 * FIX_1_847759065, CONST_BITS + PASS1_BITS);
+
+        z1 = tmp4 + tmp7;
+        int32_t z2 = tmp5 + tmp6;
+        int32_t z3 = tmp4 + tmp6;
+        int32_t z4 = tmp5 + tmp7;
+        const int32_t z5 = (z3 + z4) * FIX_1_175875602;
+
+        tmp4 *= FIX_0_298631336;
+        tmp5 *= FIX_2_053119869;
+        tmp6 *= FIX_3_072711026;
+        tmp7 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 *= -FIX_1_961570560;
+        z4 *= -FIX_0_390180644;
+
+        z3 += z5;
+        z4 += z5;
+
+        c[8*7] = jpeg_descale(tmp4 + z1 + z3, CONST_BITS + PASS1_BITS);
+        c[8*5] = jpeg_descale(tmp5 + z2 + z4, CONST_BITS + PASS1_BITS);
+        c[8*3] = jpeg_descale(tmp6 + z2 + z3, CONST_BITS + PASS1_BITS);
+        c[8*1] = jpeg_descale(tmp7 + z1 + z4, CONST_BITS + PASS1_BITS);
+    }
+}
+
+
+// in: 64 dequantized coefficients in natural order
+void jpeg_idct_islow(const int32_t* in, uint8_t* pixels, size_t stride) {
+    using namespace jpeg;
+
+    int32_t ws[64];
+
+    for (int col=0; col < 8; col++) {
+        const int32_t* c = in + col;
+
+        int32_t z2 = c[8*2];
+        int32_t z3 = c[8*6];
+        int32_t z1 = (z2 + z3) * FIX_0_541196100;
+        int32_t tmp2 = z1 - z3 * FIX_1_847759065;
+        int32_t tmp3 = z1 + z2 * FIX_0_765366865;
+
+        z2 = c[8*0];
+        z3 = c[8*4];
+        int32_t tmp0 = (z2 + z3) << CONST_BITS;
+        int32_t tmp1 = (z2 - z3) << CONST_BITS;
+
+        const int32_t tmp10 = tmp0 + tmp3;
+        const int32_t tmp13 = tmp0 - tmp3;
+        const int32_t tmp11 = tmp1 + tmp2;
+        const int32_t tmp12 = tmp1 - tmp2;
+
+        tmp0 = c[8*7];
+        tmp1 = c[8*5];
+        tmp2 = c[8*3];
+        tmp3 = c[8*1];
+
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        int32_t z4 = tmp1 + tmp3;
+        const int32_t z5 = (z3 + z4) * FIX_1_175875602;
+
+        tmp0 *= FIX_0_298631336;
+        tmp1 *= FIX_2_053119869;
+        tmp2 *= FIX_3_072711026;
+        tmp3 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 *= -FIX_1_961570560;
+        z4 *= -FIX_0_390180644;
+
+        z3 += z5;
+        z4 += z5;
+
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        int32_t* w = ws + col;
+        w[8*0] = jpeg_descale(tmp10 + tmp3, CONST_BITS - PASS1_BITS);
+        w[8*7] = jpeg_descale(tmp10 - tmp3, CONST_BITS - PASS1_BITS);
+        w[8*1] = jpeg_descale(tmp11 + tmp2, CONST_BITS - PASS1_BITS);
+        w[8*6] = jpeg_descale(tmp11 - tmp2, CONST_BITS - PASS1_BITS);
+        w[8*2] = jpeg_descale(tmp12 + tmp1, CONST_BITS - PASS1_BITS);
+        w[8*5] = jpeg_descale(tmp12 - tmp1, CONST_BITS - PASS1_BITS);
+        w[8*3] = jpeg_descale(tmp13 + tmp0, CONST_BITS - PASS1_BITS);
+        w[8*4] = jpeg_descale(tmp13 - tmp0, CONST_BITS - PASS1_BITS);
+    }
+
+    for (int row=0; row < 8; row++) {
+        const int32_t* r = ws + 8*row;
+
+        int32_t z2 = r[2];
+        int32_t z3 = r[6];
+        int32_t z1 = (z2 + z3) * FIX_0_541196100;
+        int32_t tmp2 = z1 - z3 * FIX_1_847759065;
+        int32_t tmp3 = z1 + z2 * FIX_0_765366865;
+
+        int32_t tmp0 = (r[0] + r[4]) << CONST_BITS;
+        int32_t tmp1 = (r[0] - r[4]) << CONST_BITS;
+
+        const int32_t tmp10 = tmp0 + tmp3;
+        const int32_t tmp13 = tmp0 - tmp3;
+        const int32_t tmp11 = tmp1 + tmp2;
+        const int32_t tmp12 = tmp1 - tmp2;
+
+        tmp0 = r[7];
+        tmp1 = r[5];
+        tmp2 = r[3];
+        tmp3 = r[1];
+
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        int32_t z4 = tmp1 + tmp3;
+        const int32_t z5 = (z3 + z4) * FIX_1_175875602;
+
+        tmp0 *= FIX_0_298631336;
+        tmp1 *= FIX_2_053119869;
+        tmp2 *= FIX_3_072711026;
+        tmp3 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 *= -FIX_1_961570560;
+        z4 *= -FIX_0_390180644;
+
+        z3 += z5;
+        z4 += z5;
+
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        const int32_t out[8] = {
+            tmp10 + tmp3, tmp11 + tmp2, tmp12 + tmp1, tmp13 + tmp0,
+            tmp13 - tmp0, tmp12 - tmp1, tmp11 - tmp2, tmp10 - tmp3
+        };
+
+        uint8_t* p = pixels + row * stride;
+        for (int i=0; i < 8; i++) {
+            const int32_t x = jpeg_descale(out[i], CONST_BITS + PASS1_BITS + 3) + 128;
+            p[i] = (x < 0) ? 0 : (x > 255) ? 255 : x;
+        }
+    }
+}
+
+
+// block of pixels -> 64 quantized coefficients in zigzag order
+void jpeg_forward_block_scalar(const uint8_t* pixels, size_t stride, const QuantTable& q, int16_t* out) {
+    int32_t coef[64];
+    jpeg_fdct_islow(pixels, stride, coef);
+
+    for (int i=0; i < 64; i++) {
+        const int k = zigzag_shuffle[i];
+        out[i] = jpeg_quantize_scalar(coef[k], q, k);
+    }
+}
+
+
+void jpeg_inverse_block_scalar(const int16_t* in, const QuantTable& q, uint8_t* pixels, size_t stride) {
+    int32_t coef[64];
+    for (int i=0; i < 64; i++) {
+        const int k = zigzag_shuffle[i];
+        coef[k] = int32_t(in[i]) * q.quant[k];
+    }
+
+    jpeg_idct_islow(coef, pixels, stride);
+}
+
+
+// Blocks are stored in raster order, each block has 64 coefficients
+void jpeg_forward_image_scalar(const GrayImage& img, const QuantTable& q, int16_t* coefs) {
+    for (int y=0; y < img.height; y += 8)
+        for (int x=0; x < img.width; x += 8, coefs += 64)
+            jpeg_forward_block_scalar(img.data + y * img.stride + x, img.stride, q, coefs);
+}
+
+
+void jpeg_inverse_image_scalar(const int16_t* coefs, const QuantTable& q, GrayImage& img) {
+    for (int y=0; y < img.height; y += 8)
+        for (int x=0; x < img.width; x += 8, coefs += 64)
+            jpeg_inverse_block_scalar(coefs, q, img.data + y * img.stride + x, img.stride);
+}
@@ -0,0 +1,222 @@
+#include <cstdint>
+#include <immintrin.h>
+
+/*
+    Transposition of 16x16 matrix of words, r[i] is the i-th row.
+
+    Rows 0..7 and 8..15 are transposed within 128-bit lanes (three rounds of
+    unpack: 16-, 32- and 64-bit), then lanes are exchanged.
+*/
+inline void avx2_transpose16x16_epi16(__m256i r[16]) {
+    __m256i t[16];
+
+    for (int h=0; h < 16; h += 8) {
+        __m256i s1[8];
+        for (int i=0; i < 4; i++) {
+            s1[2*i + 0] = _mm256_unpacklo_epi16(r[h + 2*i], r[h + 2*i + 1]);
+            s1[2*i + 1] = _mm256_unpackhi_epi16(r[h + 2*i], r[h + 2*i + 1]);
+        }
+
+        __m256i s2[8];
+        for (int i=0; i < 8; i += 4) {
+            s2[i + 0] = _mm256_unpacklo_epi32(s1[i + 0], s1[i + 2]);
+            s2[i + 1] = _mm256_unpackhi_epi32(s1[i + 0], s1[i + 2]);
+            s2[i + 2] = _mm256_unpacklo_epi32(s1[i + 1], s1[i + 3]);
+            s2[i + 3] = _mm256_unpackhi_epi32(s1[i + 1], s1[i + 3]);
+        }
+
+        for (int i=0; i < 4; i++) {
+            t[h + 2*i + 0] = _mm256_unpacklo_epi64(s2[i], s2[i + 4]);
+            t[h + 2*i + 1] = _mm256_unpackhi_epi64(s2[i], s2[i + 4]);
+        }
+    }
+
+    // t[c] (c < 8): column c in the lower lane, column c + 8 in the higher lane
+    for (int c=0; c < 8; c++) {
+        r[c]     = _mm256_permute2x128_si256(t[c], t[c + 8], 0x20);
+        r[c + 8] = _mm256_permute2x128_si256(t[c], t[c + 8], 0x31);
+    }
+}
+
+
+// 16 blocks of pixels -> soa (pixels - 128)
+inline void avx2_load_blocks(const uint8_t* pixels, size_t stride, int16_t* soa) {
+    const __m256i bias = _mm256_set1_epi16(128);
+
+    for (int g=0; g < 4; g++) {
+        // group g: coefficients 16*g .. 16*g + 15, i.e. rows 2*g and 2*g + 1
+        const uint8_t* row0 = pixels + (2*g + 0) * stride;
+        const uint8_t* row1 = pixels + (2*g + 1) * stride;
+
+        __m256i r[16];
+        for (int b=0; b < 16; b++) {
+            const __m128i lo = _mm_loadl_epi64((const __m128i*)(row0 + 8*b));
+            const __m128i hi = _mm_loadl_epi64((const __m128i*)(row1 + 8*b));
+            r[b] = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_unpacklo_epi64(lo, hi)), bias);
+        }
+
+        avx2_transpose16x16_epi16(r);
+
+        for (int i=0; i < 16; i++)
+            _mm256_store_si256((__m256i*)(soa + (16*g + i)*16), r[i]);
+    }
+}
+
+
+// soa (pixels 0..255) -> 16 blocks of pixels
+inline void avx2_store_blocks(const int16_t* soa, uint8_t* pixels, size_t stride) {
+    for (int g=0; g < 4; g++) {
+        __m256i r[16];
+        for (int i=0; i < 16; i++)
+            r[i] = _mm256_load_si256((const __m256i*)(soa + (16*g + i)*16));
+
+        avx2_transpose16x16_epi16(r);
+
+        uint8_t* row0 = pixels + (2*g + 0) * stride;
+        uint8_t* row1 = pixels + (2*g + 1) * stride;
+        for (int b=0; b < 16; b++) {
+            const __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(r[b]),
+                                                   _mm256_extracti128_si256(r[b], 1));
+            _mm_storel_epi64((__m128i*)(row0 + 8*b), bytes);
+            _mm_storeh_pd((double*)(row1 + 8*b), _mm_castsi128_pd(bytes));
+        }
+    }
+}
+
+
+// soa <-> 16 consecutive blocks of 64 coefficients
+inline void avx2_load_coefficients(const int16_t* coefs, int16_t* soa) {
+    for (int g=0; g < 4; g++) {
+        __m256i r[16];
+        for (int b=0; b < 16; b++)
+            r[b] = _mm256_loadu_si256((const __m256i*)(coefs + 64*b + 16*g));
+
+        avx2_transpose16x16_epi16(r);
+
+        for (int i=0; i < 16; i++)
+            _mm256_store_si256((__m256i*)(soa + (16*g + i)*16), r[i]);
+    }
+}
+
+
+inline void avx2_store_coefficients(const int16_t* soa, int16_t* coefs) {
+    for (int g=0; g < 4; g++) {
+        __m256i r[16];
+        for (int i=0; i < 16; i++)
+            r[i] = _mm256_load_si256((const __m256i*)(soa + (16*g + i)*16));
+
+        avx2_transpose16x16_epi16(r);
+
+        for (int b=0; b < 16; b++)
+            _mm256_storeu_si256((__m256i*)(coefs + 64*b + 16*g), r[b]);
+    }
+}
+
+
+struct Avx2 {
+    typedef __m256i vec;
+    static const int lanes = 8;
+
+    static vec load(const int32_t* p) {
+        return _mm256_load_si256((const __m256i*)p);
+    }
+
+    static void store(int32_t* p, vec x) {
+        _mm256_store_si256((__m256i*)p, x);
+    }
+
+    static vec load16(const int16_t* p) {
+        return _mm256_cvtepi16_epi32(_mm_load_si128((const __m128i*)p));
+    }
+
+    static void store16(int16_t* p, vec x) {
+        _mm_store_si128((__m128i*)p, _mm_packs_epi32(_mm256_castsi256_si128(x),
+                                                     _mm256_extracti128_si256(x, 1)));
+    }
+
+    static vec set1(int32_t x) {
+        return _mm256_set1_epi32(x);
+    }
+
+    static vec add(vec a, vec b) {
+        return _mm256_add_epi32(a, b);
+    }
+
+    static vec sub(vec a, vec b) {
+        return _mm256_sub_epi32(a, b);
+    }
+
+    static vec mul(vec a, int32_t c) {
+        return _mm256_mullo_epi32(a, _mm256_set1_epi32(c));
+    }
+
+    template <int n>
+    static vec shl(vec a) {
+        return _mm256_slli_epi32(a, n);
+    }
+
+    template <int n>
+    static vec descale(vec a) {
+        return _mm256_srai_epi32(_mm256_add_epi32(a, _mm256_set1_epi32(1 << (n - 1))), n);
+    }
+
+    // sign(x) * (((|x| + half) * reciprocal) >> shift)
+    static vec quantize(vec x, uint32_t reciprocal, uint32_t shift, int32_t half) {
+        const __m256i n = _mm256_add_epi32(_mm256_abs_epi32(x), _mm256_set1_epi32(half));
+        const __m256i q = _mm256_srl_epi32(_mm256_mullo_epi32(n, _mm256_set1_epi32(reciprocal)),
+                                           _mm_cvtsi32_si128(shift));
+        return _mm256_sign_epi32(q, x);
+    }
+
+    static vec clamp255(vec x) {
+        return _mm256_min_epi32(_mm256_max_epi32(x, _mm256_setzero_si256()), _mm256_set1_epi32(255));
+    }
+};
+
+
+void jpeg_forward_image_avx2(const GrayImage& img, const QuantTable& q, int16_t* coefs) {
+    alignas(32) int16_t soa[64 * jpeg::BATCH];
+    alignas(32) int16_t zigzag[64 * jpeg::BATCH];
+    alignas(32) int32_t ws[64 * Avx2::lanes];
+
+    const int blocks = img.width / 8;
+    for (int y=0; y < img.height; y += 8) {
+        const uint8_t* row = img.data + y * img.stride;
+
+        int b = 0;
+        for (/**/; b + jpeg::BATCH <= blocks; b += jpeg::BATCH, coefs += 64 * jpeg::BATCH) {
+            avx2_load_blocks(row + 8*b, img.stride, soa);
+            for (int offset=0; offset < jpeg::BATCH; offset += Avx2::lanes)
+                jpeg_forward_soa<Avx2>(soa, offset, q, zigzag, ws);
+
+            avx2_store_coefficients(zigzag, coefs);
+        }
+
+        for (/**/; b < blocks; b++, coefs += 64)
+            jpeg_forward_block_scalar(row + 8*b, img.stride, q, coefs);
+    }
+}
+
+
+void jpeg_inverse_image_avx2(const int16_t* coefs, const QuantTable& q, GrayImage& img) {
+    alignas(32) int16_t soa[64 * jpeg::BATCH];
+    alignas(32) int16_t zigzag[64 * jpeg::BATCH];
+    alignas(32) int32_t ws[64 * Avx2::lanes];
+
+    const int blocks = img.width / 8;
+    for (int y=0; y < img.height; y += 8) {
+        uint8_t* row = img.data + y * img.stride;
+
+        int b = 0;
+        for (/**/; b + jpeg::BATCH <= blocks; b += jpeg::BATCH, coefs += 64 * jpeg::BATCH) {
+            avx2_load_coefficients(coefs, zigzag);
+            for (int offset=0; offset < jpeg::BATCH; offset += Avx2::lanes)
+                jpeg_inverse_soa<Avx2>(zigzag, offset, q, soa, ws);
+
+            avx2_store_blocks(soa, row + 8*b, img.stride);
+        }
+
+        for (/**/; b < blocks; b++, coefs += 64)
+            jpeg_inverse_block_scalar(coefs, q, row + 8*b, img.stride);
+    }
+}
@@ -0,0 +1,110 @@
+#include <cstdint>
+#include <immintrin.h>
+
+/*
+    The whole batch of 16 blocks fits in a single register, arithmetic
+    needs AVX512F only.  Transpositions are shared with AVX2 code.
+*/
+
+struct Avx512 {
+    typedef __m512i vec;
+    static const int lanes = 16;
+
+    static vec load(const int32_t* p) {
+        return _mm512_load_si512((const __m512i*)p);
+    }
+
+    static void store(int32_t* p, vec x) {
+        _mm512_store_si512((__m512i*)p, x);
+    }
+
+    static vec load16(const int16_t* p) {
+        return _mm512_cvtepi16_epi32(_mm256_load_si256((const __m256i*)p));
+    }
+
+    static void store16(int16_t* p, vec x) {
+        _mm256_store_si256((__m256i*)p, _mm512_cvtsepi32_epi16(x));
+    }
+
+    static vec set1(int32_t x) {
+        return _mm512_set1_epi32(x);
+    }
+
+    static vec add(vec a, vec b) {
+        return _mm512_add_epi32(a, b);
+    }
+
+    static vec sub(vec a, vec b) {
+        return _mm512_sub_epi32(a, b);
+    }
+
+    static vec mul(vec a, int32_t c) {
+        return _mm512_mullo_epi32(a, _mm512_set1_epi32(c));
+    }
+
+    template <int n>
+    static vec shl(vec a) {
+        return _mm512_slli_epi32(a, n);
+    }
+
+    template <int n>
+    static vec descale(vec a) {
+        return _mm512_srai_epi32(_mm512_add_epi32(a, _mm512_set1_epi32(1 << (n - 1))), n);
+    }
+
+    static vec quantize(vec x, uint32_t reciprocal, uint32_t shift, int32_t half) {
+        const __m512i n = _mm512_add_epi32(_mm512_abs_epi32(x), _mm512_set1_epi32(half));
+        const __m512i q = _mm512_srl_epi32(_mm512_mullo_epi32(n, _mm512_set1_epi32(reciprocal)),
+                                           _mm_cvtsi32_si128(shift));
+        const __mmask16 negative = _mm512_cmplt_epi32_mask(x, _mm512_setzero_si512());
+        return _mm512_mask_sub_epi32(q, negative, _mm512_setzero_si512(), q);
+    }
+
+    static vec clamp255(vec x) {
+        return _mm512_min_epi32(_mm512_max_epi32(x, _mm512_setzero_si512()), _mm512_set1_epi32(255));
+    }
+};
+
+
+void jpeg_forward_image_avx512(const GrayImage& img, const QuantTable& q, int16_t* coefs) {
+    alignas(64) int16_t soa[64 * jpeg::BATCH];
+    alignas(64) int16_t zigzag[64 * jpeg::BATCH];
+    alignas(64) int32_t ws[64 * Avx512::lanes];
+
+    const int blocks = img.width / 8;
+    for (int y=0; y < img.height; y += 8) {
+        const uint8_t* row = img.data + y * img.stride;
+
+        int b = 0;
+        for (/**/; b + jpeg::BATCH <= blocks; b += jpeg::BATCH, coefs += 64 * jpeg::BATCH) {
+            avx2_load_blocks(row + 8*b, img.stride, soa);
+            jpeg_forward_soa<Avx512>(soa, 0, q, zigzag, ws);
+            avx2_store_coefficients(zigzag, coefs);
+        }
+
+        for (/**/; b < blocks; b++, coefs += 64)
+            jpeg_forward_block_scalar(row + 8*b, img.stride, q, coefs);
+    }
+}
+
+
+void jpeg_inverse_image_avx512(const int16_t* coefs, const QuantTable& q, GrayImage& img) {
+    alignas(64) int16_t soa[64 * jpeg::BATCH];
+    alignas(64) int16_t zigzag[64 * jpeg::BATCH];
+    alignas(64) int32_t ws[64 * Avx512::lanes];
+
+    const int blocks = img.width / 8;
+    for (int y=0; y < img.height; y += 8) {
+        uint8_t* row = img.data + y * img.stride;
+
+        int b = 0;
+        for (/**/; b + jpeg::BATCH <= blocks; b += jpeg::BATCH, coefs += 64 * jpeg::BATCH) {
+            avx2_load_coefficients(coefs, zigzag);
+            jpeg_inverse_soa<Avx512>(zigzag, 0, q, soa, ws);
+            avx2_store_blocks(soa, row + 8*b, img.stride);
+        }
+
+        for (/**/; b < blocks; b++, coefs += 64)
+            jpeg_inverse_block_scalar(coefs, q, row + 8*b, img.stride);
+    }
+}
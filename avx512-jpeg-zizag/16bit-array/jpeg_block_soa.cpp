@@ -0,0 +1,209 @@
+/*
+    Batch of blocks in "structure of arrays" layout.
+
+    int16_t soa[64][16] --- coefficient k of block b is soa[k][b].  Loading
+    blocks to this layout (and storing back) is a transposition of 16x16
+    words, see jpeg_block_avx2.cpp.
+
+    The transforms are templates parametrized by a vector type V, which
+    provides:
+
+    * typedef vec; lanes (number of 32-bit values);
+    * load/store of int32_t, load16/store16 of int16_t (with sign extension
+      and signed saturation);
+    * add, sub, mul by constant, shl<n>, descale<n> (rounding arithmetic
+      shift right), quantize, clamp255.
+
+    Each operation on vectors corresponds to the same operation in
+    jpeg_fdct_islow/jpeg_idct_islow, so results are exact.  The workspace
+    int32_t ws[64][V::lanes] holds a batch (or a part of it) widened to
+    32 bits.
+*/
+
+template <typename V, bool PASS1>
+inline void jpeg_fdct_1d(typename V::vec* d) {
+    using namespace jpeg;
+    typedef typename V::vec vec;
+
+    const int shift = PASS1 ? CONST_BITS - PASS1_BITS : CONST_BITS + PASS1_BITS;
+
+    const vec tmp0 = V::add(d[0], d[7]);
+    vec       tmp7 = V::sub(d[0], d[7]);
+    const vec tmp1 = V::add(d[1], d[6]);
+    vec       tmp6 = V::sub(d[1], d[6]);
+    const vec tmp2 = V::add(d[2], d[5]);
+    vec       tmp5 = V::sub(d[2], d[5]);
+    const vec tmp3 = V::add(d[3], d[4]);
+    vec       tmp4 = V::sub(d[3], d[4]);
+
+    const vec tmp10 = V::add(tmp0, tmp3);
+    const vec tmp13 = V::sub(tmp0, tmp3);
+    const vec tmp11 = V::add(tmp1, tmp2);
+    const vec tmp12 = V::sub(tmp1, tmp2);
+
+    if (PASS1) {
+        d[0] = V::template shl<PASS1_BITS>(V::add(tmp10, tmp11));
+        d[4] = V::template shl<PASS1_BITS>(V::sub(tmp10, tmp11));
+    } else {
+        d[0] = V::template descale<PASS1_BITS>(V::add(tmp10, tmp11));
+        d[4] = V::template descale<PASS1_BITS>(V::sub(tmp10, tmp11));
+    }
+
+    vec z1 = V::mul(V::add(tmp12, tmp13), FIX_0_541196100);
+    d[2] = V::template descale<shift>(V::add(z1, V::mul(tmp13, FIX_0_765366865)));
+    d[6] = V::template descale<shift>(V::sub(z1, V::mul(tmp12, FIX_1_847759065)));
+
+    z1 = V::add(tmp4, tmp7);
+    vec z2 = V::add(tmp5, tmp6);
+    vec z3 = V::add(tmp4, tmp6);
+    vec z4 = V::add(tmp5, tmp7);
+    const vec z5 = V::mul(V::add(z3, z4), FIX_1_175875602);
+
+    tmp4 = V::mul(tmp4, FIX_0_298631336);
+    tmp5 = V::mul(tmp5, FIX_2_053119869);
+    tmp6 = V::mul(tmp6, FIX_3_072711026);
+    tmp7 = V::mul(tmp7, FIX_1_501321110);
+    z1 = V::mul(z1, -FIX_0_899976223);
+    z2 = V::mul(z2, -FIX_2_562915447);
+    z3 = V::mul(z3, -FIX_1_961570560);
+    z4 = V::mul(z4, -FIX_0_390180644);
+
+    z3 = V::add(z3, z5);
+    z4 = V::add(z4, z5);
+
+    d[7] = V::template descale<shift>(V::add(V::add(tmp4, z1), z3));
+    d[5] = V::template descale<shift>(V::add(V::add(tmp5, z2), z4));
+    d[3] = V::template descale<shift>(V::add(V::add(tmp6, z2), z3));
+    d[1] = V::template descale<shift>(V::add(V::add(tmp7, z1), z4));
+}
+
+
+template <typename V, bool PASS1>
+inline void jpeg_idct_1d(typename V::vec* d) {
+    using namespace jpeg;
+    typedef typename V::vec vec;
+
+    const int shift = PASS1 ? CONST_BITS - PASS1_BITS : CONST_BITS + PASS1_BITS + 3;
+
+    vec z2 = d[2];
+    vec z3 = d[6];
+    vec z1 = V::mul(V::add(z2, z3), FIX_0_541196100);
+    vec tmp2 = V::sub(z1, V::mul(z3, FIX_1_847759065));
+    vec tmp3 = V::add(z1, V::mul(z2, FIX_0_765366865));
+
+    vec tmp0 = V::template shl<CONST_BITS>(V::add(d[0], d[4]));
+    vec tmp1 = V::template shl<CONST_BITS>(V::sub(d[0], d[4]));
+
+    const vec tmp10 = V::add(tmp0, tmp3);
+    const vec tmp13 = V::sub(tmp0, tmp3);
+    const vec tmp11 = V::add(tmp1, tmp2);
+    const vec tmp12 = V::sub(tmp1, tmp2);
+
+    tmp0 = d[7];
+    tmp1 = d[5];
+    tmp2 = d[3];
+    tmp3 = d[1];
+
+    z1 = V::add(tmp0, tmp3);
+    z2 = V::add(tmp1, tmp2);
+    z3 = V::add(tmp0, tmp2);
+    vec z4 = V::add(tmp1, tmp3);
+    const vec z5 = V::mul(V::add(z3, z4), FIX_1_175875602);
+
+    tmp0 = V::mul(tmp0, FIX_0_298631336);
+    tmp1 = V::mul(tmp1, FIX_2_053119869);
+    tmp2 = V::mul(tmp2, FIX_3_072711026);
+    tmp3 = V::mul(tmp3, FIX_1_501321110);
+    z1 = V::mul(z1, -FIX_0_899976223);
+    z2 = V::mul(z2, -FIX_2_562915447);
+    z3 = V::mul(z3, -FIX_1_961570560);
+    z4 = V::mul(z4, -FIX_0_390180644);
+
+    z3 = V::add(z3, z5);
+    z4 = V::add(z4, z5);
+
+    tmp0 = V::add(tmp0, V::add(z1, z3));
+    tmp1 = V::add(tmp1, V::add(z2, z4));
+    tmp2 = V::add(tmp2, V::add(z2, z3));
+    tmp3 = V::add(tmp3, V::add(z1, z4));
+
+    d[0] = V::template descale<shift>(V::add(tmp10, tmp3));
+    d[7] = V::template descale<shift>(V::sub(tmp10, tmp3));
+    d[1] = V::template descale<shift>(V::add(tmp11, tmp2));
+    d[6] = V::template descale<shift>(V::sub(tmp11, tmp2));
+    d[2] = V::template descale<shift>(V::add(tmp12, tmp1));
+    d[5] = V::template descale<shift>(V::sub(tmp12, tmp1));
+    d[3] = V::template descale<shift>(V::add(tmp13, tmp0));
+    d[4] = V::template descale<shift>(V::sub(tmp13, tmp0));
+}
+
+
+// soa (pixels - 128) -> quantized coefficients in zigzag order, lanes offset .. offset + V::lanes - 1
+template <typename V>
+void jpeg_forward_soa(const int16_t* soa, int offset, const QuantTable& q, int16_t* zigzag, int32_t* ws) {
+    typedef typename V::vec vec;
+    const int L = V::lanes;
+    const int B = jpeg::BATCH;
+
+    vec d[8];
+    for (int row=0; row < 8; row++) {
+        for (int i=0; i < 8; i++)
+            d[i] = V::load16(soa + (8*row + i)*B + offset);
+
+        jpeg_fdct_1d<V, true>(d);
+
+        for (int i=0; i < 8; i++)
+            V::store(ws + (8*row + i)*L, d[i]);
+    }
+
+    for (int col=0; col < 8; col++) {
+        for (int i=0; i < 8; i++)
+            d[i] = V::load(ws + (8*i + col)*L);
+
+        jpeg_fdct_1d<V, false>(d);
+
+        for (int i=0; i < 8; i++)
+            V::store(ws + (8*i + col)*L, d[i]);
+    }
+
+    for (int i=0; i < 64; i++) {
+        const int k = zigzag_shuffle[i];
+        const vec x = V::load(ws + k*L);
+        V::store16(zigzag + i*B + offset, V::quantize(x, q.reciprocal[k], q.shift[k], q.divisor[k] / 2));
+    }
+}
+
+
+// quantized coefficients in zigzag order -> soa (pixels)
+template <typename V>
+void jpeg_inverse_soa(const int16_t* zigzag, int offset, const QuantTable& q, int16_t* soa, int32_t* ws) {
+    typedef typename V::vec vec;
+    const int L = V::lanes;
+    const int B = jpeg::BATCH;
+
+    for (int i=0; i < 64; i++) {
+        const int k = zigzag_shuffle[i];
+        V::store(ws + k*L, V::mul(V::load16(zigzag + i*B + offset), q.quant[k]));
+    }
+
+    vec d[8];
+    for (int col=0; col < 8; col++) {
+        for (int i=0; i < 8; i++)
+            d[i] = V::load(ws + (8*i + col)*L);
+
+        jpeg_idct_1d<V, true>(d);
+
+        for (int i=0; i < 8; i++)
+            V::store(ws + (8*i + col)*L, d[i]);
+    }
+
+    for (int row=0; row < 8; row++) {
+        for (int i=0; i < 8; i++)
+            d[i] = V::load(ws + (8*row + i)*L);
+
+        jpeg_idct_1d<V, false>(d);
+
+        for (int i=0; i < 8; i++)
+            V::store16(soa + (8*row + i)*B + offset, V::clamp255(V::add(d[i], V::set1(128))));
+    }
+}
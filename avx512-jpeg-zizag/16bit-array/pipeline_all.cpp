@@ -0,0 +1,9 @@
+#include "common.cpp"
+#include "jpeg_block.cpp"
+#include "jpeg_block_soa.cpp"
+#ifdef HAVE_AVX2
+#   include "jpeg_block_avx2.cpp"
+#endif
+#ifdef HAVE_AVX512F
+#   include "jpeg_block_avx512.cpp"
+#endif
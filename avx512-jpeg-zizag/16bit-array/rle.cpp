@@ -0,0 +1,146 @@
+#include <cstdint>
+#include <cstddef>
+
+/*
+    Run-length coding of quantized blocks in zigzag order (the output of
+    jpeg_forward_image_*) --- JPEG entropy coding without the final Huffman
+    step.
+
+    Each block yields:
+
+    * DC symbol: run = 0, value = difference from DC of the previous block;
+    * AC symbols for each nonzero coefficient: run = number of preceding
+      zeros (0..15), value = the coefficient;
+    * ZRL (run = 15, size = 0) for each 16 zeros not followed by a nonzero
+      coefficient within a run of 15;
+    * EOB (run = 0, size = 0) if the last coefficient is zero.
+
+    Size is the bit length of |value|, thus RRRRSSSS = (run << 4) | size is
+    the Huffman symbol, and the low "size" bits of value (or value - 1 if
+    negative) are the extra bits.  A block gives at most 64 symbols.
+*/
+
+struct JpegSymbol {
+    uint8_t run;
+    uint8_t size;
+    int16_t value;
+};
+
+namespace jpeg {
+
+    const int MAX_SYMBOLS = 64; // per block
+
+} // namespace jpeg
+
+
+inline uint8_t jpeg_bit_size_scalar(int value) {
+    unsigned x = (value < 0) ? -value : value;
+    uint8_t size = 0;
+    while (x != 0) {
+        size += 1;
+        x >>= 1;
+    }
+
+    return size;
+}
+
+
+inline JpegSymbol jpeg_symbol(int run, int value) {
+    JpegSymbol s;
+    s.run   = run;
+    s.size  = jpeg_bit_size_scalar(value);
+    s.value = value;
+    return s;
+}
+
+
+// Processes count blocks, returns the number of symbols
+size_t jpeg_rle_scalar(const int16_t* blocks, size_t count, JpegSymbol* out) {
+    JpegSymbol* p = out;
+    int dc = 0;
+    for (size_t b=0; b < count; b++) {
+        const int16_t* zz = blocks + 64*b;
+
+        *p++ = jpeg_symbol(0, zz[0] - dc);
+        dc = zz[0];
+
+        int run = 0;
+        for (int k=1; k < 64; k++) {
+            if (zz[k] == 0) {
+                run += 1;
+                continue;
+            }
+
+            while (run > 15) {
+                *p++ = jpeg_symbol(15, 0);
+                run -= 16;
+            }
+
+            *p++ = jpeg_symbol(run, zz[k]);
+            run = 0;
+        }
+
+        if (run > 0)
+            *p++ = jpeg_symbol(0, 0);
+    }
+
+    return p - out;
+}
+
+
+/*
+    Bitmask driven coding: bit k of nonzero is set if coefficient k is not
+    zero.  Positions of nonzero coefficients are found by tzcnt, thus the
+    cost depends on the number of symbols rather than on 63 coefficients.
+*/
+inline JpegSymbol* jpeg_rle_bitmask(const int16_t* zz, uint64_t nonzero, int& dc, JpegSymbol* p) {
+    JpegSymbol s;
+    s.run   = 0;
+    s.value = zz[0] - dc;
+    s.size  = (s.value != 0) ? 32 - __builtin_clz(s.value < 0 ? -s.value : s.value) : 0;
+    *p++ = s;
+    dc = zz[0];
+
+    uint64_t mask = nonzero & ~uint64_t(1);
+    int last = 0;
+    while (mask != 0) {
+        const int k = __builtin_ctzll(mask);
+        int run = k - last - 1;
+        while (run > 15) {
+            *p++ = jpeg_symbol(15, 0);
+            run -= 16;
+        }
+
+        const int value = zz[k];
+        s.run   = run;
+        s.size  = 32 - __builtin_clz(value < 0 ? -value : value);
+        s.value = value;
+        *p++ = s;
+
+        last = k;
+        mask &= mask - 1;
+    }
+
+    if (last != 63)
+        *p++ = jpeg_symbol(0, 0);
+
+    return p;
+}
+
+
+// Nonzero mask build with scalar code, as a baseline for SIMD ones
+size_t jpeg_rle_scalar_tzcnt(const int16_t* blocks, size_t count, JpegSymbol* out) {
+    JpegSymbol* p = out;
+    int dc = 0;
+    for (size_t b=0; b < count; b++) {
+        const int16_t* zz = blocks + 64*b;
+
+        uint64_t nonzero = 0;
+        for (int k=0; k < 64; k++)
+            nonzero |= uint64_t(zz[k] != 0) << k;
+
+        p = jpeg_rle_bitmask(zz, nonzero, dc, p);
+    }
+
+    return p - out;
+}
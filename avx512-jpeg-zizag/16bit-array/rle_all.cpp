@@ -0,0 +1,8 @@
+#include "pipeline_all.cpp"
+#include "rle.cpp"
+#ifdef HAVE_AVX2
+#   include "rle_avx2.cpp"
+#endif
+#ifdef HAVE_AVX512BW
+#   include "rle_avx512.cpp"
+#endif
@@ -0,0 +1,34 @@
+#include <cstdint>
+#include <immintrin.h>
+
+// bit k set if zz[k] != 0
+inline uint64_t avx2_nonzero_mask(const int16_t* zz) {
+    const __m256i zero = _mm256_setzero_si256();
+
+    uint64_t mask = 0;
+    for (int i=0; i < 2; i++) {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(zz + 32*i + 0));
+        const __m256i b = _mm256_loadu_si256((const __m256i*)(zz + 32*i + 16));
+
+        // packs works within 128-bit lanes: a0..7 b0..7 a8..15 b8..15
+        const __m256i packed = _mm256_packs_epi16(_mm256_cmpeq_epi16(a, zero),
+                                                  _mm256_cmpeq_epi16(b, zero));
+        const __m256i zeros  = _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+
+        mask |= uint64_t(~uint32_t(_mm256_movemask_epi8(zeros))) << (32*i);
+    }
+
+    return mask;
+}
+
+
+size_t jpeg_rle_avx2(const int16_t* blocks, size_t count, JpegSymbol* out) {
+    JpegSymbol* p = out;
+    int dc = 0;
+    for (size_t b=0; b < count; b++) {
+        const int16_t* zz = blocks + 64*b;
+        p = jpeg_rle_bitmask(zz, avx2_nonzero_mask(zz), dc, p);
+    }
+
+    return p - out;
+}
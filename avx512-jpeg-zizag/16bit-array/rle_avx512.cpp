@@ -0,0 +1,124 @@
+#include <cstdint>
+#include <immintrin.h>
+
+#ifdef HAVE_AVX512BW
+
+inline uint64_t avx512bw_nonzero_mask(const int16_t* zz) {
+    const __m512i lo = _mm512_loadu_si512((const __m512i*)(zz + 0));
+    const __m512i hi = _mm512_loadu_si512((const __m512i*)(zz + 32));
+
+    return _mm512_test_epi16_mask(lo, lo) | (uint64_t(_mm512_test_epi16_mask(hi, hi)) << 32);
+}
+
+
+size_t jpeg_rle_avx512bw(const int16_t* blocks, size_t count, JpegSymbol* out) {
+    JpegSymbol* p = out;
+    int dc = 0;
+    for (size_t b=0; b < count; b++) {
+        const int16_t* zz = blocks + 64*b;
+        p = jpeg_rle_bitmask(zz, avx512bw_nonzero_mask(zz), dc, p);
+    }
+
+    return p - out;
+}
+
+#endif // HAVE_AVX512BW
+
+
+#ifdef HAVE_AVX512VBMI2
+
+/*
+    Branchless coding: vpcompressw gathers nonzero coefficients and their
+    positions (from a vector of indices), then 16 symbols are built at once:
+
+        run  = position[i] - position[i - 1] - 1
+        size = 32 - lzcnt(|value|)
+
+    When any run is longer than 15, the block requires ZRL symbols; such
+    blocks are rare and are coded again by jpeg_rle_bitmask.
+*/
+size_t jpeg_rle_avx512vbmi2(const int16_t* blocks, size_t count, JpegSymbol* out) {
+    static const int16_t indices[64] = {
+         0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+        32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+        48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63
+    };
+
+    // position[0] is DC, symbols for AC coefficients are computed for
+    // position[1..n]; the tails of buffers are garbage not used by symbols
+    alignas(64) int16_t position[64 + 32 + 32];
+    alignas(64) int16_t value[64 + 32];
+
+    const __m512i index_lo = _mm512_loadu_si512((const __m512i*)(indices + 0));
+    const __m512i index_hi = _mm512_loadu_si512((const __m512i*)(indices + 32));
+    const __m512i one      = _mm512_set1_epi32(1);
+    const __m512i max_run  = _mm512_set1_epi32(15);
+    const __m512i bits     = _mm512_set1_epi32(32);
+
+    position[0] = 0;
+
+    JpegSymbol* p = out;
+    int dc = 0;
+    for (size_t b=0; b < count; b++) {
+        const int16_t* zz = blocks + 64*b;
+
+        const __m512i lo = _mm512_loadu_si512((const __m512i*)(zz + 0));
+        const __m512i hi = _mm512_loadu_si512((const __m512i*)(zz + 32));
+        const __mmask32 mask_lo = _mm512_test_epi16_mask(lo, lo) & ~__mmask32(1);
+        const __mmask32 mask_hi = _mm512_test_epi16_mask(hi, hi);
+        const int n_lo = __builtin_popcount(mask_lo);
+        const int n    = n_lo + __builtin_popcount(mask_hi);
+
+        _mm512_storeu_si512((__m512i*)(value), _mm512_maskz_compress_epi16(mask_lo, lo));
+        _mm512_storeu_si512((__m512i*)(value + n_lo), _mm512_maskz_compress_epi16(mask_hi, hi));
+        _mm512_storeu_si512((__m512i*)(position + 1), _mm512_maskz_compress_epi16(mask_lo, index_lo));
+        _mm512_storeu_si512((__m512i*)(position + 1 + n_lo), _mm512_maskz_compress_epi16(mask_hi, index_hi));
+
+        JpegSymbol* const block_start = p;
+        const int prev_dc = dc;
+
+        JpegSymbol s;
+        s.run   = 0;
+        s.value = zz[0] - dc;
+        s.size  = (s.value != 0) ? 32 - __builtin_clz(s.value < 0 ? -s.value : s.value) : 0;
+        *p++ = s;
+        dc = zz[0];
+
+        bool long_run = false;
+        for (int i=0; i < n; i += 16) {
+            const __mmask16 valid = (n - i >= 16) ? 0xffff : (1u << (n - i)) - 1;
+
+            const __m512i pos  = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)(position + i + 1)));
+            const __m512i prev = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)(position + i)));
+            const __m512i run  = _mm512_sub_epi32(_mm512_sub_epi32(pos, prev), one);
+            if (_mm512_mask_cmpgt_epi32_mask(valid, run, max_run) != 0) {
+                long_run = true;
+                break;
+            }
+
+            const __m512i val  = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)(value + i)));
+            const __m512i size = _mm512_sub_epi32(bits, _mm512_lzcnt_epi32(_mm512_abs_epi32(val)));
+
+            // JpegSymbol: run, size, value
+            const __m512i symbol = _mm512_or_si512(_mm512_or_si512(run, _mm512_slli_epi32(size, 8)),
+                                                   _mm512_slli_epi32(val, 16));
+            _mm512_mask_storeu_epi32(p + i, valid, symbol);
+        }
+
+        if (long_run) {
+            dc = prev_dc;
+            const uint64_t nonzero = uint64_t(mask_lo) | (uint64_t(mask_hi) << 32);
+            p = jpeg_rle_bitmask(zz, nonzero, dc, block_start);
+            continue;
+        }
+
+        p += n;
+        if ((mask_hi & (__mmask32(1) << 31)) == 0)
+            *p++ = jpeg_symbol(0, 0);
+    }
+
+    return p - out;
+}
+
+#endif // HAVE_AVX512VBMI2
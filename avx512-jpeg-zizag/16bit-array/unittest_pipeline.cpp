@@ -0,0 +1,252 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <vector>
+#include "pipeline_all.cpp"
+
+class TestPipeline {
+
+    class TestFailed {};
+
+    struct Image {
+        std::vector<uint8_t> memory;
+        GrayImage view;
+
+        Image(int width, int height, size_t padding) {
+            view.stride = width + padding;
+            view.width  = width;
+            view.height = height;
+            memory.resize(view.stride * height);
+            view.data   = memory.data();
+        }
+    };
+
+    uint32_t seed;
+
+public:
+    TestPipeline() : seed(1) {}
+
+public:
+    bool run() {
+        try {
+            test_reciprocals();
+            test_fdct_accuracy();
+            test_roundtrip();
+#ifdef HAVE_AVX2
+            test_images("AVX2", jpeg_forward_image_avx2, jpeg_inverse_image_avx2);
+#endif
+#ifdef HAVE_AVX512F
+            test_images("AVX512F", jpeg_forward_image_avx512, jpeg_inverse_image_avx512);
+#endif
+        } catch (TestFailed&) {
+            return false;
+        }
+
+        return true;
+    }
+
+private:
+    void test_reciprocals() {
+        printf("%32s ... ", "quantization by reciprocals");
+        fflush(stdout);
+
+        QuantTable q(jpeg_luminance_table, 50);
+        for (int d=1; d <= 255; d++) {
+            q.set(0, d);
+            for (uint32_t n=0; n < (1u << 15); n++) {
+                const uint32_t expected = n / q.divisor[0];
+                const uint32_t result   = (n * q.reciprocal[0]) >> q.shift[0];
+                if (result != expected) {
+                    printf("failed for %u / %d\n", n, q.divisor[0]);
+                    throw TestFailed();
+                }
+            }
+        }
+
+        puts("OK");
+    }
+
+
+    // integer DCT must be close to 8 * the exact one
+    void test_fdct_accuracy() {
+        printf("%32s ... ", "scalar DCT vs float DCT");
+        fflush(stdout);
+
+        Image img(8, 8, 0);
+        for (int iter=0; iter < 1000; iter++) {
+            fill(img, iter % 3);
+
+            int32_t coef[64];
+            jpeg_fdct_islow(img.view.data, img.view.stride, coef);
+
+            for (int v=0; v < 8; v++) {
+                for (int u=0; u < 8; u++) {
+                    double sum = 0.0;
+                    for (int y=0; y < 8; y++)
+                        for (int x=0; x < 8; x++)
+                            sum += (img.view.data[y * 8 + x] - 128.0)
+                                 * cos((2*x + 1) * u * M_PI / 16)
+                                 * cos((2*y + 1) * v * M_PI / 16);
+
+                    const double cu = (u == 0) ? M_SQRT1_2 : 1.0;
+                    const double cv = (v == 0) ? M_SQRT1_2 : 1.0;
+                    const double expected = 8 * 0.25 * cu * cv * sum;
+                    if (fabs(expected - coef[8*v + u]) > 2.0) {
+                        printf("failed at (%d, %d): %d vs %0.2f\n", u, v, coef[8*v + u], expected);
+                        throw TestFailed();
+                    }
+                }
+            }
+        }
+
+        puts("OK");
+    }
+
+
+    // with minimal quantization the way back must be almost lossless
+    void test_roundtrip() {
+        printf("%32s ... ", "scalar round trip");
+        fflush(stdout);
+
+        QuantTable q(jpeg_luminance_table, 100);
+        Image img(64, 64, 0);
+        Image out(64, 64, 0);
+        std::vector<int16_t> coefs(img.view.blocks() * 64);
+
+        for (int pattern=0; pattern < 3; pattern++) {
+            fill(img, pattern);
+            jpeg_forward_image_scalar(img.view, q, coefs.data());
+            jpeg_inverse_image_scalar(coefs.data(), q, out.view);
+
+            for (size_t i=0; i < img.memory.size(); i++) {
+                if (abs(img.memory[i] - out.memory[i]) > 2) {
+                    printf("failed for pattern %d at %zu: %d vs %d\n", pattern, i, img.memory[i], out.memory[i]);
+                    throw TestFailed();
+                }
+            }
+        }
+
+        puts("OK");
+    }
+
+
+    template <typename FORWARD, typename INVERSE>
+    void test_images(const char* name, FORWARD forward, INVERSE inverse) {
+        // blocks per row: less than a batch, exactly a batch, batches + tail
+        const int sizes[][2] = {{8, 8}, {64, 16}, {128, 8}, {136, 24}, {256, 16}, {392, 40}};
+        const int qualities[] = {1, 25, 50, 75, 90, 100};
+
+        for (int pass=0; pass < 2; pass++) {
+            char label[64];
+            snprintf(label, sizeof(label), "%s %s", name, pass == 0 ? "forward" : "inverse");
+            printf("%32s ... ", label);
+            fflush(stdout);
+
+            for (size_t s=0; s < sizeof(sizes)/sizeof(sizes[0]); s++) {
+                for (size_t padding=0; padding <= 24; padding += 24) {
+                    Image img(sizes[s][0], sizes[s][1], padding);
+                    Image expected(sizes[s][0], sizes[s][1], padding);
+                    Image result(sizes[s][0], sizes[s][1], padding);
+                    const size_t n = img.view.blocks() * 64;
+                    std::vector<int16_t> coefs_expected(n);
+                    std::vector<int16_t> coefs_result(n);
+
+                    for (size_t k=0; k < sizeof(qualities)/sizeof(qualities[0]); k++) {
+                        const QuantTable q(jpeg_luminance_table, qualities[k]);
+
+                        for (int pattern=0; pattern < 3; pattern++) {
+                            fill(img, pattern);
+
+                            if (pass == 0) {
+                                jpeg_forward_image_scalar(img.view, q, coefs_expected.data());
+                                forward(img.view, q, coefs_result.data());
+                                compare(coefs_expected, coefs_result, s, qualities[k], pattern);
+                            } else {
+                                random_coefficients(coefs_expected, pattern);
+
+                                fill(expected, 0);
+                                memcpy(result.view.data, expected.view.data, expected.memory.size());
+                                jpeg_inverse_image_scalar(coefs_expected.data(), q, expected.view);
+                                inverse(coefs_expected.data(), q, result.view);
+                                if (expected.memory != result.memory) {
+                                    printf("failed for image %d x %d, quality %d, pattern %d\n",
+                                           sizes[s][0], sizes[s][1], qualities[k], pattern);
+                                    throw TestFailed();
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            puts("OK");
+        }
+    }
+
+
+    void compare(const std::vector<int16_t>& expected, const std::vector<int16_t>& result, size_t s, int quality, int pattern) {
+        for (size_t i=0; i < expected.size(); i++) {
+            if (expected[i] != result[i]) {
+                printf("failed for size #%zu, quality %d, pattern %d: block %zu, coefficient %zu (%d vs %d)\n",
+                       s, quality, pattern, i / 64, i % 64, result[i], expected[i]);
+                throw TestFailed();
+            }
+        }
+    }
+
+
+    uint32_t random32() {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) | (seed << 16);
+    }
+
+
+    // 0 - smooth with noise, 1 - random, 2 - extremes (0 or 255)
+    void fill(Image& img, int pattern) {
+        for (size_t i=0; i < img.memory.size(); i++) {
+            const size_t x = i % img.view.stride;
+            const size_t y = i / img.view.stride;
+            switch (pattern) {
+                case 0:
+                    img.memory[i] = (x * 3 + y * 5 + random32() % 16) & 0xff;
+                    break;
+                case 1:
+                    img.memory[i] = random32();
+                    break;
+                default:
+                    img.memory[i] = (random32() & 1) ? 255 : 0;
+                    break;
+            }
+        }
+    }
+
+
+    // 0 - typical, 1 - dense, 2 - DC only
+    void random_coefficients(std::vector<int16_t>& coefs, int pattern) {
+        for (size_t i=0; i < coefs.size(); i++) {
+            const size_t k = i % 64;
+            int16_t c;
+            switch (pattern) {
+                case 0:
+                    c = (random32() % 4 == 0) ? int16_t(random32() % 33) - 16 : 0;
+                    break;
+                case 1:
+                    c = int16_t(random32() % 65) - 32;
+                    break;
+                default:
+                    c = (k == 0) ? int16_t(random32() % 129) - 64 : 0;
+                    break;
+            }
+
+            coefs[i] = c;
+        }
+    }
+};
+
+int main() {
+
+    TestPipeline test;
+
+    return test.run() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,192 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "rle_all.cpp"
+
+class TestRle {
+
+    class TestFailed {};
+
+    typedef size_t (*RleFunction)(const int16_t* blocks, size_t count, JpegSymbol* out);
+
+    std::vector<int16_t> blocks;
+    uint32_t seed;
+
+public:
+    TestRle() : seed(1) {
+        prepare_blocks();
+    }
+
+public:
+    bool run() {
+        try {
+            test_reference();
+            test("scalar (tzcnt)",          jpeg_rle_scalar_tzcnt);
+#ifdef HAVE_AVX2
+            test("AVX2 (tzcnt)",            jpeg_rle_avx2);
+#endif
+#ifdef HAVE_AVX512BW
+            test("AVX512BW (tzcnt)",        jpeg_rle_avx512bw);
+#endif
+#ifdef HAVE_AVX512VBMI2
+            test("AVX512VBMI2 (compress)",  jpeg_rle_avx512vbmi2);
+#endif
+        } catch (TestFailed&) {
+            return false;
+        }
+
+        return true;
+    }
+
+private:
+    void test_reference() {
+        printf("%32s ... ", "scalar reference");
+        fflush(stdout);
+
+        int16_t block[2 * 64] = {0};
+        block[0]  = 5;
+        block[1]  = -3;
+        block[4]  = 1;
+        block[22] = 256;        // run 17: ZRL + (1, 9)
+        block[64] = 2;          // second block: DC only
+
+        const JpegSymbol expected[] = {
+            {0, 3, 5}, {0, 2, -3}, {2, 1, 1}, {15, 0, 0}, {1, 9, 256}, {0, 0, 0},
+            {0, 2, -3}, {0, 0, 0}
+        };
+        const size_t n = sizeof(expected)/sizeof(expected[0]);
+
+        JpegSymbol out[2 * jpeg::MAX_SYMBOLS];
+        if (jpeg_rle_scalar(block, 2, out) != n || !equal(expected, out, n)) {
+            puts("failed");
+            throw TestFailed();
+        }
+
+        puts("OK");
+    }
+
+
+    void test(const char* name, RleFunction rle) {
+        printf("%32s ... ", name);
+        fflush(stdout);
+
+        const size_t count = blocks.size() / 64;
+        std::vector<JpegSymbol> expected(count * jpeg::MAX_SYMBOLS);
+        std::vector<JpegSymbol> result(count * jpeg::MAX_SYMBOLS);
+
+        // single blocks, then all at once (DC prediction)
+        for (size_t b=0; b < count; b++) {
+            const size_t n1 = jpeg_rle_scalar(blocks.data() + 64*b, 1, expected.data());
+            const size_t n2 = rle(blocks.data() + 64*b, 1, result.data());
+            if (n1 != n2 || !equal(expected.data(), result.data(), n1)) {
+                printf("failed for block #%zu:", b);
+                for (int k=0; k < 64; k++)
+                    printf(" %d", blocks[64*b + k]);
+                putchar('\n');
+                throw TestFailed();
+            }
+        }
+
+        const size_t n1 = jpeg_rle_scalar(blocks.data(), count, expected.data());
+        const size_t n2 = rle(blocks.data(), count, result.data());
+        if (n1 != n2 || !equal(expected.data(), result.data(), n1)) {
+            printf("failed for all blocks\n");
+            throw TestFailed();
+        }
+
+        puts("OK");
+    }
+
+
+    bool equal(const JpegSymbol* a, const JpegSymbol* b, size_t n) const {
+        for (size_t i=0; i < n; i++)
+            if (a[i].run != b[i].run || a[i].size != b[i].size || a[i].value != b[i].value)
+                return false;
+
+        return true;
+    }
+
+
+    uint32_t random32() {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) | (seed << 16);
+    }
+
+
+    void prepare_blocks() {
+        int16_t block[64];
+
+        // single nonzero coefficient at each position, with zero and nonzero DC
+        for (int dc=0; dc < 2; dc++) {
+            for (int k=0; k < 64; k++) {
+                memset(block, 0, sizeof(block));
+                block[0] = dc * 100;
+                block[k] = -7;
+                add(block);
+            }
+        }
+
+        // runs of zeros of all lengths between two coefficients
+        for (int start=1; start < 64; start += 13) {
+            for (int run=0; start + run + 1 < 64; run++) {
+                memset(block, 0, sizeof(block));
+                block[start] = 1;
+                block[start + run + 1] = -1;
+                add(block);
+            }
+        }
+
+        // all nonzero; all zero; extreme values
+        for (int k=0; k < 64; k++)
+            block[k] = (k & 1) ? -2047 : 2047;
+        add(block);
+
+        memset(block, 0, sizeof(block));
+        add(block);
+
+        // random with various densities
+        const unsigned densities[] = {2, 10, 30, 50, 90, 100};
+        for (size_t d=0; d < sizeof(densities)/sizeof(densities[0]); d++) {
+            for (int i=0; i < 200; i++) {
+                for (int k=0; k < 64; k++) {
+                    if (random32() % 100 < densities[d])
+                        block[k] = int16_t(random32() % 4095) - 2047;
+                    else
+                        block[k] = 0;
+                }
+
+                add(block);
+            }
+        }
+
+        // output of DCT and quantization
+        std::vector<uint8_t> pixels(256 * 64);
+        GrayImage img;
+        img.data   = pixels.data();
+        img.stride = 256;
+        img.width  = 256;
+        img.height = 64;
+        for (size_t i=0; i < pixels.size(); i++)
+            pixels[i] = (i % 256 + (i / 256) * 3 + random32() % 32) & 0xff;
+
+        std::vector<int16_t> coefs(img.blocks() * 64);
+        const int qualities[] = {10, 50, 75, 95};
+        for (size_t q=0; q < sizeof(qualities)/sizeof(qualities[0]); q++) {
+            jpeg_forward_image_scalar(img, QuantTable(jpeg_luminance_table, qualities[q]), coefs.data());
+            blocks.insert(blocks.end(), coefs.begin(), coefs.end());
+        }
+    }
+
+
+    void add(const int16_t* block) {
+        blocks.insert(blocks.end(), block, block + 64);
+    }
+};
+
+int main() {
+
+    TestRle test;
+
+    return test.run() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -3,3 +3,5 @@
 #include "avx512vbmi_travis.cpp"
 #include "avx512vbmi_zach.cpp"
 #include "aqrit.cpp" // scalar + SSE + AVX2
+#include "filter.cpp" // scalar + SSSE3 + AVX2 + AVX512, user-defined class
+#include "stream.cpp" // whitespace normalization of streams
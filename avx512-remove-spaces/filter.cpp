@@ -0,0 +1,497 @@
+#include <immintrin.h>
+#include <cstdint>
+#include <cstddef>
+
+/*
+    Byte filter: delete (or keep) all bytes belonging to a user-defined
+    class. Procedures accept any input length and can work in-place
+    (dst == src); they return the end of output.
+
+    A class is a 256-bit set, stored as two 16-byte lookup tables indexed
+    by the lower nibble of a byte. A bit k of lut_lo[x] is set when byte
+    (k << 4) | x belongs to the class; lut_hi describes bytes 0x80..0xff
+    the same way. With the tables, membership of 16/32/64 bytes is
+    determined with three pshufb:
+
+        lo  = pshufb(lut_lo, byte & 0x8f)          -- zero if byte >= 0x80
+        hi  = pshufb(lut_hi, (byte & 0x8f) ^ 0x80) -- zero if byte <  0x80
+        bit = pshufb(1 << (k & 7), byte >> 4)
+        member = ((lo | hi) & bit) != 0
+*/
+
+class ByteClass {
+
+    uint8_t lut_lo[16];
+    uint8_t lut_hi[16];
+
+public:
+    ByteClass() {
+        for (int i=0; i < 16; i++) {
+            lut_lo[i] = 0;
+            lut_hi[i] = 0;
+        }
+    }
+
+    explicit ByteClass(const char* chars) : ByteClass() {
+        add_chars(chars);
+    }
+
+    ByteClass& add(uint8_t byte) {
+        const int row = byte >> 4;
+        const int col = byte & 0xf;
+        if (row < 8) {
+            lut_lo[col] |= uint8_t(1 << row);
+        } else {
+            lut_hi[col] |= uint8_t(1 << (row - 8));
+        }
+
+        return *this;
+    }
+
+    ByteClass& add_chars(const char* chars) {
+        while (*chars) {
+            add(uint8_t(*chars++));
+        }
+
+        return *this;
+    }
+
+    ByteClass& add_range(uint8_t first, uint8_t last) {
+        for (int byte=first; byte <= last; byte++) {
+            add(uint8_t(byte));
+        }
+
+        return *this;
+    }
+
+    ByteClass complement() const {
+        ByteClass result;
+        for (int i=0; i < 16; i++) {
+            result.lut_lo[i] = uint8_t(~lut_lo[i]);
+            result.lut_hi[i] = uint8_t(~lut_hi[i]);
+        }
+
+        return result;
+    }
+
+    bool contains(uint8_t byte) const {
+        const int row = byte >> 4;
+        const int col = byte & 0xf;
+        if (row < 8) {
+            return lut_lo[col] & (1 << row);
+        } else {
+            return lut_hi[col] & (1 << (row - 8));
+        }
+    }
+
+    __m128i lookup_lo() const {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut_lo));
+    }
+
+    __m128i lookup_hi() const {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut_hi));
+    }
+};
+
+
+namespace filter {
+
+    // --- scalar ----------------------------------------------------------
+
+    template <bool keep>
+    char* scalar(const ByteClass& cls, const char* src, char* dst, size_t n) {
+        for (size_t i=0; i < n; i++) {
+            const char c = src[i];
+            *dst = c;
+            dst += (cls.contains(uint8_t(c)) == keep);
+        }
+
+        return dst;
+    }
+
+    // --- SSSE3 -----------------------------------------------------------
+
+    struct LookupSSE {
+        __m128i lo;
+        __m128i hi;
+        __m128i bit;
+
+        explicit LookupSSE(const ByteClass& cls)
+            : lo(cls.lookup_lo())
+            , hi(cls.lookup_hi())
+            , bit(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                1, 2, 4, 8, 16, 32, 64, -128)) {}
+
+        // non-zero bytes are members of the class
+        __m128i members(const __m128i v) const {
+            const __m128i idx_lo = _mm_and_si128(v, _mm_set1_epi8(int8_t(0x8f)));
+            const __m128i idx_hi = _mm_xor_si128(idx_lo, _mm_set1_epi8(int8_t(0x80)));
+            const __m128i row    = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0f));
+
+            const __m128i t0 = _mm_or_si128(_mm_shuffle_epi8(lo, idx_lo),
+                                            _mm_shuffle_epi8(hi, idx_hi));
+            const __m128i t1 = _mm_shuffle_epi8(bit, row);
+
+            return _mm_and_si128(t0, t1);
+        }
+
+        // 0xff for bytes to be removed
+        template <bool keep>
+        __m128i removed(const __m128i v) const {
+            const __m128i outside = _mm_cmpeq_epi8(members(v), _mm_setzero_si128());
+            if (keep) {
+                return outside;
+            } else {
+                return _mm_xor_si128(outside, _mm_set1_epi8(-1));
+            }
+        }
+    };
+
+    template <bool keep>
+    struct SelectSSE {
+        const LookupSSE lookup;
+
+        explicit SelectSSE(const ByteClass& cls) : lookup(cls) {}
+
+        __m128i removed(__m128i& v) const {
+            return lookup.removed<keep>(v);
+        }
+    };
+
+    // This is despace_ssse3_cumsum by aqrit (see aqrit.cpp) with the
+    // detection of spaces replaced by a policy: POLICY::removed(v) yields
+    // a bytemask of bytes to drop (and may alter v). Only full 16-byte
+    // blocks are processed; returns the end of output.
+    template <typename POLICY>
+    uint8_t* compact_ssse3(POLICY& policy, const uint8_t* src, uint8_t* dst, size_t length) {
+
+        const __m128i is_3or7 = _mm_setr_epi8(
+            0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00);
+        const __m128i id = _mm_setr_epi8(
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+            0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F);
+        const __m128i mask_01 = _mm_set1_epi8(0x01);
+        const __m128i mask_02 = _mm_set1_epi8(0x02);
+        const __m128i mask_04 = _mm_set1_epi8(0x04);
+
+        for (const uint8_t* end = src + (length & ~size_t(15)); src != end; src += 16) {
+            __m128i a, b, c, d, s, t, v;
+            size_t cnt0, cnt1;
+
+            v = _mm_loadu_si128((const __m128i*)src);
+
+            // 0x01 == removed, 0x00 == kept
+            s = _mm_and_si128(policy.removed(v), mask_01);
+
+            // 0x00 == removed, 0xff == kept
+            b = _mm_cmpeq_epi8(_mm_setzero_si128(), s);
+
+            // (qword) prefix sum of removed bytes
+            s = _mm_add_epi8(s, _mm_slli_epi64(s, 8));
+            s = _mm_add_epi8(s, _mm_slli_epi64(s, 16));
+            s = _mm_add_epi8(s, _mm_slli_epi64(s, 32));
+
+            t = _mm_srli_epi64(s, 56);
+            cnt0 = (uint32_t)_mm_cvtsi128_si32(t);
+            t = _mm_unpackhi_epi64(t, t);
+            cnt1 = (uint32_t)_mm_cvtsi128_si32(t);
+
+            // compress
+            b = _mm_andnot_si128(b, s);
+            c = _mm_srli_epi64(_mm_and_si128(mask_02, b), 9);
+            d = _mm_srli_epi64(_mm_shuffle_epi8(is_3or7, b), 16);
+            a = _mm_or_si128(_mm_cmpgt_epi8(mask_04, s), _mm_cmpeq_epi8(b, mask_04));
+            s = _mm_add_epi8(s, c);
+            s = _mm_add_epi8(s, d);
+            s = _mm_max_epu8(s, _mm_srli_epi64(_mm_andnot_si128(a, s), 32));
+            v = _mm_shuffle_epi8(v, _mm_add_epi8(s, id));
+
+            // store; the stores never pass the bytes already loaded, thus
+            // in-place filtering is possible
+            _mm_storel_epi64((__m128i*)dst, v);
+            dst += 8 - cnt0;
+            _mm_storel_epi64((__m128i*)dst, _mm_unpackhi_epi64(v, v));
+            dst += 8 - cnt1;
+        }
+
+        return dst;
+    }
+
+    template <bool keep>
+    char* ssse3(const ByteClass& cls, const char* src, char* dst, size_t length) {
+        SelectSSE<keep> policy(cls);
+        dst = (char*)compact_ssse3(policy, (const uint8_t*)src, (uint8_t*)dst, length);
+
+        const size_t done = length & ~size_t(15);
+        return scalar<keep>(cls, src + done, dst, length - done);
+    }
+
+#ifdef __AVX2__
+    // --- AVX2 ------------------------------------------------------------
+
+    struct LookupAVX2 {
+        __m256i lo;
+        __m256i hi;
+        __m256i bit;
+
+        explicit LookupAVX2(const ByteClass& cls)
+            : lo(_mm256_broadcastsi128_si256(cls.lookup_lo()))
+            , hi(_mm256_broadcastsi128_si256(cls.lookup_hi()))
+            , bit(_mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                   1, 2, 4, 8, 16, 32, 64, -128,
+                                   1, 2, 4, 8, 16, 32, 64, -128,
+                                   1, 2, 4, 8, 16, 32, 64, -128)) {}
+
+        __m256i members(const __m256i v) const {
+            const __m256i idx_lo = _mm256_and_si256(v, _mm256_set1_epi8(int8_t(0x8f)));
+            const __m256i idx_hi = _mm256_xor_si256(idx_lo, _mm256_set1_epi8(int8_t(0x80)));
+            const __m256i row    = _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0f));
+
+            const __m256i t0 = _mm256_or_si256(_mm256_shuffle_epi8(lo, idx_lo),
+                                               _mm256_shuffle_epi8(hi, idx_hi));
+            const __m256i t1 = _mm256_shuffle_epi8(bit, row);
+
+            return _mm256_and_si256(t0, t1);
+        }
+
+        template <bool keep>
+        __m256i removed(const __m256i v) const {
+            const __m256i outside = _mm256_cmpeq_epi8(members(v), _mm256_setzero_si256());
+            if (keep) {
+                return outside;
+            } else {
+                return _mm256_xor_si256(outside, _mm256_set1_epi8(-1));
+            }
+        }
+    };
+
+    template <bool keep>
+    struct SelectAVX2 {
+        const LookupAVX2 lookup;
+
+        explicit SelectAVX2(const ByteClass& cls) : lookup(cls) {}
+
+        __m256i removed(__m256i& v) const {
+            return lookup.removed<keep>(v);
+        }
+    };
+
+    // This is despace_avx2_vpermd by aqrit (see aqrit.cpp) with the
+    // detection of spaces replaced by a policy, like in compact_ssse3.
+    // Only full 32-byte blocks are processed.
+    template <typename POLICY>
+    uint8_t* compact_avx2(POLICY& policy, const uint8_t* src, uint8_t* dst, size_t length) {
+
+        const __m256i permutation_mask = _mm256_set1_epi64x(0x0020100884828180);
+        const __m256i invert_mask = _mm256_set1_epi64x(0x0020100880808080);
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i fixup = _mm256_set_epi32(
+            0x08080808, 0x0F0F0F0F, 0x00000000, 0x07070707,
+            0x08080808, 0x0F0F0F0F, 0x00000000, 0x07070707
+        );
+        const __m256i lut = _mm256_set_epi32(
+            0x04050607, 0x04050704, 0x04060705, 0x04070504,
+            0x05060706, 0x05070604, 0x06070605, 0x07060504
+        );
+        const __m256i shuffle_a = _mm256_set_epi8(
+            0x7F, 0x7E, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x78, 0x07, 0x16, 0x25, 0x34, 0x43, 0x52, 0x61, 0x70,
+            0x7F, 0x7E, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x78, 0x07, 0x16, 0x25, 0x34, 0x43, 0x52, 0x61, 0x70
+        );
+        const __m256i shuffle_b = _mm256_set_epi32(
+            0x08080808, 0x08080808, 0x00000000, 0x00000000,
+            0x08080808, 0x08080808, 0x00000000, 0x00000000
+        );
+
+        for (const uint8_t* end = src + (length & ~size_t(31)); src != end; src += 32) {
+            __m256i r0, r1, r2, r3, r4;
+            unsigned int s0, s1;
+
+            r0 = _mm256_loadu_si256((const __m256i*)src);
+            r1 = policy.removed(r0);
+
+            r2 = _mm256_sad_epu8(zero, r1);
+            s0 = _mm256_movemask_epi8(r1);
+            r1 = _mm256_andnot_si256(r1, permutation_mask);
+            r1 = _mm256_sad_epu8(r1, invert_mask);
+            r2 = _mm256_shuffle_epi8(r2, zero);
+            r2 = _mm256_sub_epi8(shuffle_a, r2);
+            s0 = ~s0;
+            r3 = _mm256_slli_epi64(r1, 29);
+            r4 = _mm256_srli_epi64(r1, 7);
+            r4 = _mm256_shuffle_epi8(r4, shuffle_b);
+            r1 = _mm256_or_si256(r1, r3);
+            r1 = _mm256_permutevar8x32_epi32(lut, r1);
+            s1 = _mm_popcnt_u32(s0);
+            r4 = _mm256_add_epi8(r4, shuffle_a);
+            s0 = s0 & 0xFFFF;
+            r2 = _mm256_shuffle_epi8(r4, r2);
+            s0 = _mm_popcnt_u32(s0);
+            r2 = _mm256_max_epu8(r2, r4);
+            r1 = _mm256_xor_si256(r1, fixup);
+            r1 = _mm256_shuffle_epi8(r1, r2);
+            r0 = _mm256_shuffle_epi8(r0, r1);
+
+            _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(r0));
+            _mm_storeu_si128((__m128i*)&dst[s0], _mm256_extracti128_si256(r0, 1));
+            dst += s1;
+        }
+
+        return dst;
+    }
+
+    template <bool keep>
+    char* avx2(const ByteClass& cls, const char* src, char* dst, size_t length) {
+        SelectAVX2<keep> policy(cls);
+        dst = (char*)compact_avx2(policy, (const uint8_t*)src, (uint8_t*)dst, length);
+
+        const size_t done = length & ~size_t(31);
+        return ssse3<keep>(cls, src + done, dst, length - done);
+    }
+#endif // __AVX2__
+
+#ifdef __AVX512BW__
+    // --- AVX512 ----------------------------------------------------------
+
+    struct LookupAVX512 {
+        __m512i lo;
+        __m512i hi;
+        __m512i bit;
+
+        explicit LookupAVX512(const ByteClass& cls)
+            : lo(_mm512_broadcast_i32x4(cls.lookup_lo()))
+            , hi(_mm512_broadcast_i32x4(cls.lookup_hi()))
+            , bit(_mm512_set1_epi64(int64_t(0x8040201008040201))) {}
+
+        // bitmask of bytes to be kept
+        template <bool keep>
+        uint64_t kept(const __m512i v) const {
+            const __m512i idx_lo = _mm512_and_si512(v, _mm512_set1_epi8(int8_t(0x8f)));
+            const __m512i idx_hi = _mm512_xor_si512(idx_lo, _mm512_set1_epi8(int8_t(0x80)));
+            const __m512i row    = _mm512_and_si512(_mm512_srli_epi16(v, 4), _mm512_set1_epi8(0x0f));
+
+            const __m512i t0 = _mm512_or_si512(_mm512_shuffle_epi8(lo, idx_lo),
+                                               _mm512_shuffle_epi8(hi, idx_hi));
+            const __m512i t1 = _mm512_shuffle_epi8(bit, row);
+
+            if (keep) {
+                return _mm512_test_epi8_mask(t0, t1);
+            } else {
+                return _mm512_testn_epi8_mask(t0, t1);
+            }
+        }
+    };
+
+#ifndef __AVX512VBMI2__
+    // Without VBMI2 there is no byte-granularity compress; a 16-byte lane
+    // is expanded to dwords, compressed with vpcompressd and narrowed back
+    // with a masked vpmovdb store.
+    template <int lane>
+    uint8_t* compress_store_lane(uint8_t* dst, uint64_t mask, const __m512i v) {
+        const uint16_t m = uint16_t(mask >> (16 * lane));
+        const __m512i dwords = _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, lane));
+        const __m512i packed = _mm512_maskz_compress_epi32(m, dwords);
+        const int count = __builtin_popcount(m);
+
+        _mm512_mask_cvtepi32_storeu_epi8(dst, __mmask16((1u << count) - 1), packed);
+
+        return dst + count;
+    }
+#endif
+
+    // Stores bytes of v selected by mask, returns the new end of output.
+    inline uint8_t* compress_store(uint8_t* dst, uint64_t mask, const __m512i v) {
+#ifdef __AVX512VBMI2__
+        _mm512_mask_compressstoreu_epi8(dst, mask, v);
+        return dst + __builtin_popcountll(mask);
+#else
+        dst = compress_store_lane<0>(dst, mask, v);
+        dst = compress_store_lane<1>(dst, mask, v);
+        dst = compress_store_lane<2>(dst, mask, v);
+        dst = compress_store_lane<3>(dst, mask, v);
+
+        return dst;
+#endif
+    }
+
+    template <bool keep>
+    struct SelectAVX512 {
+        const LookupAVX512 lookup;
+
+        explicit SelectAVX512(const ByteClass& cls) : lookup(cls) {}
+
+        // `valid` - bitmask of loaded bytes (all ones except the tail)
+        uint64_t kept(__m512i& v, uint64_t valid) const {
+            return lookup.kept<keep>(v) & valid;
+        }
+    };
+
+    // POLICY::kept(v, valid) yields a bitmask of bytes to retain (and may
+    // alter v). Processes the whole input, the tail with masked loads.
+    template <typename POLICY>
+    uint8_t* compact_avx512(POLICY& policy, const uint8_t* src, uint8_t* dst, size_t length) {
+
+        const uint64_t all = uint64_t(-1);
+
+        size_t i = 0;
+        for (/**/; i + 64 <= length; i += 64) {
+            __m512i v = _mm512_loadu_si512((const __m512i*)(src + i));
+            const uint64_t mask = policy.kept(v, all); // might alter v
+            dst = compress_store(dst, mask, v);
+        }
+
+        if (i < length) {
+            const uint64_t tail = (uint64_t(1) << (length - i)) - 1;
+            __m512i v = _mm512_maskz_loadu_epi8(tail, src + i);
+            const uint64_t mask = policy.kept(v, tail);
+            dst = compress_store(dst, mask, v);
+        }
+
+        return dst;
+    }
+
+    template <bool keep>
+    char* avx512(const ByteClass& cls, const char* src, char* dst, size_t length) {
+        SelectAVX512<keep> policy(cls);
+        return (char*)compact_avx512(policy, (const uint8_t*)src, (uint8_t*)dst, length);
+    }
+#endif // __AVX512BW__
+
+} // namespace filter
+
+
+char* filter_delete_scalar(const char* src, char* dst, size_t n, const ByteClass& cls) {
+    return filter::scalar<false>(cls, src, dst, n);
+}
+
+char* filter_keep_scalar(const char* src, char* dst, size_t n, const ByteClass& cls) {
+    return filter::scalar<true>(cls, src, dst, n);
+}
+
+char* filter_delete_ssse3(const char* src, char* dst, size_t n, const ByteClass& cls) {
+    return filter::ssse3<false>(cls, src, dst, n);
+}
+
+char* filter_keep_ssse3(const char* src, char* dst, size_t n, const ByteClass& cls) {
+    return filter::ssse3<true>(cls, src, dst, n);
+}
+
+#ifdef __AVX2__
+char* filter_delete_avx2(const char* src, char* dst, size_t n, const ByteClass& cls) {
+    return filter::avx2<false>(cls, src, dst, n);
+}
+
+char* filter_keep_avx2(const char* src, char* dst, size_t n, const ByteClass& cls) {
+    return filter::avx2<true>(cls, src, dst, n);
+}
+#endif // __AVX2__
+
+#ifdef __AVX512BW__
+char* filter_delete_avx512(const char* src, char* dst, size_t n, const ByteClass& cls) {
+    return filter::avx512<false>(cls, src, dst, n);
+}
+
+char* filter_keep_avx512(const char* src, char* dst, size_t n, const ByteClass& cls) {
+    return filter::avx512<true>(cls, src, dst, n);
+}
+#endif // __AVX512BW__
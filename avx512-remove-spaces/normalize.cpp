@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+
+#include "all.cpp"
+
+void usage() {
+    puts("usage: normalize [--collapse] [--block-size KB] input output");
+    puts("");
+    puts("Removes whitespace (or collapses runs of whitespace into single");
+    puts("spaces) from input file; '-' denotes stdin/stdout.");
+}
+
+
+int main(int argc, char* argv[]) {
+
+    WhitespaceMode mode = WhitespaceMode::remove;
+    size_t block_size = 4*1024*1024;
+    const char* paths[2] = {nullptr, nullptr};
+    int path_count = 0;
+
+    for (int i=1; i < argc; i++) {
+        if (strcmp(argv[i], "--collapse") == 0) {
+            mode = WhitespaceMode::collapse;
+        } else if (strcmp(argv[i], "--block-size") == 0 && i + 1 < argc) {
+            block_size = size_t(atol(argv[++i])) * 1024;
+        } else if (path_count < 2) {
+            paths[path_count++] = argv[i];
+        } else {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (path_count != 2) {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    const int input = (strcmp(paths[0], "-") == 0) ? STDIN_FILENO : open(paths[0], O_RDONLY);
+    if (input < 0) {
+        perror(paths[0]);
+        return EXIT_FAILURE;
+    }
+
+    const int output = (strcmp(paths[1], "-") == 0) ? STDOUT_FILENO
+                     : open(paths[1], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (output < 0) {
+        perror(paths[1]);
+        return EXIT_FAILURE;
+    }
+
+    using namespace std::chrono;
+
+    WhitespaceNormalizer normalizer(mode);
+    stream::Stats stats;
+
+    const auto ts = high_resolution_clock::now();
+    try {
+        stats = normalize_stream(input, output, normalizer, block_size);
+    } catch (std::exception& e) {
+        fprintf(stderr, "error: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+    const auto te = high_resolution_clock::now();
+
+    close(input);
+    close(output);
+
+    const double seconds = duration_cast<microseconds>(te - ts).count() / 1e6;
+    const double mb = stats.bytes_read / (1024.0 * 1024.0);
+
+    fprintf(stderr, "%s, %s, block %lu kB: read %lu bytes, written %lu bytes, %0.3f s, %0.1f MB/s\n",
+            (mode == WhitespaceMode::remove) ? "remove" : "collapse",
+            WhitespaceNormalizer::kernel_name(), block_size / 1024,
+            stats.bytes_read, stats.bytes_written, seconds,
+            (seconds > 0.0) ? mb / seconds : 0.0);
+
+    return EXIT_SUCCESS;
+}
@@ -41,16 +41,80 @@ void measure(const char* name, FUNCTION fun, const char* input, char* output, si
 }
 
 
-int main(int argc, char* argv[1]) {
+template <typename FUNCTION>
+void measure_filter(const char* name, FUNCTION fun, const ByteClass& cls, const std::string& text) {
 
-    if (argc < 2) {
-        puts("argument expected");
-        return EXIT_FAILURE;
+    using namespace std::chrono;
+
+    printf("%-30s: ", name); fflush(stdout);
+
+    std::string output(text.size(), 0);
+
+    const int runs = 10;
+    uint64_t best_time = -1;
+    size_t len = 0;
+
+    for (int i=0; i < runs; i++) {
+        putchar('.'); fflush(stdout);
+        const auto ts = high_resolution_clock::now();
+        len = fun(text.data(), &output[0], text.size(), cls) - output.data();
+        const auto te = high_resolution_clock::now();
+
+        const uint64_t d = duration_cast<microseconds>(te - ts).count();
+        best_time = std::min(best_time, d);
     }
 
-    std::string text = load(argv[1]);
+    const double mbps = (best_time > 0) ? text.size() / double(best_time) : 0.0;
+
+    printf(" %10lu us, %8.1f MB/s, output %lu bytes\n", best_time, mbps, len);
+}
+
+
+// The filter engine runs on an arbitrary length input; the classes are
+// typical for JSON/CSV preprocessing.
+void run_filters(const std::string& text) {
+
+    struct Task {
+        const char* name;
+        ByteClass cls;
+        bool keep;
+    };
+
+    const Task tasks[] = {
+        {"delete whitespace",      ByteClass(" \t\r\n"), false},
+        {"delete JSON structure",  ByteClass("{}[]:,\""), false},
+        {"keep digits",            ByteClass().add_range('0', '9'), true},
+        {"keep CSV separators",    ByteClass(",;\n"), true},
+    };
+
+#define RUN_FILTER(__name__, __delete__, __keep__) \
+    measure_filter(__name__, task.keep ? __keep__ : __delete__, task.cls, text);
+
+    for (const Task& task: tasks) {
+        printf("%s (%s)\n", task.name, task.keep ? "keep" : "delete");
+        RUN_FILTER("filter scalar",   filter_delete_scalar, filter_keep_scalar);
+        RUN_FILTER("filter SSSE3",    filter_delete_ssse3,  filter_keep_ssse3);
+        RUN_FILTER("filter AVX2",     filter_delete_avx2,   filter_keep_avx2);
+#ifdef __AVX512VBMI2__
+        RUN_FILTER("filter AVX512 (vpcompressb)", filter_delete_avx512, filter_keep_avx512);
+#else
+        RUN_FILTER("filter AVX512 (vpcompressd)", filter_delete_avx512, filter_keep_avx512);
+#endif
+    }
+
+#undef RUN_FILTER
+}
+
+
+void run_file(const char* path) {
+
+    std::string text = load(path);
+    printf("%s (%lu bytes)\n", path, text.size());
+
+    // the original procedures process 64-byte blocks
     size_t size = 64 * ((text.size() + 63) / 64);
-    char* output = new char[text.size()];
+    text.resize(size, ' ');
+    char* output = new char[size];
 
 #define RUN(__name__, __procedure__) \
     measure(__name__, __procedure__, text.data(), output, size);
@@ -63,4 +127,25 @@ int main(int argc, char* argv[1]) {
     RUN("despace_block_mux (aqrit)",    despace_block_mux);
     RUN("despace_ssse3_cumsum (aqrit)", despace_ssse3_cumsum);
     RUN("despace_avx2_vpermd (aqrit)",  despace_avx2_vpermd);
+
+#undef RUN
+
+    delete[] output;
+
+    run_filters(text);
+}
+
+
+int main(int argc, char* argv[1]) {
+
+    if (argc < 2) {
+        puts("usage: speed file1 [file2 ...]");
+        return EXIT_FAILURE;
+    }
+
+    for (int i=1; i < argc; i++) {
+        run_file(argv[i]);
+    }
+
+    return EXIT_SUCCESS;
 }
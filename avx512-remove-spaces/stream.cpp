@@ -0,0 +1,426 @@
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+    Whitespace normalization of streams (files of any size).
+
+    Two modes are supported:
+
+    - remove   -- all whitespace bytes are deleted (filter_delete_*),
+    - collapse -- each run of whitespace is replaced with a single space.
+
+    Collapsing uses the compaction kernels from filter.cpp with a policy
+    which marks whitespace bytes preceded by another whitespace byte; the
+    state (whether the last byte seen was whitespace) is carried between
+    vectors and between blocks of a stream.
+*/
+
+enum class WhitespaceMode {
+    remove,
+    collapse
+};
+
+
+namespace collapse {
+
+    char* scalar(const ByteClass& ws, bool& previous, const char* src, char* dst, size_t n) {
+        for (size_t i=0; i < n; i++) {
+            const bool curr = ws.contains(uint8_t(src[i]));
+            *dst = curr ? ' ' : src[i];
+            dst += !(curr && previous);
+            previous = curr;
+        }
+
+        return dst;
+    }
+
+    struct CollapseSSE {
+        const filter::LookupSSE lookup;
+        __m128i previous; // whitespace bytemask of the last block
+
+        CollapseSSE(const ByteClass& ws, bool prev)
+            : lookup(ws)
+            , previous(_mm_set1_epi8(prev ? -1 : 0)) {}
+
+        __m128i removed(__m128i& v) {
+            // whitespace bytemask (the bytes not removed when keeping the class)
+            const __m128i curr = _mm_cmpeq_epi8(lookup.removed<true>(v), _mm_setzero_si128());
+            const __m128i prev = _mm_alignr_epi8(curr, previous, 15);
+            previous = curr;
+
+            v = _mm_or_si128(_mm_andnot_si128(curr, v), _mm_and_si128(curr, _mm_set1_epi8(' ')));
+
+            return _mm_and_si128(curr, prev);
+        }
+
+        bool last() const {
+            return _mm_movemask_epi8(previous) & 0x8000;
+        }
+    };
+
+    char* ssse3(const ByteClass& ws, bool& previous, const char* src, char* dst, size_t n) {
+        CollapseSSE policy(ws, previous);
+        dst = (char*)filter::compact_ssse3(policy, (const uint8_t*)src, (uint8_t*)dst, n);
+        previous = policy.last();
+
+        const size_t done = n & ~size_t(15);
+        return scalar(ws, previous, src + done, dst, n - done);
+    }
+
+#ifdef __AVX2__
+    struct CollapseAVX2 {
+        const filter::LookupAVX2 lookup;
+        __m256i previous;
+
+        CollapseAVX2(const ByteClass& ws, bool prev)
+            : lookup(ws)
+            , previous(_mm256_set1_epi8(prev ? -1 : 0)) {}
+
+        __m256i removed(__m256i& v) {
+            const __m256i curr = _mm256_cmpeq_epi8(lookup.removed<true>(v), _mm256_setzero_si256());
+            // bytes shifted by one position across the lanes
+            const __m256i prev = _mm256_alignr_epi8(curr, _mm256_permute2x128_si256(previous, curr, 0x21), 15);
+            previous = curr;
+
+            v = _mm256_blendv_epi8(v, _mm256_set1_epi8(' '), curr);
+
+            return _mm256_and_si256(curr, prev);
+        }
+
+        bool last() const {
+            return uint32_t(_mm256_movemask_epi8(previous)) & 0x80000000u;
+        }
+    };
+
+    char* avx2(const ByteClass& ws, bool& previous, const char* src, char* dst, size_t n) {
+        CollapseAVX2 policy(ws, previous);
+        dst = (char*)filter::compact_avx2(policy, (const uint8_t*)src, (uint8_t*)dst, n);
+        previous = policy.last();
+
+        const size_t done = n & ~size_t(31);
+        return ssse3(ws, previous, src + done, dst, n - done);
+    }
+#endif // __AVX2__
+
+#ifdef __AVX512BW__
+    struct CollapseAVX512 {
+        const filter::LookupAVX512 lookup;
+        uint64_t previous; // 0 or 1
+
+        CollapseAVX512(const ByteClass& ws, bool prev)
+            : lookup(ws)
+            , previous(prev) {}
+
+        uint64_t kept(__m512i& v, uint64_t valid) {
+            const uint64_t curr = lookup.kept<true>(v) & valid;
+            const uint64_t prev = (curr << 1) | previous;
+
+            // the last valid byte (valid is never zero)
+            previous = (curr >> (63 - __builtin_clzll(valid))) & 1;
+
+            v = _mm512_mask_blend_epi8(curr, v, _mm512_set1_epi8(' '));
+
+            return valid & ~(curr & prev);
+        }
+    };
+
+    char* avx512(const ByteClass& ws, bool& previous, const char* src, char* dst, size_t n) {
+        CollapseAVX512 policy(ws, previous);
+        dst = (char*)filter::compact_avx512(policy, (const uint8_t*)src, (uint8_t*)dst, n);
+        previous = policy.previous;
+
+        return dst;
+    }
+#endif // __AVX512BW__
+
+} // namespace collapse
+
+
+char* collapse_whitespace_scalar(const char* src, char* dst, size_t n, const ByteClass& ws, bool& previous) {
+    return collapse::scalar(ws, previous, src, dst, n);
+}
+
+char* collapse_whitespace_ssse3(const char* src, char* dst, size_t n, const ByteClass& ws, bool& previous) {
+    return collapse::ssse3(ws, previous, src, dst, n);
+}
+
+#ifdef __AVX2__
+char* collapse_whitespace_avx2(const char* src, char* dst, size_t n, const ByteClass& ws, bool& previous) {
+    return collapse::avx2(ws, previous, src, dst, n);
+}
+#endif // __AVX2__
+
+#ifdef __AVX512BW__
+char* collapse_whitespace_avx512(const char* src, char* dst, size_t n, const ByteClass& ws, bool& previous) {
+    return collapse::avx512(ws, previous, src, dst, n);
+}
+#endif // __AVX512BW__
+
+
+// Applies the selected mode with the best kernel available at compile
+// time; consecutive calls process consecutive parts of a stream.
+class WhitespaceNormalizer {
+
+    const ByteClass whitespace;
+    const WhitespaceMode mode;
+    bool previous;
+
+public:
+    explicit WhitespaceNormalizer(WhitespaceMode mode_, const ByteClass& ws = ByteClass(" \t\r\n"))
+        : whitespace(ws)
+        , mode(mode_)
+        , previous(false) {}
+
+    // src == dst is allowed
+    char* process(const char* src, char* dst, size_t n) {
+        if (mode == WhitespaceMode::remove) {
+#if defined(__AVX512BW__)
+            return filter_delete_avx512(src, dst, n, whitespace);
+#elif defined(__AVX2__)
+            return filter_delete_avx2(src, dst, n, whitespace);
+#else
+            return filter_delete_ssse3(src, dst, n, whitespace);
+#endif
+        } else {
+#if defined(__AVX512BW__)
+            return collapse_whitespace_avx512(src, dst, n, whitespace, previous);
+#elif defined(__AVX2__)
+            return collapse_whitespace_avx2(src, dst, n, whitespace, previous);
+#else
+            return collapse_whitespace_ssse3(src, dst, n, whitespace, previous);
+#endif
+        }
+    }
+
+    static const char* kernel_name() {
+#if defined(__AVX512BW__)
+#   ifdef __AVX512VBMI2__
+        return "AVX512 (vpcompressb)";
+#   else
+        return "AVX512 (vpcompressd)";
+#   endif
+#elif defined(__AVX2__)
+        return "AVX2";
+#else
+        return "SSSE3";
+#endif
+    }
+};
+
+
+namespace stream {
+
+    struct Stats {
+        uint64_t bytes_read    = 0;
+        uint64_t bytes_written = 0;
+    };
+
+    class AlignedBuffer {
+        char* ptr;
+
+    public:
+        explicit AlignedBuffer(size_t size) : ptr(nullptr) {
+            if (posix_memalign(reinterpret_cast<void**>(&ptr), 4096, size) != 0) {
+                throw std::bad_alloc();
+            }
+        }
+
+        ~AlignedBuffer() {
+            free(ptr);
+        }
+
+        AlignedBuffer(const AlignedBuffer&) = delete;
+        AlignedBuffer& operator=(const AlignedBuffer&) = delete;
+
+        char* data() const {
+            return ptr;
+        }
+    };
+
+    [[noreturn]] void fail(const char* what) {
+        throw std::runtime_error(std::string(what) + ": " + strerror(errno));
+    }
+
+    // reads until the buffer is full or EOF
+    size_t read_full(int fd, char* buf, size_t size) {
+        size_t done = 0;
+        while (done < size) {
+            const ssize_t n = ::read(fd, buf + done, size - done);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                fail("read");
+            }
+
+            if (n == 0) {
+                break;
+            }
+
+            done += n;
+        }
+
+        return done;
+    }
+
+    void write_full(int fd, const char* buf, size_t size) {
+        while (size > 0) {
+            const ssize_t n = ::write(fd, buf, size);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                fail("write");
+            }
+
+            buf  += n;
+            size -= n;
+        }
+    }
+
+    // Two buffers: while the main thread compacts and writes one of them,
+    // a reader thread fills the other one.
+    class DoubleBuffer {
+
+        struct Slot {
+            size_t size;
+            bool   full;
+            bool   eof;
+        };
+
+        AlignedBuffer buffer0;
+        AlignedBuffer buffer1;
+        Slot slot[2];
+
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::string error;
+        bool cancelled;
+
+    public:
+        const size_t block_size;
+
+        explicit DoubleBuffer(size_t block_size_)
+            : buffer0(block_size_)
+            , buffer1(block_size_)
+            , cancelled(false)
+            , block_size(block_size_) {
+
+            slot[0] = slot[1] = Slot{0, false, false};
+        }
+
+        char* data(int k) const {
+            return (k == 0) ? buffer0.data() : buffer1.data();
+        }
+
+        void reader(int fd) {
+            for (int k=0; /**/; k ^= 1) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    changed.wait(lock, [this, k]{return !slot[k].full || cancelled;});
+                    if (cancelled) {
+                        return;
+                    }
+                }
+
+                size_t size = 0;
+                std::string failure;
+                try {
+                    size = read_full(fd, data(k), block_size);
+                } catch (std::exception& e) {
+                    failure = e.what();
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                slot[k].size = size;
+                slot[k].eof  = (size < block_size) || !failure.empty();
+                slot[k].full = true;
+                error = failure;
+                changed.notify_all();
+
+                if (slot[k].eof) {
+                    return;
+                }
+            }
+        }
+
+        // waits for the k-th buffer; returns its size and the EOF flag
+        size_t acquire(int k, bool& eof) {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [this, k]{return slot[k].full;});
+            if (!error.empty()) {
+                throw std::runtime_error(error);
+            }
+
+            eof = slot[k].eof;
+            return slot[k].size;
+        }
+
+        void release(int k) {
+            std::lock_guard<std::mutex> lock(mutex);
+            slot[k].full = false;
+            changed.notify_all();
+        }
+
+        void cancel() {
+            std::lock_guard<std::mutex> lock(mutex);
+            cancelled = true;
+            changed.notify_all();
+        }
+    };
+
+} // namespace stream
+
+
+// Reads input_fd in blocks of block_size bytes (a multiple of 4096),
+// normalizes them in-place and writes the result to output_fd.
+// Throws std::runtime_error on I/O errors.
+stream::Stats normalize_stream(int input_fd, int output_fd, WhitespaceNormalizer& normalizer,
+                               size_t block_size = 4*1024*1024) {
+
+    if (block_size == 0 || block_size % 4096 != 0) {
+        throw std::invalid_argument("block size must be a non-zero multiple of 4096");
+    }
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(input_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    stream::Stats stats;
+    stream::DoubleBuffer buffers(block_size);
+
+    std::thread reader([&buffers, input_fd]{buffers.reader(input_fd);});
+
+    try {
+        bool eof = false;
+        for (int k=0; !eof; k ^= 1) {
+            const size_t size = buffers.acquire(k, eof);
+
+            char* data = buffers.data(k);
+            char* end  = normalizer.process(data, data, size);
+
+            stream::write_full(output_fd, data, end - data);
+            buffers.release(k);
+
+            stats.bytes_read    += size;
+            stats.bytes_written += end - data;
+        }
+    } catch (...) {
+        buffers.cancel();
+        reader.join();
+        throw;
+    }
+
+    reader.join();
+
+    return stats;
+}
@@ -2,6 +2,9 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cassert>
+#include <string>
+#include <vector>
+#include <algorithm>
 
 #include "all.cpp"
 #include "ansi.cpp"
@@ -19,6 +22,9 @@ public:
             test_1_gap();
             test_2_gaps();
             test_random();
+            test_filter();
+            test_collapse();
+            test_stream();
 
             puts(ansi::seq("All OK", ansi::GREEN).c_str());
 
@@ -74,6 +80,167 @@ private:
     }
 
 
+    void test_filter() {
+        puts("test filter (random classes, lengths 0..300, in-place)");
+
+        const ByteClass fixed[] = {
+            ByteClass(" \r\n\t"),
+            ByteClass(",;\""),
+            ByteClass().add_range('0', '9').add_range('a', 'z'),
+            ByteClass().add_range(0x80, 0xff),
+            ByteClass().add(0x00).add(0x7f).add(0x80).add(0xff),
+            ByteClass(),
+            ByteClass().complement(),
+        };
+
+        for (const ByteClass& cls: fixed) {
+            test_filter(cls);
+        }
+
+        for (int k=0; k < 50; k++) {
+            ByteClass cls;
+            const int count = 1 + rand() % 64;
+            for (int i=0; i < count; i++) {
+                cls.add(uint8_t(rand()));
+            }
+
+            test_filter(cls);
+        }
+    }
+
+    void test_filter(const ByteClass& cls) {
+        std::vector<char> text(300);
+        for (size_t n=0; n <= text.size(); n++) {
+            // about a half of bytes is taken from the class
+            for (size_t i=0; i < n; i++) {
+                text[i] = char(rand());
+                for (int tries=0; tries < 256 && (rand() % 2) && !cls.contains(uint8_t(text[i])); tries++) {
+                    text[i] = char(rand());
+                }
+            }
+
+            compare_filter("delete SSSE3", filter_delete_scalar, filter_delete_ssse3, cls, text.data(), n);
+            compare_filter("keep SSSE3",   filter_keep_scalar,   filter_keep_ssse3,   cls, text.data(), n);
+            compare_filter("delete AVX2",  filter_delete_scalar, filter_delete_avx2,  cls, text.data(), n);
+            compare_filter("keep AVX2",    filter_keep_scalar,   filter_keep_avx2,    cls, text.data(), n);
+            compare_filter("delete AVX512",filter_delete_scalar, filter_delete_avx512,cls, text.data(), n);
+            compare_filter("keep AVX512",  filter_keep_scalar,   filter_keep_avx512,  cls, text.data(), n);
+        }
+    }
+
+    template <typename REFERENCE, typename FUNCTION>
+    void compare_filter(const char* name, REFERENCE reference, FUNCTION function,
+                        const ByteClass& cls, const char* text, size_t n) {
+
+        std::string expected(n, 0);
+        std::string result(n, 0);
+        std::string inplace(text, n);
+
+        expected.resize(reference(text, &expected[0], n, cls) - &expected[0]);
+        result.resize(function(text, &result[0], n, cls) - &result[0]);
+        inplace.resize(function(&inplace[0], &inplace[0], n, cls) - &inplace[0]);
+
+        if (result != expected || inplace != expected) {
+            printf("%s %s; n=%lu, len_ref=%lu, len=%lu, len_inplace=%lu\n",
+                   name, ansi::seq("FAILED", ansi::RED).c_str(), n,
+                   expected.size(), result.size(), inplace.size());
+
+            throw UnitTestsFailed{};
+        }
+    }
+
+    static std::string random_text(size_t n) {
+        // long runs of whitespace are frequent
+        const char* alphabet = "ab  \t\r\n\n    xyz.";
+        std::string text(n, 0);
+        for (size_t i=0; i < n; i++) {
+            text[i] = alphabet[rand() % 16];
+        }
+
+        return text;
+    }
+
+    void test_collapse() {
+        puts("test collapsing whitespace (random splits, in-place)");
+
+        const ByteClass ws(" \t\r\n");
+        for (int k=0; k < 200; k++) {
+            const std::string text = random_text(rand() % 1000);
+
+            std::string expected(text.size(), 0);
+            bool previous = false;
+            expected.resize(collapse_whitespace_scalar(text.data(), &expected[0], text.size(), ws, previous) - &expected[0]);
+
+            compare_collapse("collapse SSSE3",  collapse_whitespace_ssse3,  ws, text, expected);
+            compare_collapse("collapse AVX2",   collapse_whitespace_avx2,   ws, text, expected);
+            compare_collapse("collapse AVX512", collapse_whitespace_avx512, ws, text, expected);
+        }
+    }
+
+    template <typename FUNCTION>
+    void compare_collapse(const char* name, FUNCTION function, const ByteClass& ws,
+                          const std::string& text, const std::string& expected) {
+
+        // the text is processed in random chunks, in-place
+        std::string result(text);
+        bool previous = false;
+        char* dst = &result[0];
+        for (size_t i=0; i < text.size(); /**/) {
+            const size_t chunk = std::min(text.size() - i, size_t(rand() % 200));
+            dst = function(&result[i], dst, chunk, ws, previous);
+            i += chunk;
+        }
+        result.resize(dst - &result[0]);
+
+        if (result != expected) {
+            printf("%s %s; n=%lu, len_ref=%lu, len=%lu\n",
+                   name, ansi::seq("FAILED", ansi::RED).c_str(), text.size(),
+                   expected.size(), result.size());
+
+            throw UnitTestsFailed{};
+        }
+    }
+
+    void test_stream() {
+        puts("test normalize_stream");
+
+        const ByteClass ws(" \t\r\n");
+        const std::string text = random_text(100*1000 + 17);
+
+        for (WhitespaceMode mode: {WhitespaceMode::remove, WhitespaceMode::collapse}) {
+            std::string expected(text.size(), 0);
+            bool previous = false;
+            char* end = (mode == WhitespaceMode::remove)
+                      ? filter_delete_scalar(text.data(), &expected[0], text.size(), ws)
+                      : collapse_whitespace_scalar(text.data(), &expected[0], text.size(), ws, previous);
+            expected.resize(end - &expected[0]);
+
+            FILE* input  = tmpfile();
+            FILE* output = tmpfile();
+            fwrite(text.data(), 1, text.size(), input);
+            fflush(input);
+            rewind(input);
+
+            WhitespaceNormalizer normalizer(mode, ws);
+            const stream::Stats stats = normalize_stream(fileno(input), fileno(output), normalizer, 4096);
+
+            std::string result(stats.bytes_written, 0);
+            rewind(output);
+            const size_t n = fread(&result[0], 1, result.size(), output);
+
+            fclose(input);
+            fclose(output);
+
+            if (stats.bytes_read != text.size() || n != stats.bytes_written || result != expected) {
+                printf("normalize_stream %s; read=%lu, written=%lu, len_ref=%lu\n",
+                       ansi::seq("FAILED", ansi::RED).c_str(),
+                       stats.bytes_read, stats.bytes_written, expected.size());
+
+                throw UnitTestsFailed{};
+            }
+        }
+    }
+
     void compare() {
         compare("AVX512VBMI",                   remove_spaces__avx512vbmi);
         compare("AVX512VBMI (Travis)",          remove_spaces__avx512vbmi__travis);
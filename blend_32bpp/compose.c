@@ -0,0 +1,266 @@
+/*
+	Alpha compositing of 32bpp images --- 64-bit code
+
+	Operations (see compose_scalar.c): straight alpha blending, Porter-Duff
+	over (premultiplied alpha), in, out, and crossfading.  Each operation has
+	a scalar reference implementation, an AVX2 and an AVX512BW one; vector
+	implementations process images of any size and alignment, results are
+	exactly the same as the reference.
+
+	Usage:
+
+	$ ./compose verify
+	$ ./compose bench [iterations]
+
+	Author: Wojciech Muła
+	License: BSD
+*/
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "compose_scalar.c"
+#include "compose_avx2.c"
+#include "compose_avx512.c"
+
+
+typedef void (*compose_function)(uint32_t* dst, const uint32_t* src, size_t n);
+typedef void (*crossfade_function)(uint32_t* dst, const uint32_t* A, const uint32_t* B, size_t n, uint8_t alpha);
+
+
+typedef struct {
+	const char* name;
+	compose_function blend;
+	compose_function over;
+	compose_function in;
+	compose_function out;
+	crossfade_function crossfade;
+} Implementation;
+
+
+static const Implementation implementations[] = {
+	{"scalar", scalar_blend, scalar_over, scalar_in, scalar_out, scalar_crossfade},
+#if defined(__AVX2__)
+	{"AVX2", avx2_blend, avx2_over, avx2_in, avx2_out, avx2_crossfade},
+#endif
+#if defined(__AVX512BW__)
+	{"AVX512BW", avx512_blend, avx512_over, avx512_in, avx512_out, avx512_crossfade},
+#endif
+};
+
+#define IMPLEMENTATIONS (sizeof(implementations)/sizeof(implementations[0]))
+
+
+static const char* operation_name[] = {"blend", "over", "in", "out", "crossfade"};
+
+#define OPERATIONS 5
+
+
+compose_function get_operation(const Implementation* impl, int op) {
+	switch (op) {
+		case 0: return impl->blend;
+		case 1: return impl->over;
+		case 2: return impl->in;
+		case 3: return impl->out;
+		default:
+			return NULL;
+	}
+}
+
+
+void* alloc(size_t size) {
+	void* ptr = NULL;
+	if (posix_memalign(&ptr, 64, size) != 0) {
+		puts("ERROR: out of memory");
+		exit(EXIT_FAILURE);
+	}
+
+	return ptr;
+}
+
+
+static uint32_t seed = 1;
+
+uint32_t random32(void) {
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) | (seed << 16);
+}
+
+
+// random pixels; some of them have alpha 0 or 255
+void random_pixels(uint32_t* pixels, size_t n) {
+	for (size_t i=0; i < n; i++) {
+		uint32_t p = random32();
+		switch (random32() % 8) {
+			case 0: p &= 0x00ffffff; break;
+			case 1: p |= 0xff000000; break;
+		}
+
+		pixels[i] = p;
+	}
+}
+
+
+//=== verification =======================================================
+
+int verify(void) {
+	const size_t max_n   = 100;
+	const size_t max_ofs = 16;
+	const size_t size    = max_n + max_ofs;
+
+	uint32_t* src   = (uint32_t*)alloc(size * 4);
+	uint32_t* src2  = (uint32_t*)alloc(size * 4);
+	uint32_t* dst   = (uint32_t*)alloc(size * 4);
+	uint32_t* exp   = (uint32_t*)alloc(size * 4);
+	uint32_t* res   = (uint32_t*)alloc(size * 4);
+
+	int failed = 0;
+	for (size_t impl=1; impl < IMPLEMENTATIONS; impl++) {
+		const Implementation* I = &implementations[impl];
+
+		for (int op=0; op < OPERATIONS; op++) {
+			int ok = 1;
+			for (size_t n=0; n <= max_n && ok; n++) {
+				for (size_t ofs=0; ofs < max_ofs && ok; ofs++) {
+					random_pixels(src, size);
+					random_pixels(src2, size);
+					random_pixels(dst, size);
+					memcpy(exp, dst, size * 4);
+					memcpy(res, dst, size * 4);
+
+					// source is misaligned differently than destination
+					const size_t sofs = (ofs * 7) % max_ofs;
+					if (op == 4) {
+						const uint8_t alpha = random32();
+						scalar_crossfade(exp + ofs, src + sofs, src2 + ofs, n, alpha);
+						I->crossfade(res + ofs, src + sofs, src2 + ofs, n, alpha);
+					} else {
+						get_operation(&implementations[0], op)(exp + ofs, src + sofs, n);
+						get_operation(I, op)(res + ofs, src + sofs, n);
+					}
+
+					// also checks that nothing around is touched
+					if (memcmp(exp, res, size * 4) != 0) {
+						printf("%s %s: FAILED for n=%zu, offset=%zu\n", I->name, operation_name[op], n, ofs);
+						ok = 0;
+					}
+				}
+			}
+
+			// all alpha values with all pixel values
+			if (ok && op == 4) {
+				for (int alpha=0; alpha < 256 && ok; alpha++) {
+					for (int i=0; i < 64; i++) {
+						src[i]  = 0x01010101u * (uint32_t)((4*i + alpha) & 0xff);
+						src2[i] = 0x01010101u * (uint32_t)((4*i + 3*alpha) & 0xff);
+					}
+
+					scalar_crossfade(exp, src, src2, 64, alpha);
+					I->crossfade(res, src, src2, 64, alpha);
+					if (memcmp(exp, res, 64 * 4) != 0) {
+						printf("%s crossfade: FAILED for alpha=%d\n", I->name, alpha);
+						ok = 0;
+					}
+				}
+			}
+
+			if (ok)
+				printf("%s %s: OK\n", I->name, operation_name[op]);
+			else
+				failed = 1;
+		}
+	}
+
+	free(src);
+	free(src2);
+	free(dst);
+	free(exp);
+	free(res);
+
+	puts(failed ? "verification failed" : "all OK");
+	return failed;
+}
+
+
+//=== benchmark ==========================================================
+
+double get_time(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+int bench(int iterations) {
+	const int sizes[][2] = {{1920, 1080}, {2560, 1440}, {3840, 2160}, {7680, 4320}};
+
+	for (size_t s=0; s < sizeof(sizes)/sizeof(sizes[0]); s++) {
+		const size_t n = (size_t)sizes[s][0] * sizes[s][1];
+
+		uint32_t* src  = (uint32_t*)alloc(n * 4);
+		uint32_t* src2 = (uint32_t*)alloc(n * 4);
+		uint32_t* dst  = (uint32_t*)alloc(n * 4);
+		random_pixels(src, n);
+		random_pixels(src2, n);
+		random_pixels(dst, n);
+
+		printf("image %d x %d [ms]\n", sizes[s][0], sizes[s][1]);
+		printf("%-10s", "");
+		for (size_t impl=0; impl < IMPLEMENTATIONS; impl++)
+			printf(" %10s", implementations[impl].name);
+		putchar('\n');
+
+		for (int op=0; op < OPERATIONS; op++) {
+			printf("%-10s", operation_name[op]);
+			for (size_t impl=0; impl < IMPLEMENTATIONS; impl++) {
+				const Implementation* I = &implementations[impl];
+
+				double best = 1e30;
+				for (int k=0; k < iterations; k++) {
+					const double t1 = get_time();
+					if (op == 4)
+						I->crossfade(dst, src, src2, n, 100);
+					else
+						get_operation(I, op)(dst, src, n);
+					const double t2 = get_time();
+					if (t2 - t1 < best)
+						best = t2 - t1;
+				}
+
+				printf(" %10.3f", best * 1000);
+			}
+			putchar('\n');
+		}
+
+		free(src);
+		free(src2);
+		free(dst);
+	}
+
+	return 0;
+}
+
+
+int main(int argc, char* argv[]) {
+	if (argc >= 2 && strcmp(argv[1], "verify") == 0)
+		return verify();
+
+	if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+		const int iterations = (argc >= 3) ? atoi(argv[2]) : 5;
+		if (iterations <= 0) {
+			puts("iterations must be positive");
+			return 1;
+		}
+
+		return bench(iterations);
+	}
+
+	puts("1. progname verify");
+	puts("2. progname bench [iterations]");
+	return 1;
+}
@@ -0,0 +1,136 @@
+//=== AVX2 implementation =================================================
+
+/*
+	Products are calculated on 16-bit words; division by 255 with rounding
+	is done as (t + (t >> 8)) >> 8, where t = x + 128 --- it's exact for
+	all products of two bytes.
+
+	Interpolation x*w + y*(255 - w) uses PMADDUBSW.  Its second argument
+	is signed, thus weights w - 128 and 127 - w are used, and the missing
+	128*(x + y) is added; the weights have opposite signs, so PMADDUBSW
+	never saturates.
+
+	Unaligned destination is processed by scalar code until it gets
+	aligned, then vectors of 8 pixels are processed, and the tail is
+	again processed by scalar code.
+*/
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+// each byte of pixel gets the pixel's alpha
+static inline __m256i avx2_broadcast_alpha(__m256i pixels) {
+	const __m256i shuffle = _mm256_setr_epi8(
+		3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15,
+		3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+
+	return _mm256_shuffle_epi8(pixels, shuffle);
+}
+
+
+static inline __m256i avx2_div255_epu16(__m256i x) {
+	const __m256i t = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+	return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+
+// div255(x * y) for each byte
+static inline __m256i avx2_mul_div255(__m256i x, __m256i y) {
+	const __m256i zero = _mm256_setzero_si256();
+
+	const __m256i lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(x, zero), _mm256_unpacklo_epi8(y, zero));
+	const __m256i hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(x, zero), _mm256_unpackhi_epi8(y, zero));
+
+	return _mm256_packus_epi16(avx2_div255_epu16(lo), avx2_div255_epu16(hi));
+}
+
+
+// div255(x * w + y * (255 - w)) for each byte
+static inline __m256i avx2_lerp(__m256i x, __m256i y, __m256i w) {
+	const __m256i w0   = _mm256_xor_si256(w, _mm256_set1_epi8((int8_t)0x80));	// w - 128
+	const __m256i w1   = _mm256_xor_si256(w, _mm256_set1_epi8(0x7f));		// 127 - w
+	const __m256i ones = _mm256_set1_epi8(1);
+
+	const __m256i p_lo = _mm256_unpacklo_epi8(x, y);
+	const __m256i p_hi = _mm256_unpackhi_epi8(x, y);
+	const __m256i w_lo = _mm256_unpacklo_epi8(w0, w1);
+	const __m256i w_hi = _mm256_unpackhi_epi8(w0, w1);
+
+	const __m256i t_lo = _mm256_add_epi16(_mm256_maddubs_epi16(p_lo, w_lo),
+	                                      _mm256_slli_epi16(_mm256_maddubs_epi16(p_lo, ones), 7));
+	const __m256i t_hi = _mm256_add_epi16(_mm256_maddubs_epi16(p_hi, w_hi),
+	                                      _mm256_slli_epi16(_mm256_maddubs_epi16(p_hi, ones), 7));
+
+	return _mm256_packus_epi16(avx2_div255_epu16(t_lo), avx2_div255_epu16(t_hi));
+}
+
+
+static inline __m256i avx2_blend_kernel(__m256i s, __m256i d) {
+	// alpha of result: div255(255*a + d*(255 - a))
+	const __m256i s1 = _mm256_or_si256(s, _mm256_set1_epi32(0xff000000));
+	return avx2_lerp(s1, d, avx2_broadcast_alpha(s));
+}
+
+
+static inline __m256i avx2_over_kernel(__m256i s, __m256i d) {
+	const __m256i inv = _mm256_xor_si256(avx2_broadcast_alpha(s), _mm256_set1_epi8(-1));
+	return _mm256_adds_epu8(s, avx2_mul_div255(d, inv));
+}
+
+
+static inline __m256i avx2_in_kernel(__m256i s, __m256i d) {
+	return avx2_mul_div255(s, avx2_broadcast_alpha(d));
+}
+
+
+static inline __m256i avx2_out_kernel(__m256i s, __m256i d) {
+	const __m256i inv = _mm256_xor_si256(avx2_broadcast_alpha(d), _mm256_set1_epi8(-1));
+	return avx2_mul_div255(s, inv);
+}
+
+
+// pixels before the first 32-byte boundary of dst
+static inline size_t avx2_head(const uint32_t* dst, size_t n) {
+	const size_t head = ((32 - ((uintptr_t)dst & 31)) & 31) / 4;
+	return (head < n) ? head : n;
+}
+
+
+#define AVX2_COMPOSE(name)								\
+void avx2_##name(uint32_t* dst, const uint32_t* src, size_t n) {			\
+	size_t i = avx2_head(dst, n);							\
+	scalar_##name(dst, src, i);							\
+											\
+	for (/**/; i + 8 <= n; i += 8) {						\
+		const __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));	\
+		const __m256i d = _mm256_load_si256((const __m256i*)(dst + i));		\
+		_mm256_store_si256((__m256i*)(dst + i), avx2_##name##_kernel(s, d));	\
+	}										\
+											\
+	scalar_##name(dst + i, src + i, n - i);						\
+}
+
+AVX2_COMPOSE(blend)
+AVX2_COMPOSE(over)
+AVX2_COMPOSE(in)
+AVX2_COMPOSE(out)
+
+#undef AVX2_COMPOSE
+
+
+void avx2_crossfade(uint32_t* dst, const uint32_t* A, const uint32_t* B, size_t n, uint8_t alpha) {
+	const __m256i w = _mm256_set1_epi8((int8_t)alpha);
+
+	size_t i = avx2_head(dst, n);
+	scalar_crossfade(dst, A, B, i, alpha);
+
+	for (/**/; i + 8 <= n; i += 8) {
+		const __m256i a = _mm256_loadu_si256((const __m256i*)(A + i));
+		const __m256i b = _mm256_loadu_si256((const __m256i*)(B + i));
+		_mm256_store_si256((__m256i*)(dst + i), avx2_lerp(a, b, w));
+	}
+
+	scalar_crossfade(dst + i, A + i, B + i, n - i, alpha);
+}
+
+#endif // __AVX2__
@@ -0,0 +1,130 @@
+//=== AVX512BW implementation =============================================
+
+/*
+	The same algorithms as AVX2 (all instructions work within 128-bit
+	lanes), 16 pixels at once.  The unaligned head and the tail are
+	processed with masked loads and stores.
+*/
+
+#if defined(__AVX512BW__)
+#include <immintrin.h>
+
+static inline __m512i avx512_broadcast_alpha(__m512i pixels) {
+	const __m512i shuffle = _mm512_set4_epi32(0x0f0f0f0f, 0x0b0b0b0b, 0x07070707, 0x03030303);
+	return _mm512_shuffle_epi8(pixels, shuffle);
+}
+
+
+static inline __m512i avx512_div255_epu16(__m512i x) {
+	const __m512i t = _mm512_add_epi16(x, _mm512_set1_epi16(128));
+	return _mm512_srli_epi16(_mm512_add_epi16(t, _mm512_srli_epi16(t, 8)), 8);
+}
+
+
+static inline __m512i avx512_mul_div255(__m512i x, __m512i y) {
+	const __m512i zero = _mm512_setzero_si512();
+
+	const __m512i lo = _mm512_mullo_epi16(_mm512_unpacklo_epi8(x, zero), _mm512_unpacklo_epi8(y, zero));
+	const __m512i hi = _mm512_mullo_epi16(_mm512_unpackhi_epi8(x, zero), _mm512_unpackhi_epi8(y, zero));
+
+	return _mm512_packus_epi16(avx512_div255_epu16(lo), avx512_div255_epu16(hi));
+}
+
+
+static inline __m512i avx512_lerp(__m512i x, __m512i y, __m512i w) {
+	const __m512i w0   = _mm512_xor_si512(w, _mm512_set1_epi8((int8_t)0x80));
+	const __m512i w1   = _mm512_xor_si512(w, _mm512_set1_epi8(0x7f));
+	const __m512i ones = _mm512_set1_epi8(1);
+
+	const __m512i p_lo = _mm512_unpacklo_epi8(x, y);
+	const __m512i p_hi = _mm512_unpackhi_epi8(x, y);
+	const __m512i w_lo = _mm512_unpacklo_epi8(w0, w1);
+	const __m512i w_hi = _mm512_unpackhi_epi8(w0, w1);
+
+	const __m512i t_lo = _mm512_add_epi16(_mm512_maddubs_epi16(p_lo, w_lo),
+	                                      _mm512_slli_epi16(_mm512_maddubs_epi16(p_lo, ones), 7));
+	const __m512i t_hi = _mm512_add_epi16(_mm512_maddubs_epi16(p_hi, w_hi),
+	                                      _mm512_slli_epi16(_mm512_maddubs_epi16(p_hi, ones), 7));
+
+	return _mm512_packus_epi16(avx512_div255_epu16(t_lo), avx512_div255_epu16(t_hi));
+}
+
+
+static inline __m512i avx512_blend_kernel(__m512i s, __m512i d) {
+	const __m512i s1 = _mm512_or_si512(s, _mm512_set1_epi32(0xff000000));
+	return avx512_lerp(s1, d, avx512_broadcast_alpha(s));
+}
+
+
+static inline __m512i avx512_over_kernel(__m512i s, __m512i d) {
+	const __m512i inv = _mm512_xor_si512(avx512_broadcast_alpha(s), _mm512_set1_epi8(-1));
+	return _mm512_adds_epu8(s, avx512_mul_div255(d, inv));
+}
+
+
+static inline __m512i avx512_in_kernel(__m512i s, __m512i d) {
+	return avx512_mul_div255(s, avx512_broadcast_alpha(d));
+}
+
+
+static inline __m512i avx512_out_kernel(__m512i s, __m512i d) {
+	const __m512i inv = _mm512_xor_si512(avx512_broadcast_alpha(d), _mm512_set1_epi8(-1));
+	return avx512_mul_div255(s, inv);
+}
+
+
+static inline __mmask16 avx512_mask(size_t k) {
+	return (k >= 16) ? 0xffff : (__mmask16)((1u << k) - 1);
+}
+
+
+// the first block: up to the first 64-byte boundary of dst
+static inline size_t avx512_head(const uint32_t* dst, size_t n) {
+	size_t head = ((64 - ((uintptr_t)dst & 63)) & 63) / 4;
+	if (head == 0)
+		head = 16;
+
+	return (head < n) ? head : n;
+}
+
+
+#define AVX512_COMPOSE(name)								\
+void avx512_##name(uint32_t* dst, const uint32_t* src, size_t n) {			\
+	size_t i = 0;									\
+	size_t k = avx512_head(dst, n);							\
+	while (i < n) {									\
+		const __mmask16 m = avx512_mask(k);					\
+		const __m512i s = _mm512_maskz_loadu_epi32(m, src + i);			\
+		const __m512i d = _mm512_maskz_loadu_epi32(m, dst + i);			\
+		_mm512_mask_storeu_epi32(dst + i, m, avx512_##name##_kernel(s, d));	\
+											\
+		i += k;									\
+		k = (n - i < 16) ? n - i : 16;						\
+	}										\
+}
+
+AVX512_COMPOSE(blend)
+AVX512_COMPOSE(over)
+AVX512_COMPOSE(in)
+AVX512_COMPOSE(out)
+
+#undef AVX512_COMPOSE
+
+
+void avx512_crossfade(uint32_t* dst, const uint32_t* A, const uint32_t* B, size_t n, uint8_t alpha) {
+	const __m512i w = _mm512_set1_epi8((int8_t)alpha);
+
+	size_t i = 0;
+	size_t k = avx512_head(dst, n);
+	while (i < n) {
+		const __mmask16 m = avx512_mask(k);
+		const __m512i a = _mm512_maskz_loadu_epi32(m, A + i);
+		const __m512i b = _mm512_maskz_loadu_epi32(m, B + i);
+		_mm512_mask_storeu_epi32(dst + i, m, avx512_lerp(a, b, w));
+
+		i += k;
+		k = (n - i < 16) ? n - i : 16;
+	}
+}
+
+#endif // __AVX512BW__
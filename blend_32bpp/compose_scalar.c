@@ -0,0 +1,94 @@
+//=== reference implementation ===========================================
+
+/*
+	Pixels are 32-bit: bytes 0, 1, 2 are color components, byte 3 is alpha.
+	All results are rounded: div255(x) = round(x/255).
+
+	blend     --- straight (not premultiplied) alpha:
+	              dst = src*src.alpha + dst*(255 - src.alpha); alpha of
+	              result is composed like in operator over
+	over      --- Porter-Duff over, premultiplied pixels:
+	              dst = src + dst*(255 - src.alpha), saturated
+	in        --- Porter-Duff in:  dst = src*dst.alpha
+	out       --- Porter-Duff out: dst = src*(255 - dst.alpha)
+	crossfade --- dst = A*alpha + B*(255 - alpha)
+*/
+
+static inline uint32_t div255(uint32_t x) {
+	return (x + 127) / 255;
+}
+
+
+static inline uint32_t channel(uint32_t pixel, int c) {
+	return (pixel >> (8*c)) & 0xff;
+}
+
+
+void scalar_blend(uint32_t* dst, const uint32_t* src, size_t n) {
+	for (size_t i=0; i < n; i++) {
+		const uint32_t a = src[i] >> 24;
+
+		uint32_t result = 0;
+		for (int c=0; c < 4; c++) {
+			const uint32_t s = (c == 3) ? 255 : channel(src[i], c);
+			result |= div255(s * a + channel(dst[i], c) * (255 - a)) << (8*c);
+		}
+
+		dst[i] = result;
+	}
+}
+
+
+void scalar_over(uint32_t* dst, const uint32_t* src, size_t n) {
+	for (size_t i=0; i < n; i++) {
+		const uint32_t a = src[i] >> 24;
+
+		uint32_t result = 0;
+		for (int c=0; c < 4; c++) {
+			uint32_t v = channel(src[i], c) + div255(channel(dst[i], c) * (255 - a));
+			if (v > 255)
+				v = 255;
+
+			result |= v << (8*c);
+		}
+
+		dst[i] = result;
+	}
+}
+
+
+void scalar_in(uint32_t* dst, const uint32_t* src, size_t n) {
+	for (size_t i=0; i < n; i++) {
+		const uint32_t a = dst[i] >> 24;
+
+		uint32_t result = 0;
+		for (int c=0; c < 4; c++)
+			result |= div255(channel(src[i], c) * a) << (8*c);
+
+		dst[i] = result;
+	}
+}
+
+
+void scalar_out(uint32_t* dst, const uint32_t* src, size_t n) {
+	for (size_t i=0; i < n; i++) {
+		const uint32_t a = 255 - (dst[i] >> 24);
+
+		uint32_t result = 0;
+		for (int c=0; c < 4; c++)
+			result |= div255(channel(src[i], c) * a) << (8*c);
+
+		dst[i] = result;
+	}
+}
+
+
+void scalar_crossfade(uint32_t* dst, const uint32_t* A, const uint32_t* B, size_t n, uint8_t alpha) {
+	for (size_t i=0; i < n; i++) {
+		uint32_t result = 0;
+		for (int c=0; c < 4; c++)
+			result |= div255(channel(A[i], c) * alpha + channel(B[i], c) * (255 - alpha)) << (8*c);
+
+		dst[i] = result;
+	}
+}
@@ -18,7 +18,7 @@
 
 	X11 view program
 
-	$ gcc -IXscr -Iloadppm -DUSE_Xscr saturated_add.c Xscr/Xscr.c loadppm/load_ppm.c -lX11 -o program
+	$ gcc -IXscr -Iloadppm -DUSE_Xscr saturated_add.c Xscr/Xscr.c loadppm/netpbm.c -lX11 -o program
 
 	Additional libraries are available at github:
 	* https://github.com/WojciechMula/Xscr
@@ -546,7 +546,7 @@ define_blur_gray_img_fun(
 
 #ifdef USE_Xscr
 #	include "Xscr.h"
-#	include "load_ppm.h"
+#	include "netpbm.h"
 #endif
 
 #define IMG_WIDTH	640
@@ -672,8 +672,8 @@ void usage() {
 int main(int argc, char* argv[]) {
 
 #ifdef USE_Xscr
-	FILE* f;
-	int width, height, maxval, result;
+	NetpbmImage image;
+	int result;
 #endif
 	int count;
 
@@ -739,18 +739,15 @@ int main(int argc, char* argv[]) {
 	else
 	// progname view file_ppm_640x480
 	if (argc >= 3 && iskeyword("view", 1)) {
-		f = fopen(argv[2], "rb");
-		if (!f)
-			die("Can't open file %s\n", argv[2]);
-		
-		result = ppm_load_gray(f, &width, &height, &maxval, &data, 0, Weigted);
-		fclose(f);
+		result = netpbm_load(argv[2], NETPBM_GRAY8, 16, &image);
 		if (result < 0)
-			die("PPM error: %s\n", PPM_errormsg[-result]);
-		
-		if (width != IMG_WIDTH || height != IMG_HEIGHT)
+			die("PPM error: %s\n", netpbm_errormsg[-result]);
+
+		if (image.width != IMG_WIDTH || image.height != IMG_HEIGHT)
 			die("Image %dx%d required", IMG_WIDTH, IMG_HEIGHT);
 
+		data = image.data;
+
 		posix_memalign((void*)&img, 16, PIX_COUNT);
 		if (!img)
 			die("No free memory");
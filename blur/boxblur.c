@@ -0,0 +1,604 @@
+/*
+	What is it?
+	------------------------------------------------------------------------
+
+	Box blur with arbitrary radius, 64-bit code with intrinsics.
+
+	Each output pixel is the average of (2r+1) x (2r+1) input pixels,
+	pixels outside the image are replaced by the nearest edge pixel.
+	The filter is separable, thus it's done in two passes:
+
+	1. vertical --- for each column a running sum of 2r+1 pixels is kept;
+	   moving to the next row adds one pixel and subtracts one pixel, so
+	   the cost is O(1) per pixel regardless of radius. Columns are
+	   independent, thus a row of sums is processed with SIMD instructions
+	   (AVX2: 16 columns at once).
+
+	2. horizontal --- the image is transposed (cache-blocked), blurred
+	   vertically, and transposed back.
+
+	Both grayscale (8bpp) and RGBA (32bpp) images are supported; the
+	vertical pass treats an RGBA row simply as 4*width bytes, only the
+	transposition works on 32-bit pixels.
+
+	Each stage is split into bands of rows processed by separate threads.
+
+	Average is rounded: (sum + d/2)/d, where d = 2r+1; division is done
+	by exact integer multiplication (see divisor.c).
+
+	Usage
+	------------------------------------------------------------------------
+
+	$ ./boxblur bench width height radius gray|rgba [threads [repeat]]
+	$ ./boxblur verify
+
+	Author: Wojciech Muła
+	License: BSD
+*/
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <immintrin.h>
+
+#include "divisor.c"
+
+
+typedef struct {
+	uint8_t* data;
+	int width;		// in pixels
+	int height;
+	int bpp;		// bytes per pixel: 1 or 4
+} Image;
+
+
+int clamp(int x, int lo, int hi) {
+	return (x < lo) ? lo : (x > hi) ? hi : x;
+}
+
+
+//=== threads ==============================================================
+
+typedef void (*band_function)(void* ctx, int y0, int y1);
+
+typedef struct {
+	band_function fun;
+	void* ctx;
+	int y0, y1;
+} Band;
+
+
+void* band_thread(void* arg) {
+	Band* b = (Band*)arg;
+	b->fun(b->ctx, b->y0, b->y1);
+
+	return NULL;
+}
+
+
+// calls fun for bands [y0, y1) covering rows [0, rows)
+void parallel_bands(int threads, int rows, band_function fun, void* ctx) {
+	if (threads <= 1 || rows < 2 * threads) {
+		fun(ctx, 0, rows);
+		return;
+	}
+
+	pthread_t id[threads];
+	Band band[threads];
+	for (int i=0; i < threads; i++) {
+		band[i].fun = fun;
+		band[i].ctx = ctx;
+		band[i].y0  = (int)((int64_t)rows * i / threads);
+		band[i].y1  = (int)((int64_t)rows * (i + 1) / threads);
+	}
+
+	for (int i=1; i < threads; i++)
+		pthread_create(&id[i], NULL, band_thread, &band[i]);
+
+	band_thread(&band[0]);
+
+	for (int i=1; i < threads; i++)
+		pthread_join(id[i], NULL);
+}
+
+
+//=== vertical pass ========================================================
+
+typedef struct {
+	const uint8_t* src;
+	uint8_t* dst;
+	int width;		// in bytes
+	int height;
+	int radius;
+} VerticalPass;
+
+
+// computes dst row from sums, then updates sums: sums += add - sub
+void vertical_row(uint32_t* sums, uint8_t* dst, const uint8_t* add, const uint8_t* sub,
+                  int width, int radius) {
+
+	const Divisor div = divisor(2 * radius + 1);
+
+	int x = 0;
+#if defined(__AVX2__)
+	for (/**/; x + 16 <= width; x += 16) {
+		const __m256i s0 = _mm256_loadu_si256((const __m256i*)(sums + x));
+		const __m256i s1 = _mm256_loadu_si256((const __m256i*)(sums + x + 8));
+
+		const __m256i q0 = avx2_rounded_average(&div, s0);
+		const __m256i q1 = avx2_rounded_average(&div, s1);
+
+		// 16 x int32 => 16 x uint8
+		const __m256i w  = _mm256_permute4x64_epi64(_mm256_packus_epi32(q0, q1), 0xd8);
+		const __m256i b  = _mm256_permute4x64_epi64(_mm256_packus_epi16(w, w), 0x08);
+		_mm_storeu_si128((__m128i*)(dst + x), _mm256_castsi256_si128(b));
+
+		// update sums
+		const __m128i a  = _mm_loadu_si128((const __m128i*)(add + x));
+		const __m128i r  = _mm_loadu_si128((const __m128i*)(sub + x));
+		const __m256i a0 = _mm256_cvtepu8_epi32(a);
+		const __m256i a1 = _mm256_cvtepu8_epi32(_mm_srli_si128(a, 8));
+		const __m256i r0 = _mm256_cvtepu8_epi32(r);
+		const __m256i r1 = _mm256_cvtepu8_epi32(_mm_srli_si128(r, 8));
+
+		_mm256_storeu_si256((__m256i*)(sums + x),     _mm256_sub_epi32(_mm256_add_epi32(s0, a0), r0));
+		_mm256_storeu_si256((__m256i*)(sums + x + 8), _mm256_sub_epi32(_mm256_add_epi32(s1, a1), r1));
+	}
+#endif
+	for (/**/; x < width; x++) {
+		const uint32_t s = sums[x];
+		dst[x]  = rounded_average(&div, s);
+		sums[x] = s + add[x] - sub[x];
+	}
+}
+
+
+void vertical_band(void* ctx, int y0, int y1) {
+	const VerticalPass* p = (const VerticalPass*)ctx;
+
+	const int w = p->width;
+	const int r = p->radius;
+	const int last = p->height - 1;
+
+	uint32_t* sums = malloc(w * sizeof(uint32_t));
+	if (sums == NULL) {
+		puts("ERROR: out of memory");
+		exit(EXIT_FAILURE);
+	}
+
+	// window of row y0
+	memset(sums, 0, w * sizeof(uint32_t));
+	for (int k=-r; k <= r; k++) {
+		const uint8_t* row = p->src + (size_t)clamp(y0 + k, 0, last) * w;
+		for (int x=0; x < w; x++)
+			sums[x] += row[x];
+	}
+
+	for (int y=y0; y < y1; y++) {
+		const uint8_t* add = p->src + (size_t)clamp(y + r + 1, 0, last) * w;
+		const uint8_t* sub = p->src + (size_t)clamp(y - r, 0, last) * w;
+
+		vertical_row(sums, p->dst + (size_t)y * w, add, sub, w, r);
+	}
+
+	free(sums);
+}
+
+
+//=== transposition ========================================================
+
+typedef struct {
+	const uint8_t* src;
+	uint8_t* dst;
+	int width;		// of src, in pixels
+	int height;
+} Transpose;
+
+#define TRANSPOSE_BLOCK 32
+
+
+// transposes 16x16 bytes
+void transpose8_16x16(const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride) {
+	__m128i a[16], b[16];
+
+	for (int i=0; i < 16; i++)
+		a[i] = _mm_loadu_si128((const __m128i*)(src + i * src_stride));
+
+	// four rounds of interleaving: bytes, words, dwords and qwords
+	for (int i=0; i < 8; i++) {
+		b[2*i + 0] = _mm_unpacklo_epi8(a[2*i], a[2*i + 1]);
+		b[2*i + 1] = _mm_unpackhi_epi8(a[2*i], a[2*i + 1]);
+	}
+
+	for (int i=0; i < 4; i++)
+		for (int j=0; j < 2; j++) {
+			a[4*i + 2*j + 0] = _mm_unpacklo_epi16(b[4*i + j], b[4*i + j + 2]);
+			a[4*i + 2*j + 1] = _mm_unpackhi_epi16(b[4*i + j], b[4*i + j + 2]);
+		}
+
+	for (int i=0; i < 2; i++)
+		for (int j=0; j < 4; j++) {
+			b[8*i + 2*j + 0] = _mm_unpacklo_epi32(a[8*i + j], a[8*i + j + 4]);
+			b[8*i + 2*j + 1] = _mm_unpackhi_epi32(a[8*i + j], a[8*i + j + 4]);
+		}
+
+	for (int j=0; j < 8; j++) {
+		a[2*j + 0] = _mm_unpacklo_epi64(b[j], b[j + 8]);
+		a[2*j + 1] = _mm_unpackhi_epi64(b[j], b[j + 8]);
+	}
+
+	for (int i=0; i < 16; i++)
+		_mm_storeu_si128((__m128i*)(dst + i * dst_stride), a[i]);
+}
+
+
+void transpose8_band(void* ctx, int y0, int y1) {
+	const Transpose* t = (const Transpose*)ctx;
+
+	const size_t W = t->width;
+	const size_t H = t->height;
+
+	for (int by=y0; by < y1; by += TRANSPOSE_BLOCK) {
+		const int ey = (by + TRANSPOSE_BLOCK < y1) ? by + TRANSPOSE_BLOCK : y1;
+		for (int bx=0; bx < t->width; bx += TRANSPOSE_BLOCK) {
+			const int ex = (bx + TRANSPOSE_BLOCK < t->width) ? bx + TRANSPOSE_BLOCK : t->width;
+
+			int y = by;
+			// 16x16 pixel blocks
+			for (/**/; y + 16 <= ey; y += 16) {
+				int x = bx;
+				for (/**/; x + 16 <= ex; x += 16)
+					transpose8_16x16(t->src + y * W + x, W, t->dst + x * H + y, H);
+
+				for (/**/; x < ex; x++)
+					for (int k=0; k < 16; k++)
+						t->dst[x * H + y + k] = t->src[(y + k) * W + x];
+			}
+
+			for (/**/; y < ey; y++)
+				for (int x=bx; x < ex; x++)
+					t->dst[x * H + y] = t->src[y * W + x];
+		}
+	}
+}
+
+
+void transpose32_band(void* ctx, int y0, int y1) {
+	const Transpose* t = (const Transpose*)ctx;
+	const uint32_t* src = (const uint32_t*)t->src;
+	uint32_t* dst = (uint32_t*)t->dst;
+
+	const size_t W = t->width;
+	const size_t H = t->height;
+
+	for (int by=y0; by < y1; by += TRANSPOSE_BLOCK) {
+		const int ey = (by + TRANSPOSE_BLOCK < y1) ? by + TRANSPOSE_BLOCK : y1;
+		for (int bx=0; bx < t->width; bx += TRANSPOSE_BLOCK) {
+			const int ex = (bx + TRANSPOSE_BLOCK < t->width) ? bx + TRANSPOSE_BLOCK : t->width;
+
+			int y = by;
+			// 4x4 pixel blocks
+			for (/**/; y + 4 <= ey; y += 4) {
+				int x = bx;
+				for (/**/; x + 4 <= ex; x += 4) {
+					__m128 r0 = _mm_loadu_ps((const float*)(src + (y + 0) * W + x));
+					__m128 r1 = _mm_loadu_ps((const float*)(src + (y + 1) * W + x));
+					__m128 r2 = _mm_loadu_ps((const float*)(src + (y + 2) * W + x));
+					__m128 r3 = _mm_loadu_ps((const float*)(src + (y + 3) * W + x));
+					_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+					_mm_storeu_ps((float*)(dst + (x + 0) * H + y), r0);
+					_mm_storeu_ps((float*)(dst + (x + 1) * H + y), r1);
+					_mm_storeu_ps((float*)(dst + (x + 2) * H + y), r2);
+					_mm_storeu_ps((float*)(dst + (x + 3) * H + y), r3);
+				}
+
+				for (/**/; x < ex; x++)
+					for (int k=0; k < 4; k++)
+						dst[x * H + y + k] = src[(y + k) * W + x];
+			}
+
+			for (/**/; y < ey; y++)
+				for (int x=bx; x < ex; x++)
+					dst[x * H + y] = src[y * W + x];
+		}
+	}
+}
+
+
+//=== the whole filter =====================================================
+
+typedef struct {
+	int threads;
+	uint8_t* tmp1;	// image-sized buffers
+	uint8_t* tmp2;
+} BlurContext;
+
+
+void vertical_pass(const BlurContext* c, const uint8_t* src, uint8_t* dst,
+                   int width, int height, int bpp, int radius) {
+	VerticalPass p;
+	p.src    = src;
+	p.dst    = dst;
+	p.width  = width * bpp;
+	p.height = height;
+	p.radius = radius;
+
+	parallel_bands(c->threads, height, vertical_band, &p);
+}
+
+
+void transpose(const BlurContext* c, const uint8_t* src, uint8_t* dst,
+               int width, int height, int bpp) {
+	Transpose t;
+	t.src    = src;
+	t.dst    = dst;
+	t.width  = width;
+	t.height = height;
+
+	parallel_bands(c->threads, height, (bpp == 4) ? transpose32_band : transpose8_band, &t);
+}
+
+
+// dst may be the same as src
+void box_blur(const BlurContext* c, const Image* src, Image* dst, int radius) {
+	const int w = src->width;
+	const int h = src->height;
+	const int bpp = src->bpp;
+
+	vertical_pass(c, src->data, c->tmp1, w, h, bpp, radius);
+	transpose(c, c->tmp1, c->tmp2, w, h, bpp);
+	vertical_pass(c, c->tmp2, c->tmp1, h, w, bpp, radius);
+	transpose(c, c->tmp1, dst->data, h, w, bpp);
+}
+
+
+//=== reference implementation ==============================================
+
+// the same order of passes and rounding as box_blur
+void box_blur_reference(const Image* src, Image* dst, int radius) {
+	const int w = src->width;
+	const int h = src->height;
+	const int bpp = src->bpp;
+	const uint32_t d = 2 * radius + 1;
+
+	uint8_t* tmp = malloc((size_t)w * h * bpp);
+
+	for (int y=0; y < h; y++)
+		for (int x=0; x < w * bpp; x++) {
+			uint32_t sum = 0;
+			for (int k=-radius; k <= radius; k++)
+				sum += src->data[(size_t)clamp(y + k, 0, h - 1) * w * bpp + x];
+
+			tmp[(size_t)y * w * bpp + x] = (sum + d/2) / d;
+		}
+
+	for (int y=0; y < h; y++)
+		for (int x=0; x < w; x++)
+			for (int c=0; c < bpp; c++) {
+				uint32_t sum = 0;
+				for (int k=-radius; k <= radius; k++)
+					sum += tmp[((size_t)y * w + clamp(x + k, 0, w - 1)) * bpp + c];
+
+				dst->data[((size_t)y * w + x) * bpp + c] = (sum + d/2) / d;
+			}
+
+	free(tmp);
+}
+
+
+//=== main program =========================================================
+
+void die(const char* fmt, ...) {
+	va_list ap;
+
+	va_start(ap, fmt);
+	vprintf(fmt, ap);
+	putchar('\n');
+	va_end(ap);
+
+	exit(EXIT_FAILURE);
+}
+
+
+uint8_t* alloc_image(int width, int height, int bpp) {
+	void* ptr = NULL;
+	if (posix_memalign(&ptr, 64, (size_t)width * height * bpp) != 0)
+		die("No free memory");
+
+	return (uint8_t*)ptr;
+}
+
+
+void random_image(Image* img) {
+	const size_t n = (size_t)img->width * img->height * img->bpp;
+	uint32_t seed = 12345;
+	for (size_t i=0; i < n; i++) {
+		seed = seed * 1103515245 + 12345;
+		img->data[i] = seed >> 24;
+	}
+}
+
+
+double get_time(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+// all possible sums for a few divisors, including the largest ones
+int verify_division(void) {
+	const int radii[] = {0, 1, 2, 100, 8191, 13164, 16383};
+
+	for (size_t r=0; r < sizeof(radii)/sizeof(radii[0]); r++) {
+		const Divisor div = divisor(2 * radii[r] + 1);
+		const uint32_t max_sum = 255 * div.d;
+
+		for (uint32_t s=0; s <= max_sum; s++) {
+			const uint32_t expected = (s + div.d/2) / div.d;
+			if (rounded_average(&div, s) != expected) {
+				printf("FAILED: radius=%d sum=%u\n", radii[r], s);
+				return 1;
+			}
+		}
+
+#if defined(__SSE4_1__)
+		for (uint32_t s=0; s <= max_sum; s += 4) {
+			uint32_t q[4];
+			_mm_storeu_si128((__m128i*)q, sse41_rounded_average(&div, _mm_add_epi32(_mm_set1_epi32(s), _mm_setr_epi32(0, 1, 2, 3))));
+			for (int i=0; i < 4; i++) {
+				const uint32_t expected = (s + i + div.d/2) / div.d;
+				if (q[i] != expected) {
+					printf("FAILED: SSE4.1 radius=%d sum=%u\n", radii[r], s + i);
+					return 1;
+				}
+			}
+		}
+#endif
+
+#if defined(__AVX2__)
+		for (uint32_t s=0; s <= max_sum; s += 8) {
+			uint32_t q[8];
+			_mm256_storeu_si256((__m256i*)q, avx2_rounded_average(&div, _mm256_add_epi32(_mm256_set1_epi32(s), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7))));
+			for (int i=0; i < 8; i++) {
+				const uint32_t expected = (s + i + div.d/2) / div.d;
+				if (q[i] != expected) {
+					printf("FAILED: AVX2 radius=%d sum=%u\n", radii[r], s + i);
+					return 1;
+				}
+			}
+		}
+#endif
+	}
+
+	return 0;
+}
+
+
+int verify(void) {
+	const int sizes[][2] = {{1, 1}, {7, 5}, {33, 17}, {64, 64}, {127, 45}, {250, 3}};
+	const int radii[] = {0, 1, 2, 5, 16, 100};
+
+	int failed = verify_division();
+	for (size_t s=0; s < sizeof(sizes)/sizeof(sizes[0]); s++) {
+		for (int bpp=1; bpp <= 4; bpp += 3) {
+			for (size_t r=0; r < sizeof(radii)/sizeof(radii[0]); r++) {
+				for (int threads=1; threads <= 3; threads += 2) {
+					Image src = {NULL, sizes[s][0], sizes[s][1], bpp};
+					Image dst = src;
+					Image ref = src;
+					src.data = alloc_image(src.width, src.height, bpp);
+					dst.data = alloc_image(src.width, src.height, bpp);
+					ref.data = alloc_image(src.width, src.height, bpp);
+					random_image(&src);
+
+					BlurContext c;
+					c.threads = threads;
+					c.tmp1 = alloc_image(src.width, src.height, bpp);
+					c.tmp2 = alloc_image(src.width, src.height, bpp);
+
+					box_blur(&c, &src, &dst, radii[r]);
+					box_blur_reference(&src, &ref, radii[r]);
+
+					if (memcmp(dst.data, ref.data, (size_t)src.width * src.height * bpp) != 0) {
+						printf("FAILED: %dx%d bpp=%d radius=%d threads=%d\n",
+						       src.width, src.height, bpp, radii[r], threads);
+						failed = 1;
+					}
+
+					free(c.tmp1);
+					free(c.tmp2);
+					free(src.data);
+					free(dst.data);
+					free(ref.data);
+				}
+			}
+		}
+	}
+
+	puts(failed ? "verification failed" : "all OK");
+	return failed;
+}
+
+
+int bench(int width, int height, int radius, int bpp, int threads, int repeat) {
+	Image src = {alloc_image(width, height, bpp), width, height, bpp};
+	Image dst = {alloc_image(width, height, bpp), width, height, bpp};
+	random_image(&src);
+	memset(dst.data, 0, (size_t)width * height * bpp);
+
+	BlurContext c;
+	c.threads = threads;
+	c.tmp1 = alloc_image(width, height, bpp);
+	c.tmp2 = alloc_image(width, height, bpp);
+	memset(c.tmp1, 0, (size_t)width * height * bpp);
+	memset(c.tmp2, 0, (size_t)width * height * bpp);
+
+	double best = 1e30;
+	for (int i=0; i < repeat; i++) {
+		const double t1 = get_time();
+		box_blur(&c, &src, &dst, radius);
+		const double t2 = get_time();
+		if (t2 - t1 < best)
+			best = t2 - t1;
+	}
+
+	const double pixels = (double)width * height;
+	printf("%5d x %-5d %-4s radius %4d threads %2d: %8.3f ms, %7.1f Mpix/s\n",
+	       width, height, (bpp == 4) ? "rgba" : "gray", radius, threads,
+	       best * 1000, pixels / best / 1e6);
+
+	free(c.tmp1);
+	free(c.tmp2);
+	free(src.data);
+	free(dst.data);
+
+	return 0;
+}
+
+
+void usage(void) {
+	puts("boxblur bench width height radius gray|rgba [threads [repeat]]");
+	puts("boxblur verify");
+}
+
+
+int main(int argc, char* argv[]) {
+
+	if (argc >= 2 && strcmp(argv[1], "verify") == 0)
+		return verify();
+
+	if (argc >= 6 && strcmp(argv[1], "bench") == 0) {
+		const int width  = atoi(argv[2]);
+		const int height = atoi(argv[3]);
+		const int radius = atoi(argv[4]);
+		int bpp = 0;
+		if (strcmp(argv[5], "gray") == 0)
+			bpp = 1;
+		if (strcmp(argv[5], "rgba") == 0)
+			bpp = 4;
+
+		const int threads = (argc >= 7) ? atoi(argv[6]) : sysconf(_SC_NPROCESSORS_ONLN);
+		const int repeat  = (argc >= 8) ? atoi(argv[7]) : 5;
+
+		if (width <= 0 || height <= 0 || bpp == 0 || threads <= 0 || repeat <= 0)
+			die("Invalid arguments");
+		if (radius < 0 || radius > BLUR_MAX_RADIUS)
+			die("Radius must be in range 0..%d", BLUR_MAX_RADIUS);
+
+		return bench(width, height, radius, bpp, threads, repeat);
+	}
+
+	usage();
+	return 1;
+}
+
+/*
+vim: ts=4 sw=4 nowrap noexpandtab
+*/
@@ -0,0 +1,83 @@
+//=== exact division of box sums ===========================================
+
+/*
+	Average of d = 2r+1 bytes is rounded: (sum + d/2)/d.  Division is done
+	by multiplication: n/d = (n * m) >> k, where k = 23 + ceil(log2 d) and
+	m = floor(2^k/d) + 1 < 2^32.  The result is exact if n * (m*d - 2^k)
+	< 2^k; since n < 256*d and m*d - 2^k <= d, it holds for d < 2^15,
+	i.e. radius up to BLUR_MAX_RADIUS (checked exhaustively, too).
+
+	Multiplication by a reciprocal in single precision is not enough, it
+	gives wrong results from radius 13164.
+
+	Used by boxblur.c and ../image-pipeline.
+*/
+
+#include <stdint.h>
+#if defined(__SSE4_1__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#define BLUR_MAX_RADIUS 16383
+
+typedef struct {
+	uint32_t d;
+	uint32_t mul;
+	int shift;
+} Divisor;
+
+
+Divisor divisor(uint32_t d) {
+	int log2 = 0;
+	while ((1u << log2) < d)
+		log2 += 1;
+
+	Divisor div;
+	div.d     = d;
+	div.shift = 23 + log2;
+	div.mul   = (uint32_t)((1ull << div.shift) / d + 1);
+
+	return div;
+}
+
+
+// (s + d/2) / d
+static inline uint8_t rounded_average(const Divisor* div, uint32_t s) {
+	return (uint8_t)(((uint64_t)(s + div->d / 2) * div->mul) >> div->shift);
+}
+
+
+/*
+	SIMD: n is shifted left by 38 - k, then products are shifted by the
+	constant 38; the results of odd lanes need only 6-bit shift to land
+	in the high dwords.
+*/
+
+#if defined(__SSE4_1__)
+static inline __m128i sse41_rounded_average(const Divisor* div, __m128i s) {
+	const __m128i half  = _mm_set1_epi32(div->d / 2);
+	const __m128i mul   = _mm_set1_epi32(div->mul);
+	const __m128i scale = _mm_cvtsi32_si128(38 - div->shift);
+
+	const __m128i n    = _mm_sll_epi32(_mm_add_epi32(s, half), scale);
+	const __m128i even = _mm_srli_epi64(_mm_mul_epu32(n, mul), 38);
+	const __m128i odd  = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(n, 32), mul), 6);
+
+	return _mm_blend_epi16(even, odd, 0xcc);
+}
+#endif // __SSE4_1__
+
+
+#if defined(__AVX2__)
+static inline __m256i avx2_rounded_average(const Divisor* div, __m256i s) {
+	const __m256i half  = _mm256_set1_epi32(div->d / 2);
+	const __m256i mul   = _mm256_set1_epi32(div->mul);
+	const __m128i scale = _mm_cvtsi32_si128(38 - div->shift);
+
+	const __m256i n    = _mm256_sll_epi32(_mm256_add_epi32(s, half), scale);
+	const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(n, mul), 38);
+	const __m256i odd  = _mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(n, 32), mul), 6);
+
+	return _mm256_blend_epi32(even, odd, 0xaa);
+}
+#endif // __AVX2__
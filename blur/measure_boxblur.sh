@@ -0,0 +1,26 @@
+log=boxblur.log
+threads=$(nproc)
+
+rm -f $log
+for program in ./boxblur ./boxblur_avx2
+do
+    for size in "3840 2160" "7680 4320"
+    do
+        for format in gray rgba
+        do
+            for radius in 1 5 25 100
+            do
+                echo "$program $size $format $radius..."
+                echo -n "${program#./} " >> $log
+                $program bench $size $radius $format 1 >> $log
+                if [ $threads -gt 1 ]
+                then
+                    echo -n "${program#./} " >> $log
+                    $program bench $size $radius $format $threads >> $log
+                fi
+            done
+        done
+    done
+done
+
+cat $log
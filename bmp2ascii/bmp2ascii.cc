@@ -23,6 +23,8 @@
 #include <sys/ioctl.h>
 #include <sys/kd.h>
 
+#include "../loadppm/netpbm.h"
+
 extern int errno;
 
 // size of character cell (standard 80x25 EGA mode)
@@ -54,6 +56,7 @@ void get_EGA_font(unsigned char font[256][32]);
 
 // guess
 void parse_opt(int argc, char* argv[]);
+void print_help();
 
 // convert data from `image_row' (pixels) into `char_row' (characters)
 void ASCII();
@@ -63,40 +66,70 @@ int main(int argc, char* argv[])
  parse_opt(argc, argv);
  get_EGA_font(font);
 
- cx = (width  + cellx-1)/cellx; // size of output image
- cy = (height + celly-1)/celly; // in character cells
-
- errno = 0;
- FILE *file = fopen(filename, "r");
- if (errno)
+ // PBM files (P4) are mapped, any other file is read as raw bits
+ NetpbmFile pbm;
+ bool is_pbm = (netpbm_open(&pbm, filename) == NETPBM_OK);
+ if (is_pbm && pbm.pixels.format != NETPBM_P4)
  	{
-	 printf("open: %s\n",strerror(errno));
-	 exit(1);
+	 netpbm_close(&pbm);
+	 is_pbm = false;
 	}
-
- struct stat buf;
- stat(filename, &buf);
- if (errno)
+ if (is_pbm)
  	{
-	 printf("stat: %s\n", strerror(errno));
-	 exit(1);
+	 width  = ((pbm.pixels.width + cellx-1)/cellx)*cellx;
+	 height = pbm.pixels.height;
 	}
-	
- // skip header, in fact input data can be any bin file
- fseek(file, buf.st_size-(width*height)/cellx, SEEK_SET);
- if (errno)
+ if ((width < 0 || width > 2048) || height < 0)
  	{
-	 printf("seek: %s\n", strerror(errno));
+	 puts("bad width or height\n");
+	 print_help();
 	 exit(1);
 	}
- 
+
+ cx = (width  + cellx-1)/cellx; // size of output image
+ cy = (height + celly-1)/celly; // in character cells
+
+ FILE *file = NULL;
+ if (!is_pbm)
+ 	{
+	 errno = 0;
+	 file = fopen(filename, "r");
+	 if (errno)
+	 	{
+		 printf("open: %s\n",strerror(errno));
+		 exit(1);
+		}
+
+	 struct stat buf;
+	 stat(filename, &buf);
+	 if (errno)
+	 	{
+		 printf("stat: %s\n", strerror(errno));
+		 exit(1);
+		}
+
+	 // skip header, in fact input data can be any bin file
+	 fseek(file, buf.st_size-(width*height)/cellx, SEEK_SET);
+	 if (errno)
+	 	{
+		 printf("seek: %s\n", strerror(errno));
+		 exit(1);
+		}
+	}
+
  char_row[cx] = '\0';
+ int row = 0;
  for (int y=0; y<cy; y++)
  	{
-	 for (int n=0; n<celly; n++)
+	 for (int n=0; n<celly; n++, row++)
 	 	{
 		 memset(image_row[n], 0, sizeof(image_row[0]));
-		 if (height--)
+		 if (row >= height)
+		 	continue;
+
+		 if (is_pbm)
+		 	memcpy(image_row[n], pbm.pixels.data + row*pbm.pixels.stride, pbm.pixels.stride);
+		 else
  	    	    fread(image_row[n], cx, 1, file);
 		}
 
@@ -104,7 +137,11 @@ int main(int argc, char* argv[])
 
 	 puts(char_row);
 	}
- fclose(file);
+
+ if (is_pbm)
+ 	netpbm_close(&pbm);
+ else
+ 	fclose(file);
  
  return 0;
 }
@@ -143,8 +180,8 @@ void ASCII()
 void print_help()
 {
  puts("bmp2ascii usage:\n"
-      "-w=width   -- width of image\n"
-      "-h=height  -- height of image\n"
+      "-w=width   -- width of image (not needed for .pbm files)\n"
+      "-h=height  -- height of image (not needed for .pbm files)\n"
       "-s=lLns    -- sets of chars using to build image\n"
       "              * l - small leters\n"
       "              * L - big letters\n"
@@ -238,12 +275,6 @@ void parse_opt(int argc, char* argv[])
 	 
 	}
 
- if ((width < 0 || width > 2048) || height < 0)
- 	{
- 	 puts("bad width or height\n");
-	 print_help();
-	 exit(1);
-	}
  if (*filename == '\0')
  	{
 	 puts("no filename\n");
@@ -265,7 +296,8 @@ void parse_opt(int argc, char* argv[])
 		}
 	}
  strcat(set, " ");
- width = ((width+cellx-1)/cellx)*cellx;
+ if (width > 0)
+ 	width = ((width+cellx-1)/cellx)*cellx;
 }
 
 void get_EGA_font(unsigned char font[256][32])
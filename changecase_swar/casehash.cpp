@@ -0,0 +1,137 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/*
+    Case-insensitive (ASCII) hashing and comparison, word-at-a-time.
+
+    Words of 8 bytes are lowercased with swar::to_lower_ascii_mask, strings
+    of 32 bytes or longer are processed in steps of four words, each hashed
+    in a separate lane. Bytes >= 0x80 are never altered, so the functions
+    are safe for any input, like HTTP header names with obs-text.
+
+    The hash function is not FNV: mixing a whole word at once (multiply and
+    rotate) is what makes it faster than FNV32::get after a lowering pass.
+*/
+
+namespace ci {
+
+    inline uint64_t load_word(const char* s) {
+        uint64_t w;
+        memcpy(&w, s, 8);
+        return w;
+    }
+
+    inline uint64_t load_u32(const char* s) {
+        uint32_t w;
+        memcpy(&w, s, 4);
+        return w;
+    }
+
+    // the last r = 1..7 bytes of string of length n, the rest of word is
+    // zero; no byte outside the string is touched and no memcpy with
+    // a variable size (i.e. a library call) is needed
+    inline uint64_t load_tail(const char* s, size_t n, size_t r) {
+        if (n >= 8) {
+            // overlapping load of the last word
+            return load_word(s + n - 8) >> (8 * (8 - r));
+        }
+
+        const char* t = s + n - r;
+        if (r >= 4) {
+            // two overlapping 32-bit loads; the common bytes are equal
+            return load_u32(t) | (load_u32(t + r - 4) << (8 * (r - 4)));
+        }
+
+        return uint64_t(uint8_t(t[0]))
+             | (uint64_t(uint8_t(t[r / 2])) << (8 * (r / 2)))
+             | (uint64_t(uint8_t(t[r - 1])) << (8 * (r - 1)));
+    }
+
+    inline uint64_t to_lower(uint64_t w) {
+        // the mask computed for 7-bit values, then cleared for non-ASCII bytes
+        const uint64_t mask = swar::to_lower_ascii_mask(w & packed_byte(0x7f)) & ~w;
+
+        return w ^ (mask >> 2);
+    }
+
+    inline uint64_t rotl(uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    const uint64_t k0 = 0x9e3779b97f4a7c15ull;
+    const uint64_t k1 = 0xc2b2ae3d27d4eb4full;
+
+    inline uint64_t mix(uint64_t h, uint64_t w) {
+        return rotl((h ^ w) * k0, 29);
+    }
+
+    inline uint64_t finalize(uint64_t h) {
+        h ^= h >> 32;
+        h *= k1;
+        h ^= h >> 29;
+
+        return h;
+    }
+
+    uint64_t hash(const char* s, size_t n) {
+        uint64_t h = n * k1;
+        size_t i = 0;
+
+        if (n >= 32) {
+            uint64_t h0 = h;
+            uint64_t h1 = h + 1;
+            uint64_t h2 = h + 2;
+            uint64_t h3 = h + 3;
+            for (/**/; i + 32 <= n; i += 32) {
+                h0 = mix(h0, to_lower(load_word(s + i +  0)));
+                h1 = mix(h1, to_lower(load_word(s + i +  8)));
+                h2 = mix(h2, to_lower(load_word(s + i + 16)));
+                h3 = mix(h3, to_lower(load_word(s + i + 24)));
+            }
+
+            h = h0 ^ rotl(h1, 16) ^ rotl(h2, 32) ^ rotl(h3, 48);
+        }
+
+        for (/**/; i + 8 <= n; i += 8) {
+            h = mix(h, to_lower(load_word(s + i)));
+        }
+
+        if (i < n) {
+            h = mix(h, to_lower(load_tail(s, n, n - i)));
+        }
+
+        return finalize(h);
+    }
+
+    // Differences are accumulated without branches; the input case
+    // is random, thus checking words one by one would mispredict.
+    bool equal(const char* a, const char* b, size_t n) {
+        uint64_t diff = 0;
+        size_t i = 0;
+        for (/**/; i + 8 <= n; i += 8) {
+            diff |= to_lower(load_word(a + i)) ^ to_lower(load_word(b + i));
+        }
+
+        if (i < n) {
+            diff |= to_lower(load_tail(a, n, n - i)) ^ to_lower(load_tail(b, n, n - i));
+        }
+
+        return diff == 0;
+    }
+
+    // functors for std::unordered_map & co.
+    struct Hash {
+        size_t operator()(const std::string& s) const {
+            return size_t(hash(s.data(), s.size()));
+        }
+    };
+
+    struct Equal {
+        bool operator()(const std::string& a, const std::string& b) const {
+            return a.size() == b.size() && equal(a.data(), b.data(), a.size());
+        }
+    };
+
+} // namespace ci
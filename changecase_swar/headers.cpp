@@ -0,0 +1,185 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "gettime.cpp"
+#include "tolower.cpp"
+#include "fnv32.cpp"
+#include "casehash.cpp"
+
+// Case-insensitive lookup of HTTP header names: the two-pass approach
+// (lowering a copy of name, then FNV32::get) compared with the
+// word-at-a-time ci::Hash/ci::Equal.
+
+const char* header_names[] = {
+    "Accept", "Accept-Charset", "Accept-Encoding", "Accept-Language",
+    "Accept-Ranges", "Access-Control-Allow-Credentials",
+    "Access-Control-Allow-Headers", "Access-Control-Allow-Methods",
+    "Access-Control-Allow-Origin", "Access-Control-Expose-Headers",
+    "Access-Control-Max-Age", "Access-Control-Request-Headers",
+    "Access-Control-Request-Method", "Age", "Allow", "Authorization",
+    "Cache-Control", "Connection", "Content-Disposition",
+    "Content-Encoding", "Content-Language", "Content-Length",
+    "Content-Location", "Content-Range", "Content-Security-Policy",
+    "Content-Type", "Cookie", "Date", "ETag", "Expect", "Expires",
+    "Forwarded", "From", "Host", "If-Match", "If-Modified-Since",
+    "If-None-Match", "If-Range", "If-Unmodified-Since", "Keep-Alive",
+    "Last-Modified", "Link", "Location", "Max-Forwards", "Origin",
+    "Pragma", "Proxy-Authenticate", "Proxy-Authorization", "Range",
+    "Referer", "Retry-After", "Server", "Set-Cookie",
+    "Strict-Transport-Security", "TE", "Trailer", "Transfer-Encoding",
+    "Upgrade", "Upgrade-Insecure-Requests", "User-Agent", "Vary", "Via",
+    "WWW-Authenticate", "X-Content-Type-Options", "X-Forwarded-For",
+    "X-Forwarded-Host", "X-Forwarded-Proto", "X-Frame-Options",
+    "X-Requested-With", "X-XSS-Protection"
+};
+
+const size_t header_count = sizeof(header_names)/sizeof(header_names[0]);
+
+
+struct FNV32Hash {
+    size_t operator()(const std::string& s) const {
+        return FNV32::get(s.data(), s.size());
+    }
+};
+
+
+std::vector<std::string> generate_queries(size_t count) {
+
+    std::vector<std::string> queries;
+    queries.reserve(count);
+
+    for (size_t i=0; i < count; i++) {
+        std::string name = header_names[rand() % header_count];
+        switch (rand() % 4) {
+            case 0: // as is
+                break;
+            case 1:
+                swar::to_lower_inplace(&name[0], name.size());
+                break;
+            case 2:
+                for (char& c: name) {
+                    c = toupper(c);
+                }
+                break;
+            default:
+                for (char& c: name) {
+                    if (rand() % 2) {
+                        c = isupper(c) ? tolower(c) : toupper(c);
+                    }
+                }
+        }
+
+        // some unknown names
+        if (rand() % 10 == 0) {
+            name += "-Ext";
+        }
+
+        queries.push_back(name);
+    }
+
+    return queries;
+}
+
+
+int main(int argc, char* argv[]) {
+
+    // a small set of queries (cache-resident, like headers of requests)
+    const size_t count = (argc > 1) ? atol(argv[1]) : 10000;
+    const int repeat   = (argc > 2) ? atoi(argv[2]) : 1000;
+
+    const std::vector<std::string> queries = generate_queries(count);
+
+    // two-pass: keys stored lowercased, query lowered before lookup
+    std::unordered_map<std::string, int, FNV32Hash> two_pass;
+    std::unordered_map<std::string, int, ci::Hash, ci::Equal> fused;
+
+    for (size_t i=0; i < header_count; i++) {
+        std::string lower = header_names[i];
+        swar::to_lower_inplace(&lower[0], lower.size());
+        two_pass[lower] = int(i);
+        fused[header_names[i]] = int(i);
+    }
+
+    printf("%lu queries, %d repeats\n", count, repeat);
+
+    long found1 = 0;
+    {
+        std::string tmp;
+        const auto t1 = time();
+        for (int r=0; r < repeat; r++) {
+            for (const std::string& q: queries) {
+                tmp.assign(q);
+                swar::to_lower_inplace(&tmp[0], tmp.size());
+                const auto it = two_pass.find(tmp);
+                if (it != two_pass.end()) {
+                    found1 += it->second;
+                }
+            }
+        }
+        const auto t2 = time();
+        const double t = (t2 - t1)/1000000.0;
+        printf("two-pass (SWAR lower + FNV32::get): %0.4f s, %6.1f Mlookups/s (%ld)\n",
+               t, (repeat * count) / t / 1e6, found1);
+    }
+
+    long found2 = 0;
+    {
+        const auto t1 = time();
+        for (int r=0; r < repeat; r++) {
+            for (const std::string& q: queries) {
+                const auto it = fused.find(q);
+                if (it != fused.end()) {
+                    found2 += it->second;
+                }
+            }
+        }
+        const auto t2 = time();
+        const double t = (t2 - t1)/1000000.0;
+        printf("case-insensitive ci::Hash/ci::Equal: %0.4f s, %6.1f Mlookups/s (%ld)\n",
+               t, (repeat * count) / t / 1e6, found2);
+    }
+
+    // hashing alone (no table)
+    {
+        std::string tmp;
+        uint32_t h = 0;
+        const auto t1 = time();
+        for (int r=0; r < repeat; r++) {
+            for (const std::string& q: queries) {
+                tmp.assign(q);
+                swar::to_lower_inplace(&tmp[0], tmp.size());
+                h += FNV32::get(tmp.data(), tmp.size());
+            }
+        }
+        const auto t2 = time();
+        const double t = (t2 - t1)/1000000.0;
+        printf("hash only, two-pass:                 %0.4f s, %6.1f Mhashes/s (%08x)\n",
+               t, (repeat * count) / t / 1e6, h);
+    }
+
+    {
+        uint64_t h = 0;
+        const auto t1 = time();
+        for (int r=0; r < repeat; r++) {
+            for (const std::string& q: queries) {
+                h += ci::hash(q.data(), q.size());
+            }
+        }
+        const auto t2 = time();
+        const double t = (t2 - t1)/1000000.0;
+        printf("hash only, ci::hash:                 %0.4f s, %6.1f Mhashes/s (%08x)\n",
+               t, (repeat * count) / t / 1e6, uint32_t(h));
+    }
+
+    if (found1 != found2) {
+        puts("results differ!");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -3,10 +3,16 @@
 #include <cstdlib>
 #include <cstring>
 #include <cassert>
+#include <clocale>
+#include <cwctype>
 
 #include "gettime.cpp"
 #include "tolower.cpp"
 #include "fnv32.cpp"
+#include "utf8case.cpp"
+#include "casehash.cpp"
+#include <string>
+#include <vector>
 
 class CommandLine;
 
@@ -25,6 +31,9 @@ public:
 private:
     char* load_file(const char* path, size_t size);
     void usage();
+
+    void benchmark_utf8(char* buf, size_t size);
+    void verify();
 };
 
 
@@ -94,10 +103,16 @@ char* Application::load_file(const char* path, size_t size) {
 
 void Application::run() {
 
+    if (cmd.count() == 1 && cmd.has("verify")) {
+        verify();
+        return;
+    }
+
     const bool test_scalar = cmd.has("scalar") || cmd.has("both");
     const bool test_swar   = cmd.has("swar") || cmd.has("both");
+    const bool test_utf8   = cmd.has("utf8");
 
-    if (cmd.count() != 2 || (test_scalar == false && test_swar == false)) {
+    if (cmd.count() != 2 || (test_scalar == false && test_swar == false && test_utf8 == false)) {
         usage();
 
         throw Terminate();
@@ -110,6 +125,10 @@ void Application::run() {
     char* buf = load_file(cmd.get(0), size);
     double ts = 0.0;
 
+    if (test_utf8) {
+        benchmark_utf8(buf, size);
+    }
+
     if (test_scalar) {
 
         printf("testing scalar... "); std::fflush(stdout);
@@ -139,7 +158,346 @@ void Application::run() {
         putchar('\n');
     }
 
-    delete buf;
+    delete[] buf;
+}
+
+
+void Application::benchmark_utf8(char* buf, size_t size) {
+
+    auto measure = [buf, size](const char* name, void (*function)(CaseOp, const char*, char*, size_t)) {
+        printf("%-24s... ", name); std::fflush(stdout);
+
+        const auto t1 = time();
+        function(CaseOp::lower, buf, buf, size);
+        const auto t2 = time();
+        const double t = (t2 - t1)/1000000.0;
+
+        printf("%0.4f s, %7.1f MB/s\n", t, (size / (1024.0*1024.0)) / t);
+    };
+
+    measure("UTF-8 scalar", utf8case_scalar);
+    measure("UTF-8 SSE",    utf8case_sse);
+#ifdef __AVX2__
+    measure("UTF-8 AVX2",   utf8case_avx2);
+#endif
+#ifdef __AVX512BW__
+    measure("UTF-8 AVX512", utf8case_avx512);
+#endif
+
+    // case-insensitive hashing of 32-byte keys
+    const size_t key = 32;
+    char tmp[key];
+    uint32_t h1 = 0;
+    uint32_t h2 = 0;
+
+    printf("%-24s... ", "lower + FNV32::get"); std::fflush(stdout);
+    auto t1 = time();
+    for (size_t i=0; i + key <= size; i += key) {
+        utf8case_convert(CaseOp::lower, buf + i, tmp, key);
+        h1 += FNV32::get(tmp, key);
+    }
+    auto t2 = time();
+    printf("%0.4f s (%08x)\n", (t2 - t1)/1000000.0, h1);
+
+    printf("%-24s... ", "fused fold + FNV"); std::fflush(stdout);
+    t1 = time();
+    for (size_t i=0; i + key <= size; i += key) {
+        h2 += utf8case_fold_fnv32(buf + i, key);
+    }
+    t2 = time();
+    printf("%0.4f s (%08x)\n", (t2 - t1)/1000000.0, h2);
+}
+
+
+namespace verify_utf8 {
+
+    struct Failed {};
+
+    void encode(uint32_t cp, std::string& out) {
+        if (cp < 0x80) {
+            out += char(cp);
+        } else if (cp < 0x800) {
+            out += char(0xc0 | (cp >> 6));
+            out += char(0x80 | (cp & 0x3f));
+        } else if (cp < 0x10000) {
+            out += char(0xe0 | (cp >> 12));
+            out += char(0x80 | ((cp >> 6) & 0x3f));
+            out += char(0x80 | (cp & 0x3f));
+        } else {
+            out += char(0xf0 | (cp >> 18));
+            out += char(0x80 | ((cp >> 12) & 0x3f));
+            out += char(0x80 | ((cp >> 6) & 0x3f));
+            out += char(0x80 | (cp & 0x3f));
+        }
+    }
+
+    // Reference mapping comes from the C library (towlower/towupper in a
+    // UTF-8 locale), not from the generated tables; it's restricted the
+    // same way: only the four blocks, only results being 2-byte sequences.
+    bool in_blocks(uint32_t cp) {
+        return (cp >= 0x0080 && cp <= 0x017f)   // Latin-1 Supplement, Latin Extended-A
+            || (cp >= 0x0370 && cp <= 0x04ff);  // Greek and Coptic, Cyrillic
+    }
+
+    uint32_t libc_mapping(uint32_t cp, wint_t (*fun)(wint_t)) {
+        if (!in_blocks(cp)) {
+            return cp;
+        }
+
+        const uint32_t res = fun(wint_t(cp));
+        return (res >= 0x80 && res <= 0x7ff) ? res : cp;
+    }
+
+    uint32_t expected(CaseOp op, uint32_t cp) {
+        const uint32_t lower = libc_mapping(cp, towlower);
+        const uint32_t upper = libc_mapping(cp, towupper);
+
+        switch (op) {
+            case CaseOp::lower:
+                return lower;
+            case CaseOp::upper:
+                return upper;
+            case CaseOp::swap:
+            default:
+                return (lower != cp) ? lower : upper;
+        }
+    }
+
+    const char* name(CaseOp op) {
+        switch (op) {
+            case CaseOp::lower: return "lower";
+            case CaseOp::upper: return "upper";
+            default:            return "swap";
+        }
+    }
+
+    const CaseOp all_ops[] = {CaseOp::lower, CaseOp::upper, CaseOp::swap};
+
+    void check_scalar(CaseOp op, uint32_t cp, uint32_t exp) {
+        std::string input;
+        std::string ref;
+        encode(cp, input);
+        encode(exp, ref);
+
+        std::string result(input.size(), 0);
+        utf8case_scalar(op, input.data(), &result[0], input.size());
+        if (result != ref) {
+            printf("FAILED: %s U+%04X\n", name(op), cp);
+            throw Failed();
+        }
+    }
+
+    // hand-checked cases, including mappings that are left out
+    void known_answers() {
+        printf("known answers... "); std::fflush(stdout);
+
+        static const uint32_t answers[][4] = {
+            // code point, lower, upper, swap
+            {0x00c9, 0x00e9, 0x00c9, 0x00e9},   // É
+            {0x00e9, 0x00e9, 0x00c9, 0x00c9},   // é
+            {0x00d7, 0x00d7, 0x00d7, 0x00d7},   // multiplication sign
+            {0x00df, 0x00df, 0x00df, 0x00df},   // ß, uppercase is "SS"
+            {0x00b5, 0x00b5, 0x039c, 0x039c},   // micro sign, uppercase is Greek Μ
+            {0x00ff, 0x00ff, 0x0178, 0x0178},   // ÿ, uppercase is Ÿ from Latin Extended-A
+            {0x0178, 0x00ff, 0x0178, 0x00ff},   // Ÿ
+            {0x0130, 0x0130, 0x0130, 0x0130},   // İ, lowercase is ASCII 'i' (+ combining dot)
+            {0x0131, 0x0131, 0x0131, 0x0131},   // ı, uppercase is ASCII 'I'
+            {0x0149, 0x0149, 0x0149, 0x0149},   // ŉ, uppercase is two characters
+            {0x017f, 0x017f, 0x017f, 0x017f},   // ſ, uppercase is ASCII 'S'
+            {0x0141, 0x0142, 0x0141, 0x0142},   // Ł
+            {0x0391, 0x03b1, 0x0391, 0x03b1},   // Α
+            {0x03c2, 0x03c2, 0x03a3, 0x03a3},   // final ς
+            {0x03a3, 0x03c3, 0x03a3, 0x03c3},   // Σ
+            {0x0390, 0x0390, 0x0390, 0x0390},   // ΐ, uppercase is three characters
+            {0x0410, 0x0430, 0x0410, 0x0430},   // А
+            {0x044f, 0x044f, 0x042f, 0x042f},   // я
+            {0x0401, 0x0451, 0x0401, 0x0451},   // Ё
+            {0x04c0, 0x04cf, 0x04c0, 0x04cf},   // Ӏ
+            {0x0531, 0x0531, 0x0531, 0x0531},   // Armenian Ա, outside the blocks
+            {0x07ff, 0x07ff, 0x07ff, 0x07ff},
+        };
+
+        for (const auto& answer: answers) {
+            for (int i=0; i < 3; i++) {
+                check_scalar(all_ops[i], answer[0], answer[i + 1]);
+            }
+        }
+        puts("OK");
+    }
+
+    // every ASCII character and every 2-byte sequence against the reference
+    void code_points() {
+        printf("code points U+0000..U+07FF... "); std::fflush(stdout);
+        if (setlocale(LC_CTYPE, "C.UTF-8") == nullptr && setlocale(LC_CTYPE, "en_US.UTF-8") == nullptr) {
+            puts("FAILED: no UTF-8 locale for towlower/towupper");
+            throw Failed();
+        }
+
+        for (CaseOp op: all_ops) {
+            for (uint32_t cp=0; cp < 0x800; cp++) {
+                uint32_t exp;
+                if (cp < 0x80) {
+                    const bool letter = isalpha(int(cp));
+                    exp = (op == CaseOp::lower) ? tolower(int(cp))
+                        : (op == CaseOp::upper) ? toupper(int(cp))
+                        : (letter ? (cp ^ 0x20) : cp);
+                } else {
+                    exp = expected(op, cp);
+                }
+
+                check_scalar(op, cp, exp);
+            }
+        }
+        setlocale(LC_CTYPE, "C");
+        puts("OK");
+    }
+
+    std::string random_text(size_t length) {
+        static const uint32_t samples[] = {
+            'a', 'Z', ' ', '.', '@', '[', '`', '{',
+            0x00e9, 0x00c9, 0x00df, 0x00ff, 0x00b5, 0x0130, 0x0131, 0x0178,
+            0x0391, 0x03a3, 0x03c2, 0x03c9, 0x0386, 0x0410, 0x042f, 0x0451,
+            0x0531, 0x20ac, 0x1f600, 0x07ff, 0x0100, 0x017f, 0x04c0, 0x04ff
+        };
+
+        std::string text;
+        while (text.size() < length) {
+            switch (rand() % 8) {
+                case 0: // an invalid byte
+                    text += char(0x80 + rand() % 128);
+                    break;
+                case 1: case 2: // any ASCII
+                    text += char(rand() % 128);
+                    break;
+                default:
+                    encode(samples[rand() % 32], text);
+            }
+        }
+
+        text.resize(length);
+        return text;
+    }
+
+    template <typename FUNCTION>
+    void compare(const char* proc, FUNCTION function) {
+        printf("%-6s random texts... ", proc); std::fflush(stdout);
+        for (int k=0; k < 2000; k++) {
+            const std::string text = random_text(rand() % 300);
+            for (CaseOp op: all_ops) {
+                std::string ref(text.size(), 0);
+                utf8case_scalar(op, text.data(), &ref[0], text.size());
+
+                std::string result(text.size(), 0);
+                function(op, text.data(), &result[0], text.size());
+
+                std::string inplace(text);
+                function(op, &inplace[0], &inplace[0], inplace.size());
+
+                if (result != ref || inplace != ref) {
+                    printf("FAILED: %s, size %lu\n", name(op), text.size());
+                    throw Failed();
+                }
+            }
+        }
+        puts("OK");
+    }
+
+    void fused_hash() {
+        printf("fused fold + FNV... "); std::fflush(stdout);
+        for (int k=0; k < 2000; k++) {
+            const std::string text = random_text(rand() % 1000);
+            std::string lower(text.size(), 0);
+            utf8case_scalar(CaseOp::lower, text.data(), &lower[0], text.size());
+
+            if (utf8case_fold_fnv32(text.data(), text.size()) != FNV32::get(lower.data(), lower.size())) {
+                printf("FAILED: size %lu\n", text.size());
+                throw Failed();
+            }
+        }
+        puts("OK");
+    }
+
+} // namespace verify_utf8
+
+
+namespace verify_ci {
+
+    using verify_utf8::Failed;
+
+    bool equal_reference(const std::string& a, const std::string& b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+
+        for (size_t i=0; i < a.size(); i++) {
+            if (utf8case::ascii(CaseOp::lower, uint8_t(a[i])) != utf8case::ascii(CaseOp::lower, uint8_t(b[i]))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // case-insensitive hash and equality, for all bytes
+    void hash_and_equal() {
+        printf("case-insensitive hash and equality... "); std::fflush(stdout);
+        for (int k=0; k < 100000; k++) {
+            const size_t n = rand() % 80;
+            std::string a(n, 0);
+            for (char& c: a) {
+                c = char((rand() % 2) ? ('A' + rand() % 32) : rand());
+            }
+
+            // change case of letters and randomly one byte
+            std::string b(a);
+            for (char& c: b) {
+                if (rand() % 2) {
+                    c = char(utf8case::ascii(CaseOp::swap, uint8_t(c)));
+                }
+            }
+
+            if (n > 0 && rand() % 4 == 0) {
+                b[rand() % n] ^= char(1 << (rand() % 8));
+            }
+
+            const bool ref = equal_reference(a, b);
+            if (ci::equal(a.data(), b.data(), n) != ref) {
+                printf("FAILED: equal, size %lu\n", n);
+                throw Failed();
+            }
+
+            if (ref && ci::hash(a.data(), n) != ci::hash(b.data(), n)) {
+                printf("FAILED: hash, size %lu\n", n);
+                throw Failed();
+            }
+        }
+        puts("OK");
+    }
+
+} // namespace verify_ci
+
+
+void Application::verify() {
+
+    using namespace verify_utf8;
+
+    try {
+        known_answers();
+        code_points();
+        compare("SSE",    utf8case_sse);
+#ifdef __AVX2__
+        compare("AVX2",   utf8case_avx2);
+#endif
+#ifdef __AVX512BW__
+        compare("AVX512", utf8case_avx512);
+#endif
+        fused_hash();
+        verify_ci::hash_and_equal();
+    } catch (Failed&) {
+        throw Terminate();
+    }
+
+    puts("All OK");
 }
 
 
@@ -147,11 +505,15 @@ void Application::usage() {
     puts("usage:");
     puts("");
     puts("test FILE option");
+    puts("test verify");
     puts("");
     puts("options:");
     puts("- scalar - test the scalar code");
     puts("- swar   - test the SWAR code");
     puts("- both   - test both implementations");
+    puts("- utf8   - test UTF-8 aware SIMD conversion and fused hashing");
+    puts("");
+    puts("verify   - validate UTF-8 procedures against the C library and known answers");
 }
 
 
@@ -0,0 +1,293 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+/*
+    Case conversion of UTF-8 text.
+
+    ASCII letters are converted with SIMD instructions. Besides ASCII, the
+    2-byte sequences from Latin-1 Supplement, Latin Extended-A, Greek and
+    Cyrillic are converted; the mapping of a pair (leading byte, continuation
+    byte) is read from a table generated by utf8case_generate.py. Other
+    bytes (longer sequences, invalid input) are copied verbatim, thus the
+    length of text never changes and the conversion can be done in-place
+    (src == dst).
+
+    A pair is recognized when a byte 0xc2..0xdf is followed by a byte
+    0x80..0xbf; no other byte can be a part of such a pair, so a vector
+    of bytes might be examined independently of its neighbours, except a
+    leading byte at the end of vector --- the vector loop then advances
+    one byte less and the pair is handled by the next iteration.
+*/
+
+enum class CaseOp {
+    lower,
+    upper,
+    swap
+};
+
+namespace utf8case {
+
+    #include "utf8case.inl"
+
+    inline bool is_lead(uint8_t b) {
+        return b >= first_lead && b <= last_lead;
+    }
+
+    inline bool is_continuation(uint8_t b) {
+        return (b & 0xc0) == 0x80;
+    }
+
+    inline uint8_t ascii(CaseOp op, uint8_t c) {
+        const bool upper = (c >= 'A' && c <= 'Z');
+        const bool lower = (c >= 'a' && c <= 'z');
+        switch (op) {
+            case CaseOp::lower:
+                return upper ? (c ^ 0x20) : c;
+            case CaseOp::upper:
+                return lower ? (c ^ 0x20) : c;
+            case CaseOp::swap:
+            default:
+                return (upper || lower) ? (c ^ 0x20) : c;
+        }
+    }
+
+    // src[0] is a leading byte, src[1] a continuation byte
+    inline void convert_pair(CaseOp op, const char* src, char* dst) {
+        const uint8_t lead = uint8_t(src[0]);
+        const uint8_t cont = uint8_t(src[1]);
+        const size_t idx = (lead - first_lead) * 64 + (cont & 0x3f);
+
+        memcpy(dst, pairs[int(op)][idx], 2);
+    }
+
+    // Converts the pairs denoted by bits of `leads` (bit k = byte k is a
+    // leading byte followed by continuation byte).
+    inline void convert_pairs(CaseOp op, uint64_t leads, const char* src, char* dst) {
+        while (leads) {
+            const int k = __builtin_ctzll(leads);
+            convert_pair(op, src + k, dst + k);
+            leads &= leads - 1;
+        }
+    }
+
+} // namespace utf8case
+
+
+void utf8case_scalar(CaseOp op, const char* src, char* dst, size_t n) {
+    using namespace utf8case;
+
+    size_t i = 0;
+    while (i < n) {
+        const uint8_t c = uint8_t(src[i]);
+        if (c < 0x80) {
+            dst[i] = char(ascii(op, c));
+            i += 1;
+        } else if (is_lead(c) && i + 1 < n && is_continuation(uint8_t(src[i + 1]))) {
+            convert_pair(op, src + i, dst + i);
+            i += 2;
+        } else {
+            dst[i] = char(c);
+            i += 1;
+        }
+    }
+}
+
+
+namespace utf8case {
+
+    // --- SSE -------------------------------------------------------------
+
+    inline __m128i ascii_sse(CaseOp op, const __m128i v) {
+        // signed comparisons: bytes >= 0x80 are negative, thus never letters
+        const __m128i x = (op == CaseOp::swap) ? _mm_or_si128(v, _mm_set1_epi8(0x20)) : v;
+        const char first = (op == CaseOp::lower) ? 'A' : 'a';
+        const char last  = (op == CaseOp::lower) ? 'Z' : 'z';
+
+        const __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8(first - 1)),
+                                             _mm_cmplt_epi8(x, _mm_set1_epi8(last + 1)));
+
+        return _mm_xor_si128(v, _mm_and_si128(letter, _mm_set1_epi8(0x20)));
+    }
+
+    // bitmask of leading bytes (0xc2..0xdf) and continuation bytes (0x80..0xbf)
+    inline void classify_sse(const __m128i v, uint32_t& leads, uint32_t& continuations) {
+        const __m128i lead = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(int8_t(first_lead - 1))),
+                                           _mm_cmplt_epi8(v, _mm_set1_epi8(int8_t(last_lead + 1))));
+        const __m128i cont = _mm_cmplt_epi8(v, _mm_set1_epi8(int8_t(0xc0)));
+
+        leads         = _mm_movemask_epi8(lead);
+        continuations = _mm_movemask_epi8(cont);
+    }
+
+} // namespace utf8case
+
+
+void utf8case_sse(CaseOp op, const char* src, char* dst, size_t n) {
+    using namespace utf8case;
+
+    size_t i = 0;
+    while (i + 16 <= n) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), ascii_sse(op, v));
+
+        if (_mm_movemask_epi8(v) == 0) {
+            i += 16;
+            continue;
+        }
+
+        uint32_t leads;
+        uint32_t continuations;
+        classify_sse(v, leads, continuations);
+
+        // a leading byte at the end is left for the next iteration
+        const uint32_t pairs = leads & (continuations >> 1);
+        convert_pairs(op, pairs, src + i, dst + i);
+
+        i += 16 - ((leads >> 15) & 1);
+    }
+
+    utf8case_scalar(op, src + i, dst + i, n - i);
+}
+
+
+#ifdef __AVX2__
+namespace utf8case {
+
+    inline __m256i ascii_avx2(CaseOp op, const __m256i v) {
+        const __m256i x = (op == CaseOp::swap) ? _mm256_or_si256(v, _mm256_set1_epi8(0x20)) : v;
+        const char first = (op == CaseOp::lower) ? 'A' : 'a';
+        const char last  = (op == CaseOp::lower) ? 'Z' : 'z';
+
+        const __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8(first - 1)),
+                                                _mm256_cmpgt_epi8(_mm256_set1_epi8(last + 1), x));
+
+        return _mm256_xor_si256(v, _mm256_and_si256(letter, _mm256_set1_epi8(0x20)));
+    }
+
+    inline void classify_avx2(const __m256i v, uint32_t& leads, uint32_t& continuations) {
+        const __m256i lead = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(int8_t(first_lead - 1))),
+                                              _mm256_cmpgt_epi8(_mm256_set1_epi8(int8_t(last_lead + 1)), v));
+        const __m256i cont = _mm256_cmpgt_epi8(_mm256_set1_epi8(int8_t(0xc0)), v);
+
+        leads         = _mm256_movemask_epi8(lead);
+        continuations = _mm256_movemask_epi8(cont);
+    }
+
+} // namespace utf8case
+
+
+void utf8case_avx2(CaseOp op, const char* src, char* dst, size_t n) {
+    using namespace utf8case;
+
+    size_t i = 0;
+    while (i + 32 <= n) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), ascii_avx2(op, v));
+
+        if (_mm256_movemask_epi8(v) == 0) {
+            i += 32;
+            continue;
+        }
+
+        uint32_t leads;
+        uint32_t continuations;
+        classify_avx2(v, leads, continuations);
+
+        const uint32_t pairs = leads & (continuations >> 1);
+        convert_pairs(op, pairs, src + i, dst + i);
+
+        i += 32 - (leads >> 31);
+    }
+
+    utf8case_sse(op, src + i, dst + i, n - i);
+}
+#endif // __AVX2__
+
+
+#ifdef __AVX512BW__
+void utf8case_avx512(CaseOp op, const char* src, char* dst, size_t n) {
+    using namespace utf8case;
+
+    const __m512i first  = _mm512_set1_epi8((op == CaseOp::lower) ? 'A' : 'a');
+    const __m512i length = _mm512_set1_epi8(26);
+    const __m512i bit5   = _mm512_set1_epi8(0x20);
+
+    const __m512i lead_first = _mm512_set1_epi8(int8_t(first_lead));
+    const __m512i lead_count = _mm512_set1_epi8(last_lead - first_lead + 1);
+    const __m512i cont_max   = _mm512_set1_epi8(int8_t(0xbf));
+
+    size_t i = 0;
+    while (i < n) {
+        const size_t   count = (n - i < 64) ? n - i : 64;
+        const uint64_t valid = (count == 64) ? uint64_t(-1) : (uint64_t(1) << count) - 1;
+
+        const __m512i v = _mm512_maskz_loadu_epi8(valid, src + i);
+        const __m512i x = (op == CaseOp::swap) ? _mm512_or_si512(v, bit5) : v;
+
+        // (x - first) < 26 as unsigned
+        const uint64_t letters = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(x, first), length);
+        const __m512i converted = _mm512_xor_si512(v, bit5);
+        _mm512_mask_storeu_epi8(dst + i, valid, _mm512_mask_blend_epi8(letters, v, converted));
+
+        const uint64_t non_ascii = _mm512_movepi8_mask(v) & valid;
+        if (non_ascii == 0) {
+            i += count;
+            continue;
+        }
+
+        const uint64_t leads = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(v, lead_first), lead_count) & valid;
+        const uint64_t conts = _mm512_cmple_epu8_mask(v, cont_max) & non_ascii;
+
+        convert_pairs(op, leads & (conts >> 1), src + i, dst + i);
+
+        // a leading byte at the end of full vector is left for the next one
+        i += count - ((count == 64) ? (leads >> 63) : 0);
+    }
+}
+#endif // __AVX512BW__
+
+
+// the best procedure available
+void utf8case_convert(CaseOp op, const char* src, char* dst, size_t n) {
+#if defined(__AVX512BW__)
+    utf8case_avx512(op, src, dst, n);
+#elif defined(__AVX2__)
+    utf8case_avx2(op, src, dst, n);
+#else
+    utf8case_sse(op, src, dst, n);
+#endif
+}
+
+
+// FNV-1a hash of lowercased text, the same as FNV32::get after
+// utf8case_convert(CaseOp::lower); the text is converted in small,
+// cache-resident chunks, so the input is read only once.
+uint32_t utf8case_fold_fnv32(const char* str, size_t size) {
+
+    const uint32_t offset_basis = 2166136261u;
+    const uint32_t prime = 16777619u;
+
+    uint32_t hash = offset_basis;
+    char chunk[256];
+
+    size_t i = 0;
+    while (i < size) {
+        size_t n = (size - i < sizeof(chunk)) ? size - i : sizeof(chunk);
+        // do not split a pair between chunks
+        if (i + n < size && utf8case::is_lead(uint8_t(str[i + n - 1]))) {
+            n -= 1;
+        }
+
+        utf8case_convert(CaseOp::lower, str + i, chunk, n);
+        for (size_t j=0; j < n; j++) {
+            hash = hash ^ uint8_t(chunk[j]);
+            hash = hash * prime;
+        }
+
+        i += n;
+    }
+
+    return hash;
+}
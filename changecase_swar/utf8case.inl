@@ -0,0 +1,738 @@
+// generated by utf8case_generate.py, do not edit
+// Unicode 14.0.0
+
+const int first_lead = 0xc2;
+const int last_lead  = 0xdf;
+
+// [operation][(lead - first_lead) * 64 + (continuation & 0x3f)] = {lead, continuation}
+const uint8_t pairs[3][1920][2] = {
+    // lower
+    {
+        {0xc2,0x80},{0xc2,0x81},{0xc2,0x82},{0xc2,0x83},{0xc2,0x84},{0xc2,0x85},{0xc2,0x86},{0xc2,0x87},
+        {0xc2,0x88},{0xc2,0x89},{0xc2,0x8a},{0xc2,0x8b},{0xc2,0x8c},{0xc2,0x8d},{0xc2,0x8e},{0xc2,0x8f},
+        {0xc2,0x90},{0xc2,0x91},{0xc2,0x92},{0xc2,0x93},{0xc2,0x94},{0xc2,0x95},{0xc2,0x96},{0xc2,0x97},
+        {0xc2,0x98},{0xc2,0x99},{0xc2,0x9a},{0xc2,0x9b},{0xc2,0x9c},{0xc2,0x9d},{0xc2,0x9e},{0xc2,0x9f},
+        {0xc2,0xa0},{0xc2,0xa1},{0xc2,0xa2},{0xc2,0xa3},{0xc2,0xa4},{0xc2,0xa5},{0xc2,0xa6},{0xc2,0xa7},
+        {0xc2,0xa8},{0xc2,0xa9},{0xc2,0xaa},{0xc2,0xab},{0xc2,0xac},{0xc2,0xad},{0xc2,0xae},{0xc2,0xaf},
+        {0xc2,0xb0},{0xc2,0xb1},{0xc2,0xb2},{0xc2,0xb3},{0xc2,0xb4},{0xc2,0xb5},{0xc2,0xb6},{0xc2,0xb7},
+        {0xc2,0xb8},{0xc2,0xb9},{0xc2,0xba},{0xc2,0xbb},{0xc2,0xbc},{0xc2,0xbd},{0xc2,0xbe},{0xc2,0xbf},
+        {0xc3,0xa0},{0xc3,0xa1},{0xc3,0xa2},{0xc3,0xa3},{0xc3,0xa4},{0xc3,0xa5},{0xc3,0xa6},{0xc3,0xa7},
+        {0xc3,0xa8},{0xc3,0xa9},{0xc3,0xaa},{0xc3,0xab},{0xc3,0xac},{0xc3,0xad},{0xc3,0xae},{0xc3,0xaf},
+        {0xc3,0xb0},{0xc3,0xb1},{0xc3,0xb2},{0xc3,0xb3},{0xc3,0xb4},{0xc3,0xb5},{0xc3,0xb6},{0xc3,0x97},
+        {0xc3,0xb8},{0xc3,0xb9},{0xc3,0xba},{0xc3,0xbb},{0xc3,0xbc},{0xc3,0xbd},{0xc3,0xbe},{0xc3,0x9f},
+        {0xc3,0xa0},{0xc3,0xa1},{0xc3,0xa2},{0xc3,0xa3},{0xc3,0xa4},{0xc3,0xa5},{0xc3,0xa6},{0xc3,0xa7},
+        {0xc3,0xa8},{0xc3,0xa9},{0xc3,0xaa},{0xc3,0xab},{0xc3,0xac},{0xc3,0xad},{0xc3,0xae},{0xc3,0xaf},
+        {0xc3,0xb0},{0xc3,0xb1},{0xc3,0xb2},{0xc3,0xb3},{0xc3,0xb4},{0xc3,0xb5},{0xc3,0xb6},{0xc3,0xb7},
+        {0xc3,0xb8},{0xc3,0xb9},{0xc3,0xba},{0xc3,0xbb},{0xc3,0xbc},{0xc3,0xbd},{0xc3,0xbe},{0xc3,0xbf},
+        {0xc4,0x81},{0xc4,0x81},{0xc4,0x83},{0xc4,0x83},{0xc4,0x85},{0xc4,0x85},{0xc4,0x87},{0xc4,0x87},
+        {0xc4,0x89},{0xc4,0x89},{0xc4,0x8b},{0xc4,0x8b},{0xc4,0x8d},{0xc4,0x8d},{0xc4,0x8f},{0xc4,0x8f},
+        {0xc4,0x91},{0xc4,0x91},{0xc4,0x93},{0xc4,0x93},{0xc4,0x95},{0xc4,0x95},{0xc4,0x97},{0xc4,0x97},
+        {0xc4,0x99},{0xc4,0x99},{0xc4,0x9b},{0xc4,0x9b},{0xc4,0x9d},{0xc4,0x9d},{0xc4,0x9f},{0xc4,0x9f},
+        {0xc4,0xa1},{0xc4,0xa1},{0xc4,0xa3},{0xc4,0xa3},{0xc4,0xa5},{0xc4,0xa5},{0xc4,0xa7},{0xc4,0xa7},
+        {0xc4,0xa9},{0xc4,0xa9},{0xc4,0xab},{0xc4,0xab},{0xc4,0xad},{0xc4,0xad},{0xc4,0xaf},{0xc4,0xaf},
+        {0xc4,0xb0},{0xc4,0xb1},{0xc4,0xb3},{0xc4,0xb3},{0xc4,0xb5},{0xc4,0xb5},{0xc4,0xb7},{0xc4,0xb7},
+        {0xc4,0xb8},{0xc4,0xba},{0xc4,0xba},{0xc4,0xbc},{0xc4,0xbc},{0xc4,0xbe},{0xc4,0xbe},{0xc5,0x80},
+        {0xc5,0x80},{0xc5,0x82},{0xc5,0x82},{0xc5,0x84},{0xc5,0x84},{0xc5,0x86},{0xc5,0x86},{0xc5,0x88},
+        {0xc5,0x88},{0xc5,0x89},{0xc5,0x8b},{0xc5,0x8b},{0xc5,0x8d},{0xc5,0x8d},{0xc5,0x8f},{0xc5,0x8f},
+        {0xc5,0x91},{0xc5,0x91},{0xc5,0x93},{0xc5,0x93},{0xc5,0x95},{0xc5,0x95},{0xc5,0x97},{0xc5,0x97},
+        {0xc5,0x99},{0xc5,0x99},{0xc5,0x9b},{0xc5,0x9b},{0xc5,0x9d},{0xc5,0x9d},{0xc5,0x9f},{0xc5,0x9f},
+        {0xc5,0xa1},{0xc5,0xa1},{0xc5,0xa3},{0xc5,0xa3},{0xc5,0xa5},{0xc5,0xa5},{0xc5,0xa7},{0xc5,0xa7},
+        {0xc5,0xa9},{0xc5,0xa9},{0xc5,0xab},{0xc5,0xab},{0xc5,0xad},{0xc5,0xad},{0xc5,0xaf},{0xc5,0xaf},
+        {0xc5,0xb1},{0xc5,0xb1},{0xc5,0xb3},{0xc5,0xb3},{0xc5,0xb5},{0xc5,0xb5},{0xc5,0xb7},{0xc5,0xb7},
+        {0xc3,0xbf},{0xc5,0xba},{0xc5,0xba},{0xc5,0xbc},{0xc5,0xbc},{0xc5,0xbe},{0xc5,0xbe},{0xc5,0xbf},
+        {0xc6,0x80},{0xc6,0x81},{0xc6,0x82},{0xc6,0x83},{0xc6,0x84},{0xc6,0x85},{0xc6,0x86},{0xc6,0x87},
+        {0xc6,0x88},{0xc6,0x89},{0xc6,0x8a},{0xc6,0x8b},{0xc6,0x8c},{0xc6,0x8d},{0xc6,0x8e},{0xc6,0x8f},
+        {0xc6,0x90},{0xc6,0x91},{0xc6,0x92},{0xc6,0x93},{0xc6,0x94},{0xc6,0x95},{0xc6,0x96},{0xc6,0x97},
+        {0xc6,0x98},{0xc6,0x99},{0xc6,0x9a},{0xc6,0x9b},{0xc6,0x9c},{0xc6,0x9d},{0xc6,0x9e},{0xc6,0x9f},
+        {0xc6,0xa0},{0xc6,0xa1},{0xc6,0xa2},{0xc6,0xa3},{0xc6,0xa4},{0xc6,0xa5},{0xc6,0xa6},{0xc6,0xa7},
+        {0xc6,0xa8},{0xc6,0xa9},{0xc6,0xaa},{0xc6,0xab},{0xc6,0xac},{0xc6,0xad},{0xc6,0xae},{0xc6,0xaf},
+        {0xc6,0xb0},{0xc6,0xb1},{0xc6,0xb2},{0xc6,0xb3},{0xc6,0xb4},{0xc6,0xb5},{0xc6,0xb6},{0xc6,0xb7},
+        {0xc6,0xb8},{0xc6,0xb9},{0xc6,0xba},{0xc6,0xbb},{0xc6,0xbc},{0xc6,0xbd},{0xc6,0xbe},{0xc6,0xbf},
+        {0xc7,0x80},{0xc7,0x81},{0xc7,0x82},{0xc7,0x83},{0xc7,0x84},{0xc7,0x85},{0xc7,0x86},{0xc7,0x87},
+        {0xc7,0x88},{0xc7,0x89},{0xc7,0x8a},{0xc7,0x8b},{0xc7,0x8c},{0xc7,0x8d},{0xc7,0x8e},{0xc7,0x8f},
+        {0xc7,0x90},{0xc7,0x91},{0xc7,0x92},{0xc7,0x93},{0xc7,0x94},{0xc7,0x95},{0xc7,0x96},{0xc7,0x97},
+        {0xc7,0x98},{0xc7,0x99},{0xc7,0x9a},{0xc7,0x9b},{0xc7,0x9c},{0xc7,0x9d},{0xc7,0x9e},{0xc7,0x9f},
+        {0xc7,0xa0},{0xc7,0xa1},{0xc7,0xa2},{0xc7,0xa3},{0xc7,0xa4},{0xc7,0xa5},{0xc7,0xa6},{0xc7,0xa7},
+        {0xc7,0xa8},{0xc7,0xa9},{0xc7,0xaa},{0xc7,0xab},{0xc7,0xac},{0xc7,0xad},{0xc7,0xae},{0xc7,0xaf},
+        {0xc7,0xb0},{0xc7,0xb1},{0xc7,0xb2},{0xc7,0xb3},{0xc7,0xb4},{0xc7,0xb5},{0xc7,0xb6},{0xc7,0xb7},
+        {0xc7,0xb8},{0xc7,0xb9},{0xc7,0xba},{0xc7,0xbb},{0xc7,0xbc},{0xc7,0xbd},{0xc7,0xbe},{0xc7,0xbf},
+        {0xc8,0x80},{0xc8,0x81},{0xc8,0x82},{0xc8,0x83},{0xc8,0x84},{0xc8,0x85},{0xc8,0x86},{0xc8,0x87},
+        {0xc8,0x88},{0xc8,0x89},{0xc8,0x8a},{0xc8,0x8b},{0xc8,0x8c},{0xc8,0x8d},{0xc8,0x8e},{0xc8,0x8f},
+        {0xc8,0x90},{0xc8,0x91},{0xc8,0x92},{0xc8,0x93},{0xc8,0x94},{0xc8,0x95},{0xc8,0x96},{0xc8,0x97},
+        {0xc8,0x98},{0xc8,0x99},{0xc8,0x9a},{0xc8,0x9b},{0xc8,0x9c},{0xc8,0x9d},{0xc8,0x9e},{0xc8,0x9f},
+        {0xc8,0xa0},{0xc8,0xa1},{0xc8,0xa2},{0xc8,0xa3},{0xc8,0xa4},{0xc8,0xa5},{0xc8,0xa6},{0xc8,0xa7},
+        {0xc8,0xa8},{0xc8,0xa9},{0xc8,0xaa},{0xc8,0xab},{0xc8,0xac},{0xc8,0xad},{0xc8,0xae},{0xc8,0xaf},
+        {0xc8,0xb0},{0xc8,0xb1},{0xc8,0xb2},{0xc8,0xb3},{0xc8,0xb4},{0xc8,0xb5},{0xc8,0xb6},{0xc8,0xb7},
+        {0xc8,0xb8},{0xc8,0xb9},{0xc8,0xba},{0xc8,0xbb},{0xc8,0xbc},{0xc8,0xbd},{0xc8,0xbe},{0xc8,0xbf},
+        {0xc9,0x80},{0xc9,0x81},{0xc9,0x82},{0xc9,0x83},{0xc9,0x84},{0xc9,0x85},{0xc9,0x86},{0xc9,0x87},
+        {0xc9,0x88},{0xc9,0x89},{0xc9,0x8a},{0xc9,0x8b},{0xc9,0x8c},{0xc9,0x8d},{0xc9,0x8e},{0xc9,0x8f},
+        {0xc9,0x90},{0xc9,0x91},{0xc9,0x92},{0xc9,0x93},{0xc9,0x94},{0xc9,0x95},{0xc9,0x96},{0xc9,0x97},
+        {0xc9,0x98},{0xc9,0x99},{0xc9,0x9a},{0xc9,0x9b},{0xc9,0x9c},{0xc9,0x9d},{0xc9,0x9e},{0xc9,0x9f},
+        {0xc9,0xa0},{0xc9,0xa1},{0xc9,0xa2},{0xc9,0xa3},{0xc9,0xa4},{0xc9,0xa5},{0xc9,0xa6},{0xc9,0xa7},
+        {0xc9,0xa8},{0xc9,0xa9},{0xc9,0xaa},{0xc9,0xab},{0xc9,0xac},{0xc9,0xad},{0xc9,0xae},{0xc9,0xaf},
+        {0xc9,0xb0},{0xc9,0xb1},{0xc9,0xb2},{0xc9,0xb3},{0xc9,0xb4},{0xc9,0xb5},{0xc9,0xb6},{0xc9,0xb7},
+        {0xc9,0xb8},{0xc9,0xb9},{0xc9,0xba},{0xc9,0xbb},{0xc9,0xbc},{0xc9,0xbd},{0xc9,0xbe},{0xc9,0xbf},
+        {0xca,0x80},{0xca,0x81},{0xca,0x82},{0xca,0x83},{0xca,0x84},{0xca,0x85},{0xca,0x86},{0xca,0x87},
+        {0xca,0x88},{0xca,0x89},{0xca,0x8a},{0xca,0x8b},{0xca,0x8c},{0xca,0x8d},{0xca,0x8e},{0xca,0x8f},
+        {0xca,0x90},{0xca,0x91},{0xca,0x92},{0xca,0x93},{0xca,0x94},{0xca,0x95},{0xca,0x96},{0xca,0x97},
+        {0xca,0x98},{0xca,0x99},{0xca,0x9a},{0xca,0x9b},{0xca,0x9c},{0xca,0x9d},{0xca,0x9e},{0xca,0x9f},
+        {0xca,0xa0},{0xca,0xa1},{0xca,0xa2},{0xca,0xa3},{0xca,0xa4},{0xca,0xa5},{0xca,0xa6},{0xca,0xa7},
+        {0xca,0xa8},{0xca,0xa9},{0xca,0xaa},{0xca,0xab},{0xca,0xac},{0xca,0xad},{0xca,0xae},{0xca,0xaf},
+        {0xca,0xb0},{0xca,0xb1},{0xca,0xb2},{0xca,0xb3},{0xca,0xb4},{0xca,0xb5},{0xca,0xb6},{0xca,0xb7},
+        {0xca,0xb8},{0xca,0xb9},{0xca,0xba},{0xca,0xbb},{0xca,0xbc},{0xca,0xbd},{0xca,0xbe},{0xca,0xbf},
+        {0xcb,0x80},{0xcb,0x81},{0xcb,0x82},{0xcb,0x83},{0xcb,0x84},{0xcb,0x85},{0xcb,0x86},{0xcb,0x87},
+        {0xcb,0x88},{0xcb,0x89},{0xcb,0x8a},{0xcb,0x8b},{0xcb,0x8c},{0xcb,0x8d},{0xcb,0x8e},{0xcb,0x8f},
+        {0xcb,0x90},{0xcb,0x91},{0xcb,0x92},{0xcb,0x93},{0xcb,0x94},{0xcb,0x95},{0xcb,0x96},{0xcb,0x97},
+        {0xcb,0x98},{0xcb,0x99},{0xcb,0x9a},{0xcb,0x9b},{0xcb,0x9c},{0xcb,0x9d},{0xcb,0x9e},{0xcb,0x9f},
+        {0xcb,0xa0},{0xcb,0xa1},{0xcb,0xa2},{0xcb,0xa3},{0xcb,0xa4},{0xcb,0xa5},{0xcb,0xa6},{0xcb,0xa7},
+        {0xcb,0xa8},{0xcb,0xa9},{0xcb,0xaa},{0xcb,0xab},{0xcb,0xac},{0xcb,0xad},{0xcb,0xae},{0xcb,0xaf},
+        {0xcb,0xb0},{0xcb,0xb1},{0xcb,0xb2},{0xcb,0xb3},{0xcb,0xb4},{0xcb,0xb5},{0xcb,0xb6},{0xcb,0xb7},
+        {0xcb,0xb8},{0xcb,0xb9},{0xcb,0xba},{0xcb,0xbb},{0xcb,0xbc},{0xcb,0xbd},{0xcb,0xbe},{0xcb,0xbf},
+        {0xcc,0x80},{0xcc,0x81},{0xcc,0x82},{0xcc,0x83},{0xcc,0x84},{0xcc,0x85},{0xcc,0x86},{0xcc,0x87},
+        {0xcc,0x88},{0xcc,0x89},{0xcc,0x8a},{0xcc,0x8b},{0xcc,0x8c},{0xcc,0x8d},{0xcc,0x8e},{0xcc,0x8f},
+        {0xcc,0x90},{0xcc,0x91},{0xcc,0x92},{0xcc,0x93},{0xcc,0x94},{0xcc,0x95},{0xcc,0x96},{0xcc,0x97},
+        {0xcc,0x98},{0xcc,0x99},{0xcc,0x9a},{0xcc,0x9b},{0xcc,0x9c},{0xcc,0x9d},{0xcc,0x9e},{0xcc,0x9f},
+        {0xcc,0xa0},{0xcc,0xa1},{0xcc,0xa2},{0xcc,0xa3},{0xcc,0xa4},{0xcc,0xa5},{0xcc,0xa6},{0xcc,0xa7},
+        {0xcc,0xa8},{0xcc,0xa9},{0xcc,0xaa},{0xcc,0xab},{0xcc,0xac},{0xcc,0xad},{0xcc,0xae},{0xcc,0xaf},
+        {0xcc,0xb0},{0xcc,0xb1},{0xcc,0xb2},{0xcc,0xb3},{0xcc,0xb4},{0xcc,0xb5},{0xcc,0xb6},{0xcc,0xb7},
+        {0xcc,0xb8},{0xcc,0xb9},{0xcc,0xba},{0xcc,0xbb},{0xcc,0xbc},{0xcc,0xbd},{0xcc,0xbe},{0xcc,0xbf},
+        {0xcd,0x80},{0xcd,0x81},{0xcd,0x82},{0xcd,0x83},{0xcd,0x84},{0xcd,0x85},{0xcd,0x86},{0xcd,0x87},
+        {0xcd,0x88},{0xcd,0x89},{0xcd,0x8a},{0xcd,0x8b},{0xcd,0x8c},{0xcd,0x8d},{0xcd,0x8e},{0xcd,0x8f},
+        {0xcd,0x90},{0xcd,0x91},{0xcd,0x92},{0xcd,0x93},{0xcd,0x94},{0xcd,0x95},{0xcd,0x96},{0xcd,0x97},
+        {0xcd,0x98},{0xcd,0x99},{0xcd,0x9a},{0xcd,0x9b},{0xcd,0x9c},{0xcd,0x9d},{0xcd,0x9e},{0xcd,0x9f},
+        {0xcd,0xa0},{0xcd,0xa1},{0xcd,0xa2},{0xcd,0xa3},{0xcd,0xa4},{0xcd,0xa5},{0xcd,0xa6},{0xcd,0xa7},
+        {0xcd,0xa8},{0xcd,0xa9},{0xcd,0xaa},{0xcd,0xab},{0xcd,0xac},{0xcd,0xad},{0xcd,0xae},{0xcd,0xaf},
+        {0xcd,0xb1},{0xcd,0xb1},{0xcd,0xb3},{0xcd,0xb3},{0xcd,0xb4},{0xcd,0xb5},{0xcd,0xb7},{0xcd,0xb7},
+        {0xcd,0xb8},{0xcd,0xb9},{0xcd,0xba},{0xcd,0xbb},{0xcd,0xbc},{0xcd,0xbd},{0xcd,0xbe},{0xcf,0xb3},
+        {0xce,0x80},{0xce,0x81},{0xce,0x82},{0xce,0x83},{0xce,0x84},{0xce,0x85},{0xce,0xac},{0xce,0x87},
+        {0xce,0xad},{0xce,0xae},{0xce,0xaf},{0xce,0x8b},{0xcf,0x8c},{0xce,0x8d},{0xcf,0x8d},{0xcf,0x8e},
+        {0xce,0x90},{0xce,0xb1},{0xce,0xb2},{0xce,0xb3},{0xce,0xb4},{0xce,0xb5},{0xce,0xb6},{0xce,0xb7},
+        {0xce,0xb8},{0xce,0xb9},{0xce,0xba},{0xce,0xbb},{0xce,0xbc},{0xce,0xbd},{0xce,0xbe},{0xce,0xbf},
+        {0xcf,0x80},{0xcf,0x81},{0xce,0xa2},{0xcf,0x83},{0xcf,0x84},{0xcf,0x85},{0xcf,0x86},{0xcf,0x87},
+        {0xcf,0x88},{0xcf,0x89},{0xcf,0x8a},{0xcf,0x8b},{0xce,0xac},{0xce,0xad},{0xce,0xae},{0xce,0xaf},
+        {0xce,0xb0},{0xce,0xb1},{0xce,0xb2},{0xce,0xb3},{0xce,0xb4},{0xce,0xb5},{0xce,0xb6},{0xce,0xb7},
+        {0xce,0xb8},{0xce,0xb9},{0xce,0xba},{0xce,0xbb},{0xce,0xbc},{0xce,0xbd},{0xce,0xbe},{0xce,0xbf},
+        {0xcf,0x80},{0xcf,0x81},{0xcf,0x82},{0xcf,0x83},{0xcf,0x84},{0xcf,0x85},{0xcf,0x86},{0xcf,0x87},
+        {0xcf,0x88},{0xcf,0x89},{0xcf,0x8a},{0xcf,0x8b},{0xcf,0x8c},{0xcf,0x8d},{0xcf,0x8e},{0xcf,0x97},
+        {0xcf,0x90},{0xcf,0x91},{0xcf,0x92},{0xcf,0x93},{0xcf,0x94},{0xcf,0x95},{0xcf,0x96},{0xcf,0x97},
+        {0xcf,0x99},{0xcf,0x99},{0xcf,0x9b},{0xcf,0x9b},{0xcf,0x9d},{0xcf,0x9d},{0xcf,0x9f},{0xcf,0x9f},
+        {0xcf,0xa1},{0xcf,0xa1},{0xcf,0xa3},{0xcf,0xa3},{0xcf,0xa5},{0xcf,0xa5},{0xcf,0xa7},{0xcf,0xa7},
+        {0xcf,0xa9},{0xcf,0xa9},{0xcf,0xab},{0xcf,0xab},{0xcf,0xad},{0xcf,0xad},{0xcf,0xaf},{0xcf,0xaf},
+        {0xcf,0xb0},{0xcf,0xb1},{0xcf,0xb2},{0xcf,0xb3},{0xce,0xb8},{0xcf,0xb5},{0xcf,0xb6},{0xcf,0xb8},
+        {0xcf,0xb8},{0xcf,0xb2},{0xcf,0xbb},{0xcf,0xbb},{0xcf,0xbc},{0xcd,0xbb},{0xcd,0xbc},{0xcd,0xbd},
+        {0xd1,0x90},{0xd1,0x91},{0xd1,0x92},{0xd1,0x93},{0xd1,0x94},{0xd1,0x95},{0xd1,0x96},{0xd1,0x97},
+        {0xd1,0x98},{0xd1,0x99},{0xd1,0x9a},{0xd1,0x9b},{0xd1,0x9c},{0xd1,0x9d},{0xd1,0x9e},{0xd1,0x9f},
+        {0xd0,0xb0},{0xd0,0xb1},{0xd0,0xb2},{0xd0,0xb3},{0xd0,0xb4},{0xd0,0xb5},{0xd0,0xb6},{0xd0,0xb7},
+        {0xd0,0xb8},{0xd0,0xb9},{0xd0,0xba},{0xd0,0xbb},{0xd0,0xbc},{0xd0,0xbd},{0xd0,0xbe},{0xd0,0xbf},
+        {0xd1,0x80},{0xd1,0x81},{0xd1,0x82},{0xd1,0x83},{0xd1,0x84},{0xd1,0x85},{0xd1,0x86},{0xd1,0x87},
+        {0xd1,0x88},{0xd1,0x89},{0xd1,0x8a},{0xd1,0x8b},{0xd1,0x8c},{0xd1,0x8d},{0xd1,0x8e},{0xd1,0x8f},
+        {0xd0,0xb0},{0xd0,0xb1},{0xd0,0xb2},{0xd0,0xb3},{0xd0,0xb4},{0xd0,0xb5},{0xd0,0xb6},{0xd0,0xb7},
+        {0xd0,0xb8},{0xd0,0xb9},{0xd0,0xba},{0xd0,0xbb},{0xd0,0xbc},{0xd0,0xbd},{0xd0,0xbe},{0xd0,0xbf},
+        {0xd1,0x80},{0xd1,0x81},{0xd1,0x82},{0xd1,0x83},{0xd1,0x84},{0xd1,0x85},{0xd1,0x86},{0xd1,0x87},
+        {0xd1,0x88},{0xd1,0x89},{0xd1,0x8a},{0xd1,0x8b},{0xd1,0x8c},{0xd1,0x8d},{0xd1,0x8e},{0xd1,0x8f},
+        {0xd1,0x90},{0xd1,0x91},{0xd1,0x92},{0xd1,0x93},{0xd1,0x94},{0xd1,0x95},{0xd1,0x96},{0xd1,0x97},
+        {0xd1,0x98},{0xd1,0x99},{0xd1,0x9a},{0xd1,0x9b},{0xd1,0x9c},{0xd1,0x9d},{0xd1,0x9e},{0xd1,0x9f},
+        {0xd1,0xa1},{0xd1,0xa1},{0xd1,0xa3},{0xd1,0xa3},{0xd1,0xa5},{0xd1,0xa5},{0xd1,0xa7},{0xd1,0xa7},
+        {0xd1,0xa9},{0xd1,0xa9},{0xd1,0xab},{0xd1,0xab},{0xd1,0xad},{0xd1,0xad},{0xd1,0xaf},{0xd1,0xaf},
+        {0xd1,0xb1},{0xd1,0xb1},{0xd1,0xb3},{0xd1,0xb3},{0xd1,0xb5},{0xd1,0xb5},{0xd1,0xb7},{0xd1,0xb7},
+        {0xd1,0xb9},{0xd1,0xb9},{0xd1,0xbb},{0xd1,0xbb},{0xd1,0xbd},{0xd1,0xbd},{0xd1,0xbf},{0xd1,0xbf},
+        {0xd2,0x81},{0xd2,0x81},{0xd2,0x82},{0xd2,0x83},{0xd2,0x84},{0xd2,0x85},{0xd2,0x86},{0xd2,0x87},
+        {0xd2,0x88},{0xd2,0x89},{0xd2,0x8b},{0xd2,0x8b},{0xd2,0x8d},{0xd2,0x8d},{0xd2,0x8f},{0xd2,0x8f},
+        {0xd2,0x91},{0xd2,0x91},{0xd2,0x93},{0xd2,0x93},{0xd2,0x95},{0xd2,0x95},{0xd2,0x97},{0xd2,0x97},
+        {0xd2,0x99},{0xd2,0x99},{0xd2,0x9b},{0xd2,0x9b},{0xd2,0x9d},{0xd2,0x9d},{0xd2,0x9f},{0xd2,0x9f},
+        {0xd2,0xa1},{0xd2,0xa1},{0xd2,0xa3},{0xd2,0xa3},{0xd2,0xa5},{0xd2,0xa5},{0xd2,0xa7},{0xd2,0xa7},
+        {0xd2,0xa9},{0xd2,0xa9},{0xd2,0xab},{0xd2,0xab},{0xd2,0xad},{0xd2,0xad},{0xd2,0xaf},{0xd2,0xaf},
+        {0xd2,0xb1},{0xd2,0xb1},{0xd2,0xb3},{0xd2,0xb3},{0xd2,0xb5},{0xd2,0xb5},{0xd2,0xb7},{0xd2,0xb7},
+        {0xd2,0xb9},{0xd2,0xb9},{0xd2,0xbb},{0xd2,0xbb},{0xd2,0xbd},{0xd2,0xbd},{0xd2,0xbf},{0xd2,0xbf},
+        {0xd3,0x8f},{0xd3,0x82},{0xd3,0x82},{0xd3,0x84},{0xd3,0x84},{0xd3,0x86},{0xd3,0x86},{0xd3,0x88},
+        {0xd3,0x88},{0xd3,0x8a},{0xd3,0x8a},{0xd3,0x8c},{0xd3,0x8c},{0xd3,0x8e},{0xd3,0x8e},{0xd3,0x8f},
+        {0xd3,0x91},{0xd3,0x91},{0xd3,0x93},{0xd3,0x93},{0xd3,0x95},{0xd3,0x95},{0xd3,0x97},{0xd3,0x97},
+        {0xd3,0x99},{0xd3,0x99},{0xd3,0x9b},{0xd3,0x9b},{0xd3,0x9d},{0xd3,0x9d},{0xd3,0x9f},{0xd3,0x9f},
+        {0xd3,0xa1},{0xd3,0xa1},{0xd3,0xa3},{0xd3,0xa3},{0xd3,0xa5},{0xd3,0xa5},{0xd3,0xa7},{0xd3,0xa7},
+        {0xd3,0xa9},{0xd3,0xa9},{0xd3,0xab},{0xd3,0xab},{0xd3,0xad},{0xd3,0xad},{0xd3,0xaf},{0xd3,0xaf},
+        {0xd3,0xb1},{0xd3,0xb1},{0xd3,0xb3},{0xd3,0xb3},{0xd3,0xb5},{0xd3,0xb5},{0xd3,0xb7},{0xd3,0xb7},
+        {0xd3,0xb9},{0xd3,0xb9},{0xd3,0xbb},{0xd3,0xbb},{0xd3,0xbd},{0xd3,0xbd},{0xd3,0xbf},{0xd3,0xbf},
+        {0xd4,0x80},{0xd4,0x81},{0xd4,0x82},{0xd4,0x83},{0xd4,0x84},{0xd4,0x85},{0xd4,0x86},{0xd4,0x87},
+        {0xd4,0x88},{0xd4,0x89},{0xd4,0x8a},{0xd4,0x8b},{0xd4,0x8c},{0xd4,0x8d},{0xd4,0x8e},{0xd4,0x8f},
+        {0xd4,0x90},{0xd4,0x91},{0xd4,0x92},{0xd4,0x93},{0xd4,0x94},{0xd4,0x95},{0xd4,0x96},{0xd4,0x97},
+        {0xd4,0x98},{0xd4,0x99},{0xd4,0x9a},{0xd4,0x9b},{0xd4,0x9c},{0xd4,0x9d},{0xd4,0x9e},{0xd4,0x9f},
+        {0xd4,0xa0},{0xd4,0xa1},{0xd4,0xa2},{0xd4,0xa3},{0xd4,0xa4},{0xd4,0xa5},{0xd4,0xa6},{0xd4,0xa7},
+        {0xd4,0xa8},{0xd4,0xa9},{0xd4,0xaa},{0xd4,0xab},{0xd4,0xac},{0xd4,0xad},{0xd4,0xae},{0xd4,0xaf},
+        {0xd4,0xb0},{0xd4,0xb1},{0xd4,0xb2},{0xd4,0xb3},{0xd4,0xb4},{0xd4,0xb5},{0xd4,0xb6},{0xd4,0xb7},
+        {0xd4,0xb8},{0xd4,0xb9},{0xd4,0xba},{0xd4,0xbb},{0xd4,0xbc},{0xd4,0xbd},{0xd4,0xbe},{0xd4,0xbf},
+        {0xd5,0x80},{0xd5,0x81},{0xd5,0x82},{0xd5,0x83},{0xd5,0x84},{0xd5,0x85},{0xd5,0x86},{0xd5,0x87},
+        {0xd5,0x88},{0xd5,0x89},{0xd5,0x8a},{0xd5,0x8b},{0xd5,0x8c},{0xd5,0x8d},{0xd5,0x8e},{0xd5,0x8f},
+        {0xd5,0x90},{0xd5,0x91},{0xd5,0x92},{0xd5,0x93},{0xd5,0x94},{0xd5,0x95},{0xd5,0x96},{0xd5,0x97},
+        {0xd5,0x98},{0xd5,0x99},{0xd5,0x9a},{0xd5,0x9b},{0xd5,0x9c},{0xd5,0x9d},{0xd5,0x9e},{0xd5,0x9f},
+        {0xd5,0xa0},{0xd5,0xa1},{0xd5,0xa2},{0xd5,0xa3},{0xd5,0xa4},{0xd5,0xa5},{0xd5,0xa6},{0xd5,0xa7},
+        {0xd5,0xa8},{0xd5,0xa9},{0xd5,0xaa},{0xd5,0xab},{0xd5,0xac},{0xd5,0xad},{0xd5,0xae},{0xd5,0xaf},
+        {0xd5,0xb0},{0xd5,0xb1},{0xd5,0xb2},{0xd5,0xb3},{0xd5,0xb4},{0xd5,0xb5},{0xd5,0xb6},{0xd5,0xb7},
+        {0xd5,0xb8},{0xd5,0xb9},{0xd5,0xba},{0xd5,0xbb},{0xd5,0xbc},{0xd5,0xbd},{0xd5,0xbe},{0xd5,0xbf},
+        {0xd6,0x80},{0xd6,0x81},{0xd6,0x82},{0xd6,0x83},{0xd6,0x84},{0xd6,0x85},{0xd6,0x86},{0xd6,0x87},
+        {0xd6,0x88},{0xd6,0x89},{0xd6,0x8a},{0xd6,0x8b},{0xd6,0x8c},{0xd6,0x8d},{0xd6,0x8e},{0xd6,0x8f},
+        {0xd6,0x90},{0xd6,0x91},{0xd6,0x92},{0xd6,0x93},{0xd6,0x94},{0xd6,0x95},{0xd6,0x96},{0xd6,0x97},
+        {0xd6,0x98},{0xd6,0x99},{0xd6,0x9a},{0xd6,0x9b},{0xd6,0x9c},{0xd6,0x9d},{0xd6,0x9e},{0xd6,0x9f},
+        {0xd6,0xa0},{0xd6,0xa1},{0xd6,0xa2},{0xd6,0xa3},{0xd6,0xa4},{0xd6,0xa5},{0xd6,0xa6},{0xd6,0xa7},
+        {0xd6,0xa8},{0xd6,0xa9},{0xd6,0xaa},{0xd6,0xab},{0xd6,0xac},{0xd6,0xad},{0xd6,0xae},{0xd6,0xaf},
+        {0xd6,0xb0},{0xd6,0xb1},{0xd6,0xb2},{0xd6,0xb3},{0xd6,0xb4},{0xd6,0xb5},{0xd6,0xb6},{0xd6,0xb7},
+        {0xd6,0xb8},{0xd6,0xb9},{0xd6,0xba},{0xd6,0xbb},{0xd6,0xbc},{0xd6,0xbd},{0xd6,0xbe},{0xd6,0xbf},
+        {0xd7,0x80},{0xd7,0x81},{0xd7,0x82},{0xd7,0x83},{0xd7,0x84},{0xd7,0x85},{0xd7,0x86},{0xd7,0x87},
+        {0xd7,0x88},{0xd7,0x89},{0xd7,0x8a},{0xd7,0x8b},{0xd7,0x8c},{0xd7,0x8d},{0xd7,0x8e},{0xd7,0x8f},
+        {0xd7,0x90},{0xd7,0x91},{0xd7,0x92},{0xd7,0x93},{0xd7,0x94},{0xd7,0x95},{0xd7,0x96},{0xd7,0x97},
+        {0xd7,0x98},{0xd7,0x99},{0xd7,0x9a},{0xd7,0x9b},{0xd7,0x9c},{0xd7,0x9d},{0xd7,0x9e},{0xd7,0x9f},
+        {0xd7,0xa0},{0xd7,0xa1},{0xd7,0xa2},{0xd7,0xa3},{0xd7,0xa4},{0xd7,0xa5},{0xd7,0xa6},{0xd7,0xa7},
+        {0xd7,0xa8},{0xd7,0xa9},{0xd7,0xaa},{0xd7,0xab},{0xd7,0xac},{0xd7,0xad},{0xd7,0xae},{0xd7,0xaf},
+        {0xd7,0xb0},{0xd7,0xb1},{0xd7,0xb2},{0xd7,0xb3},{0xd7,0xb4},{0xd7,0xb5},{0xd7,0xb6},{0xd7,0xb7},
+        {0xd7,0xb8},{0xd7,0xb9},{0xd7,0xba},{0xd7,0xbb},{0xd7,0xbc},{0xd7,0xbd},{0xd7,0xbe},{0xd7,0xbf},
+        {0xd8,0x80},{0xd8,0x81},{0xd8,0x82},{0xd8,0x83},{0xd8,0x84},{0xd8,0x85},{0xd8,0x86},{0xd8,0x87},
+        {0xd8,0x88},{0xd8,0x89},{0xd8,0x8a},{0xd8,0x8b},{0xd8,0x8c},{0xd8,0x8d},{0xd8,0x8e},{0xd8,0x8f},
+        {0xd8,0x90},{0xd8,0x91},{0xd8,0x92},{0xd8,0x93},{0xd8,0x94},{0xd8,0x95},{0xd8,0x96},{0xd8,0x97},
+        {0xd8,0x98},{0xd8,0x99},{0xd8,0x9a},{0xd8,0x9b},{0xd8,0x9c},{0xd8,0x9d},{0xd8,0x9e},{0xd8,0x9f},
+        {0xd8,0xa0},{0xd8,0xa1},{0xd8,0xa2},{0xd8,0xa3},{0xd8,0xa4},{0xd8,0xa5},{0xd8,0xa6},{0xd8,0xa7},
+        {0xd8,0xa8},{0xd8,0xa9},{0xd8,0xaa},{0xd8,0xab},{0xd8,0xac},{0xd8,0xad},{0xd8,0xae},{0xd8,0xaf},
+        {0xd8,0xb0},{0xd8,0xb1},{0xd8,0xb2},{0xd8,0xb3},{0xd8,0xb4},{0xd8,0xb5},{0xd8,0xb6},{0xd8,0xb7},
+        {0xd8,0xb8},{0xd8,0xb9},{0xd8,0xba},{0xd8,0xbb},{0xd8,0xbc},{0xd8,0xbd},{0xd8,0xbe},{0xd8,0xbf},
+        {0xd9,0x80},{0xd9,0x81},{0xd9,0x82},{0xd9,0x83},{0xd9,0x84},{0xd9,0x85},{0xd9,0x86},{0xd9,0x87},
+        {0xd9,0x88},{0xd9,0x89},{0xd9,0x8a},{0xd9,0x8b},{0xd9,0x8c},{0xd9,0x8d},{0xd9,0x8e},{0xd9,0x8f},
+        {0xd9,0x90},{0xd9,0x91},{0xd9,0x92},{0xd9,0x93},{0xd9,0x94},{0xd9,0x95},{0xd9,0x96},{0xd9,0x97},
+        {0xd9,0x98},{0xd9,0x99},{0xd9,0x9a},{0xd9,0x9b},{0xd9,0x9c},{0xd9,0x9d},{0xd9,0x9e},{0xd9,0x9f},
+        {0xd9,0xa0},{0xd9,0xa1},{0xd9,0xa2},{0xd9,0xa3},{0xd9,0xa4},{0xd9,0xa5},{0xd9,0xa6},{0xd9,0xa7},
+        {0xd9,0xa8},{0xd9,0xa9},{0xd9,0xaa},{0xd9,0xab},{0xd9,0xac},{0xd9,0xad},{0xd9,0xae},{0xd9,0xaf},
+        {0xd9,0xb0},{0xd9,0xb1},{0xd9,0xb2},{0xd9,0xb3},{0xd9,0xb4},{0xd9,0xb5},{0xd9,0xb6},{0xd9,0xb7},
+        {0xd9,0xb8},{0xd9,0xb9},{0xd9,0xba},{0xd9,0xbb},{0xd9,0xbc},{0xd9,0xbd},{0xd9,0xbe},{0xd9,0xbf},
+        {0xda,0x80},{0xda,0x81},{0xda,0x82},{0xda,0x83},{0xda,0x84},{0xda,0x85},{0xda,0x86},{0xda,0x87},
+        {0xda,0x88},{0xda,0x89},{0xda,0x8a},{0xda,0x8b},{0xda,0x8c},{0xda,0x8d},{0xda,0x8e},{0xda,0x8f},
+        {0xda,0x90},{0xda,0x91},{0xda,0x92},{0xda,0x93},{0xda,0x94},{0xda,0x95},{0xda,0x96},{0xda,0x97},
+        {0xda,0x98},{0xda,0x99},{0xda,0x9a},{0xda,0x9b},{0xda,0x9c},{0xda,0x9d},{0xda,0x9e},{0xda,0x9f},
+        {0xda,0xa0},{0xda,0xa1},{0xda,0xa2},{0xda,0xa3},{0xda,0xa4},{0xda,0xa5},{0xda,0xa6},{0xda,0xa7},
+        {0xda,0xa8},{0xda,0xa9},{0xda,0xaa},{0xda,0xab},{0xda,0xac},{0xda,0xad},{0xda,0xae},{0xda,0xaf},
+        {0xda,0xb0},{0xda,0xb1},{0xda,0xb2},{0xda,0xb3},{0xda,0xb4},{0xda,0xb5},{0xda,0xb6},{0xda,0xb7},
+        {0xda,0xb8},{0xda,0xb9},{0xda,0xba},{0xda,0xbb},{0xda,0xbc},{0xda,0xbd},{0xda,0xbe},{0xda,0xbf},
+        {0xdb,0x80},{0xdb,0x81},{0xdb,0x82},{0xdb,0x83},{0xdb,0x84},{0xdb,0x85},{0xdb,0x86},{0xdb,0x87},
+        {0xdb,0x88},{0xdb,0x89},{0xdb,0x8a},{0xdb,0x8b},{0xdb,0x8c},{0xdb,0x8d},{0xdb,0x8e},{0xdb,0x8f},
+        {0xdb,0x90},{0xdb,0x91},{0xdb,0x92},{0xdb,0x93},{0xdb,0x94},{0xdb,0x95},{0xdb,0x96},{0xdb,0x97},
+        {0xdb,0x98},{0xdb,0x99},{0xdb,0x9a},{0xdb,0x9b},{0xdb,0x9c},{0xdb,0x9d},{0xdb,0x9e},{0xdb,0x9f},
+        {0xdb,0xa0},{0xdb,0xa1},{0xdb,0xa2},{0xdb,0xa3},{0xdb,0xa4},{0xdb,0xa5},{0xdb,0xa6},{0xdb,0xa7},
+        {0xdb,0xa8},{0xdb,0xa9},{0xdb,0xaa},{0xdb,0xab},{0xdb,0xac},{0xdb,0xad},{0xdb,0xae},{0xdb,0xaf},
+        {0xdb,0xb0},{0xdb,0xb1},{0xdb,0xb2},{0xdb,0xb3},{0xdb,0xb4},{0xdb,0xb5},{0xdb,0xb6},{0xdb,0xb7},
+        {0xdb,0xb8},{0xdb,0xb9},{0xdb,0xba},{0xdb,0xbb},{0xdb,0xbc},{0xdb,0xbd},{0xdb,0xbe},{0xdb,0xbf},
+        {0xdc,0x80},{0xdc,0x81},{0xdc,0x82},{0xdc,0x83},{0xdc,0x84},{0xdc,0x85},{0xdc,0x86},{0xdc,0x87},
+        {0xdc,0x88},{0xdc,0x89},{0xdc,0x8a},{0xdc,0x8b},{0xdc,0x8c},{0xdc,0x8d},{0xdc,0x8e},{0xdc,0x8f},
+        {0xdc,0x90},{0xdc,0x91},{0xdc,0x92},{0xdc,0x93},{0xdc,0x94},{0xdc,0x95},{0xdc,0x96},{0xdc,0x97},
+        {0xdc,0x98},{0xdc,0x99},{0xdc,0x9a},{0xdc,0x9b},{0xdc,0x9c},{0xdc,0x9d},{0xdc,0x9e},{0xdc,0x9f},
+        {0xdc,0xa0},{0xdc,0xa1},{0xdc,0xa2},{0xdc,0xa3},{0xdc,0xa4},{0xdc,0xa5},{0xdc,0xa6},{0xdc,0xa7},
+        {0xdc,0xa8},{0xdc,0xa9},{0xdc,0xaa},{0xdc,0xab},{0xdc,0xac},{0xdc,0xad},{0xdc,0xae},{0xdc,0xaf},
+        {0xdc,0xb0},{0xdc,0xb1},{0xdc,0xb2},{0xdc,0xb3},{0xdc,0xb4},{0xdc,0xb5},{0xdc,0xb6},{0xdc,0xb7},
+        {0xdc,0xb8},{0xdc,0xb9},{0xdc,0xba},{0xdc,0xbb},{0xdc,0xbc},{0xdc,0xbd},{0xdc,0xbe},{0xdc,0xbf},
+        {0xdd,0x80},{0xdd,0x81},{0xdd,0x82},{0xdd,0x83},{0xdd,0x84},{0xdd,0x85},{0xdd,0x86},{0xdd,0x87},
+        {0xdd,0x88},{0xdd,0x89},{0xdd,0x8a},{0xdd,0x8b},{0xdd,0x8c},{0xdd,0x8d},{0xdd,0x8e},{0xdd,0x8f},
+        {0xdd,0x90},{0xdd,0x91},{0xdd,0x92},{0xdd,0x93},{0xdd,0x94},{0xdd,0x95},{0xdd,0x96},{0xdd,0x97},
+        {0xdd,0x98},{0xdd,0x99},{0xdd,0x9a},{0xdd,0x9b},{0xdd,0x9c},{0xdd,0x9d},{0xdd,0x9e},{0xdd,0x9f},
+        {0xdd,0xa0},{0xdd,0xa1},{0xdd,0xa2},{0xdd,0xa3},{0xdd,0xa4},{0xdd,0xa5},{0xdd,0xa6},{0xdd,0xa7},
+        {0xdd,0xa8},{0xdd,0xa9},{0xdd,0xaa},{0xdd,0xab},{0xdd,0xac},{0xdd,0xad},{0xdd,0xae},{0xdd,0xaf},
+        {0xdd,0xb0},{0xdd,0xb1},{0xdd,0xb2},{0xdd,0xb3},{0xdd,0xb4},{0xdd,0xb5},{0xdd,0xb6},{0xdd,0xb7},
+        {0xdd,0xb8},{0xdd,0xb9},{0xdd,0xba},{0xdd,0xbb},{0xdd,0xbc},{0xdd,0xbd},{0xdd,0xbe},{0xdd,0xbf},
+        {0xde,0x80},{0xde,0x81},{0xde,0x82},{0xde,0x83},{0xde,0x84},{0xde,0x85},{0xde,0x86},{0xde,0x87},
+        {0xde,0x88},{0xde,0x89},{0xde,0x8a},{0xde,0x8b},{0xde,0x8c},{0xde,0x8d},{0xde,0x8e},{0xde,0x8f},
+        {0xde,0x90},{0xde,0x91},{0xde,0x92},{0xde,0x93},{0xde,0x94},{0xde,0x95},{0xde,0x96},{0xde,0x97},
+        {0xde,0x98},{0xde,0x99},{0xde,0x9a},{0xde,0x9b},{0xde,0x9c},{0xde,0x9d},{0xde,0x9e},{0xde,0x9f},
+        {0xde,0xa0},{0xde,0xa1},{0xde,0xa2},{0xde,0xa3},{0xde,0xa4},{0xde,0xa5},{0xde,0xa6},{0xde,0xa7},
+        {0xde,0xa8},{0xde,0xa9},{0xde,0xaa},{0xde,0xab},{0xde,0xac},{0xde,0xad},{0xde,0xae},{0xde,0xaf},
+        {0xde,0xb0},{0xde,0xb1},{0xde,0xb2},{0xde,0xb3},{0xde,0xb4},{0xde,0xb5},{0xde,0xb6},{0xde,0xb7},
+        {0xde,0xb8},{0xde,0xb9},{0xde,0xba},{0xde,0xbb},{0xde,0xbc},{0xde,0xbd},{0xde,0xbe},{0xde,0xbf},
+        {0xdf,0x80},{0xdf,0x81},{0xdf,0x82},{0xdf,0x83},{0xdf,0x84},{0xdf,0x85},{0xdf,0x86},{0xdf,0x87},
+        {0xdf,0x88},{0xdf,0x89},{0xdf,0x8a},{0xdf,0x8b},{0xdf,0x8c},{0xdf,0x8d},{0xdf,0x8e},{0xdf,0x8f},
+        {0xdf,0x90},{0xdf,0x91},{0xdf,0x92},{0xdf,0x93},{0xdf,0x94},{0xdf,0x95},{0xdf,0x96},{0xdf,0x97},
+        {0xdf,0x98},{0xdf,0x99},{0xdf,0x9a},{0xdf,0x9b},{0xdf,0x9c},{0xdf,0x9d},{0xdf,0x9e},{0xdf,0x9f},
+        {0xdf,0xa0},{0xdf,0xa1},{0xdf,0xa2},{0xdf,0xa3},{0xdf,0xa4},{0xdf,0xa5},{0xdf,0xa6},{0xdf,0xa7},
+        {0xdf,0xa8},{0xdf,0xa9},{0xdf,0xaa},{0xdf,0xab},{0xdf,0xac},{0xdf,0xad},{0xdf,0xae},{0xdf,0xaf},
+        {0xdf,0xb0},{0xdf,0xb1},{0xdf,0xb2},{0xdf,0xb3},{0xdf,0xb4},{0xdf,0xb5},{0xdf,0xb6},{0xdf,0xb7},
+        {0xdf,0xb8},{0xdf,0xb9},{0xdf,0xba},{0xdf,0xbb},{0xdf,0xbc},{0xdf,0xbd},{0xdf,0xbe},{0xdf,0xbf},
+    },
+    // upper
+    {
+        {0xc2,0x80},{0xc2,0x81},{0xc2,0x82},{0xc2,0x83},{0xc2,0x84},{0xc2,0x85},{0xc2,0x86},{0xc2,0x87},
+        {0xc2,0x88},{0xc2,0x89},{0xc2,0x8a},{0xc2,0x8b},{0xc2,0x8c},{0xc2,0x8d},{0xc2,0x8e},{0xc2,0x8f},
+        {0xc2,0x90},{0xc2,0x91},{0xc2,0x92},{0xc2,0x93},{0xc2,0x94},{0xc2,0x95},{0xc2,0x96},{0xc2,0x97},
+        {0xc2,0x98},{0xc2,0x99},{0xc2,0x9a},{0xc2,0x9b},{0xc2,0x9c},{0xc2,0x9d},{0xc2,0x9e},{0xc2,0x9f},
+        {0xc2,0xa0},{0xc2,0xa1},{0xc2,0xa2},{0xc2,0xa3},{0xc2,0xa4},{0xc2,0xa5},{0xc2,0xa6},{0xc2,0xa7},
+        {0xc2,0xa8},{0xc2,0xa9},{0xc2,0xaa},{0xc2,0xab},{0xc2,0xac},{0xc2,0xad},{0xc2,0xae},{0xc2,0xaf},
+        {0xc2,0xb0},{0xc2,0xb1},{0xc2,0xb2},{0xc2,0xb3},{0xc2,0xb4},{0xce,0x9c},{0xc2,0xb6},{0xc2,0xb7},
+        {0xc2,0xb8},{0xc2,0xb9},{0xc2,0xba},{0xc2,0xbb},{0xc2,0xbc},{0xc2,0xbd},{0xc2,0xbe},{0xc2,0xbf},
+        {0xc3,0x80},{0xc3,0x81},{0xc3,0x82},{0xc3,0x83},{0xc3,0x84},{0xc3,0x85},{0xc3,0x86},{0xc3,0x87},
+        {0xc3,0x88},{0xc3,0x89},{0xc3,0x8a},{0xc3,0x8b},{0xc3,0x8c},{0xc3,0x8d},{0xc3,0x8e},{0xc3,0x8f},
+        {0xc3,0x90},{0xc3,0x91},{0xc3,0x92},{0xc3,0x93},{0xc3,0x94},{0xc3,0x95},{0xc3,0x96},{0xc3,0x97},
+        {0xc3,0x98},{0xc3,0x99},{0xc3,0x9a},{0xc3,0x9b},{0xc3,0x9c},{0xc3,0x9d},{0xc3,0x9e},{0xc3,0x9f},
+        {0xc3,0x80},{0xc3,0x81},{0xc3,0x82},{0xc3,0x83},{0xc3,0x84},{0xc3,0x85},{0xc3,0x86},{0xc3,0x87},
+        {0xc3,0x88},{0xc3,0x89},{0xc3,0x8a},{0xc3,0x8b},{0xc3,0x8c},{0xc3,0x8d},{0xc3,0x8e},{0xc3,0x8f},
+        {0xc3,0x90},{0xc3,0x91},{0xc3,0x92},{0xc3,0x93},{0xc3,0x94},{0xc3,0x95},{0xc3,0x96},{0xc3,0xb7},
+        {0xc3,0x98},{0xc3,0x99},{0xc3,0x9a},{0xc3,0x9b},{0xc3,0x9c},{0xc3,0x9d},{0xc3,0x9e},{0xc5,0xb8},
+        {0xc4,0x80},{0xc4,0x80},{0xc4,0x82},{0xc4,0x82},{0xc4,0x84},{0xc4,0x84},{0xc4,0x86},{0xc4,0x86},
+        {0xc4,0x88},{0xc4,0x88},{0xc4,0x8a},{0xc4,0x8a},{0xc4,0x8c},{0xc4,0x8c},{0xc4,0x8e},{0xc4,0x8e},
+        {0xc4,0x90},{0xc4,0x90},{0xc4,0x92},{0xc4,0x92},{0xc4,0x94},{0xc4,0x94},{0xc4,0x96},{0xc4,0x96},
+        {0xc4,0x98},{0xc4,0x98},{0xc4,0x9a},{0xc4,0x9a},{0xc4,0x9c},{0xc4,0x9c},{0xc4,0x9e},{0xc4,0x9e},
+        {0xc4,0xa0},{0xc4,0xa0},{0xc4,0xa2},{0xc4,0xa2},{0xc4,0xa4},{0xc4,0xa4},{0xc4,0xa6},{0xc4,0xa6},
+        {0xc4,0xa8},{0xc4,0xa8},{0xc4,0xaa},{0xc4,0xaa},{0xc4,0xac},{0xc4,0xac},{0xc4,0xae},{0xc4,0xae},
+        {0xc4,0xb0},{0xc4,0xb1},{0xc4,0xb2},{0xc4,0xb2},{0xc4,0xb4},{0xc4,0xb4},{0xc4,0xb6},{0xc4,0xb6},
+        {0xc4,0xb8},{0xc4,0xb9},{0xc4,0xb9},{0xc4,0xbb},{0xc4,0xbb},{0xc4,0xbd},{0xc4,0xbd},{0xc4,0xbf},
+        {0xc4,0xbf},{0xc5,0x81},{0xc5,0x81},{0xc5,0x83},{0xc5,0x83},{0xc5,0x85},{0xc5,0x85},{0xc5,0x87},
+        {0xc5,0x87},{0xc5,0x89},{0xc5,0x8a},{0xc5,0x8a},{0xc5,0x8c},{0xc5,0x8c},{0xc5,0x8e},{0xc5,0x8e},
+        {0xc5,0x90},{0xc5,0x90},{0xc5,0x92},{0xc5,0x92},{0xc5,0x94},{0xc5,0x94},{0xc5,0x96},{0xc5,0x96},
+        {0xc5,0x98},{0xc5,0x98},{0xc5,0x9a},{0xc5,0x9a},{0xc5,0x9c},{0xc5,0x9c},{0xc5,0x9e},{0xc5,0x9e},
+        {0xc5,0xa0},{0xc5,0xa0},{0xc5,0xa2},{0xc5,0xa2},{0xc5,0xa4},{0xc5,0xa4},{0xc5,0xa6},{0xc5,0xa6},
+        {0xc5,0xa8},{0xc5,0xa8},{0xc5,0xaa},{0xc5,0xaa},{0xc5,0xac},{0xc5,0xac},{0xc5,0xae},{0xc5,0xae},
+        {0xc5,0xb0},{0xc5,0xb0},{0xc5,0xb2},{0xc5,0xb2},{0xc5,0xb4},{0xc5,0xb4},{0xc5,0xb6},{0xc5,0xb6},
+        {0xc5,0xb8},{0xc5,0xb9},{0xc5,0xb9},{0xc5,0xbb},{0xc5,0xbb},{0xc5,0xbd},{0xc5,0xbd},{0xc5,0xbf},
+        {0xc6,0x80},{0xc6,0x81},{0xc6,0x82},{0xc6,0x83},{0xc6,0x84},{0xc6,0x85},{0xc6,0x86},{0xc6,0x87},
+        {0xc6,0x88},{0xc6,0x89},{0xc6,0x8a},{0xc6,0x8b},{0xc6,0x8c},{0xc6,0x8d},{0xc6,0x8e},{0xc6,0x8f},
+        {0xc6,0x90},{0xc6,0x91},{0xc6,0x92},{0xc6,0x93},{0xc6,0x94},{0xc6,0x95},{0xc6,0x96},{0xc6,0x97},
+        {0xc6,0x98},{0xc6,0x99},{0xc6,0x9a},{0xc6,0x9b},{0xc6,0x9c},{0xc6,0x9d},{0xc6,0x9e},{0xc6,0x9f},
+        {0xc6,0xa0},{0xc6,0xa1},{0xc6,0xa2},{0xc6,0xa3},{0xc6,0xa4},{0xc6,0xa5},{0xc6,0xa6},{0xc6,0xa7},
+        {0xc6,0xa8},{0xc6,0xa9},{0xc6,0xaa},{0xc6,0xab},{0xc6,0xac},{0xc6,0xad},{0xc6,0xae},{0xc6,0xaf},
+        {0xc6,0xb0},{0xc6,0xb1},{0xc6,0xb2},{0xc6,0xb3},{0xc6,0xb4},{0xc6,0xb5},{0xc6,0xb6},{0xc6,0xb7},
+        {0xc6,0xb8},{0xc6,0xb9},{0xc6,0xba},{0xc6,0xbb},{0xc6,0xbc},{0xc6,0xbd},{0xc6,0xbe},{0xc6,0xbf},
+        {0xc7,0x80},{0xc7,0x81},{0xc7,0x82},{0xc7,0x83},{0xc7,0x84},{0xc7,0x85},{0xc7,0x86},{0xc7,0x87},
+        {0xc7,0x88},{0xc7,0x89},{0xc7,0x8a},{0xc7,0x8b},{0xc7,0x8c},{0xc7,0x8d},{0xc7,0x8e},{0xc7,0x8f},
+        {0xc7,0x90},{0xc7,0x91},{0xc7,0x92},{0xc7,0x93},{0xc7,0x94},{0xc7,0x95},{0xc7,0x96},{0xc7,0x97},
+        {0xc7,0x98},{0xc7,0x99},{0xc7,0x9a},{0xc7,0x9b},{0xc7,0x9c},{0xc7,0x9d},{0xc7,0x9e},{0xc7,0x9f},
+        {0xc7,0xa0},{0xc7,0xa1},{0xc7,0xa2},{0xc7,0xa3},{0xc7,0xa4},{0xc7,0xa5},{0xc7,0xa6},{0xc7,0xa7},
+        {0xc7,0xa8},{0xc7,0xa9},{0xc7,0xaa},{0xc7,0xab},{0xc7,0xac},{0xc7,0xad},{0xc7,0xae},{0xc7,0xaf},
+        {0xc7,0xb0},{0xc7,0xb1},{0xc7,0xb2},{0xc7,0xb3},{0xc7,0xb4},{0xc7,0xb5},{0xc7,0xb6},{0xc7,0xb7},
+        {0xc7,0xb8},{0xc7,0xb9},{0xc7,0xba},{0xc7,0xbb},{0xc7,0xbc},{0xc7,0xbd},{0xc7,0xbe},{0xc7,0xbf},
+        {0xc8,0x80},{0xc8,0x81},{0xc8,0x82},{0xc8,0x83},{0xc8,0x84},{0xc8,0x85},{0xc8,0x86},{0xc8,0x87},
+        {0xc8,0x88},{0xc8,0x89},{0xc8,0x8a},{0xc8,0x8b},{0xc8,0x8c},{0xc8,0x8d},{0xc8,0x8e},{0xc8,0x8f},
+        {0xc8,0x90},{0xc8,0x91},{0xc8,0x92},{0xc8,0x93},{0xc8,0x94},{0xc8,0x95},{0xc8,0x96},{0xc8,0x97},
+        {0xc8,0x98},{0xc8,0x99},{0xc8,0x9a},{0xc8,0x9b},{0xc8,0x9c},{0xc8,0x9d},{0xc8,0x9e},{0xc8,0x9f},
+        {0xc8,0xa0},{0xc8,0xa1},{0xc8,0xa2},{0xc8,0xa3},{0xc8,0xa4},{0xc8,0xa5},{0xc8,0xa6},{0xc8,0xa7},
+        {0xc8,0xa8},{0xc8,0xa9},{0xc8,0xaa},{0xc8,0xab},{0xc8,0xac},{0xc8,0xad},{0xc8,0xae},{0xc8,0xaf},
+        {0xc8,0xb0},{0xc8,0xb1},{0xc8,0xb2},{0xc8,0xb3},{0xc8,0xb4},{0xc8,0xb5},{0xc8,0xb6},{0xc8,0xb7},
+        {0xc8,0xb8},{0xc8,0xb9},{0xc8,0xba},{0xc8,0xbb},{0xc8,0xbc},{0xc8,0xbd},{0xc8,0xbe},{0xc8,0xbf},
+        {0xc9,0x80},{0xc9,0x81},{0xc9,0x82},{0xc9,0x83},{0xc9,0x84},{0xc9,0x85},{0xc9,0x86},{0xc9,0x87},
+        {0xc9,0x88},{0xc9,0x89},{0xc9,0x8a},{0xc9,0x8b},{0xc9,0x8c},{0xc9,0x8d},{0xc9,0x8e},{0xc9,0x8f},
+        {0xc9,0x90},{0xc9,0x91},{0xc9,0x92},{0xc9,0x93},{0xc9,0x94},{0xc9,0x95},{0xc9,0x96},{0xc9,0x97},
+        {0xc9,0x98},{0xc9,0x99},{0xc9,0x9a},{0xc9,0x9b},{0xc9,0x9c},{0xc9,0x9d},{0xc9,0x9e},{0xc9,0x9f},
+        {0xc9,0xa0},{0xc9,0xa1},{0xc9,0xa2},{0xc9,0xa3},{0xc9,0xa4},{0xc9,0xa5},{0xc9,0xa6},{0xc9,0xa7},
+        {0xc9,0xa8},{0xc9,0xa9},{0xc9,0xaa},{0xc9,0xab},{0xc9,0xac},{0xc9,0xad},{0xc9,0xae},{0xc9,0xaf},
+        {0xc9,0xb0},{0xc9,0xb1},{0xc9,0xb2},{0xc9,0xb3},{0xc9,0xb4},{0xc9,0xb5},{0xc9,0xb6},{0xc9,0xb7},
+        {0xc9,0xb8},{0xc9,0xb9},{0xc9,0xba},{0xc9,0xbb},{0xc9,0xbc},{0xc9,0xbd},{0xc9,0xbe},{0xc9,0xbf},
+        {0xca,0x80},{0xca,0x81},{0xca,0x82},{0xca,0x83},{0xca,0x84},{0xca,0x85},{0xca,0x86},{0xca,0x87},
+        {0xca,0x88},{0xca,0x89},{0xca,0x8a},{0xca,0x8b},{0xca,0x8c},{0xca,0x8d},{0xca,0x8e},{0xca,0x8f},
+        {0xca,0x90},{0xca,0x91},{0xca,0x92},{0xca,0x93},{0xca,0x94},{0xca,0x95},{0xca,0x96},{0xca,0x97},
+        {0xca,0x98},{0xca,0x99},{0xca,0x9a},{0xca,0x9b},{0xca,0x9c},{0xca,0x9d},{0xca,0x9e},{0xca,0x9f},
+        {0xca,0xa0},{0xca,0xa1},{0xca,0xa2},{0xca,0xa3},{0xca,0xa4},{0xca,0xa5},{0xca,0xa6},{0xca,0xa7},
+        {0xca,0xa8},{0xca,0xa9},{0xca,0xaa},{0xca,0xab},{0xca,0xac},{0xca,0xad},{0xca,0xae},{0xca,0xaf},
+        {0xca,0xb0},{0xca,0xb1},{0xca,0xb2},{0xca,0xb3},{0xca,0xb4},{0xca,0xb5},{0xca,0xb6},{0xca,0xb7},
+        {0xca,0xb8},{0xca,0xb9},{0xca,0xba},{0xca,0xbb},{0xca,0xbc},{0xca,0xbd},{0xca,0xbe},{0xca,0xbf},
+        {0xcb,0x80},{0xcb,0x81},{0xcb,0x82},{0xcb,0x83},{0xcb,0x84},{0xcb,0x85},{0xcb,0x86},{0xcb,0x87},
+        {0xcb,0x88},{0xcb,0x89},{0xcb,0x8a},{0xcb,0x8b},{0xcb,0x8c},{0xcb,0x8d},{0xcb,0x8e},{0xcb,0x8f},
+        {0xcb,0x90},{0xcb,0x91},{0xcb,0x92},{0xcb,0x93},{0xcb,0x94},{0xcb,0x95},{0xcb,0x96},{0xcb,0x97},
+        {0xcb,0x98},{0xcb,0x99},{0xcb,0x9a},{0xcb,0x9b},{0xcb,0x9c},{0xcb,0x9d},{0xcb,0x9e},{0xcb,0x9f},
+        {0xcb,0xa0},{0xcb,0xa1},{0xcb,0xa2},{0xcb,0xa3},{0xcb,0xa4},{0xcb,0xa5},{0xcb,0xa6},{0xcb,0xa7},
+        {0xcb,0xa8},{0xcb,0xa9},{0xcb,0xaa},{0xcb,0xab},{0xcb,0xac},{0xcb,0xad},{0xcb,0xae},{0xcb,0xaf},
+        {0xcb,0xb0},{0xcb,0xb1},{0xcb,0xb2},{0xcb,0xb3},{0xcb,0xb4},{0xcb,0xb5},{0xcb,0xb6},{0xcb,0xb7},
+        {0xcb,0xb8},{0xcb,0xb9},{0xcb,0xba},{0xcb,0xbb},{0xcb,0xbc},{0xcb,0xbd},{0xcb,0xbe},{0xcb,0xbf},
+        {0xcc,0x80},{0xcc,0x81},{0xcc,0x82},{0xcc,0x83},{0xcc,0x84},{0xcc,0x85},{0xcc,0x86},{0xcc,0x87},
+        {0xcc,0x88},{0xcc,0x89},{0xcc,0x8a},{0xcc,0x8b},{0xcc,0x8c},{0xcc,0x8d},{0xcc,0x8e},{0xcc,0x8f},
+        {0xcc,0x90},{0xcc,0x91},{0xcc,0x92},{0xcc,0x93},{0xcc,0x94},{0xcc,0x95},{0xcc,0x96},{0xcc,0x97},
+        {0xcc,0x98},{0xcc,0x99},{0xcc,0x9a},{0xcc,0x9b},{0xcc,0x9c},{0xcc,0x9d},{0xcc,0x9e},{0xcc,0x9f},
+        {0xcc,0xa0},{0xcc,0xa1},{0xcc,0xa2},{0xcc,0xa3},{0xcc,0xa4},{0xcc,0xa5},{0xcc,0xa6},{0xcc,0xa7},
+        {0xcc,0xa8},{0xcc,0xa9},{0xcc,0xaa},{0xcc,0xab},{0xcc,0xac},{0xcc,0xad},{0xcc,0xae},{0xcc,0xaf},
+        {0xcc,0xb0},{0xcc,0xb1},{0xcc,0xb2},{0xcc,0xb3},{0xcc,0xb4},{0xcc,0xb5},{0xcc,0xb6},{0xcc,0xb7},
+        {0xcc,0xb8},{0xcc,0xb9},{0xcc,0xba},{0xcc,0xbb},{0xcc,0xbc},{0xcc,0xbd},{0xcc,0xbe},{0xcc,0xbf},
+        {0xcd,0x80},{0xcd,0x81},{0xcd,0x82},{0xcd,0x83},{0xcd,0x84},{0xcd,0x85},{0xcd,0x86},{0xcd,0x87},
+        {0xcd,0x88},{0xcd,0x89},{0xcd,0x8a},{0xcd,0x8b},{0xcd,0x8c},{0xcd,0x8d},{0xcd,0x8e},{0xcd,0x8f},
+        {0xcd,0x90},{0xcd,0x91},{0xcd,0x92},{0xcd,0x93},{0xcd,0x94},{0xcd,0x95},{0xcd,0x96},{0xcd,0x97},
+        {0xcd,0x98},{0xcd,0x99},{0xcd,0x9a},{0xcd,0x9b},{0xcd,0x9c},{0xcd,0x9d},{0xcd,0x9e},{0xcd,0x9f},
+        {0xcd,0xa0},{0xcd,0xa1},{0xcd,0xa2},{0xcd,0xa3},{0xcd,0xa4},{0xcd,0xa5},{0xcd,0xa6},{0xcd,0xa7},
+        {0xcd,0xa8},{0xcd,0xa9},{0xcd,0xaa},{0xcd,0xab},{0xcd,0xac},{0xcd,0xad},{0xcd,0xae},{0xcd,0xaf},
+        {0xcd,0xb0},{0xcd,0xb0},{0xcd,0xb2},{0xcd,0xb2},{0xcd,0xb4},{0xcd,0xb5},{0xcd,0xb6},{0xcd,0xb6},
+        {0xcd,0xb8},{0xcd,0xb9},{0xcd,0xba},{0xcf,0xbd},{0xcf,0xbe},{0xcf,0xbf},{0xcd,0xbe},{0xcd,0xbf},
+        {0xce,0x80},{0xce,0x81},{0xce,0x82},{0xce,0x83},{0xce,0x84},{0xce,0x85},{0xce,0x86},{0xce,0x87},
+        {0xce,0x88},{0xce,0x89},{0xce,0x8a},{0xce,0x8b},{0xce,0x8c},{0xce,0x8d},{0xce,0x8e},{0xce,0x8f},
+        {0xce,0x90},{0xce,0x91},{0xce,0x92},{0xce,0x93},{0xce,0x94},{0xce,0x95},{0xce,0x96},{0xce,0x97},
+        {0xce,0x98},{0xce,0x99},{0xce,0x9a},{0xce,0x9b},{0xce,0x9c},{0xce,0x9d},{0xce,0x9e},{0xce,0x9f},
+        {0xce,0xa0},{0xce,0xa1},{0xce,0xa2},{0xce,0xa3},{0xce,0xa4},{0xce,0xa5},{0xce,0xa6},{0xce,0xa7},
+        {0xce,0xa8},{0xce,0xa9},{0xce,0xaa},{0xce,0xab},{0xce,0x86},{0xce,0x88},{0xce,0x89},{0xce,0x8a},
+        {0xce,0xb0},{0xce,0x91},{0xce,0x92},{0xce,0x93},{0xce,0x94},{0xce,0x95},{0xce,0x96},{0xce,0x97},
+        {0xce,0x98},{0xce,0x99},{0xce,0x9a},{0xce,0x9b},{0xce,0x9c},{0xce,0x9d},{0xce,0x9e},{0xce,0x9f},
+        {0xce,0xa0},{0xce,0xa1},{0xce,0xa3},{0xce,0xa3},{0xce,0xa4},{0xce,0xa5},{0xce,0xa6},{0xce,0xa7},
+        {0xce,0xa8},{0xce,0xa9},{0xce,0xaa},{0xce,0xab},{0xce,0x8c},{0xce,0x8e},{0xce,0x8f},{0xcf,0x8f},
+        {0xce,0x92},{0xce,0x98},{0xcf,0x92},{0xcf,0x93},{0xcf,0x94},{0xce,0xa6},{0xce,0xa0},{0xcf,0x8f},
+        {0xcf,0x98},{0xcf,0x98},{0xcf,0x9a},{0xcf,0x9a},{0xcf,0x9c},{0xcf,0x9c},{0xcf,0x9e},{0xcf,0x9e},
+        {0xcf,0xa0},{0xcf,0xa0},{0xcf,0xa2},{0xcf,0xa2},{0xcf,0xa4},{0xcf,0xa4},{0xcf,0xa6},{0xcf,0xa6},
+        {0xcf,0xa8},{0xcf,0xa8},{0xcf,0xaa},{0xcf,0xaa},{0xcf,0xac},{0xcf,0xac},{0xcf,0xae},{0xcf,0xae},
+        {0xce,0x9a},{0xce,0xa1},{0xcf,0xb9},{0xcd,0xbf},{0xcf,0xb4},{0xce,0x95},{0xcf,0xb6},{0xcf,0xb7},
+        {0xcf,0xb7},{0xcf,0xb9},{0xcf,0xba},{0xcf,0xba},{0xcf,0xbc},{0xcf,0xbd},{0xcf,0xbe},{0xcf,0xbf},
+        {0xd0,0x80},{0xd0,0x81},{0xd0,0x82},{0xd0,0x83},{0xd0,0x84},{0xd0,0x85},{0xd0,0x86},{0xd0,0x87},
+        {0xd0,0x88},{0xd0,0x89},{0xd0,0x8a},{0xd0,0x8b},{0xd0,0x8c},{0xd0,0x8d},{0xd0,0x8e},{0xd0,0x8f},
+        {0xd0,0x90},{0xd0,0x91},{0xd0,0x92},{0xd0,0x93},{0xd0,0x94},{0xd0,0x95},{0xd0,0x96},{0xd0,0x97},
+        {0xd0,0x98},{0xd0,0x99},{0xd0,0x9a},{0xd0,0x9b},{0xd0,0x9c},{0xd0,0x9d},{0xd0,0x9e},{0xd0,0x9f},
+        {0xd0,0xa0},{0xd0,0xa1},{0xd0,0xa2},{0xd0,0xa3},{0xd0,0xa4},{0xd0,0xa5},{0xd0,0xa6},{0xd0,0xa7},
+        {0xd0,0xa8},{0xd0,0xa9},{0xd0,0xaa},{0xd0,0xab},{0xd0,0xac},{0xd0,0xad},{0xd0,0xae},{0xd0,0xaf},
+        {0xd0,0x90},{0xd0,0x91},{0xd0,0x92},{0xd0,0x93},{0xd0,0x94},{0xd0,0x95},{0xd0,0x96},{0xd0,0x97},
+        {0xd0,0x98},{0xd0,0x99},{0xd0,0x9a},{0xd0,0x9b},{0xd0,0x9c},{0xd0,0x9d},{0xd0,0x9e},{0xd0,0x9f},
+        {0xd0,0xa0},{0xd0,0xa1},{0xd0,0xa2},{0xd0,0xa3},{0xd0,0xa4},{0xd0,0xa5},{0xd0,0xa6},{0xd0,0xa7},
+        {0xd0,0xa8},{0xd0,0xa9},{0xd0,0xaa},{0xd0,0xab},{0xd0,0xac},{0xd0,0xad},{0xd0,0xae},{0xd0,0xaf},
+        {0xd0,0x80},{0xd0,0x81},{0xd0,0x82},{0xd0,0x83},{0xd0,0x84},{0xd0,0x85},{0xd0,0x86},{0xd0,0x87},
+        {0xd0,0x88},{0xd0,0x89},{0xd0,0x8a},{0xd0,0x8b},{0xd0,0x8c},{0xd0,0x8d},{0xd0,0x8e},{0xd0,0x8f},
+        {0xd1,0xa0},{0xd1,0xa0},{0xd1,0xa2},{0xd1,0xa2},{0xd1,0xa4},{0xd1,0xa4},{0xd1,0xa6},{0xd1,0xa6},
+        {0xd1,0xa8},{0xd1,0xa8},{0xd1,0xaa},{0xd1,0xaa},{0xd1,0xac},{0xd1,0xac},{0xd1,0xae},{0xd1,0xae},
+        {0xd1,0xb0},{0xd1,0xb0},{0xd1,0xb2},{0xd1,0xb2},{0xd1,0xb4},{0xd1,0xb4},{0xd1,0xb6},{0xd1,0xb6},
+        {0xd1,0xb8},{0xd1,0xb8},{0xd1,0xba},{0xd1,0xba},{0xd1,0xbc},{0xd1,0xbc},{0xd1,0xbe},{0xd1,0xbe},
+        {0xd2,0x80},{0xd2,0x80},{0xd2,0x82},{0xd2,0x83},{0xd2,0x84},{0xd2,0x85},{0xd2,0x86},{0xd2,0x87},
+        {0xd2,0x88},{0xd2,0x89},{0xd2,0x8a},{0xd2,0x8a},{0xd2,0x8c},{0xd2,0x8c},{0xd2,0x8e},{0xd2,0x8e},
+        {0xd2,0x90},{0xd2,0x90},{0xd2,0x92},{0xd2,0x92},{0xd2,0x94},{0xd2,0x94},{0xd2,0x96},{0xd2,0x96},
+        {0xd2,0x98},{0xd2,0x98},{0xd2,0x9a},{0xd2,0x9a},{0xd2,0x9c},{0xd2,0x9c},{0xd2,0x9e},{0xd2,0x9e},
+        {0xd2,0xa0},{0xd2,0xa0},{0xd2,0xa2},{0xd2,0xa2},{0xd2,0xa4},{0xd2,0xa4},{0xd2,0xa6},{0xd2,0xa6},
+        {0xd2,0xa8},{0xd2,0xa8},{0xd2,0xaa},{0xd2,0xaa},{0xd2,0xac},{0xd2,0xac},{0xd2,0xae},{0xd2,0xae},
+        {0xd2,0xb0},{0xd2,0xb0},{0xd2,0xb2},{0xd2,0xb2},{0xd2,0xb4},{0xd2,0xb4},{0xd2,0xb6},{0xd2,0xb6},
+        {0xd2,0xb8},{0xd2,0xb8},{0xd2,0xba},{0xd2,0xba},{0xd2,0xbc},{0xd2,0xbc},{0xd2,0xbe},{0xd2,0xbe},
+        {0xd3,0x80},{0xd3,0x81},{0xd3,0x81},{0xd3,0x83},{0xd3,0x83},{0xd3,0x85},{0xd3,0x85},{0xd3,0x87},
+        {0xd3,0x87},{0xd3,0x89},{0xd3,0x89},{0xd3,0x8b},{0xd3,0x8b},{0xd3,0x8d},{0xd3,0x8d},{0xd3,0x80},
+        {0xd3,0x90},{0xd3,0x90},{0xd3,0x92},{0xd3,0x92},{0xd3,0x94},{0xd3,0x94},{0xd3,0x96},{0xd3,0x96},
+        {0xd3,0x98},{0xd3,0x98},{0xd3,0x9a},{0xd3,0x9a},{0xd3,0x9c},{0xd3,0x9c},{0xd3,0x9e},{0xd3,0x9e},
+        {0xd3,0xa0},{0xd3,0xa0},{0xd3,0xa2},{0xd3,0xa2},{0xd3,0xa4},{0xd3,0xa4},{0xd3,0xa6},{0xd3,0xa6},
+        {0xd3,0xa8},{0xd3,0xa8},{0xd3,0xaa},{0xd3,0xaa},{0xd3,0xac},{0xd3,0xac},{0xd3,0xae},{0xd3,0xae},
+        {0xd3,0xb0},{0xd3,0xb0},{0xd3,0xb2},{0xd3,0xb2},{0xd3,0xb4},{0xd3,0xb4},{0xd3,0xb6},{0xd3,0xb6},
+        {0xd3,0xb8},{0xd3,0xb8},{0xd3,0xba},{0xd3,0xba},{0xd3,0xbc},{0xd3,0xbc},{0xd3,0xbe},{0xd3,0xbe},
+        {0xd4,0x80},{0xd4,0x81},{0xd4,0x82},{0xd4,0x83},{0xd4,0x84},{0xd4,0x85},{0xd4,0x86},{0xd4,0x87},
+        {0xd4,0x88},{0xd4,0x89},{0xd4,0x8a},{0xd4,0x8b},{0xd4,0x8c},{0xd4,0x8d},{0xd4,0x8e},{0xd4,0x8f},
+        {0xd4,0x90},{0xd4,0x91},{0xd4,0x92},{0xd4,0x93},{0xd4,0x94},{0xd4,0x95},{0xd4,0x96},{0xd4,0x97},
+        {0xd4,0x98},{0xd4,0x99},{0xd4,0x9a},{0xd4,0x9b},{0xd4,0x9c},{0xd4,0x9d},{0xd4,0x9e},{0xd4,0x9f},
+        {0xd4,0xa0},{0xd4,0xa1},{0xd4,0xa2},{0xd4,0xa3},{0xd4,0xa4},{0xd4,0xa5},{0xd4,0xa6},{0xd4,0xa7},
+        {0xd4,0xa8},{0xd4,0xa9},{0xd4,0xaa},{0xd4,0xab},{0xd4,0xac},{0xd4,0xad},{0xd4,0xae},{0xd4,0xaf},
+        {0xd4,0xb0},{0xd4,0xb1},{0xd4,0xb2},{0xd4,0xb3},{0xd4,0xb4},{0xd4,0xb5},{0xd4,0xb6},{0xd4,0xb7},
+        {0xd4,0xb8},{0xd4,0xb9},{0xd4,0xba},{0xd4,0xbb},{0xd4,0xbc},{0xd4,0xbd},{0xd4,0xbe},{0xd4,0xbf},
+        {0xd5,0x80},{0xd5,0x81},{0xd5,0x82},{0xd5,0x83},{0xd5,0x84},{0xd5,0x85},{0xd5,0x86},{0xd5,0x87},
+        {0xd5,0x88},{0xd5,0x89},{0xd5,0x8a},{0xd5,0x8b},{0xd5,0x8c},{0xd5,0x8d},{0xd5,0x8e},{0xd5,0x8f},
+        {0xd5,0x90},{0xd5,0x91},{0xd5,0x92},{0xd5,0x93},{0xd5,0x94},{0xd5,0x95},{0xd5,0x96},{0xd5,0x97},
+        {0xd5,0x98},{0xd5,0x99},{0xd5,0x9a},{0xd5,0x9b},{0xd5,0x9c},{0xd5,0x9d},{0xd5,0x9e},{0xd5,0x9f},
+        {0xd5,0xa0},{0xd5,0xa1},{0xd5,0xa2},{0xd5,0xa3},{0xd5,0xa4},{0xd5,0xa5},{0xd5,0xa6},{0xd5,0xa7},
+        {0xd5,0xa8},{0xd5,0xa9},{0xd5,0xaa},{0xd5,0xab},{0xd5,0xac},{0xd5,0xad},{0xd5,0xae},{0xd5,0xaf},
+        {0xd5,0xb0},{0xd5,0xb1},{0xd5,0xb2},{0xd5,0xb3},{0xd5,0xb4},{0xd5,0xb5},{0xd5,0xb6},{0xd5,0xb7},
+        {0xd5,0xb8},{0xd5,0xb9},{0xd5,0xba},{0xd5,0xbb},{0xd5,0xbc},{0xd5,0xbd},{0xd5,0xbe},{0xd5,0xbf},
+        {0xd6,0x80},{0xd6,0x81},{0xd6,0x82},{0xd6,0x83},{0xd6,0x84},{0xd6,0x85},{0xd6,0x86},{0xd6,0x87},
+        {0xd6,0x88},{0xd6,0x89},{0xd6,0x8a},{0xd6,0x8b},{0xd6,0x8c},{0xd6,0x8d},{0xd6,0x8e},{0xd6,0x8f},
+        {0xd6,0x90},{0xd6,0x91},{0xd6,0x92},{0xd6,0x93},{0xd6,0x94},{0xd6,0x95},{0xd6,0x96},{0xd6,0x97},
+        {0xd6,0x98},{0xd6,0x99},{0xd6,0x9a},{0xd6,0x9b},{0xd6,0x9c},{0xd6,0x9d},{0xd6,0x9e},{0xd6,0x9f},
+        {0xd6,0xa0},{0xd6,0xa1},{0xd6,0xa2},{0xd6,0xa3},{0xd6,0xa4},{0xd6,0xa5},{0xd6,0xa6},{0xd6,0xa7},
+        {0xd6,0xa8},{0xd6,0xa9},{0xd6,0xaa},{0xd6,0xab},{0xd6,0xac},{0xd6,0xad},{0xd6,0xae},{0xd6,0xaf},
+        {0xd6,0xb0},{0xd6,0xb1},{0xd6,0xb2},{0xd6,0xb3},{0xd6,0xb4},{0xd6,0xb5},{0xd6,0xb6},{0xd6,0xb7},
+        {0xd6,0xb8},{0xd6,0xb9},{0xd6,0xba},{0xd6,0xbb},{0xd6,0xbc},{0xd6,0xbd},{0xd6,0xbe},{0xd6,0xbf},
+        {0xd7,0x80},{0xd7,0x81},{0xd7,0x82},{0xd7,0x83},{0xd7,0x84},{0xd7,0x85},{0xd7,0x86},{0xd7,0x87},
+        {0xd7,0x88},{0xd7,0x89},{0xd7,0x8a},{0xd7,0x8b},{0xd7,0x8c},{0xd7,0x8d},{0xd7,0x8e},{0xd7,0x8f},
+        {0xd7,0x90},{0xd7,0x91},{0xd7,0x92},{0xd7,0x93},{0xd7,0x94},{0xd7,0x95},{0xd7,0x96},{0xd7,0x97},
+        {0xd7,0x98},{0xd7,0x99},{0xd7,0x9a},{0xd7,0x9b},{0xd7,0x9c},{0xd7,0x9d},{0xd7,0x9e},{0xd7,0x9f},
+        {0xd7,0xa0},{0xd7,0xa1},{0xd7,0xa2},{0xd7,0xa3},{0xd7,0xa4},{0xd7,0xa5},{0xd7,0xa6},{0xd7,0xa7},
+        {0xd7,0xa8},{0xd7,0xa9},{0xd7,0xaa},{0xd7,0xab},{0xd7,0xac},{0xd7,0xad},{0xd7,0xae},{0xd7,0xaf},
+        {0xd7,0xb0},{0xd7,0xb1},{0xd7,0xb2},{0xd7,0xb3},{0xd7,0xb4},{0xd7,0xb5},{0xd7,0xb6},{0xd7,0xb7},
+        {0xd7,0xb8},{0xd7,0xb9},{0xd7,0xba},{0xd7,0xbb},{0xd7,0xbc},{0xd7,0xbd},{0xd7,0xbe},{0xd7,0xbf},
+        {0xd8,0x80},{0xd8,0x81},{0xd8,0x82},{0xd8,0x83},{0xd8,0x84},{0xd8,0x85},{0xd8,0x86},{0xd8,0x87},
+        {0xd8,0x88},{0xd8,0x89},{0xd8,0x8a},{0xd8,0x8b},{0xd8,0x8c},{0xd8,0x8d},{0xd8,0x8e},{0xd8,0x8f},
+        {0xd8,0x90},{0xd8,0x91},{0xd8,0x92},{0xd8,0x93},{0xd8,0x94},{0xd8,0x95},{0xd8,0x96},{0xd8,0x97},
+        {0xd8,0x98},{0xd8,0x99},{0xd8,0x9a},{0xd8,0x9b},{0xd8,0x9c},{0xd8,0x9d},{0xd8,0x9e},{0xd8,0x9f},
+        {0xd8,0xa0},{0xd8,0xa1},{0xd8,0xa2},{0xd8,0xa3},{0xd8,0xa4},{0xd8,0xa5},{0xd8,0xa6},{0xd8,0xa7},
+        {0xd8,0xa8},{0xd8,0xa9},{0xd8,0xaa},{0xd8,0xab},{0xd8,0xac},{0xd8,0xad},{0xd8,0xae},{0xd8,0xaf},
+        {0xd8,0xb0},{0xd8,0xb1},{0xd8,0xb2},{0xd8,0xb3},{0xd8,0xb4},{0xd8,0xb5},{0xd8,0xb6},{0xd8,0xb7},
+        {0xd8,0xb8},{0xd8,0xb9},{0xd8,0xba},{0xd8,0xbb},{0xd8,0xbc},{0xd8,0xbd},{0xd8,0xbe},{0xd8,0xbf},
+        {0xd9,0x80},{0xd9,0x81},{0xd9,0x82},{0xd9,0x83},{0xd9,0x84},{0xd9,0x85},{0xd9,0x86},{0xd9,0x87},
+        {0xd9,0x88},{0xd9,0x89},{0xd9,0x8a},{0xd9,0x8b},{0xd9,0x8c},{0xd9,0x8d},{0xd9,0x8e},{0xd9,0x8f},
+        {0xd9,0x90},{0xd9,0x91},{0xd9,0x92},{0xd9,0x93},{0xd9,0x94},{0xd9,0x95},{0xd9,0x96},{0xd9,0x97},
+        {0xd9,0x98},{0xd9,0x99},{0xd9,0x9a},{0xd9,0x9b},{0xd9,0x9c},{0xd9,0x9d},{0xd9,0x9e},{0xd9,0x9f},
+        {0xd9,0xa0},{0xd9,0xa1},{0xd9,0xa2},{0xd9,0xa3},{0xd9,0xa4},{0xd9,0xa5},{0xd9,0xa6},{0xd9,0xa7},
+        {0xd9,0xa8},{0xd9,0xa9},{0xd9,0xaa},{0xd9,0xab},{0xd9,0xac},{0xd9,0xad},{0xd9,0xae},{0xd9,0xaf},
+        {0xd9,0xb0},{0xd9,0xb1},{0xd9,0xb2},{0xd9,0xb3},{0xd9,0xb4},{0xd9,0xb5},{0xd9,0xb6},{0xd9,0xb7},
+        {0xd9,0xb8},{0xd9,0xb9},{0xd9,0xba},{0xd9,0xbb},{0xd9,0xbc},{0xd9,0xbd},{0xd9,0xbe},{0xd9,0xbf},
+        {0xda,0x80},{0xda,0x81},{0xda,0x82},{0xda,0x83},{0xda,0x84},{0xda,0x85},{0xda,0x86},{0xda,0x87},
+        {0xda,0x88},{0xda,0x89},{0xda,0x8a},{0xda,0x8b},{0xda,0x8c},{0xda,0x8d},{0xda,0x8e},{0xda,0x8f},
+        {0xda,0x90},{0xda,0x91},{0xda,0x92},{0xda,0x93},{0xda,0x94},{0xda,0x95},{0xda,0x96},{0xda,0x97},
+        {0xda,0x98},{0xda,0x99},{0xda,0x9a},{0xda,0x9b},{0xda,0x9c},{0xda,0x9d},{0xda,0x9e},{0xda,0x9f},
+        {0xda,0xa0},{0xda,0xa1},{0xda,0xa2},{0xda,0xa3},{0xda,0xa4},{0xda,0xa5},{0xda,0xa6},{0xda,0xa7},
+        {0xda,0xa8},{0xda,0xa9},{0xda,0xaa},{0xda,0xab},{0xda,0xac},{0xda,0xad},{0xda,0xae},{0xda,0xaf},
+        {0xda,0xb0},{0xda,0xb1},{0xda,0xb2},{0xda,0xb3},{0xda,0xb4},{0xda,0xb5},{0xda,0xb6},{0xda,0xb7},
+        {0xda,0xb8},{0xda,0xb9},{0xda,0xba},{0xda,0xbb},{0xda,0xbc},{0xda,0xbd},{0xda,0xbe},{0xda,0xbf},
+        {0xdb,0x80},{0xdb,0x81},{0xdb,0x82},{0xdb,0x83},{0xdb,0x84},{0xdb,0x85},{0xdb,0x86},{0xdb,0x87},
+        {0xdb,0x88},{0xdb,0x89},{0xdb,0x8a},{0xdb,0x8b},{0xdb,0x8c},{0xdb,0x8d},{0xdb,0x8e},{0xdb,0x8f},
+        {0xdb,0x90},{0xdb,0x91},{0xdb,0x92},{0xdb,0x93},{0xdb,0x94},{0xdb,0x95},{0xdb,0x96},{0xdb,0x97},
+        {0xdb,0x98},{0xdb,0x99},{0xdb,0x9a},{0xdb,0x9b},{0xdb,0x9c},{0xdb,0x9d},{0xdb,0x9e},{0xdb,0x9f},
+        {0xdb,0xa0},{0xdb,0xa1},{0xdb,0xa2},{0xdb,0xa3},{0xdb,0xa4},{0xdb,0xa5},{0xdb,0xa6},{0xdb,0xa7},
+        {0xdb,0xa8},{0xdb,0xa9},{0xdb,0xaa},{0xdb,0xab},{0xdb,0xac},{0xdb,0xad},{0xdb,0xae},{0xdb,0xaf},
+        {0xdb,0xb0},{0xdb,0xb1},{0xdb,0xb2},{0xdb,0xb3},{0xdb,0xb4},{0xdb,0xb5},{0xdb,0xb6},{0xdb,0xb7},
+        {0xdb,0xb8},{0xdb,0xb9},{0xdb,0xba},{0xdb,0xbb},{0xdb,0xbc},{0xdb,0xbd},{0xdb,0xbe},{0xdb,0xbf},
+        {0xdc,0x80},{0xdc,0x81},{0xdc,0x82},{0xdc,0x83},{0xdc,0x84},{0xdc,0x85},{0xdc,0x86},{0xdc,0x87},
+        {0xdc,0x88},{0xdc,0x89},{0xdc,0x8a},{0xdc,0x8b},{0xdc,0x8c},{0xdc,0x8d},{0xdc,0x8e},{0xdc,0x8f},
+        {0xdc,0x90},{0xdc,0x91},{0xdc,0x92},{0xdc,0x93},{0xdc,0x94},{0xdc,0x95},{0xdc,0x96},{0xdc,0x97},
+        {0xdc,0x98},{0xdc,0x99},{0xdc,0x9a},{0xdc,0x9b},{0xdc,0x9c},{0xdc,0x9d},{0xdc,0x9e},{0xdc,0x9f},
+        {0xdc,0xa0},{0xdc,0xa1},{0xdc,0xa2},{0xdc,0xa3},{0xdc,0xa4},{0xdc,0xa5},{0xdc,0xa6},{0xdc,0xa7},
+        {0xdc,0xa8},{0xdc,0xa9},{0xdc,0xaa},{0xdc,0xab},{0xdc,0xac},{0xdc,0xad},{0xdc,0xae},{0xdc,0xaf},
+        {0xdc,0xb0},{0xdc,0xb1},{0xdc,0xb2},{0xdc,0xb3},{0xdc,0xb4},{0xdc,0xb5},{0xdc,0xb6},{0xdc,0xb7},
+        {0xdc,0xb8},{0xdc,0xb9},{0xdc,0xba},{0xdc,0xbb},{0xdc,0xbc},{0xdc,0xbd},{0xdc,0xbe},{0xdc,0xbf},
+        {0xdd,0x80},{0xdd,0x81},{0xdd,0x82},{0xdd,0x83},{0xdd,0x84},{0xdd,0x85},{0xdd,0x86},{0xdd,0x87},
+        {0xdd,0x88},{0xdd,0x89},{0xdd,0x8a},{0xdd,0x8b},{0xdd,0x8c},{0xdd,0x8d},{0xdd,0x8e},{0xdd,0x8f},
+        {0xdd,0x90},{0xdd,0x91},{0xdd,0x92},{0xdd,0x93},{0xdd,0x94},{0xdd,0x95},{0xdd,0x96},{0xdd,0x97},
+        {0xdd,0x98},{0xdd,0x99},{0xdd,0x9a},{0xdd,0x9b},{0xdd,0x9c},{0xdd,0x9d},{0xdd,0x9e},{0xdd,0x9f},
+        {0xdd,0xa0},{0xdd,0xa1},{0xdd,0xa2},{0xdd,0xa3},{0xdd,0xa4},{0xdd,0xa5},{0xdd,0xa6},{0xdd,0xa7},
+        {0xdd,0xa8},{0xdd,0xa9},{0xdd,0xaa},{0xdd,0xab},{0xdd,0xac},{0xdd,0xad},{0xdd,0xae},{0xdd,0xaf},
+        {0xdd,0xb0},{0xdd,0xb1},{0xdd,0xb2},{0xdd,0xb3},{0xdd,0xb4},{0xdd,0xb5},{0xdd,0xb6},{0xdd,0xb7},
+        {0xdd,0xb8},{0xdd,0xb9},{0xdd,0xba},{0xdd,0xbb},{0xdd,0xbc},{0xdd,0xbd},{0xdd,0xbe},{0xdd,0xbf},
+        {0xde,0x80},{0xde,0x81},{0xde,0x82},{0xde,0x83},{0xde,0x84},{0xde,0x85},{0xde,0x86},{0xde,0x87},
+        {0xde,0x88},{0xde,0x89},{0xde,0x8a},{0xde,0x8b},{0xde,0x8c},{0xde,0x8d},{0xde,0x8e},{0xde,0x8f},
+        {0xde,0x90},{0xde,0x91},{0xde,0x92},{0xde,0x93},{0xde,0x94},{0xde,0x95},{0xde,0x96},{0xde,0x97},
+        {0xde,0x98},{0xde,0x99},{0xde,0x9a},{0xde,0x9b},{0xde,0x9c},{0xde,0x9d},{0xde,0x9e},{0xde,0x9f},
+        {0xde,0xa0},{0xde,0xa1},{0xde,0xa2},{0xde,0xa3},{0xde,0xa4},{0xde,0xa5},{0xde,0xa6},{0xde,0xa7},
+        {0xde,0xa8},{0xde,0xa9},{0xde,0xaa},{0xde,0xab},{0xde,0xac},{0xde,0xad},{0xde,0xae},{0xde,0xaf},
+        {0xde,0xb0},{0xde,0xb1},{0xde,0xb2},{0xde,0xb3},{0xde,0xb4},{0xde,0xb5},{0xde,0xb6},{0xde,0xb7},
+        {0xde,0xb8},{0xde,0xb9},{0xde,0xba},{0xde,0xbb},{0xde,0xbc},{0xde,0xbd},{0xde,0xbe},{0xde,0xbf},
+        {0xdf,0x80},{0xdf,0x81},{0xdf,0x82},{0xdf,0x83},{0xdf,0x84},{0xdf,0x85},{0xdf,0x86},{0xdf,0x87},
+        {0xdf,0x88},{0xdf,0x89},{0xdf,0x8a},{0xdf,0x8b},{0xdf,0x8c},{0xdf,0x8d},{0xdf,0x8e},{0xdf,0x8f},
+        {0xdf,0x90},{0xdf,0x91},{0xdf,0x92},{0xdf,0x93},{0xdf,0x94},{0xdf,0x95},{0xdf,0x96},{0xdf,0x97},
+        {0xdf,0x98},{0xdf,0x99},{0xdf,0x9a},{0xdf,0x9b},{0xdf,0x9c},{0xdf,0x9d},{0xdf,0x9e},{0xdf,0x9f},
+        {0xdf,0xa0},{0xdf,0xa1},{0xdf,0xa2},{0xdf,0xa3},{0xdf,0xa4},{0xdf,0xa5},{0xdf,0xa6},{0xdf,0xa7},
+        {0xdf,0xa8},{0xdf,0xa9},{0xdf,0xaa},{0xdf,0xab},{0xdf,0xac},{0xdf,0xad},{0xdf,0xae},{0xdf,0xaf},
+        {0xdf,0xb0},{0xdf,0xb1},{0xdf,0xb2},{0xdf,0xb3},{0xdf,0xb4},{0xdf,0xb5},{0xdf,0xb6},{0xdf,0xb7},
+        {0xdf,0xb8},{0xdf,0xb9},{0xdf,0xba},{0xdf,0xbb},{0xdf,0xbc},{0xdf,0xbd},{0xdf,0xbe},{0xdf,0xbf},
+    },
+    // swap
+    {
+        {0xc2,0x80},{0xc2,0x81},{0xc2,0x82},{0xc2,0x83},{0xc2,0x84},{0xc2,0x85},{0xc2,0x86},{0xc2,0x87},
+        {0xc2,0x88},{0xc2,0x89},{0xc2,0x8a},{0xc2,0x8b},{0xc2,0x8c},{0xc2,0x8d},{0xc2,0x8e},{0xc2,0x8f},
+        {0xc2,0x90},{0xc2,0x91},{0xc2,0x92},{0xc2,0x93},{0xc2,0x94},{0xc2,0x95},{0xc2,0x96},{0xc2,0x97},
+        {0xc2,0x98},{0xc2,0x99},{0xc2,0x9a},{0xc2,0x9b},{0xc2,0x9c},{0xc2,0x9d},{0xc2,0x9e},{0xc2,0x9f},
+        {0xc2,0xa0},{0xc2,0xa1},{0xc2,0xa2},{0xc2,0xa3},{0xc2,0xa4},{0xc2,0xa5},{0xc2,0xa6},{0xc2,0xa7},
+        {0xc2,0xa8},{0xc2,0xa9},{0xc2,0xaa},{0xc2,0xab},{0xc2,0xac},{0xc2,0xad},{0xc2,0xae},{0xc2,0xaf},
+        {0xc2,0xb0},{0xc2,0xb1},{0xc2,0xb2},{0xc2,0xb3},{0xc2,0xb4},{0xce,0x9c},{0xc2,0xb6},{0xc2,0xb7},
+        {0xc2,0xb8},{0xc2,0xb9},{0xc2,0xba},{0xc2,0xbb},{0xc2,0xbc},{0xc2,0xbd},{0xc2,0xbe},{0xc2,0xbf},
+        {0xc3,0xa0},{0xc3,0xa1},{0xc3,0xa2},{0xc3,0xa3},{0xc3,0xa4},{0xc3,0xa5},{0xc3,0xa6},{0xc3,0xa7},
+        {0xc3,0xa8},{0xc3,0xa9},{0xc3,0xaa},{0xc3,0xab},{0xc3,0xac},{0xc3,0xad},{0xc3,0xae},{0xc3,0xaf},
+        {0xc3,0xb0},{0xc3,0xb1},{0xc3,0xb2},{0xc3,0xb3},{0xc3,0xb4},{0xc3,0xb5},{0xc3,0xb6},{0xc3,0x97},
+        {0xc3,0xb8},{0xc3,0xb9},{0xc3,0xba},{0xc3,0xbb},{0xc3,0xbc},{0xc3,0xbd},{0xc3,0xbe},{0xc3,0x9f},
+        {0xc3,0x80},{0xc3,0x81},{0xc3,0x82},{0xc3,0x83},{0xc3,0x84},{0xc3,0x85},{0xc3,0x86},{0xc3,0x87},
+        {0xc3,0x88},{0xc3,0x89},{0xc3,0x8a},{0xc3,0x8b},{0xc3,0x8c},{0xc3,0x8d},{0xc3,0x8e},{0xc3,0x8f},
+        {0xc3,0x90},{0xc3,0x91},{0xc3,0x92},{0xc3,0x93},{0xc3,0x94},{0xc3,0x95},{0xc3,0x96},{0xc3,0xb7},
+        {0xc3,0x98},{0xc3,0x99},{0xc3,0x9a},{0xc3,0x9b},{0xc3,0x9c},{0xc3,0x9d},{0xc3,0x9e},{0xc5,0xb8},
+        {0xc4,0x81},{0xc4,0x80},{0xc4,0x83},{0xc4,0x82},{0xc4,0x85},{0xc4,0x84},{0xc4,0x87},{0xc4,0x86},
+        {0xc4,0x89},{0xc4,0x88},{0xc4,0x8b},{0xc4,0x8a},{0xc4,0x8d},{0xc4,0x8c},{0xc4,0x8f},{0xc4,0x8e},
+        {0xc4,0x91},{0xc4,0x90},{0xc4,0x93},{0xc4,0x92},{0xc4,0x95},{0xc4,0x94},{0xc4,0x97},{0xc4,0x96},
+        {0xc4,0x99},{0xc4,0x98},{0xc4,0x9b},{0xc4,0x9a},{0xc4,0x9d},{0xc4,0x9c},{0xc4,0x9f},{0xc4,0x9e},
+        {0xc4,0xa1},{0xc4,0xa0},{0xc4,0xa3},{0xc4,0xa2},{0xc4,0xa5},{0xc4,0xa4},{0xc4,0xa7},{0xc4,0xa6},
+        {0xc4,0xa9},{0xc4,0xa8},{0xc4,0xab},{0xc4,0xaa},{0xc4,0xad},{0xc4,0xac},{0xc4,0xaf},{0xc4,0xae},
+        {0xc4,0xb0},{0xc4,0xb1},{0xc4,0xb3},{0xc4,0xb2},{0xc4,0xb5},{0xc4,0xb4},{0xc4,0xb7},{0xc4,0xb6},
+        {0xc4,0xb8},{0xc4,0xba},{0xc4,0xb9},{0xc4,0xbc},{0xc4,0xbb},{0xc4,0xbe},{0xc4,0xbd},{0xc5,0x80},
+        {0xc4,0xbf},{0xc5,0x82},{0xc5,0x81},{0xc5,0x84},{0xc5,0x83},{0xc5,0x86},{0xc5,0x85},{0xc5,0x88},
+        {0xc5,0x87},{0xc5,0x89},{0xc5,0x8b},{0xc5,0x8a},{0xc5,0x8d},{0xc5,0x8c},{0xc5,0x8f},{0xc5,0x8e},
+        {0xc5,0x91},{0xc5,0x90},{0xc5,0x93},{0xc5,0x92},{0xc5,0x95},{0xc5,0x94},{0xc5,0x97},{0xc5,0x96},
+        {0xc5,0x99},{0xc5,0x98},{0xc5,0x9b},{0xc5,0x9a},{0xc5,0x9d},{0xc5,0x9c},{0xc5,0x9f},{0xc5,0x9e},
+        {0xc5,0xa1},{0xc5,0xa0},{0xc5,0xa3},{0xc5,0xa2},{0xc5,0xa5},{0xc5,0xa4},{0xc5,0xa7},{0xc5,0xa6},
+        {0xc5,0xa9},{0xc5,0xa8},{0xc5,0xab},{0xc5,0xaa},{0xc5,0xad},{0xc5,0xac},{0xc5,0xaf},{0xc5,0xae},
+        {0xc5,0xb1},{0xc5,0xb0},{0xc5,0xb3},{0xc5,0xb2},{0xc5,0xb5},{0xc5,0xb4},{0xc5,0xb7},{0xc5,0xb6},
+        {0xc3,0xbf},{0xc5,0xba},{0xc5,0xb9},{0xc5,0xbc},{0xc5,0xbb},{0xc5,0xbe},{0xc5,0xbd},{0xc5,0xbf},
+        {0xc6,0x80},{0xc6,0x81},{0xc6,0x82},{0xc6,0x83},{0xc6,0x84},{0xc6,0x85},{0xc6,0x86},{0xc6,0x87},
+        {0xc6,0x88},{0xc6,0x89},{0xc6,0x8a},{0xc6,0x8b},{0xc6,0x8c},{0xc6,0x8d},{0xc6,0x8e},{0xc6,0x8f},
+        {0xc6,0x90},{0xc6,0x91},{0xc6,0x92},{0xc6,0x93},{0xc6,0x94},{0xc6,0x95},{0xc6,0x96},{0xc6,0x97},
+        {0xc6,0x98},{0xc6,0x99},{0xc6,0x9a},{0xc6,0x9b},{0xc6,0x9c},{0xc6,0x9d},{0xc6,0x9e},{0xc6,0x9f},
+        {0xc6,0xa0},{0xc6,0xa1},{0xc6,0xa2},{0xc6,0xa3},{0xc6,0xa4},{0xc6,0xa5},{0xc6,0xa6},{0xc6,0xa7},
+        {0xc6,0xa8},{0xc6,0xa9},{0xc6,0xaa},{0xc6,0xab},{0xc6,0xac},{0xc6,0xad},{0xc6,0xae},{0xc6,0xaf},
+        {0xc6,0xb0},{0xc6,0xb1},{0xc6,0xb2},{0xc6,0xb3},{0xc6,0xb4},{0xc6,0xb5},{0xc6,0xb6},{0xc6,0xb7},
+        {0xc6,0xb8},{0xc6,0xb9},{0xc6,0xba},{0xc6,0xbb},{0xc6,0xbc},{0xc6,0xbd},{0xc6,0xbe},{0xc6,0xbf},
+        {0xc7,0x80},{0xc7,0x81},{0xc7,0x82},{0xc7,0x83},{0xc7,0x84},{0xc7,0x85},{0xc7,0x86},{0xc7,0x87},
+        {0xc7,0x88},{0xc7,0x89},{0xc7,0x8a},{0xc7,0x8b},{0xc7,0x8c},{0xc7,0x8d},{0xc7,0x8e},{0xc7,0x8f},
+        {0xc7,0x90},{0xc7,0x91},{0xc7,0x92},{0xc7,0x93},{0xc7,0x94},{0xc7,0x95},{0xc7,0x96},{0xc7,0x97},
+        {0xc7,0x98},{0xc7,0x99},{0xc7,0x9a},{0xc7,0x9b},{0xc7,0x9c},{0xc7,0x9d},{0xc7,0x9e},{0xc7,0x9f},
+        {0xc7,0xa0},{0xc7,0xa1},{0xc7,0xa2},{0xc7,0xa3},{0xc7,0xa4},{0xc7,0xa5},{0xc7,0xa6},{0xc7,0xa7},
+        {0xc7,0xa8},{0xc7,0xa9},{0xc7,0xaa},{0xc7,0xab},{0xc7,0xac},{0xc7,0xad},{0xc7,0xae},{0xc7,0xaf},
+        {0xc7,0xb0},{0xc7,0xb1},{0xc7,0xb2},{0xc7,0xb3},{0xc7,0xb4},{0xc7,0xb5},{0xc7,0xb6},{0xc7,0xb7},
+        {0xc7,0xb8},{0xc7,0xb9},{0xc7,0xba},{0xc7,0xbb},{0xc7,0xbc},{0xc7,0xbd},{0xc7,0xbe},{0xc7,0xbf},
+        {0xc8,0x80},{0xc8,0x81},{0xc8,0x82},{0xc8,0x83},{0xc8,0x84},{0xc8,0x85},{0xc8,0x86},{0xc8,0x87},
+        {0xc8,0x88},{0xc8,0x89},{0xc8,0x8a},{0xc8,0x8b},{0xc8,0x8c},{0xc8,0x8d},{0xc8,0x8e},{0xc8,0x8f},
+        {0xc8,0x90},{0xc8,0x91},{0xc8,0x92},{0xc8,0x93},{0xc8,0x94},{0xc8,0x95},{0xc8,0x96},{0xc8,0x97},
+        {0xc8,0x98},{0xc8,0x99},{0xc8,0x9a},{0xc8,0x9b},{0xc8,0x9c},{0xc8,0x9d},{0xc8,0x9e},{0xc8,0x9f},
+        {0xc8,0xa0},{0xc8,0xa1},{0xc8,0xa2},{0xc8,0xa3},{0xc8,0xa4},{0xc8,0xa5},{0xc8,0xa6},{0xc8,0xa7},
+        {0xc8,0xa8},{0xc8,0xa9},{0xc8,0xaa},{0xc8,0xab},{0xc8,0xac},{0xc8,0xad},{0xc8,0xae},{0xc8,0xaf},
+        {0xc8,0xb0},{0xc8,0xb1},{0xc8,0xb2},{0xc8,0xb3},{0xc8,0xb4},{0xc8,0xb5},{0xc8,0xb6},{0xc8,0xb7},
+        {0xc8,0xb8},{0xc8,0xb9},{0xc8,0xba},{0xc8,0xbb},{0xc8,0xbc},{0xc8,0xbd},{0xc8,0xbe},{0xc8,0xbf},
+        {0xc9,0x80},{0xc9,0x81},{0xc9,0x82},{0xc9,0x83},{0xc9,0x84},{0xc9,0x85},{0xc9,0x86},{0xc9,0x87},
+        {0xc9,0x88},{0xc9,0x89},{0xc9,0x8a},{0xc9,0x8b},{0xc9,0x8c},{0xc9,0x8d},{0xc9,0x8e},{0xc9,0x8f},
+        {0xc9,0x90},{0xc9,0x91},{0xc9,0x92},{0xc9,0x93},{0xc9,0x94},{0xc9,0x95},{0xc9,0x96},{0xc9,0x97},
+        {0xc9,0x98},{0xc9,0x99},{0xc9,0x9a},{0xc9,0x9b},{0xc9,0x9c},{0xc9,0x9d},{0xc9,0x9e},{0xc9,0x9f},
+        {0xc9,0xa0},{0xc9,0xa1},{0xc9,0xa2},{0xc9,0xa3},{0xc9,0xa4},{0xc9,0xa5},{0xc9,0xa6},{0xc9,0xa7},
+        {0xc9,0xa8},{0xc9,0xa9},{0xc9,0xaa},{0xc9,0xab},{0xc9,0xac},{0xc9,0xad},{0xc9,0xae},{0xc9,0xaf},
+        {0xc9,0xb0},{0xc9,0xb1},{0xc9,0xb2},{0xc9,0xb3},{0xc9,0xb4},{0xc9,0xb5},{0xc9,0xb6},{0xc9,0xb7},
+        {0xc9,0xb8},{0xc9,0xb9},{0xc9,0xba},{0xc9,0xbb},{0xc9,0xbc},{0xc9,0xbd},{0xc9,0xbe},{0xc9,0xbf},
+        {0xca,0x80},{0xca,0x81},{0xca,0x82},{0xca,0x83},{0xca,0x84},{0xca,0x85},{0xca,0x86},{0xca,0x87},
+        {0xca,0x88},{0xca,0x89},{0xca,0x8a},{0xca,0x8b},{0xca,0x8c},{0xca,0x8d},{0xca,0x8e},{0xca,0x8f},
+        {0xca,0x90},{0xca,0x91},{0xca,0x92},{0xca,0x93},{0xca,0x94},{0xca,0x95},{0xca,0x96},{0xca,0x97},
+        {0xca,0x98},{0xca,0x99},{0xca,0x9a},{0xca,0x9b},{0xca,0x9c},{0xca,0x9d},{0xca,0x9e},{0xca,0x9f},
+        {0xca,0xa0},{0xca,0xa1},{0xca,0xa2},{0xca,0xa3},{0xca,0xa4},{0xca,0xa5},{0xca,0xa6},{0xca,0xa7},
+        {0xca,0xa8},{0xca,0xa9},{0xca,0xaa},{0xca,0xab},{0xca,0xac},{0xca,0xad},{0xca,0xae},{0xca,0xaf},
+        {0xca,0xb0},{0xca,0xb1},{0xca,0xb2},{0xca,0xb3},{0xca,0xb4},{0xca,0xb5},{0xca,0xb6},{0xca,0xb7},
+        {0xca,0xb8},{0xca,0xb9},{0xca,0xba},{0xca,0xbb},{0xca,0xbc},{0xca,0xbd},{0xca,0xbe},{0xca,0xbf},
+        {0xcb,0x80},{0xcb,0x81},{0xcb,0x82},{0xcb,0x83},{0xcb,0x84},{0xcb,0x85},{0xcb,0x86},{0xcb,0x87},
+        {0xcb,0x88},{0xcb,0x89},{0xcb,0x8a},{0xcb,0x8b},{0xcb,0x8c},{0xcb,0x8d},{0xcb,0x8e},{0xcb,0x8f},
+        {0xcb,0x90},{0xcb,0x91},{0xcb,0x92},{0xcb,0x93},{0xcb,0x94},{0xcb,0x95},{0xcb,0x96},{0xcb,0x97},
+        {0xcb,0x98},{0xcb,0x99},{0xcb,0x9a},{0xcb,0x9b},{0xcb,0x9c},{0xcb,0x9d},{0xcb,0x9e},{0xcb,0x9f},
+        {0xcb,0xa0},{0xcb,0xa1},{0xcb,0xa2},{0xcb,0xa3},{0xcb,0xa4},{0xcb,0xa5},{0xcb,0xa6},{0xcb,0xa7},
+        {0xcb,0xa8},{0xcb,0xa9},{0xcb,0xaa},{0xcb,0xab},{0xcb,0xac},{0xcb,0xad},{0xcb,0xae},{0xcb,0xaf},
+        {0xcb,0xb0},{0xcb,0xb1},{0xcb,0xb2},{0xcb,0xb3},{0xcb,0xb4},{0xcb,0xb5},{0xcb,0xb6},{0xcb,0xb7},
+        {0xcb,0xb8},{0xcb,0xb9},{0xcb,0xba},{0xcb,0xbb},{0xcb,0xbc},{0xcb,0xbd},{0xcb,0xbe},{0xcb,0xbf},
+        {0xcc,0x80},{0xcc,0x81},{0xcc,0x82},{0xcc,0x83},{0xcc,0x84},{0xcc,0x85},{0xcc,0x86},{0xcc,0x87},
+        {0xcc,0x88},{0xcc,0x89},{0xcc,0x8a},{0xcc,0x8b},{0xcc,0x8c},{0xcc,0x8d},{0xcc,0x8e},{0xcc,0x8f},
+        {0xcc,0x90},{0xcc,0x91},{0xcc,0x92},{0xcc,0x93},{0xcc,0x94},{0xcc,0x95},{0xcc,0x96},{0xcc,0x97},
+        {0xcc,0x98},{0xcc,0x99},{0xcc,0x9a},{0xcc,0x9b},{0xcc,0x9c},{0xcc,0x9d},{0xcc,0x9e},{0xcc,0x9f},
+        {0xcc,0xa0},{0xcc,0xa1},{0xcc,0xa2},{0xcc,0xa3},{0xcc,0xa4},{0xcc,0xa5},{0xcc,0xa6},{0xcc,0xa7},
+        {0xcc,0xa8},{0xcc,0xa9},{0xcc,0xaa},{0xcc,0xab},{0xcc,0xac},{0xcc,0xad},{0xcc,0xae},{0xcc,0xaf},
+        {0xcc,0xb0},{0xcc,0xb1},{0xcc,0xb2},{0xcc,0xb3},{0xcc,0xb4},{0xcc,0xb5},{0xcc,0xb6},{0xcc,0xb7},
+        {0xcc,0xb8},{0xcc,0xb9},{0xcc,0xba},{0xcc,0xbb},{0xcc,0xbc},{0xcc,0xbd},{0xcc,0xbe},{0xcc,0xbf},
+        {0xcd,0x80},{0xcd,0x81},{0xcd,0x82},{0xcd,0x83},{0xcd,0x84},{0xcd,0x85},{0xcd,0x86},{0xcd,0x87},
+        {0xcd,0x88},{0xcd,0x89},{0xcd,0x8a},{0xcd,0x8b},{0xcd,0x8c},{0xcd,0x8d},{0xcd,0x8e},{0xcd,0x8f},
+        {0xcd,0x90},{0xcd,0x91},{0xcd,0x92},{0xcd,0x93},{0xcd,0x94},{0xcd,0x95},{0xcd,0x96},{0xcd,0x97},
+        {0xcd,0x98},{0xcd,0x99},{0xcd,0x9a},{0xcd,0x9b},{0xcd,0x9c},{0xcd,0x9d},{0xcd,0x9e},{0xcd,0x9f},
+        {0xcd,0xa0},{0xcd,0xa1},{0xcd,0xa2},{0xcd,0xa3},{0xcd,0xa4},{0xcd,0xa5},{0xcd,0xa6},{0xcd,0xa7},
+        {0xcd,0xa8},{0xcd,0xa9},{0xcd,0xaa},{0xcd,0xab},{0xcd,0xac},{0xcd,0xad},{0xcd,0xae},{0xcd,0xaf},
+        {0xcd,0xb1},{0xcd,0xb0},{0xcd,0xb3},{0xcd,0xb2},{0xcd,0xb4},{0xcd,0xb5},{0xcd,0xb7},{0xcd,0xb6},
+        {0xcd,0xb8},{0xcd,0xb9},{0xcd,0xba},{0xcf,0xbd},{0xcf,0xbe},{0xcf,0xbf},{0xcd,0xbe},{0xcf,0xb3},
+        {0xce,0x80},{0xce,0x81},{0xce,0x82},{0xce,0x83},{0xce,0x84},{0xce,0x85},{0xce,0xac},{0xce,0x87},
+        {0xce,0xad},{0xce,0xae},{0xce,0xaf},{0xce,0x8b},{0xcf,0x8c},{0xce,0x8d},{0xcf,0x8d},{0xcf,0x8e},
+        {0xce,0x90},{0xce,0xb1},{0xce,0xb2},{0xce,0xb3},{0xce,0xb4},{0xce,0xb5},{0xce,0xb6},{0xce,0xb7},
+        {0xce,0xb8},{0xce,0xb9},{0xce,0xba},{0xce,0xbb},{0xce,0xbc},{0xce,0xbd},{0xce,0xbe},{0xce,0xbf},
+        {0xcf,0x80},{0xcf,0x81},{0xce,0xa2},{0xcf,0x83},{0xcf,0x84},{0xcf,0x85},{0xcf,0x86},{0xcf,0x87},
+        {0xcf,0x88},{0xcf,0x89},{0xcf,0x8a},{0xcf,0x8b},{0xce,0x86},{0xce,0x88},{0xce,0x89},{0xce,0x8a},
+        {0xce,0xb0},{0xce,0x91},{0xce,0x92},{0xce,0x93},{0xce,0x94},{0xce,0x95},{0xce,0x96},{0xce,0x97},
+        {0xce,0x98},{0xce,0x99},{0xce,0x9a},{0xce,0x9b},{0xce,0x9c},{0xce,0x9d},{0xce,0x9e},{0xce,0x9f},
+        {0xce,0xa0},{0xce,0xa1},{0xce,0xa3},{0xce,0xa3},{0xce,0xa4},{0xce,0xa5},{0xce,0xa6},{0xce,0xa7},
+        {0xce,0xa8},{0xce,0xa9},{0xce,0xaa},{0xce,0xab},{0xce,0x8c},{0xce,0x8e},{0xce,0x8f},{0xcf,0x97},
+        {0xce,0x92},{0xce,0x98},{0xcf,0x92},{0xcf,0x93},{0xcf,0x94},{0xce,0xa6},{0xce,0xa0},{0xcf,0x8f},
+        {0xcf,0x99},{0xcf,0x98},{0xcf,0x9b},{0xcf,0x9a},{0xcf,0x9d},{0xcf,0x9c},{0xcf,0x9f},{0xcf,0x9e},
+        {0xcf,0xa1},{0xcf,0xa0},{0xcf,0xa3},{0xcf,0xa2},{0xcf,0xa5},{0xcf,0xa4},{0xcf,0xa7},{0xcf,0xa6},
+        {0xcf,0xa9},{0xcf,0xa8},{0xcf,0xab},{0xcf,0xaa},{0xcf,0xad},{0xcf,0xac},{0xcf,0xaf},{0xcf,0xae},
+        {0xce,0x9a},{0xce,0xa1},{0xcf,0xb9},{0xcd,0xbf},{0xce,0xb8},{0xce,0x95},{0xcf,0xb6},{0xcf,0xb8},
+        {0xcf,0xb7},{0xcf,0xb2},{0xcf,0xbb},{0xcf,0xba},{0xcf,0xbc},{0xcd,0xbb},{0xcd,0xbc},{0xcd,0xbd},
+        {0xd1,0x90},{0xd1,0x91},{0xd1,0x92},{0xd1,0x93},{0xd1,0x94},{0xd1,0x95},{0xd1,0x96},{0xd1,0x97},
+        {0xd1,0x98},{0xd1,0x99},{0xd1,0x9a},{0xd1,0x9b},{0xd1,0x9c},{0xd1,0x9d},{0xd1,0x9e},{0xd1,0x9f},
+        {0xd0,0xb0},{0xd0,0xb1},{0xd0,0xb2},{0xd0,0xb3},{0xd0,0xb4},{0xd0,0xb5},{0xd0,0xb6},{0xd0,0xb7},
+        {0xd0,0xb8},{0xd0,0xb9},{0xd0,0xba},{0xd0,0xbb},{0xd0,0xbc},{0xd0,0xbd},{0xd0,0xbe},{0xd0,0xbf},
+        {0xd1,0x80},{0xd1,0x81},{0xd1,0x82},{0xd1,0x83},{0xd1,0x84},{0xd1,0x85},{0xd1,0x86},{0xd1,0x87},
+        {0xd1,0x88},{0xd1,0x89},{0xd1,0x8a},{0xd1,0x8b},{0xd1,0x8c},{0xd1,0x8d},{0xd1,0x8e},{0xd1,0x8f},
+        {0xd0,0x90},{0xd0,0x91},{0xd0,0x92},{0xd0,0x93},{0xd0,0x94},{0xd0,0x95},{0xd0,0x96},{0xd0,0x97},
+        {0xd0,0x98},{0xd0,0x99},{0xd0,0x9a},{0xd0,0x9b},{0xd0,0x9c},{0xd0,0x9d},{0xd0,0x9e},{0xd0,0x9f},
+        {0xd0,0xa0},{0xd0,0xa1},{0xd0,0xa2},{0xd0,0xa3},{0xd0,0xa4},{0xd0,0xa5},{0xd0,0xa6},{0xd0,0xa7},
+        {0xd0,0xa8},{0xd0,0xa9},{0xd0,0xaa},{0xd0,0xab},{0xd0,0xac},{0xd0,0xad},{0xd0,0xae},{0xd0,0xaf},
+        {0xd0,0x80},{0xd0,0x81},{0xd0,0x82},{0xd0,0x83},{0xd0,0x84},{0xd0,0x85},{0xd0,0x86},{0xd0,0x87},
+        {0xd0,0x88},{0xd0,0x89},{0xd0,0x8a},{0xd0,0x8b},{0xd0,0x8c},{0xd0,0x8d},{0xd0,0x8e},{0xd0,0x8f},
+        {0xd1,0xa1},{0xd1,0xa0},{0xd1,0xa3},{0xd1,0xa2},{0xd1,0xa5},{0xd1,0xa4},{0xd1,0xa7},{0xd1,0xa6},
+        {0xd1,0xa9},{0xd1,0xa8},{0xd1,0xab},{0xd1,0xaa},{0xd1,0xad},{0xd1,0xac},{0xd1,0xaf},{0xd1,0xae},
+        {0xd1,0xb1},{0xd1,0xb0},{0xd1,0xb3},{0xd1,0xb2},{0xd1,0xb5},{0xd1,0xb4},{0xd1,0xb7},{0xd1,0xb6},
+        {0xd1,0xb9},{0xd1,0xb8},{0xd1,0xbb},{0xd1,0xba},{0xd1,0xbd},{0xd1,0xbc},{0xd1,0xbf},{0xd1,0xbe},
+        {0xd2,0x81},{0xd2,0x80},{0xd2,0x82},{0xd2,0x83},{0xd2,0x84},{0xd2,0x85},{0xd2,0x86},{0xd2,0x87},
+        {0xd2,0x88},{0xd2,0x89},{0xd2,0x8b},{0xd2,0x8a},{0xd2,0x8d},{0xd2,0x8c},{0xd2,0x8f},{0xd2,0x8e},
+        {0xd2,0x91},{0xd2,0x90},{0xd2,0x93},{0xd2,0x92},{0xd2,0x95},{0xd2,0x94},{0xd2,0x97},{0xd2,0x96},
+        {0xd2,0x99},{0xd2,0x98},{0xd2,0x9b},{0xd2,0x9a},{0xd2,0x9d},{0xd2,0x9c},{0xd2,0x9f},{0xd2,0x9e},
+        {0xd2,0xa1},{0xd2,0xa0},{0xd2,0xa3},{0xd2,0xa2},{0xd2,0xa5},{0xd2,0xa4},{0xd2,0xa7},{0xd2,0xa6},
+        {0xd2,0xa9},{0xd2,0xa8},{0xd2,0xab},{0xd2,0xaa},{0xd2,0xad},{0xd2,0xac},{0xd2,0xaf},{0xd2,0xae},
+        {0xd2,0xb1},{0xd2,0xb0},{0xd2,0xb3},{0xd2,0xb2},{0xd2,0xb5},{0xd2,0xb4},{0xd2,0xb7},{0xd2,0xb6},
+        {0xd2,0xb9},{0xd2,0xb8},{0xd2,0xbb},{0xd2,0xba},{0xd2,0xbd},{0xd2,0xbc},{0xd2,0xbf},{0xd2,0xbe},
+        {0xd3,0x8f},{0xd3,0x82},{0xd3,0x81},{0xd3,0x84},{0xd3,0x83},{0xd3,0x86},{0xd3,0x85},{0xd3,0x88},
+        {0xd3,0x87},{0xd3,0x8a},{0xd3,0x89},{0xd3,0x8c},{0xd3,0x8b},{0xd3,0x8e},{0xd3,0x8d},{0xd3,0x80},
+        {0xd3,0x91},{0xd3,0x90},{0xd3,0x93},{0xd3,0x92},{0xd3,0x95},{0xd3,0x94},{0xd3,0x97},{0xd3,0x96},
+        {0xd3,0x99},{0xd3,0x98},{0xd3,0x9b},{0xd3,0x9a},{0xd3,0x9d},{0xd3,0x9c},{0xd3,0x9f},{0xd3,0x9e},
+        {0xd3,0xa1},{0xd3,0xa0},{0xd3,0xa3},{0xd3,0xa2},{0xd3,0xa5},{0xd3,0xa4},{0xd3,0xa7},{0xd3,0xa6},
+        {0xd3,0xa9},{0xd3,0xa8},{0xd3,0xab},{0xd3,0xaa},{0xd3,0xad},{0xd3,0xac},{0xd3,0xaf},{0xd3,0xae},
+        {0xd3,0xb1},{0xd3,0xb0},{0xd3,0xb3},{0xd3,0xb2},{0xd3,0xb5},{0xd3,0xb4},{0xd3,0xb7},{0xd3,0xb6},
+        {0xd3,0xb9},{0xd3,0xb8},{0xd3,0xbb},{0xd3,0xba},{0xd3,0xbd},{0xd3,0xbc},{0xd3,0xbf},{0xd3,0xbe},
+        {0xd4,0x80},{0xd4,0x81},{0xd4,0x82},{0xd4,0x83},{0xd4,0x84},{0xd4,0x85},{0xd4,0x86},{0xd4,0x87},
+        {0xd4,0x88},{0xd4,0x89},{0xd4,0x8a},{0xd4,0x8b},{0xd4,0x8c},{0xd4,0x8d},{0xd4,0x8e},{0xd4,0x8f},
+        {0xd4,0x90},{0xd4,0x91},{0xd4,0x92},{0xd4,0x93},{0xd4,0x94},{0xd4,0x95},{0xd4,0x96},{0xd4,0x97},
+        {0xd4,0x98},{0xd4,0x99},{0xd4,0x9a},{0xd4,0x9b},{0xd4,0x9c},{0xd4,0x9d},{0xd4,0x9e},{0xd4,0x9f},
+        {0xd4,0xa0},{0xd4,0xa1},{0xd4,0xa2},{0xd4,0xa3},{0xd4,0xa4},{0xd4,0xa5},{0xd4,0xa6},{0xd4,0xa7},
+        {0xd4,0xa8},{0xd4,0xa9},{0xd4,0xaa},{0xd4,0xab},{0xd4,0xac},{0xd4,0xad},{0xd4,0xae},{0xd4,0xaf},
+        {0xd4,0xb0},{0xd4,0xb1},{0xd4,0xb2},{0xd4,0xb3},{0xd4,0xb4},{0xd4,0xb5},{0xd4,0xb6},{0xd4,0xb7},
+        {0xd4,0xb8},{0xd4,0xb9},{0xd4,0xba},{0xd4,0xbb},{0xd4,0xbc},{0xd4,0xbd},{0xd4,0xbe},{0xd4,0xbf},
+        {0xd5,0x80},{0xd5,0x81},{0xd5,0x82},{0xd5,0x83},{0xd5,0x84},{0xd5,0x85},{0xd5,0x86},{0xd5,0x87},
+        {0xd5,0x88},{0xd5,0x89},{0xd5,0x8a},{0xd5,0x8b},{0xd5,0x8c},{0xd5,0x8d},{0xd5,0x8e},{0xd5,0x8f},
+        {0xd5,0x90},{0xd5,0x91},{0xd5,0x92},{0xd5,0x93},{0xd5,0x94},{0xd5,0x95},{0xd5,0x96},{0xd5,0x97},
+        {0xd5,0x98},{0xd5,0x99},{0xd5,0x9a},{0xd5,0x9b},{0xd5,0x9c},{0xd5,0x9d},{0xd5,0x9e},{0xd5,0x9f},
+        {0xd5,0xa0},{0xd5,0xa1},{0xd5,0xa2},{0xd5,0xa3},{0xd5,0xa4},{0xd5,0xa5},{0xd5,0xa6},{0xd5,0xa7},
+        {0xd5,0xa8},{0xd5,0xa9},{0xd5,0xaa},{0xd5,0xab},{0xd5,0xac},{0xd5,0xad},{0xd5,0xae},{0xd5,0xaf},
+        {0xd5,0xb0},{0xd5,0xb1},{0xd5,0xb2},{0xd5,0xb3},{0xd5,0xb4},{0xd5,0xb5},{0xd5,0xb6},{0xd5,0xb7},
+        {0xd5,0xb8},{0xd5,0xb9},{0xd5,0xba},{0xd5,0xbb},{0xd5,0xbc},{0xd5,0xbd},{0xd5,0xbe},{0xd5,0xbf},
+        {0xd6,0x80},{0xd6,0x81},{0xd6,0x82},{0xd6,0x83},{0xd6,0x84},{0xd6,0x85},{0xd6,0x86},{0xd6,0x87},
+        {0xd6,0x88},{0xd6,0x89},{0xd6,0x8a},{0xd6,0x8b},{0xd6,0x8c},{0xd6,0x8d},{0xd6,0x8e},{0xd6,0x8f},
+        {0xd6,0x90},{0xd6,0x91},{0xd6,0x92},{0xd6,0x93},{0xd6,0x94},{0xd6,0x95},{0xd6,0x96},{0xd6,0x97},
+        {0xd6,0x98},{0xd6,0x99},{0xd6,0x9a},{0xd6,0x9b},{0xd6,0x9c},{0xd6,0x9d},{0xd6,0x9e},{0xd6,0x9f},
+        {0xd6,0xa0},{0xd6,0xa1},{0xd6,0xa2},{0xd6,0xa3},{0xd6,0xa4},{0xd6,0xa5},{0xd6,0xa6},{0xd6,0xa7},
+        {0xd6,0xa8},{0xd6,0xa9},{0xd6,0xaa},{0xd6,0xab},{0xd6,0xac},{0xd6,0xad},{0xd6,0xae},{0xd6,0xaf},
+        {0xd6,0xb0},{0xd6,0xb1},{0xd6,0xb2},{0xd6,0xb3},{0xd6,0xb4},{0xd6,0xb5},{0xd6,0xb6},{0xd6,0xb7},
+        {0xd6,0xb8},{0xd6,0xb9},{0xd6,0xba},{0xd6,0xbb},{0xd6,0xbc},{0xd6,0xbd},{0xd6,0xbe},{0xd6,0xbf},
+        {0xd7,0x80},{0xd7,0x81},{0xd7,0x82},{0xd7,0x83},{0xd7,0x84},{0xd7,0x85},{0xd7,0x86},{0xd7,0x87},
+        {0xd7,0x88},{0xd7,0x89},{0xd7,0x8a},{0xd7,0x8b},{0xd7,0x8c},{0xd7,0x8d},{0xd7,0x8e},{0xd7,0x8f},
+        {0xd7,0x90},{0xd7,0x91},{0xd7,0x92},{0xd7,0x93},{0xd7,0x94},{0xd7,0x95},{0xd7,0x96},{0xd7,0x97},
+        {0xd7,0x98},{0xd7,0x99},{0xd7,0x9a},{0xd7,0x9b},{0xd7,0x9c},{0xd7,0x9d},{0xd7,0x9e},{0xd7,0x9f},
+        {0xd7,0xa0},{0xd7,0xa1},{0xd7,0xa2},{0xd7,0xa3},{0xd7,0xa4},{0xd7,0xa5},{0xd7,0xa6},{0xd7,0xa7},
+        {0xd7,0xa8},{0xd7,0xa9},{0xd7,0xaa},{0xd7,0xab},{0xd7,0xac},{0xd7,0xad},{0xd7,0xae},{0xd7,0xaf},
+        {0xd7,0xb0},{0xd7,0xb1},{0xd7,0xb2},{0xd7,0xb3},{0xd7,0xb4},{0xd7,0xb5},{0xd7,0xb6},{0xd7,0xb7},
+        {0xd7,0xb8},{0xd7,0xb9},{0xd7,0xba},{0xd7,0xbb},{0xd7,0xbc},{0xd7,0xbd},{0xd7,0xbe},{0xd7,0xbf},
+        {0xd8,0x80},{0xd8,0x81},{0xd8,0x82},{0xd8,0x83},{0xd8,0x84},{0xd8,0x85},{0xd8,0x86},{0xd8,0x87},
+        {0xd8,0x88},{0xd8,0x89},{0xd8,0x8a},{0xd8,0x8b},{0xd8,0x8c},{0xd8,0x8d},{0xd8,0x8e},{0xd8,0x8f},
+        {0xd8,0x90},{0xd8,0x91},{0xd8,0x92},{0xd8,0x93},{0xd8,0x94},{0xd8,0x95},{0xd8,0x96},{0xd8,0x97},
+        {0xd8,0x98},{0xd8,0x99},{0xd8,0x9a},{0xd8,0x9b},{0xd8,0x9c},{0xd8,0x9d},{0xd8,0x9e},{0xd8,0x9f},
+        {0xd8,0xa0},{0xd8,0xa1},{0xd8,0xa2},{0xd8,0xa3},{0xd8,0xa4},{0xd8,0xa5},{0xd8,0xa6},{0xd8,0xa7},
+        {0xd8,0xa8},{0xd8,0xa9},{0xd8,0xaa},{0xd8,0xab},{0xd8,0xac},{0xd8,0xad},{0xd8,0xae},{0xd8,0xaf},
+        {0xd8,0xb0},{0xd8,0xb1},{0xd8,0xb2},{0xd8,0xb3},{0xd8,0xb4},{0xd8,0xb5},{0xd8,0xb6},{0xd8,0xb7},
+        {0xd8,0xb8},{0xd8,0xb9},{0xd8,0xba},{0xd8,0xbb},{0xd8,0xbc},{0xd8,0xbd},{0xd8,0xbe},{0xd8,0xbf},
+        {0xd9,0x80},{0xd9,0x81},{0xd9,0x82},{0xd9,0x83},{0xd9,0x84},{0xd9,0x85},{0xd9,0x86},{0xd9,0x87},
+        {0xd9,0x88},{0xd9,0x89},{0xd9,0x8a},{0xd9,0x8b},{0xd9,0x8c},{0xd9,0x8d},{0xd9,0x8e},{0xd9,0x8f},
+        {0xd9,0x90},{0xd9,0x91},{0xd9,0x92},{0xd9,0x93},{0xd9,0x94},{0xd9,0x95},{0xd9,0x96},{0xd9,0x97},
+        {0xd9,0x98},{0xd9,0x99},{0xd9,0x9a},{0xd9,0x9b},{0xd9,0x9c},{0xd9,0x9d},{0xd9,0x9e},{0xd9,0x9f},
+        {0xd9,0xa0},{0xd9,0xa1},{0xd9,0xa2},{0xd9,0xa3},{0xd9,0xa4},{0xd9,0xa5},{0xd9,0xa6},{0xd9,0xa7},
+        {0xd9,0xa8},{0xd9,0xa9},{0xd9,0xaa},{0xd9,0xab},{0xd9,0xac},{0xd9,0xad},{0xd9,0xae},{0xd9,0xaf},
+        {0xd9,0xb0},{0xd9,0xb1},{0xd9,0xb2},{0xd9,0xb3},{0xd9,0xb4},{0xd9,0xb5},{0xd9,0xb6},{0xd9,0xb7},
+        {0xd9,0xb8},{0xd9,0xb9},{0xd9,0xba},{0xd9,0xbb},{0xd9,0xbc},{0xd9,0xbd},{0xd9,0xbe},{0xd9,0xbf},
+        {0xda,0x80},{0xda,0x81},{0xda,0x82},{0xda,0x83},{0xda,0x84},{0xda,0x85},{0xda,0x86},{0xda,0x87},
+        {0xda,0x88},{0xda,0x89},{0xda,0x8a},{0xda,0x8b},{0xda,0x8c},{0xda,0x8d},{0xda,0x8e},{0xda,0x8f},
+        {0xda,0x90},{0xda,0x91},{0xda,0x92},{0xda,0x93},{0xda,0x94},{0xda,0x95},{0xda,0x96},{0xda,0x97},
+        {0xda,0x98},{0xda,0x99},{0xda,0x9a},{0xda,0x9b},{0xda,0x9c},{0xda,0x9d},{0xda,0x9e},{0xda,0x9f},
+        {0xda,0xa0},{0xda,0xa1},{0xda,0xa2},{0xda,0xa3},{0xda,0xa4},{0xda,0xa5},{0xda,0xa6},{0xda,0xa7},
+        {0xda,0xa8},{0xda,0xa9},{0xda,0xaa},{0xda,0xab},{0xda,0xac},{0xda,0xad},{0xda,0xae},{0xda,0xaf},
+        {0xda,0xb0},{0xda,0xb1},{0xda,0xb2},{0xda,0xb3},{0xda,0xb4},{0xda,0xb5},{0xda,0xb6},{0xda,0xb7},
+        {0xda,0xb8},{0xda,0xb9},{0xda,0xba},{0xda,0xbb},{0xda,0xbc},{0xda,0xbd},{0xda,0xbe},{0xda,0xbf},
+        {0xdb,0x80},{0xdb,0x81},{0xdb,0x82},{0xdb,0x83},{0xdb,0x84},{0xdb,0x85},{0xdb,0x86},{0xdb,0x87},
+        {0xdb,0x88},{0xdb,0x89},{0xdb,0x8a},{0xdb,0x8b},{0xdb,0x8c},{0xdb,0x8d},{0xdb,0x8e},{0xdb,0x8f},
+        {0xdb,0x90},{0xdb,0x91},{0xdb,0x92},{0xdb,0x93},{0xdb,0x94},{0xdb,0x95},{0xdb,0x96},{0xdb,0x97},
+        {0xdb,0x98},{0xdb,0x99},{0xdb,0x9a},{0xdb,0x9b},{0xdb,0x9c},{0xdb,0x9d},{0xdb,0x9e},{0xdb,0x9f},
+        {0xdb,0xa0},{0xdb,0xa1},{0xdb,0xa2},{0xdb,0xa3},{0xdb,0xa4},{0xdb,0xa5},{0xdb,0xa6},{0xdb,0xa7},
+        {0xdb,0xa8},{0xdb,0xa9},{0xdb,0xaa},{0xdb,0xab},{0xdb,0xac},{0xdb,0xad},{0xdb,0xae},{0xdb,0xaf},
+        {0xdb,0xb0},{0xdb,0xb1},{0xdb,0xb2},{0xdb,0xb3},{0xdb,0xb4},{0xdb,0xb5},{0xdb,0xb6},{0xdb,0xb7},
+        {0xdb,0xb8},{0xdb,0xb9},{0xdb,0xba},{0xdb,0xbb},{0xdb,0xbc},{0xdb,0xbd},{0xdb,0xbe},{0xdb,0xbf},
+        {0xdc,0x80},{0xdc,0x81},{0xdc,0x82},{0xdc,0x83},{0xdc,0x84},{0xdc,0x85},{0xdc,0x86},{0xdc,0x87},
+        {0xdc,0x88},{0xdc,0x89},{0xdc,0x8a},{0xdc,0x8b},{0xdc,0x8c},{0xdc,0x8d},{0xdc,0x8e},{0xdc,0x8f},
+        {0xdc,0x90},{0xdc,0x91},{0xdc,0x92},{0xdc,0x93},{0xdc,0x94},{0xdc,0x95},{0xdc,0x96},{0xdc,0x97},
+        {0xdc,0x98},{0xdc,0x99},{0xdc,0x9a},{0xdc,0x9b},{0xdc,0x9c},{0xdc,0x9d},{0xdc,0x9e},{0xdc,0x9f},
+        {0xdc,0xa0},{0xdc,0xa1},{0xdc,0xa2},{0xdc,0xa3},{0xdc,0xa4},{0xdc,0xa5},{0xdc,0xa6},{0xdc,0xa7},
+        {0xdc,0xa8},{0xdc,0xa9},{0xdc,0xaa},{0xdc,0xab},{0xdc,0xac},{0xdc,0xad},{0xdc,0xae},{0xdc,0xaf},
+        {0xdc,0xb0},{0xdc,0xb1},{0xdc,0xb2},{0xdc,0xb3},{0xdc,0xb4},{0xdc,0xb5},{0xdc,0xb6},{0xdc,0xb7},
+        {0xdc,0xb8},{0xdc,0xb9},{0xdc,0xba},{0xdc,0xbb},{0xdc,0xbc},{0xdc,0xbd},{0xdc,0xbe},{0xdc,0xbf},
+        {0xdd,0x80},{0xdd,0x81},{0xdd,0x82},{0xdd,0x83},{0xdd,0x84},{0xdd,0x85},{0xdd,0x86},{0xdd,0x87},
+        {0xdd,0x88},{0xdd,0x89},{0xdd,0x8a},{0xdd,0x8b},{0xdd,0x8c},{0xdd,0x8d},{0xdd,0x8e},{0xdd,0x8f},
+        {0xdd,0x90},{0xdd,0x91},{0xdd,0x92},{0xdd,0x93},{0xdd,0x94},{0xdd,0x95},{0xdd,0x96},{0xdd,0x97},
+        {0xdd,0x98},{0xdd,0x99},{0xdd,0x9a},{0xdd,0x9b},{0xdd,0x9c},{0xdd,0x9d},{0xdd,0x9e},{0xdd,0x9f},
+        {0xdd,0xa0},{0xdd,0xa1},{0xdd,0xa2},{0xdd,0xa3},{0xdd,0xa4},{0xdd,0xa5},{0xdd,0xa6},{0xdd,0xa7},
+        {0xdd,0xa8},{0xdd,0xa9},{0xdd,0xaa},{0xdd,0xab},{0xdd,0xac},{0xdd,0xad},{0xdd,0xae},{0xdd,0xaf},
+        {0xdd,0xb0},{0xdd,0xb1},{0xdd,0xb2},{0xdd,0xb3},{0xdd,0xb4},{0xdd,0xb5},{0xdd,0xb6},{0xdd,0xb7},
+        {0xdd,0xb8},{0xdd,0xb9},{0xdd,0xba},{0xdd,0xbb},{0xdd,0xbc},{0xdd,0xbd},{0xdd,0xbe},{0xdd,0xbf},
+        {0xde,0x80},{0xde,0x81},{0xde,0x82},{0xde,0x83},{0xde,0x84},{0xde,0x85},{0xde,0x86},{0xde,0x87},
+        {0xde,0x88},{0xde,0x89},{0xde,0x8a},{0xde,0x8b},{0xde,0x8c},{0xde,0x8d},{0xde,0x8e},{0xde,0x8f},
+        {0xde,0x90},{0xde,0x91},{0xde,0x92},{0xde,0x93},{0xde,0x94},{0xde,0x95},{0xde,0x96},{0xde,0x97},
+        {0xde,0x98},{0xde,0x99},{0xde,0x9a},{0xde,0x9b},{0xde,0x9c},{0xde,0x9d},{0xde,0x9e},{0xde,0x9f},
+        {0xde,0xa0},{0xde,0xa1},{0xde,0xa2},{0xde,0xa3},{0xde,0xa4},{0xde,0xa5},{0xde,0xa6},{0xde,0xa7},
+        {0xde,0xa8},{0xde,0xa9},{0xde,0xaa},{0xde,0xab},{0xde,0xac},{0xde,0xad},{0xde,0xae},{0xde,0xaf},
+        {0xde,0xb0},{0xde,0xb1},{0xde,0xb2},{0xde,0xb3},{0xde,0xb4},{0xde,0xb5},{0xde,0xb6},{0xde,0xb7},
+        {0xde,0xb8},{0xde,0xb9},{0xde,0xba},{0xde,0xbb},{0xde,0xbc},{0xde,0xbd},{0xde,0xbe},{0xde,0xbf},
+        {0xdf,0x80},{0xdf,0x81},{0xdf,0x82},{0xdf,0x83},{0xdf,0x84},{0xdf,0x85},{0xdf,0x86},{0xdf,0x87},
+        {0xdf,0x88},{0xdf,0x89},{0xdf,0x8a},{0xdf,0x8b},{0xdf,0x8c},{0xdf,0x8d},{0xdf,0x8e},{0xdf,0x8f},
+        {0xdf,0x90},{0xdf,0x91},{0xdf,0x92},{0xdf,0x93},{0xdf,0x94},{0xdf,0x95},{0xdf,0x96},{0xdf,0x97},
+        {0xdf,0x98},{0xdf,0x99},{0xdf,0x9a},{0xdf,0x9b},{0xdf,0x9c},{0xdf,0x9d},{0xdf,0x9e},{0xdf,0x9f},
+        {0xdf,0xa0},{0xdf,0xa1},{0xdf,0xa2},{0xdf,0xa3},{0xdf,0xa4},{0xdf,0xa5},{0xdf,0xa6},{0xdf,0xa7},
+        {0xdf,0xa8},{0xdf,0xa9},{0xdf,0xaa},{0xdf,0xab},{0xdf,0xac},{0xdf,0xad},{0xdf,0xae},{0xdf,0xaf},
+        {0xdf,0xb0},{0xdf,0xb1},{0xdf,0xb2},{0xdf,0xb3},{0xdf,0xb4},{0xdf,0xb5},{0xdf,0xb6},{0xdf,0xb7},
+        {0xdf,0xb8},{0xdf,0xb9},{0xdf,0xba},{0xdf,0xbb},{0xdf,0xbc},{0xdf,0xbd},{0xdf,0xbe},{0xdf,0xbf},
+    },
+};
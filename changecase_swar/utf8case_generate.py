@@ -0,0 +1,123 @@
+import sys
+import unicodedata
+
+# Case mapping tables for 2-byte UTF-8 sequences (see utf8case.cpp).
+#
+# Only simple (1:1) mappings are considered, within the blocks:
+#
+#   - Latin-1 Supplement   U+0080 .. U+00FF,
+#   - Latin Extended-A     U+0100 .. U+017F,
+#   - Greek and Coptic     U+0370 .. U+03FF,
+#   - Cyrillic             U+0400 .. U+04FF.
+#
+# A mapping is used only if the result is also a 2-byte sequence (so the
+# conversion never changes length of text); for instance 'ı' (U+0131) is
+# left intact, as its uppercase is ASCII 'I'.
+#
+# Usage: utf8case_generate.py tables.inl
+#
+# tables.inl -- for all leading bytes 0xc2..0xdf and all continuation
+#               bytes the converted pair, for each operation.
+#
+# test.cpp doesn't use these tables for reference, it checks the result
+# against towlower/towupper from the C library.
+
+blocks = [
+    (0x0080, 0x00ff),
+    (0x0100, 0x017f),
+    (0x0370, 0x03ff),
+    (0x0400, 0x04ff),
+]
+
+first_lead = 0xc2
+last_lead  = 0xdf
+
+
+def in_blocks(cp):
+    return any(lo <= cp <= hi for lo, hi in blocks)
+
+
+def simple_mapping(cp, fun):
+    s = fun(chr(cp))
+    if len(s) != 1:
+        return cp
+
+    res = ord(s)
+    if not (0x80 <= res <= 0x7ff):
+        return cp
+
+    return res
+
+
+def lower(cp):
+    if not in_blocks(cp):
+        return cp
+
+    return simple_mapping(cp, str.lower)
+
+
+def upper(cp):
+    if not in_blocks(cp):
+        return cp
+
+    return simple_mapping(cp, str.upper)
+
+
+def swap(cp):
+    l = lower(cp)
+    if l != cp:
+        return l
+
+    return upper(cp)
+
+
+def encode(cp):
+    assert 0x80 <= cp <= 0x7ff
+    return (0xc0 | (cp >> 6), 0x80 | (cp & 0x3f))
+
+
+def generate_tables():
+    lines = []
+    lines.append('// generated by utf8case_generate.py, do not edit')
+    lines.append('// Unicode %s' % unicodedata.unidata_version)
+    lines.append('')
+    lines.append('const int first_lead = 0x%02x;' % first_lead)
+    lines.append('const int last_lead  = 0x%02x;' % last_lead)
+    lines.append('')
+    lines.append('// [operation][(lead - first_lead) * 64 + (continuation & 0x3f)] = {lead, continuation}')
+    lines.append('const uint8_t pairs[3][%d][2] = {' % ((last_lead - first_lead + 1) * 64))
+    for name, fun in [('lower', lower), ('upper', upper), ('swap', swap)]:
+        lines.append('    // %s' % name)
+        lines.append('    {')
+        for lead in range(first_lead, last_lead + 1):
+            row = []
+            for cont in range(0x80, 0xc0):
+                cp = ((lead & 0x1f) << 6) | (cont & 0x3f)
+                l, c = encode(fun(cp))
+                row.append('{0x%02x,0x%02x}' % (l, c))
+
+            for i in range(0, 64, 8):
+                lines.append('        ' + ','.join(row[i:i + 8]) + ',')
+        lines.append('    },')
+    lines.append('};')
+
+    return lines
+
+
+def write(path, lines):
+    with open(path, 'wt') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def main():
+    if len(sys.argv) != 2:
+        print('usage: %s tables.inl' % sys.argv[0])
+        return 1
+
+    write(sys.argv[1], generate_tables())
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -2,6 +2,8 @@
 #include <cstdio>
 #include <cassert>
 #include <cstring>
+#include <cstdlib>
+#include <vector>
 
 #include "procedures.cpp"
 
@@ -31,9 +33,104 @@ void benchmark(const std::string& info, convfun fun, int count) {
     printf("%8u us\n", elapsed_time(t0, t1));
 }
 
+// bulk conversion
+// ------------------------------------------------------------------------
+
+std::string generate_csv(size_t count, int min_digits, int max_digits, bool sign) {
+    std::string s;
+    for (size_t i=0; i < count; i++) {
+        if (sign && (rand() % 2)) {
+            s += '-';
+        }
+
+        const int digits = min_digits + rand() % (max_digits - min_digits + 1);
+        s += char('1' + rand() % 9);
+        for (int j=1; j < digits; j++) {
+            s += char('0' + rand() % 10);
+        }
+
+        s += (i % 8 == 7) ? '\n' : ',';
+    }
+
+    return s;
+}
+
+
+template <typename T, typename FUN>
+void benchmark_bulk(const char* info, const std::string& input, std::vector<T>& output, FUN fun) {
+
+    printf("%-20s ", info);
+    fflush(stdout);
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    const int repeat = 10;
+    const auto t0 = Clock::now();
+    size_t count = 0;
+    for (int i=0; i < repeat; i++) {
+        count += fun(input.data(), input.size(), output.data(), output.size());
+    }
+    const auto t1 = Clock::now();
+
+    const unsigned us = elapsed_time(t0, t1);
+    const double mb   = double(input.size()) * repeat / (1024*1024);
+    printf("%8u us %8.1f MB/s %8.1f Mnum/s\n", us, mb / (us / 1e6), (count / 1e6) / (us / 1e6));
+}
+
+
+template <typename T>
+size_t strto_loop(const char* s, size_t size, T* output, size_t capacity) {
+    const char* end = s + size;
+    size_t count = 0;
+    while (s < end && count < capacity) {
+        char* next;
+        output[count++] = std::is_signed<T>::value ? T(strtoll(s, &next, 10)) : T(strtoull(s, &next, 10));
+        s = next + 1;
+    }
+
+    return count;
+}
+
+
+template <typename T>
+void benchmark_bulk_all(const char* title, int min_digits, int max_digits) {
+
+    const size_t count = 1000000;
+    const std::string input = generate_csv(count, min_digits, max_digits, std::is_signed<T>::value);
+    std::vector<T> output(count);
+
+    printf("%s, %d..%d digits, %lu numbers, %lu bytes\n", title, min_digits, max_digits, count, input.size());
+
+    benchmark_bulk<T>(std::is_signed<T>::value ? "strtoll loop" : "strtoull loop", input, output,
+        [](const char* s, size_t size, T* out, size_t capacity) {
+            return strto_loop(s, size, out, capacity);
+        });
+    benchmark_bulk<T>("bulk scalar", input, output,
+        [](const char* s, size_t size, T* out, size_t capacity) {
+            return bulk_parse_scalar(s, size, ',', out, capacity).count;
+        });
+    benchmark_bulk<T>("bulk SSSE3", input, output,
+        [](const char* s, size_t size, T* out, size_t capacity) {
+            return bulk_parse_ssse3(s, size, ',', out, capacity).count;
+        });
+#ifdef __AVX2__
+    benchmark_bulk<T>("bulk AVX2", input, output,
+        [](const char* s, size_t size, T* out, size_t capacity) {
+            return bulk_parse_avx2(s, size, ',', out, capacity).count;
+        });
+#endif
+}
+
+
 int main() {
 
     for (auto& item: get_procedures()) {
         benchmark(item.name, item.fun, 10000000);
     }
+
+    putchar('\n');
+    benchmark_bulk_all<uint64_t>("uint64_t", 1, 8);
+    benchmark_bulk_all<uint64_t>("uint64_t", 1, 16);
+    benchmark_bulk_all<uint64_t>("uint64_t", 1, 19);
+    benchmark_bulk_all<int64_t>("int64_t", 1, 16);
 }
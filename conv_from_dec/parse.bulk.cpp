@@ -0,0 +1,372 @@
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <immintrin.h>
+
+// Bulk conversion of delimited, variable-length decimal numbers.
+//
+// Input is a buffer of fields separated either with the given delimiter
+// or with a newline; a single trailing separator is allowed. Fields
+// must contain only digits, for signed output an optional sign ('+' or
+// '-') is accepted.
+//
+// SIMD procedures use the same arithmetic as parse_ssse3: a field of
+// at most 16 digits is loaded as the 16 bytes *ending* at the field's
+// end, bytes preceding the field are zeroed, and then the value is
+// computed with pmaddubsw/pmaddwd. Longer fields are rare and are
+// handled by the scalar code, which also checks for overflows.
+
+enum class BulkStatus {
+    ok,
+    invalid_character,
+    empty_field,
+    overflow,
+    output_full
+};
+
+struct BulkResult {
+    BulkStatus status;
+    size_t count;   // number of values written to output
+    size_t offset;  // ok -- input size; output_full -- start of the first
+                    // not parsed field; otherwise -- position of error
+                    // (the invalid character or the start of field)
+};
+
+namespace bulk {
+
+    bool is_separator(char c, char delimiter) {
+        return c == delimiter || c == '\n';
+    }
+
+    template <typename T>
+    T make_value(uint64_t magnitude, bool negative) {
+        return negative ? static_cast<T>(~magnitude + 1) : static_cast<T>(magnitude);
+    }
+
+    template <typename T>
+    BulkStatus parse_field_scalar(const char* s, size_t start, size_t end, T& result, size_t& error) {
+
+        size_t i = start;
+        bool negative = false;
+        if (std::is_signed<T>::value && i < end && (s[i] == '-' || s[i] == '+')) {
+            negative = (s[i] == '-');
+            i++;
+        }
+
+        if (i == end) {
+            error = start;
+            return BulkStatus::empty_field;
+        }
+
+        const uint64_t limit = std::is_signed<T>::value
+                             ? (negative ? uint64_t(1) << 63 : (uint64_t(1) << 63) - 1)
+                             : ~uint64_t(0);
+
+        uint64_t value = 0;
+        for (/**/; i < end; i++) {
+            const uint8_t digit = uint8_t(s[i]) - '0';
+            if (digit > 9) {
+                error = i;
+                return BulkStatus::invalid_character;
+            }
+
+            if (__builtin_mul_overflow(value, 10, &value)
+             || __builtin_add_overflow(value, digit, &value)
+             || value > limit) {
+                error = start;
+                return BulkStatus::overflow;
+            }
+        }
+
+        result = make_value<T>(value, negative);
+        return BulkStatus::ok;
+    }
+
+    // 16 zeros followed by 16 ones; loading 16 bytes at offset `k` yields
+    // a mask that keeps the last `k` bytes of a vector
+    const uint8_t keep_last[32] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    };
+
+    __m128i keep_last_mask(size_t k) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(keep_last + k));
+    }
+
+    struct Field {
+        size_t start;   // the first byte of field
+        size_t end;     // position of separator (or input size)
+        size_t digits;  // position of the first digit (after sign)
+        bool negative;
+
+        size_t length() const {
+            return end - digits;
+        }
+    };
+
+    template <typename T>
+    Field make_field(const char* s, size_t start, size_t end) {
+        Field f;
+        f.start = start;
+        f.end = end;
+        f.digits = start;
+        f.negative = false;
+        if (std::is_signed<T>::value && start < end && (s[start] == '-' || s[start] == '+')) {
+            f.negative = (s[start] == '-');
+            f.digits += 1;
+        }
+
+        return f;
+    }
+
+    // SIMD path requires 1..16 digits and 16 bytes available before the end
+    bool fast_path(const Field& f) {
+        return f.end >= 16 && f.length() > 0 && f.length() <= 16;
+    }
+
+    template <typename T, typename FIND_SEPARATOR, typename CONVERT>
+    BulkResult parse_aux(const char* s, size_t size, T* output, size_t capacity,
+                         FIND_SEPARATOR find_separator, CONVERT convert) {
+        size_t count = 0;
+        size_t pos = 0;
+        while (pos < size) {
+            if (count == capacity) {
+                return {BulkStatus::output_full, count, pos};
+            }
+
+            const Field f = make_field<T>(s, pos, find_separator(pos));
+
+            size_t error = 0;
+            BulkStatus status = BulkStatus::invalid_character;
+            if (fast_path(f)) {
+                uint64_t value;
+                if (convert(f, value, error)) {
+                    output[count] = make_value<T>(value, f.negative);
+                    status = BulkStatus::ok;
+                }
+            } else {
+                status = parse_field_scalar(s, f.start, f.end, output[count], error);
+            }
+
+            if (status != BulkStatus::ok) {
+                return {status, count, error};
+            }
+
+            count += 1;
+            pos = f.end + 1;
+        }
+
+        return {BulkStatus::ok, count, size};
+    }
+
+    size_t find_separator_scalar(const char* s, size_t pos, size_t size, char delimiter) {
+        while (pos < size && !is_separator(s[pos], delimiter)) {
+            pos++;
+        }
+
+        return pos;
+    }
+
+    size_t find_separator_sse(const char* s, size_t pos, size_t size, char delimiter) {
+        const __m128i delim   = _mm_set1_epi8(delimiter);
+        const __m128i newline = _mm_set1_epi8('\n');
+        for (/**/; pos + 16 <= size; pos += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + pos));
+            const __m128i t = _mm_or_si128(_mm_cmpeq_epi8(v, delim), _mm_cmpeq_epi8(v, newline));
+            const uint32_t mask = _mm_movemask_epi8(t);
+            if (mask != 0) {
+                return pos + __builtin_ctz(mask);
+            }
+        }
+
+        return find_separator_scalar(s, pos, size, delimiter);
+    }
+
+    bool convert_ssse3(const char* s, const Field& f, uint64_t& value, size_t& error) {
+
+        const __m128i ascii0      = _mm_set1_epi8('0');
+        const __m128i nine        = _mm_set1_epi8(9);
+        const __m128i mul_1_10    = _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1);
+        const __m128i mul_1_100   = _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1);
+        const __m128i mul_1_10000 = _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1);
+
+        const size_t n = f.length();
+        const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + f.end - 16));
+        const __m128i keep  = keep_last_mask(n);
+        const __m128i t0    = _mm_sub_epi8(input, ascii0);
+
+        // a byte is a digit iff (byte - '0') <= 9 (unsigned)
+        const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(t0, nine), t0);
+        const uint32_t invalid = ~_mm_movemask_epi8(is_digit) & _mm_movemask_epi8(keep);
+        if (invalid != 0) {
+            error = f.end - 16 + __builtin_ctz(invalid);
+            return false;
+        }
+
+        const __m128i t1 = _mm_maddubs_epi16(_mm_and_si128(t0, keep), mul_1_10);
+        const __m128i t2 = _mm_madd_epi16(t1, mul_1_100);
+        const __m128i t3 = _mm_packus_epi32(t2, t2);
+        const __m128i t4 = _mm_madd_epi16(t3, mul_1_10000);
+
+        uint32_t p[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), t4);
+
+        value = uint64_t(p[0]) * 100000000u + uint64_t(p[1]);
+        return true;
+    }
+
+#ifdef __AVX2__
+    size_t find_separator_avx2(const char* s, size_t pos, size_t size, char delimiter) {
+        const __m256i delim   = _mm256_set1_epi8(delimiter);
+        const __m256i newline = _mm256_set1_epi8('\n');
+        for (/**/; pos + 32 <= size; pos += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + pos));
+            const __m256i t = _mm256_or_si256(_mm256_cmpeq_epi8(v, delim), _mm256_cmpeq_epi8(v, newline));
+            const uint32_t mask = _mm256_movemask_epi8(t);
+            if (mask != 0) {
+                return pos + __builtin_ctz(mask);
+            }
+        }
+
+        return find_separator_sse(s, pos, size, delimiter);
+    }
+
+    // Converts two fields at once, each in a separate 128-bit lane.
+    // Returns false if any of fields contains invalid characters;
+    // the caller then goes through the single-field path to locate error.
+    bool convert_pair_avx2(const char* s, const Field& f1, const Field& f2, uint64_t& value1, uint64_t& value2) {
+
+        const __m256i ascii0      = _mm256_set1_epi8('0');
+        const __m256i nine        = _mm256_set1_epi8(9);
+        const __m256i mul_1_10    = _mm256_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1,
+                                                     10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1);
+        const __m256i mul_1_100   = _mm256_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1,
+                                                      100, 1, 100, 1, 100, 1, 100, 1);
+        const __m256i mul_1_10000 = _mm256_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1,
+                                                      10000, 1, 10000, 1, 10000, 1, 10000, 1);
+
+        const __m128i in1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + f1.end - 16));
+        const __m128i in2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + f2.end - 16));
+        const __m256i input = _mm256_inserti128_si256(_mm256_castsi128_si256(in1), in2, 1);
+        const __m256i keep  = _mm256_inserti128_si256(_mm256_castsi128_si256(keep_last_mask(f1.length())),
+                                                      keep_last_mask(f2.length()), 1);
+
+        const __m256i t0 = _mm256_sub_epi8(input, ascii0);
+        const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(t0, nine), t0);
+        if ((~_mm256_movemask_epi8(is_digit) & _mm256_movemask_epi8(keep)) != 0) {
+            return false;
+        }
+
+        const __m256i t1 = _mm256_maddubs_epi16(_mm256_and_si256(t0, keep), mul_1_10);
+        const __m256i t2 = _mm256_madd_epi16(t1, mul_1_100);
+        const __m256i t3 = _mm256_packus_epi32(t2, t2);
+        const __m256i t4 = _mm256_madd_epi16(t3, mul_1_10000);
+
+        uint32_t p[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), t4);
+
+        value1 = uint64_t(p[0]) * 100000000u + uint64_t(p[1]);
+        value2 = uint64_t(p[4]) * 100000000u + uint64_t(p[5]);
+        return true;
+    }
+#endif // __AVX2__
+
+} // namespace bulk
+
+
+template <typename T>
+BulkResult bulk_parse_scalar(const char* s, size_t size, char delimiter, T* output, size_t capacity) {
+    static_assert(std::is_same<T, uint64_t>::value || std::is_same<T, int64_t>::value, "uint64_t or int64_t expected");
+
+    size_t count = 0;
+    size_t pos = 0;
+    while (pos < size) {
+        if (count == capacity) {
+            return {BulkStatus::output_full, count, pos};
+        }
+
+        const size_t end = bulk::find_separator_scalar(s, pos, size, delimiter);
+
+        size_t error = 0;
+        const BulkStatus status = bulk::parse_field_scalar(s, pos, end, output[count], error);
+        if (status != BulkStatus::ok) {
+            return {status, count, error};
+        }
+
+        count += 1;
+        pos = end + 1;
+    }
+
+    return {BulkStatus::ok, count, size};
+}
+
+
+template <typename T>
+BulkResult bulk_parse_ssse3(const char* s, size_t size, char delimiter, T* output, size_t capacity) {
+    static_assert(std::is_same<T, uint64_t>::value || std::is_same<T, int64_t>::value, "uint64_t or int64_t expected");
+
+    return bulk::parse_aux(s, size, output, capacity,
+        [s, size, delimiter](size_t pos) {
+            return bulk::find_separator_sse(s, pos, size, delimiter);
+        },
+        [s](const bulk::Field& f, uint64_t& value, size_t& error) {
+            return bulk::convert_ssse3(s, f, value, error);
+        });
+}
+
+
+#ifdef __AVX2__
+template <typename T>
+BulkResult bulk_parse_avx2(const char* s, size_t size, char delimiter, T* output, size_t capacity) {
+    static_assert(std::is_same<T, uint64_t>::value || std::is_same<T, int64_t>::value, "uint64_t or int64_t expected");
+
+    size_t count = 0;
+    size_t pos = 0;
+    while (pos < size) {
+        if (count == capacity) {
+            return {BulkStatus::output_full, count, pos};
+        }
+
+        const bulk::Field f1 = bulk::make_field<T>(s, pos, bulk::find_separator_avx2(s, pos, size, delimiter));
+        if (count + 1 < capacity && f1.end + 1 < size && bulk::fast_path(f1)) {
+            const size_t pos2 = f1.end + 1;
+            const bulk::Field f2 = bulk::make_field<T>(s, pos2, bulk::find_separator_avx2(s, pos2, size, delimiter));
+
+            uint64_t value1;
+            uint64_t value2;
+            if (bulk::fast_path(f2) && bulk::convert_pair_avx2(s, f1, f2, value1, value2)) {
+                output[count + 0] = bulk::make_value<T>(value1, f1.negative);
+                output[count + 1] = bulk::make_value<T>(value2, f2.negative);
+                count += 2;
+                pos = f2.end + 1;
+                continue;
+            }
+        }
+
+        // a single field: either no pair is available, or
+        // any field is long or invalid
+        size_t error = 0;
+        BulkStatus status = BulkStatus::invalid_character;
+        if (bulk::fast_path(f1)) {
+            uint64_t value;
+            if (bulk::convert_ssse3(s, f1, value, error)) {
+                output[count] = bulk::make_value<T>(value, f1.negative);
+                status = BulkStatus::ok;
+            }
+        } else {
+            status = bulk::parse_field_scalar(s, f1.start, f1.end, output[count], error);
+        }
+
+        if (status != BulkStatus::ok) {
+            return {status, count, error};
+        }
+
+        count += 1;
+        pos = f1.end + 1;
+    }
+
+    return {BulkStatus::ok, count, size};
+}
+#endif // __AVX2__
@@ -17,6 +17,7 @@ uint64_t convchunk_aux(FUN f, const char* s) {
 #include "parse.swar.cpp"
 #include "parse.sse.cpp"
 #include "parse.ssse3.cpp"
+#include "parse.bulk.cpp"
 
 using convfun = uint64_t (*)(const char* s);
 
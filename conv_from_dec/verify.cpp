@@ -1,6 +1,9 @@
 #include <cstdio>
 #include <cassert>
 #include <cstring>
+#include <cstdlib>
+#include <string>
+#include <vector>
 
 #include "procedures.cpp"
 
@@ -31,9 +34,151 @@ void verify() {
 }
 
 
+// bulk conversion
+// ------------------------------------------------------------------------
+
+template <typename T>
+using bulkfun = BulkResult (*)(const char* s, size_t size, char delimiter, T* output, size_t capacity);
+
+
+template <typename T>
+void verify_bulk_case(const std::string& input, size_t capacity) {
+
+    std::vector<T> reference(capacity + 1);
+    const BulkResult ref = bulk_parse_scalar(input.data(), input.size(), ',', reference.data(), capacity);
+
+    std::vector<std::pair<const char*, bulkfun<T>>> procedures;
+    procedures.emplace_back("SSSE3", bulk_parse_ssse3<T>);
+#ifdef __AVX2__
+    procedures.emplace_back("AVX2", bulk_parse_avx2<T>);
+#endif
+
+    for (auto& item: procedures) {
+        std::vector<T> output(capacity + 1);
+        const BulkResult res = item.second(input.data(), input.size(), ',', output.data(), capacity);
+
+        bool ok = (res.status == ref.status)
+               && (res.count  == ref.count)
+               && (res.offset == ref.offset);
+
+        for (size_t i=0; ok && i < ref.count; i++) {
+            ok = (output[i] == reference[i]);
+        }
+
+        if (!ok) {
+            printf("bulk %s failed for '%s'\n", item.first, input.c_str());
+            printf("expected: status=%d count=%lu offset=%lu\n", int(ref.status), ref.count, ref.offset);
+            printf("result  : status=%d count=%lu offset=%lu\n", int(res.status), res.count, res.offset);
+            exit(2);
+        }
+    }
+}
+
+
+template <typename T>
+BulkResult bulk_expect(const std::string& input, BulkStatus status, size_t count, size_t offset) {
+    T output[16];
+    const BulkResult res = bulk_parse_scalar(input.data(), input.size(), ',', output, 16);
+    if (res.status != status || res.count != count || res.offset != offset) {
+        printf("bulk scalar failed for '%s': status=%d count=%lu offset=%lu\n",
+               input.c_str(), int(res.status), res.count, res.offset);
+        exit(2);
+    }
+
+    verify_bulk_case<T>(input, 16);
+    return res;
+}
+
+
+std::string random_number(bool sign) {
+    std::string s;
+    if (sign) {
+        switch (rand() % 3) {
+            case 0: s += '-'; break;
+            case 1: s += '+'; break;
+        }
+    }
+
+    // at most 18 digits, so int64_t never overflows
+    const int digits = 1 + rand() % 18;
+    for (int i=0; i < digits; i++) {
+        s += char('0' + rand() % 10);
+    }
+
+    return s;
+}
+
+
+template <typename T>
+void verify_bulk_random(bool sign) {
+
+    for (int iteration=0; iteration < 20000; iteration++) {
+        std::string input;
+        const int count = 1 + rand() % 20;
+        for (int i=0; i < count; i++) {
+            input += random_number(sign);
+            input += (rand() % 4 == 0) ? '\n' : ',';
+        }
+
+        if (rand() % 2) {
+            input.pop_back();
+        }
+
+        // reference is checked against the standard library
+        std::vector<T> reference(count);
+        const BulkResult ref = bulk_parse_scalar(input.data(), input.size(), ',', reference.data(), count);
+        if (ref.status != BulkStatus::ok || ref.count != size_t(count)) {
+            printf("bulk scalar failed for '%s'\n", input.c_str());
+            exit(2);
+        }
+
+        const char* s = input.c_str();
+        for (int i=0; i < count; i++) {
+            char* end;
+            const T expected = std::is_signed<T>::value ? T(strtoll(s, &end, 10)) : T(strtoull(s, &end, 10));
+            if (expected != reference[i]) {
+                printf("bulk scalar failed for '%s', item #%d\n", input.c_str(), i);
+                exit(2);
+            }
+            s = end + 1;
+        }
+
+        verify_bulk_case<T>(input, count);
+        verify_bulk_case<T>(input, count / 2);
+
+        // corrupt a single byte
+        input[rand() % input.size()] = "x-+,\n0"[rand() % 6];
+        verify_bulk_case<T>(input, count);
+    }
+}
+
+
+void verify_bulk() {
+    const std::string pad = "1234567890123456,";
+
+    bulk_expect<uint64_t>("", BulkStatus::ok, 0, 0);
+    bulk_expect<uint64_t>("1,2\n3\n", BulkStatus::ok, 3, 6);
+    bulk_expect<uint64_t>(pad + "1,,2", BulkStatus::empty_field, 2, 19);
+    bulk_expect<uint64_t>(pad + pad + "123a5", BulkStatus::invalid_character, 2, 37);
+    bulk_expect<uint64_t>(pad + "-1", BulkStatus::invalid_character, 1, 17);
+    bulk_expect<uint64_t>(pad + "18446744073709551615", BulkStatus::ok, 2, 37);
+    bulk_expect<uint64_t>(pad + "18446744073709551616", BulkStatus::overflow, 1, 17);
+    bulk_expect<uint64_t>(pad + "0000000000000000000000000000042", BulkStatus::ok, 2, 48);
+    bulk_expect<int64_t>(pad + "-9223372036854775808", BulkStatus::ok, 2, 37);
+    bulk_expect<int64_t>(pad + "9223372036854775808", BulkStatus::overflow, 1, 17);
+    bulk_expect<int64_t>(pad + "+9223372036854775807", BulkStatus::ok, 2, 37);
+    bulk_expect<int64_t>(pad + "-,1", BulkStatus::empty_field, 1, 17);
+    bulk_expect<int64_t>(pad + "1-2", BulkStatus::invalid_character, 1, 18);
+
+    verify_bulk_random<uint64_t>(false);
+    verify_bulk_random<int64_t>(true);
+}
+
+
 int main() {
 
     puts("Verfication started, it might take a litte longer");
+    verify_bulk();
     verify();
     puts("All OK");
 }
@@ -0,0 +1,479 @@
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Linux stuff
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+    Loading whole files without copying into std::string.
+
+    All loaders return a FileView: a pointer and size, plus a handle which
+    keeps the storage alive (a memory mapping or a buffer borrowed from
+    a BufferPool). Copying a view is cheap, the storage is released when
+    the last copy is destroyed.
+
+    - map_file           -- mmap, optionally MAP_POPULATE, madvise hints
+                            and huge pages;
+    - read_file          -- read() loop into a pooled buffer, handles partial
+                            reads and EINTR;
+    - read_file_direct   -- like read_file, but with O_DIRECT (page cache is
+                            bypassed); falls back to buffered I/O if the file
+                            system doesn't support it;
+    - read_file_parallel -- preadv issued by several threads, each loads
+                            a contiguous part of file.
+
+    Errors are reported with std::runtime_error.
+*/
+
+namespace fileload {
+
+    class FileView {
+        const char* ptr;
+        size_t      len;
+        std::shared_ptr<void> storage;
+
+    public:
+        FileView()
+            : ptr(nullptr)
+            , len(0) {}
+
+        FileView(const char* ptr, size_t len, std::shared_ptr<void> storage)
+            : ptr(ptr)
+            , len(len)
+            , storage(std::move(storage)) {}
+
+        const char* data() const {
+            return ptr;
+        }
+
+        size_t size() const {
+            return len;
+        }
+
+        const char* begin() const {
+            return ptr;
+        }
+
+        const char* end() const {
+            return ptr + len;
+        }
+
+        std::string str() const {
+            return std::string(ptr, len);
+        }
+    };
+
+
+    [[noreturn]] void fail(const char* what, const std::string& path) {
+        throw std::runtime_error(std::string(what) + " '" + path + "': " + strerror(errno));
+    }
+
+
+    class File {
+        int fd;
+
+    public:
+        File(const std::string& path, int flags) : fd(::open(path.c_str(), flags)) {}
+
+        ~File() {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+
+        File(const File&) = delete;
+        File& operator=(const File&) = delete;
+
+        int get() const {
+            return fd;
+        }
+
+        bool is_open() const {
+            return fd >= 0;
+        }
+
+        size_t size(const std::string& path) const {
+            struct stat sb;
+            if (fstat(fd, &sb) < 0) {
+                fail("fstat", path);
+            }
+
+            return sb.st_size;
+        }
+    };
+
+
+    // --- mmap ------------------------------------------------------------
+
+    struct MapOptions {
+        bool populate   = true;             // MAP_POPULATE: pre-fault all pages
+        bool huge_pages = false;            // MAP_HUGETLB, or MADV_HUGEPAGE if not possible
+        int  advice     = MADV_SEQUENTIAL;  // passed to madvise, -1 = none
+    };
+
+
+    FileView map_file(const std::string& path, const MapOptions& options = MapOptions()) {
+
+        File file(path, O_RDONLY);
+        if (!file.is_open()) {
+            fail("open", path);
+        }
+
+        const size_t size = file.size(path);
+        if (size == 0) {
+            return FileView();
+        }
+
+        const int flags = MAP_PRIVATE | (options.populate ? MAP_POPULATE : 0);
+
+        void* addr = MAP_FAILED;
+        if (options.huge_pages) {
+            // works only for files on hugetlbfs
+            addr = mmap(nullptr, size, PROT_READ, flags | MAP_HUGETLB, file.get(), 0);
+        }
+
+        if (addr == MAP_FAILED) {
+            addr = mmap(nullptr, size, PROT_READ, flags, file.get(), 0);
+            if (addr == MAP_FAILED) {
+                fail("mmap", path);
+            }
+
+#ifdef MADV_HUGEPAGE
+            if (options.huge_pages) {
+                madvise(addr, size, MADV_HUGEPAGE); // just a hint
+            }
+#endif
+        }
+
+        if (options.advice >= 0) {
+            madvise(addr, size, options.advice);
+        }
+
+        // the mapping stays valid after the file is closed
+        std::shared_ptr<void> storage(addr, [size](void* p){munmap(p, size);});
+
+        return FileView(static_cast<const char*>(addr), size, std::move(storage));
+    }
+
+
+    // --- pooled buffers --------------------------------------------------
+
+    // Page-aligned buffers (anonymous mappings), reused between loads; a buffer
+    // is returned to pool when the last FileView referring to it is destroyed.
+    // The pool must outlive views. Thread-safe.
+    class BufferPool {
+
+        struct Buffer {
+            char*  ptr;
+            size_t capacity;
+        };
+
+        std::vector<Buffer> free_buffers;
+        std::mutex mutex;
+        const bool huge_pages;
+
+    public:
+        static const size_t alignment = 4096;
+
+        explicit BufferPool(bool huge_pages = false) : huge_pages(huge_pages) {}
+
+        ~BufferPool() {
+            for (const auto& buffer: free_buffers) {
+                munmap(buffer.ptr, buffer.capacity);
+            }
+        }
+
+        BufferPool(const BufferPool&) = delete;
+        BufferPool& operator=(const BufferPool&) = delete;
+
+        // returns a buffer of at least size bytes, rounded up to alignment
+        std::shared_ptr<char> acquire(size_t size) {
+
+            const size_t capacity = round_up(size == 0 ? 1 : size);
+            Buffer buffer = take(capacity);
+            if (buffer.ptr == nullptr) {
+                buffer = allocate(capacity);
+            }
+
+            return std::shared_ptr<char>(buffer.ptr, [this, buffer](char*){release(buffer);});
+        }
+
+        static size_t round_up(size_t size) {
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+    private:
+        // the smallest free buffer large enough
+        Buffer take(size_t capacity) {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            size_t best = free_buffers.size();
+            for (size_t i=0; i < free_buffers.size(); i++) {
+                if (free_buffers[i].capacity >= capacity
+                    && (best == free_buffers.size() || free_buffers[i].capacity < free_buffers[best].capacity)) {
+                    best = i;
+                }
+            }
+
+            if (best == free_buffers.size()) {
+                return Buffer{nullptr, 0};
+            }
+
+            const Buffer result = free_buffers[best];
+            free_buffers.erase(free_buffers.begin() + best);
+
+            return result;
+        }
+
+        void release(const Buffer& buffer) {
+            std::lock_guard<std::mutex> lock(mutex);
+            free_buffers.push_back(buffer);
+        }
+
+        Buffer allocate(size_t capacity) {
+            const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+            void* addr = MAP_FAILED;
+            if (huge_pages) {
+                const size_t huge = 2*1024*1024;
+                const size_t rounded = (capacity + huge - 1) & ~(huge - 1);
+                addr = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+                if (addr != MAP_FAILED) {
+                    capacity = rounded;
+                }
+            }
+
+            if (addr == MAP_FAILED) {
+                addr = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, flags, -1, 0);
+                if (addr == MAP_FAILED) {
+                    throw std::bad_alloc();
+                }
+#ifdef MADV_HUGEPAGE
+                if (huge_pages) {
+                    madvise(addr, capacity, MADV_HUGEPAGE);
+                }
+#endif
+            }
+
+            return Buffer{static_cast<char*>(addr), capacity};
+        }
+    };
+
+
+    // --- read() ----------------------------------------------------------
+
+    // reads until size bytes are read or EOF; returns number of bytes read
+    size_t read_full(int fd, char* buf, size_t size, off_t offset, const std::string& path) {
+        size_t done = 0;
+        while (done < size) {
+            const ssize_t n = ::pread(fd, buf + done, size - done, offset + done);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                fail("read", path);
+            }
+
+            if (n == 0) {
+                break;
+            }
+
+            done += n;
+        }
+
+        return done;
+    }
+
+
+    FileView read_file(const std::string& path, BufferPool& pool) {
+
+        File file(path, O_RDONLY);
+        if (!file.is_open()) {
+            fail("open", path);
+        }
+
+#ifdef POSIX_FADV_SEQUENTIAL
+        posix_fadvise(file.get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+        const size_t size = file.size(path);
+        auto buffer = pool.acquire(size);
+        char* data = buffer.get();
+
+        // the file might be truncated meanwhile
+        const size_t n = read_full(file.get(), data, size, 0, path);
+
+        return FileView(data, n, std::move(buffer));
+    }
+
+
+    // --- O_DIRECT --------------------------------------------------------
+
+    FileView read_file_direct(const std::string& path, BufferPool& pool) {
+
+        File file(path, O_RDONLY | O_DIRECT);
+        if (!file.is_open()) {
+            if (errno == EINVAL) { // tmpfs and others
+                return read_file(path, pool);
+            }
+
+            fail("open", path);
+        }
+
+        const size_t size = file.size(path);
+
+        // O_DIRECT requires aligned buffer, offset and length; the last
+        // block is requested in full, a read stops at EOF
+        const size_t capacity = BufferPool::round_up(size);
+        auto buffer = pool.acquire(capacity);
+        char* data = buffer.get();
+
+        size_t done = 0;
+        while (done < capacity) {
+            const ssize_t n = ::pread(file.get(), data + done, capacity - done, done);
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                fail("read", path);
+            }
+
+            done += n;
+            if (n == 0 || done % BufferPool::alignment != 0) {
+                break; // EOF; the next offset wouldn't be aligned anyway
+            }
+        }
+
+        return FileView(data, std::min(done, size), std::move(buffer));
+    }
+
+
+    // --- preadv from many threads ----------------------------------------
+
+    // Each thread reads a contiguous part of file (aligned to chunk_size)
+    // with preadv, using iovecs of chunk_size bytes.
+    FileView read_file_parallel(const std::string& path, BufferPool& pool,
+                                unsigned threads = std::thread::hardware_concurrency(),
+                                size_t chunk_size = 1024*1024) {
+
+        File file(path, O_RDONLY);
+        if (!file.is_open()) {
+            fail("open", path);
+        }
+
+        const size_t size = file.size(path);
+        auto buffer = pool.acquire(size);
+        char* data = buffer.get();
+
+        const size_t chunks = (size + chunk_size - 1) / chunk_size;
+        if (threads == 0) {
+            threads = 1;
+        }
+        if (threads > chunks) {
+            threads = (chunks == 0) ? 1 : chunks;
+        }
+
+        const size_t chunks_per_thread = (chunks + threads - 1) / threads;
+
+        std::vector<std::thread> workers;
+        std::vector<std::string> errors(threads);
+        std::vector<size_t> loaded(threads, 0);
+
+        auto worker = [&](unsigned id) {
+            const size_t first = id * chunks_per_thread * chunk_size;
+            const size_t last  = std::min(size, first + chunks_per_thread * chunk_size);
+            if (first >= last) {
+                return;
+            }
+
+            std::vector<iovec> iov;
+            for (size_t offset = first; offset < last; offset += chunk_size) {
+                iov.push_back(iovec{data + offset, std::min(chunk_size, last - offset)});
+            }
+
+            // preadv might return less than requested, then iovecs are adjusted
+            size_t done = 0;
+            size_t k = 0;
+            while (k < iov.size()) {
+                const int count = std::min<size_t>(iov.size() - k, IOV_MAX);
+                const ssize_t n = ::preadv(file.get(), &iov[k], count, first + done);
+                if (n < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    errors[id] = std::string("preadv '") + path + "': " + strerror(errno);
+                    return;
+                }
+
+                if (n == 0) {
+                    break; // EOF, the file was truncated
+                }
+
+                done += n;
+                size_t left = n;
+                while (left > 0 && left >= iov[k].iov_len) {
+                    left -= iov[k].iov_len;
+                    k += 1;
+                }
+
+                if (left > 0) {
+                    iov[k].iov_base = static_cast<char*>(iov[k].iov_base) + left;
+                    iov[k].iov_len -= left;
+                }
+            }
+
+            loaded[id] = done;
+        };
+
+        for (unsigned id=1; id < threads; id++) {
+            workers.emplace_back(worker, id);
+        }
+
+        worker(0);
+
+        for (auto& t: workers) {
+            t.join();
+        }
+
+        size_t total = 0;
+        for (unsigned id=0; id < threads; id++) {
+            if (!errors[id].empty()) {
+                throw std::runtime_error(errors[id]);
+            }
+
+            total += loaded[id];
+        }
+
+        if (total != size) {
+            throw std::runtime_error("file '" + path + "' changed while reading");
+        }
+
+        return FileView(data, size, std::move(buffer));
+    }
+
+
+    // drops the file from page cache (clean pages only), for cold-cache tests
+    void evict_from_page_cache(const std::string& path) {
+        File file(path, O_RDONLY);
+        if (!file.is_open()) {
+            fail("open", path);
+        }
+
+        fdatasync(file.get());
+        posix_fadvise(file.get(), 0, 0, POSIX_FADV_DONTNEED);
+    }
+
+} // namespace fileload
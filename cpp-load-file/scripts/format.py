@@ -21,13 +21,14 @@ def load(file):
         F = line.split()
         if F[0] == 'File':
             size = F[1]
-            assert size[-1] == 'M'
-            size = int(size[:-1])
+            if size[-1] != 'M':
+                size = None # only sizes in megabytes are tabulated
+            else:
+                size = int(size[:-1])
             continue
 
-        assert size is not None
-        if size not in data:
-            data[size] = [None, None, None, None]
+        if size is None:
+            continue
 
         F = line.split(': .', 2)
         name = F[0].strip()
@@ -41,8 +42,10 @@ def load(file):
         elif name == "POSIX read":
             index = 3
         else:
-            print "'%s'" % name
-            assert False
+            continue # procedures from fileload.cpp
+
+        if size not in data:
+            data[size] = [None, None, None, None]
 
         data[size][index] = time
 
@@ -15,6 +15,8 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include "fileload.cpp"
+
 
 std::string load1(const std::string& path) {
     std::ifstream file(path);
@@ -72,38 +74,100 @@ std::string load4(const std::string& path) {
     res.resize(sb.st_size);
 
     // C++17 defines .data() which returns a non-const pointer
-    read(fd, const_cast<char*>(res.data()), sb.st_size);
+    char* buf = const_cast<char*>(res.data());
+    size_t done = 0;
+    while (done < res.size()) {
+        const ssize_t n = read(fd, buf + done, res.size() - done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+
+        done += n;
+    }
     close(fd);
 
+    res.resize(done);
     return res;
 }
 
 // --------------------------------------------------------------------------------
 
+// Loaders copying the file need the whole file in memory; when it's larger
+// than available memory they are skipped (mapping still works).
+bool fits_in_memory(const std::string& path) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0)
+        return true; // loaders report the error
+
+    // MemAvailable includes page cache that can be reclaimed
+    uint64_t available = 0;
+    FILE* f = fopen("/proc/meminfo", "r");
+    if (f == nullptr)
+        return true;
+
+    char line[256];
+    while (fgets(line, sizeof(line), f) != nullptr) {
+        unsigned long long kb;
+        if (sscanf(line, "MemAvailable: %llu kB", &kb) == 1)
+            available = kb * 1024;
+    }
+    fclose(f);
+
+    return available == 0 || uint64_t(st.st_size) < available;
+}
+
+
 class Test {
     const std::string path;
+    const bool cold;
+    const bool copy;
     const int k = 10;
     uint64_t ref_time = 0;
+    fileload::BufferPool pool;
 
 public:
-    Test(const std::string& p) : path(p) {}
+    Test(const std::string& p, bool cold) : path(p), cold(cold), copy(fits_in_memory(p)) {}
 
     void run() {
+        if (!copy)
+            puts("file is larger than available memory, only mmap is measured");
+
         measure("C++ istreambuf_iterator",  load1);
         measure("C++ stream::rdbuf",        load2);
         measure("libc fread",               load3);
         measure("POSIX read",               load4);
+
+        using namespace fileload;
+
+        measure_map("mmap (populate)",      [](const std::string& p) {return map_file(p);});
+        measure_map("mmap (populate, huge)", [](const std::string& p) {
+            MapOptions options;
+            options.huge_pages = true;
+            return map_file(p, options);
+        });
+        measure("pooled read",              [this](const std::string& p) {return read_file(p, pool);});
+        measure("O_DIRECT read",            [this](const std::string& p) {return read_file_direct(p, pool);});
+        measure("preadv, 4 threads",        [this](const std::string& p) {return read_file_parallel(p, pool, 4);});
     }
 
 private:
     template <typename FUNCTION>
     void measure(const char* name, FUNCTION load_function) {
+        if (copy)
+            measure_map(name, load_function);
+    }
+
+    template <typename FUNCTION>
+    void measure_map(const char* name, FUNCTION load_function) {
 
         auto load = [this, &load_function]() {return load_function(path);};
 
         printf("%-30s: ", name); fflush(stdout);
         uint64_t time = -1;
         for (int i=0; i < k; i++) {
+          if (cold)
+              fileload::evict_from_page_cache(path);
           time = std::min(time, measure(load));
           putchar('.'); fflush(stdout);
         }
@@ -134,11 +198,21 @@ private:
 
 int main(int argc, char* argv[]) {
 
+    // --cold: the file is dropped from page cache before each load
+    bool cold = false;
+    for (int i=1; i < argc; i++) {
+        if (std::string(argv[i]) == "--cold")
+            cold = true;
+    }
+
     for (int i=1; i < argc; i++) {
         const std::string path = argv[i];
+        if (path == "--cold")
+            continue;
+
         printf("File %s\n", path.c_str());
 
-        Test test(path);
+        Test test(path, cold);
         test.run();
     }
 
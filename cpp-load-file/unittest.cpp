@@ -0,0 +1,96 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include "fileload.cpp"
+
+// Writes files of various sizes (empty, unaligned tails for O_DIRECT,
+// several chunks for read_file_parallel) and checks that every loader
+// returns exactly the bytes written.
+
+class Test {
+    const std::string path;
+    fileload::BufferPool pool;
+    bool ok = true;
+
+public:
+    Test(const std::string& path) : path(path) {}
+
+    bool run() {
+        const size_t sizes[] = {0, 1, 100, 4095, 4096, 4097, 65536 + 123, 3*1024*1024 + 7};
+
+        for (size_t size: sizes) {
+            const std::string expected = generate(size);
+            save(expected);
+
+            using namespace fileload;
+
+            check("map_file",           size, expected, [this]{return map_file(path);});
+            check("map_file (no populate)", size, expected, [this]{
+                MapOptions options;
+                options.populate = false;
+                return map_file(path, options);
+            });
+            check("read_file",          size, expected, [this]{return read_file(path, pool);});
+            check("read_file_direct",   size, expected, [this]{return read_file_direct(path, pool);});
+            check("read_file_parallel", size, expected, [this]{return read_file_parallel(path, pool, 4, 64*1024);});
+        }
+
+        remove(path.c_str());
+        return ok;
+    }
+
+private:
+    std::string generate(size_t size) {
+        std::string s(size, '\0');
+        uint32_t x = size + 1;
+        for (size_t i=0; i < size; i++) {
+            x = x * 1103515245 + 12345;
+            s[i] = char(x >> 24);
+        }
+
+        return s;
+    }
+
+    void save(const std::string& data) {
+        FILE* f = fopen(path.c_str(), "wb");
+        if (f == nullptr || fwrite(data.data(), 1, data.size(), f) != data.size()) {
+            throw std::runtime_error("can't write " + path);
+        }
+        fclose(f);
+    }
+
+    void check(const char* name, size_t size, const std::string& expected, std::function<fileload::FileView()> load) {
+        const auto view = load();
+
+        if (view.size() != expected.size()) {
+            printf("%s, size = %lu: got %lu bytes\n", name, size, view.size());
+            ok = false;
+            return;
+        }
+
+        if (size > 0 && (view.data() == nullptr || memcmp(view.data(), expected.data(), size) != 0)) {
+            printf("%s, size = %lu: wrong content\n", name, size);
+            ok = false;
+        }
+    }
+};
+
+
+int main() {
+
+    Test test("unittest.tmp");
+    try {
+        if (!test.run()) {
+            return EXIT_FAILURE;
+        }
+    } catch (std::exception& e) {
+        printf("%s\n", e.what());
+        return EXIT_FAILURE;
+    }
+
+    puts("All OK");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <emmintrin.h>
+
+/*
+    Join with a single allocation.
+
+    The size of result is calculated in the first pass, then all pieces
+    are written through a single pointer --- there are no capacity checks
+    of std::string::append. Input is any range (anything usable in
+    range-for) of items convertible to std::string_view.
+
+    Strings are usually short, a call to memcpy costs more than copying;
+    copy() handles sizes up to 32 bytes with two overlapping loads/stores
+    (scalar or SSE), larger pieces go to memcpy.
+
+    Result can be written to:
+
+    * a new std::string --- join(); before C++23 the string has to be
+      resized (zero-filled) first, that is noticeable for large results;
+    * an existing std::string, its capacity is reused --- join_into();
+    * a caller-provided buffer --- join_to(); use joined_size() to get
+      the required size.
+*/
+
+namespace strjoin {
+
+    inline char* copy(char* dst, const char* src, size_t n) {
+        if (n <= 16) {
+            if (n >= 8) {
+                uint64_t a, b;
+                memcpy(&a, src, 8);
+                memcpy(&b, src + n - 8, 8);
+                memcpy(dst, &a, 8);
+                memcpy(dst + n - 8, &b, 8);
+            } else if (n >= 4) {
+                uint32_t a, b;
+                memcpy(&a, src, 4);
+                memcpy(&b, src + n - 4, 4);
+                memcpy(dst, &a, 4);
+                memcpy(dst + n - 4, &b, 4);
+            } else if (n > 0) {
+                // n = 1, 2 or 3
+                dst[0]     = src[0];
+                dst[n / 2] = src[n / 2];
+                dst[n - 1] = src[n - 1];
+            }
+        } else if (n <= 32) {
+            const __m128i a = _mm_loadu_si128((const __m128i*)src);
+            const __m128i b = _mm_loadu_si128((const __m128i*)(src + n - 16));
+            _mm_storeu_si128((__m128i*)dst, a);
+            _mm_storeu_si128((__m128i*)(dst + n - 16), b);
+        } else {
+            memcpy(dst, src, n);
+        }
+
+        return dst + n;
+    }
+
+    inline char* copy(char* dst, std::string_view s) {
+        return copy(dst, s.data(), s.size());
+    }
+
+    template <typename Range>
+    size_t joined_size(std::string_view sep, const Range& items) {
+        size_t len = 0;
+        size_t n   = 0;
+        for (const auto& item: items) {
+            len += std::string_view(item).size();
+            n   += 1;
+        }
+
+        return (n > 0) ? len + (n - 1) * sep.size() : 0;
+    }
+
+    // writes joined items to out, which must have at least
+    // joined_size(sep, items) bytes; returns the end of written data
+    template <typename Range>
+    char* join_to(char* out, std::string_view sep, const Range& items) {
+        bool first = true;
+        for (const auto& item: items) {
+            if (!first) {
+                out = copy(out, sep);
+            }
+
+            out = copy(out, std::string_view(item));
+            first = false;
+        }
+
+        return out;
+    }
+
+    template <typename Range>
+    void join_into(std::string& result, std::string_view sep, const Range& items) {
+        result.resize(joined_size(sep, items));
+        join_to(&result[0], sep, items);
+    }
+
+    template <typename Range>
+    std::string join(std::string_view sep, const Range& items) {
+        std::string result;
+#ifdef __cpp_lib_string_resize_and_overwrite
+        // C++23: no zero-filling of fresh memory
+        result.resize_and_overwrite(joined_size(sep, items), [&](char* out, size_t len) {
+            join_to(out, sep, items);
+            return len;
+        });
+#else
+        join_into(result, sep, items);
+#endif
+
+        return result;
+    }
+
+    // concat("a", s, 'x', sv) --- arguments are anything convertible
+    // to std::string_view or single chars
+    namespace detail {
+
+        inline std::string_view view(std::string_view s) {
+            return s;
+        }
+
+        inline std::string_view view(const char& c) {
+            return std::string_view(&c, 1);
+        }
+
+    } // namespace detail
+
+    template <typename... Args>
+    std::string concat(const Args&... args) {
+        if constexpr (sizeof...(Args) == 0) {
+            return std::string();
+        } else {
+            const std::string_view pieces[] = {detail::view(args)...};
+
+            size_t len = 0;
+            for (const auto& s: pieces) {
+                len += s.size();
+            }
+
+            std::string result;
+            result.resize(len);
+
+            char* out = &result[0];
+            for (const auto& s: pieces) {
+                out = copy(out, s);
+            }
+
+            return result;
+        }
+    }
+
+    template <typename... Args>
+    std::string join_args(std::string_view sep, const Args&... args) {
+        if constexpr (sizeof...(Args) == 0) {
+            (void)sep;
+            return std::string();
+        } else {
+            const std::string_view pieces[] = {detail::view(args)...};
+
+            return join(sep, pieces);
+        }
+    }
+
+} // namespace strjoin
@@ -10,7 +10,7 @@ std::string join_precalc(const std::string& sep, const std::vector<std::string>&
 
     size_t len = (n - 1) * sep.size();
 
-    for (size_t i=1; i < n; i++) {
+    for (size_t i=0; i < n; i++) {
         len += items[i].size();
     }
 
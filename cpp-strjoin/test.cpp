@@ -1,27 +1,34 @@
 #include <cstdlib>
+#include <memory>
 
 #include "benchmark.h"
 #include "join_naive.h"
 #include "join_precalc.h"
+#include "join_builder.h"
 
 
 class Test {
 
-    const int min_length = 1;
-    const int max_length = 64;
+    const size_t min_length;
+    const size_t max_length;
     const int sep_length = 2;
     size_t count;
 
     std::vector<std::string> input;
+    std::vector<std::string_view> views;
     std::string output;
     std::string sep;
+    std::unique_ptr<char[]> buffer;
 
 public:
-    Test(size_t count_) : count(count_) {}
+    Test(size_t count_, size_t min_length_, size_t max_length_)
+        : min_length(min_length_)
+        , max_length(max_length_)
+        , count(count_) {}
 
     void run() {
         prepare();
-        printf("element count = %lu\n", count);
+        printf("element count = %lu, length %lu..%lu\n", count, min_length, max_length);
 
         const size_t repeat = 1000;
 
@@ -34,6 +41,28 @@ public:
             output = join_precalc(sep, input);
         };
         BEST_TIME(/**/, f2(), "precalc", repeat, count);
+
+        auto f3 = [this]() {
+            output = strjoin::join(sep, input);
+        };
+        BEST_TIME(/**/, f3(), "builder", repeat, count);
+
+        auto f4 = [this]() {
+            output = strjoin::join(sep, views);
+        };
+        BEST_TIME(/**/, f4(), "builder (string_view)", repeat, count);
+
+        auto f5 = [this]() {
+            strjoin::join_into(output, sep, input);
+        };
+        BEST_TIME(/**/, f5(), "builder (reuse string)", repeat, count);
+
+        auto f6 = [this]() {
+            strjoin::join_to(buffer.get(), sep, input);
+        };
+        BEST_TIME(/**/, f6(), "builder (caller buffer)", repeat, count);
+
+        verify();
     }
 
 private:
@@ -42,13 +71,55 @@ private:
 
         input.reserve(count);
         for (size_t i=0; i < count; i++)
-            input.push_back(random_string());
+            input.push_back(random_string(i));
+
+        views.assign(input.begin(), input.end());
+        buffer.reset(new char[strjoin::joined_size(sep, input)]);
     }
 
-    std::string random_string() {
+    std::string random_string(size_t i) {
         const size_t k = rand() % (max_length - min_length + 1) + min_length;
 
-        return std::string(k, '*');
+        return std::string(k, 'a' + i % 26);
+    }
+
+    void verify() {
+        const std::string expected = join_naive(sep, input);
+        const size_t len = strjoin::joined_size(sep, input);
+
+        if (join_precalc(sep, input) != expected
+            || strjoin::join(sep, input) != expected
+            || strjoin::join(sep, views) != expected
+            || len != expected.size()
+            || strjoin::join_to(buffer.get(), sep, input) != buffer.get() + len
+            || std::string(buffer.get(), len) != expected) {
+
+            puts("wrong result");
+            exit(1);
+        }
+
+        verify_args();
+    }
+
+    // variadic versions, with all kinds of arguments
+    void verify_args() {
+        const std::string s = "string";
+        const std::string_view v = "view";
+        const char c = '!';
+
+        if (strjoin::concat() != ""
+            || strjoin::concat(s) != "string"
+            || strjoin::concat(c) != "!"
+            || strjoin::concat(s, "-", v, c, std::string(40, 'x')) != "string-view!" + std::string(40, 'x')
+            || strjoin::join_args(", ") != ""
+            || strjoin::join_args(", ", v) != "view"
+            || strjoin::join_args(", ", c) != "!"
+            || strjoin::join_args(", ", s, v, c, "") != "string, view, !, "
+            || strjoin::join_args("", s, v) != "stringview") {
+
+            puts("wrong result of concat/join_args");
+            exit(1);
+        }
     }
 };
 
@@ -56,11 +127,18 @@ private:
 int main(int argc, char* argv[]) {
 
     if (argc < 2) {
-        printf("usage: %s input-size\n", argv[0]);
+        printf("usage: %s input-size [min-length max-length]\n", argv[0]);
         return 1;
     }
 
-    Test test(atoi(argv[1]));
+    size_t min_length = 1;
+    size_t max_length = 64;
+    if (argc >= 4) {
+        min_length = atoi(argv[2]);
+        max_length = atoi(argv[3]);
+    }
+
+    Test test(atoi(argv[1]), min_length, max_length);
 
     test.run();
 
@@ -1,3 +1,5 @@
+#pragma once
+
 #include <cstdio>
 #include <cstdint>
 #include <cmath>
@@ -55,6 +57,50 @@ struct traits<float> {
 };
 
 
+template <>
+struct traits<double> {
+
+    using type = double;
+
+    static const unsigned mantissa_bits = 52;
+    static const unsigned exponent_bits = 11;
+    static const int      exp_shift     = 1023;
+
+    union proxy {
+        type        value;
+        uint64_t    raw;
+
+        explicit proxy(type v) : value(v) {}
+        explicit proxy(uint64_t r) : raw(r) {}
+
+        bool is_negative() const {
+
+            return raw & 0x8000000000000000llu;
+        }
+
+        int get_exponent() const {
+
+            return int((raw >> mantissa_bits) & ((uint64_t(1) << exponent_bits) - 1)) - exp_shift;
+        }
+
+        uint64_t get_mantissa() const {
+
+            const uint64_t implicit_one = (uint64_t(1) << mantissa_bits);
+
+            return (raw & (implicit_one - 1));
+        }
+
+        uint64_t get_normalized_mantissa() const {
+
+            const uint64_t implicit_one = (uint64_t(1) << mantissa_bits);
+
+            return (raw & (implicit_one - 1)) | implicit_one;
+        }
+    };
+
+};
+
+
 template <typename FP_TYPE>
 class tostring;
 
@@ -0,0 +1,707 @@
+// generated by pow10_generate.py, do not edit
+
+static const int pow10_float_min = -31;
+static const int pow10_float_max = 45;
+static const uint64_t pow10_float[77] = {
+    0x81ceb32c4b43fcf5llu, // 10^-31
+    0xa2425ff75e14fc32llu, // 10^-30
+    0xcad2f7f5359a3b3fllu, // 10^-29
+    0xfd87b5f28300ca0ellu, // 10^-28
+    0x9e74d1b791e07e49llu, // 10^-27
+    0xc612062576589ddbllu, // 10^-26
+    0xf79687aed3eec552llu, // 10^-25
+    0x9abe14cd44753b53llu, // 10^-24
+    0xc16d9a0095928a28llu, // 10^-23
+    0xf1c90080baf72cb2llu, // 10^-22
+    0x971da05074da7befllu, // 10^-21
+    0xbce5086492111aebllu, // 10^-20
+    0xec1e4a7db69561a6llu, // 10^-19
+    0x9392ee8e921d5d08llu, // 10^-18
+    0xb877aa3236a4b44allu, // 10^-17
+    0xe69594bec44de15cllu, // 10^-16
+    0x901d7cf73ab0acdallu, // 10^-15
+    0xb424dc35095cd810llu, // 10^-14
+    0xe12e13424bb40e14llu, // 10^-13
+    0x8cbccc096f5088ccllu, // 10^-12
+    0xafebff0bcb24aaffllu, // 10^-11
+    0xdbe6fecebdedd5bfllu, // 10^-10
+    0x89705f4136b4a598llu, // 10^-9
+    0xabcc77118461cefdllu, // 10^-8
+    0xd6bf94d5e57a42bdllu, // 10^-7
+    0x8637bd05af6c69b6llu, // 10^-6
+    0xa7c5ac471b478424llu, // 10^-5
+    0xd1b71758e219652cllu, // 10^-4
+    0x83126e978d4fdf3cllu, // 10^-3
+    0xa3d70a3d70a3d70bllu, // 10^-2
+    0xcccccccccccccccdllu, // 10^-1
+    0x8000000000000001llu, // 10^0
+    0xa000000000000001llu, // 10^1
+    0xc800000000000001llu, // 10^2
+    0xfa00000000000001llu, // 10^3
+    0x9c40000000000001llu, // 10^4
+    0xc350000000000001llu, // 10^5
+    0xf424000000000001llu, // 10^6
+    0x9896800000000001llu, // 10^7
+    0xbebc200000000001llu, // 10^8
+    0xee6b280000000001llu, // 10^9
+    0x9502f90000000001llu, // 10^10
+    0xba43b74000000001llu, // 10^11
+    0xe8d4a51000000001llu, // 10^12
+    0x9184e72a00000001llu, // 10^13
+    0xb5e620f480000001llu, // 10^14
+    0xe35fa931a0000001llu, // 10^15
+    0x8e1bc9bf04000001llu, // 10^16
+    0xb1a2bc2ec5000001llu, // 10^17
+    0xde0b6b3a76400001llu, // 10^18
+    0x8ac7230489e80001llu, // 10^19
+    0xad78ebc5ac620001llu, // 10^20
+    0xd8d726b7177a8001llu, // 10^21
+    0x878678326eac9001llu, // 10^22
+    0xa968163f0a57b401llu, // 10^23
+    0xd3c21bcecceda101llu, // 10^24
+    0x84595161401484a1llu, // 10^25
+    0xa56fa5b99019a5c9llu, // 10^26
+    0xcecb8f27f4200f3bllu, // 10^27
+    0x813f3978f8940985llu, // 10^28
+    0xa18f07d736b90be6llu, // 10^29
+    0xc9f2c9cd04674edfllu, // 10^30
+    0xfc6f7c4045812297llu, // 10^31
+    0x9dc5ada82b70b59ellu, // 10^32
+    0xc5371912364ce306llu, // 10^33
+    0xf684df56c3e01bc7llu, // 10^34
+    0x9a130b963a6c115dllu, // 10^35
+    0xc097ce7bc90715b4llu, // 10^36
+    0xf0bdc21abb48db21llu, // 10^37
+    0x96769950b50d88f5llu, // 10^38
+    0xbc143fa4e250eb32llu, // 10^39
+    0xeb194f8e1ae525fellu, // 10^40
+    0x92efd1b8d0cf37bfllu, // 10^41
+    0xb7abc627050305aellu, // 10^42
+    0xe596b7b0c643c71allu, // 10^43
+    0x8f7e32ce7bea5c70llu, // 10^44
+    0xb35dbf821ae4f38cllu, // 10^45
+};
+
+static const int pow10_double_min = -292;
+static const int pow10_double_max = 326;
+static const uint64x2 pow10_double[619] = {
+    {0xff77b1fcbebcdc4fllu, 0x25e8e89c13bb0f7bllu}, // 10^-292
+    {0x9faacf3df73609b1llu, 0x77b191618c54e9adllu}, // 10^-291
+    {0xc795830d75038c1dllu, 0xd59df5b9ef6a2418llu}, // 10^-290
+    {0xf97ae3d0d2446f25llu, 0x4b0573286b44ad1ellu}, // 10^-289
+    {0x9becce62836ac577llu, 0x4ee367f9430aec33llu}, // 10^-288
+    {0xc2e801fb244576d5llu, 0x229c41f793cda740llu}, // 10^-287
+    {0xf3a20279ed56d48allu, 0x6b43527578c11110llu}, // 10^-286
+    {0x9845418c345644d6llu, 0x830a13896b78aaaallu}, // 10^-285
+    {0xbe5691ef416bd60cllu, 0x23cc986bc656d554llu}, // 10^-284
+    {0xedec366b11c6cb8fllu, 0x2cbfbe86b7ec8aa9llu}, // 10^-283
+    {0x94b3a202eb1c3f39llu, 0x7bf7d71432f3d6aallu}, // 10^-282
+    {0xb9e08a83a5e34f07llu, 0xdaf5ccd93fb0cc54llu}, // 10^-281
+    {0xe858ad248f5c22c9llu, 0xd1b3400f8f9cff69llu}, // 10^-280
+    {0x91376c36d99995bellu, 0x23100809b9c21fa2llu}, // 10^-279
+    {0xb58547448ffffb2dllu, 0xabd40a0c2832a78bllu}, // 10^-278
+    {0xe2e69915b3fff9f9llu, 0x16c90c8f323f516dllu}, // 10^-277
+    {0x8dd01fad907ffc3bllu, 0xae3da7d97f6792e4llu}, // 10^-276
+    {0xb1442798f49ffb4allu, 0x99cd11cfdf41779dllu}, // 10^-275
+    {0xdd95317f31c7fa1dllu, 0x40405643d711d584llu}, // 10^-274
+    {0x8a7d3eef7f1cfc52llu, 0x482835ea666b2573llu}, // 10^-273
+    {0xad1c8eab5ee43b66llu, 0xda3243650005eed0llu}, // 10^-272
+    {0xd863b256369d4a40llu, 0x90bed43e40076a83llu}, // 10^-271
+    {0x873e4f75e2224e68llu, 0x5a7744a6e804a292llu}, // 10^-270
+    {0xa90de3535aaae202llu, 0x711515d0a205cb37llu}, // 10^-269
+    {0xd3515c2831559a83llu, 0x0d5a5b44ca873e04llu}, // 10^-268
+    {0x8412d9991ed58091llu, 0xe858790afe9486c3llu}, // 10^-267
+    {0xa5178fff668ae0b6llu, 0x626e974dbe39a873llu}, // 10^-266
+    {0xce5d73ff402d98e3llu, 0xfb0a3d212dc81290llu}, // 10^-265
+    {0x80fa687f881c7f8ellu, 0x7ce66634bc9d0b9allu}, // 10^-264
+    {0xa139029f6a239f72llu, 0x1c1fffc1ebc44e81llu}, // 10^-263
+    {0xc987434744ac874ellu, 0xa327ffb266b56221llu}, // 10^-262
+    {0xfbe9141915d7a922llu, 0x4bf1ff9f0062baa9llu}, // 10^-261
+    {0x9d71ac8fada6c9b5llu, 0x6f773fc3603db4aallu}, // 10^-260
+    {0xc4ce17b399107c22llu, 0xcb550fb4384d21d4llu}, // 10^-259
+    {0xf6019da07f549b2bllu, 0x7e2a53a146606a49llu}, // 10^-258
+    {0x99c102844f94e0fbllu, 0x2eda7444cbfc426ellu}, // 10^-257
+    {0xc0314325637a1939llu, 0xfa911155fefb5309llu}, // 10^-256
+    {0xf03d93eebc589f88llu, 0x793555ab7eba27cbllu}, // 10^-255
+    {0x96267c7535b763b5llu, 0x4bc1558b2f3458dfllu}, // 10^-254
+    {0xbbb01b9283253ca2llu, 0x9eb1aaedfb016f17llu}, // 10^-253
+    {0xea9c227723ee8bcbllu, 0x465e15a979c1caddllu}, // 10^-252
+    {0x92a1958a7675175fllu, 0x0bfacd89ec191ecallu}, // 10^-251
+    {0xb749faed14125d36llu, 0xcef980ec671f667cllu}, // 10^-250
+    {0xe51c79a85916f484llu, 0x82b7e12780e7401bllu}, // 10^-249
+    {0x8f31cc0937ae58d2llu, 0xd1b2ecb8b0908811llu}, // 10^-248
+    {0xb2fe3f0b8599ef07llu, 0x861fa7e6dcb4aa16llu}, // 10^-247
+    {0xdfbdcece67006ac9llu, 0x67a791e093e1d49bllu}, // 10^-246
+    {0x8bd6a141006042bdllu, 0xe0c8bb2c5c6d24e1llu}, // 10^-245
+    {0xaecc49914078536dllu, 0x58fae9f773886e19llu}, // 10^-244
+    {0xda7f5bf590966848llu, 0xaf39a475506a899fllu}, // 10^-243
+    {0x888f99797a5e012dllu, 0x6d8406c952429604llu}, // 10^-242
+    {0xaab37fd7d8f58178llu, 0xc8e5087ba6d33b84llu}, // 10^-241
+    {0xd5605fcdcf32e1d6llu, 0xfb1e4a9a90880a65llu}, // 10^-240
+    {0x855c3be0a17fcd26llu, 0x5cf2eea09a550680llu}, // 10^-239
+    {0xa6b34ad8c9dfc06fllu, 0xf42faa48c0ea481fllu}, // 10^-238
+    {0xd0601d8efc57b08bllu, 0xf13b94daf124da27llu}, // 10^-237
+    {0x823c12795db6ce57llu, 0x76c53d08d6b70859llu}, // 10^-236
+    {0xa2cb1717b52481edllu, 0x54768c4b0c64ca6fllu}, // 10^-235
+    {0xcb7ddcdda26da268llu, 0xa9942f5dcf7dfd0allu}, // 10^-234
+    {0xfe5d54150b090b02llu, 0xd3f93b35435d7c4dllu}, // 10^-233
+    {0x9efa548d26e5a6e1llu, 0xc47bc5014a1a6db0llu}, // 10^-232
+    {0xc6b8e9b0709f109allu, 0x359ab6419ca1091cllu}, // 10^-231
+    {0xf867241c8cc6d4c0llu, 0xc30163d203c94b63llu}, // 10^-230
+    {0x9b407691d7fc44f8llu, 0x79e0de63425dcf1ellu}, // 10^-229
+    {0xc21094364dfb5636llu, 0x985915fc12f542e5llu}, // 10^-228
+    {0xf294b943e17a2bc4llu, 0x3e6f5b7b17b2939ellu}, // 10^-227
+    {0x979cf3ca6cec5b5allu, 0xa705992ceecf9c43llu}, // 10^-226
+    {0xbd8430bd08277231llu, 0x50c6ff782a838354llu}, // 10^-225
+    {0xece53cec4a314ebdllu, 0xa4f8bf5635246429llu}, // 10^-224
+    {0x940f4613ae5ed136llu, 0x871b7795e136be9allu}, // 10^-223
+    {0xb913179899f68584llu, 0x28e2557b59846e40llu}, // 10^-222
+    {0xe757dd7ec07426e5llu, 0x331aeada2fe589d0llu}, // 10^-221
+    {0x9096ea6f3848984fllu, 0x3ff0d2c85def7622llu}, // 10^-220
+    {0xb4bca50b065abe63llu, 0x0fed077a756b53aallu}, // 10^-219
+    {0xe1ebce4dc7f16dfbllu, 0xd3e8495912c62895llu}, // 10^-218
+    {0x8d3360f09cf6e4bdllu, 0x64712dd7abbbd95dllu}, // 10^-217
+    {0xb080392cc4349decllu, 0xbd8d794d96aacfb4llu}, // 10^-216
+    {0xdca04777f541c567llu, 0xecf0d7a0fc5583a1llu}, // 10^-215
+    {0x89e42caaf9491b60llu, 0xf41686c49db57245llu}, // 10^-214
+    {0xac5d37d5b79b6239llu, 0x311c2875c522ced6llu}, // 10^-213
+    {0xd77485cb25823ac7llu, 0x7d633293366b828cllu}, // 10^-212
+    {0x86a8d39ef77164bcllu, 0xae5dff9c02033198llu}, // 10^-211
+    {0xa8530886b54dbdebllu, 0xd9f57f830283fdfdllu}, // 10^-210
+    {0xd267caa862a12d66llu, 0xd072df63c324fd7cllu}, // 10^-209
+    {0x8380dea93da4bc60llu, 0x4247cb9e59f71e6ellu}, // 10^-208
+    {0xa46116538d0deb78llu, 0x52d9be85f074e609llu}, // 10^-207
+    {0xcd795be870516656llu, 0x67902e276c921f8cllu}, // 10^-206
+    {0x806bd9714632dff6llu, 0x00ba1cd8a3db53b7llu}, // 10^-205
+    {0xa086cfcd97bf97f3llu, 0x80e8a40eccd228a5llu}, // 10^-204
+    {0xc8a883c0fdaf7df0llu, 0x6122cd128006b2cellu}, // 10^-203
+    {0xfad2a4b13d1b5d6cllu, 0x796b805720085f82llu}, // 10^-202
+    {0x9cc3a6eec6311a63llu, 0xcbe3303674053bb1llu}, // 10^-201
+    {0xc3f490aa77bd60fcllu, 0xbedbfc4411068a9dllu}, // 10^-200
+    {0xf4f1b4d515acb93bllu, 0xee92fb5515482d45llu}, // 10^-199
+    {0x991711052d8bf3c5llu, 0x751bdd152d4d1c4bllu}, // 10^-198
+    {0xbf5cd54678eef0b6llu, 0xd262d45a78a0635ellu}, // 10^-197
+    {0xef340a98172aace4llu, 0x86fb897116c87c35llu}, // 10^-196
+    {0x9580869f0e7aac0ellu, 0xd45d35e6ae3d4da1llu}, // 10^-195
+    {0xbae0a846d2195712llu, 0x8974836059cca10allu}, // 10^-194
+    {0xe998d258869facd7llu, 0x2bd1a438703fc94cllu}, // 10^-193
+    {0x91ff83775423cc06llu, 0x7b6306a34627ddd0llu}, // 10^-192
+    {0xb67f6455292cbf08llu, 0x1a3bc84c17b1d543llu}, // 10^-191
+    {0xe41f3d6a7377eecallu, 0x20caba5f1d9e4a94llu}, // 10^-190
+    {0x8e938662882af53ellu, 0x547eb47b7282ee9dllu}, // 10^-189
+    {0xb23867fb2a35b28dllu, 0xe99e619a4f23aa44llu}, // 10^-188
+    {0xdec681f9f4c31f31llu, 0x6405fa00e2ec94d5llu}, // 10^-187
+    {0x8b3c113c38f9f37ellu, 0xde83bc408dd3dd05llu}, // 10^-186
+    {0xae0b158b4738705ellu, 0x9624ab50b148d446llu}, // 10^-185
+    {0xd98ddaee19068c76llu, 0x3badd624dd9b0958llu}, // 10^-184
+    {0x87f8a8d4cfa417c9llu, 0xe54ca5d70a80e5d7llu}, // 10^-183
+    {0xa9f6d30a038d1dbcllu, 0x5e9fcf4ccd211f4dllu}, // 10^-182
+    {0xd47487cc8470652bllu, 0x7647c32000696720llu}, // 10^-181
+    {0x84c8d4dfd2c63f3bllu, 0x29ecd9f40041e074llu}, // 10^-180
+    {0xa5fb0a17c777cf09llu, 0xf468107100525891llu}, // 10^-179
+    {0xcf79cc9db955c2ccllu, 0x7182148d4066eeb5llu}, // 10^-178
+    {0x81ac1fe293d599bfllu, 0xc6f14cd848405531llu}, // 10^-177
+    {0xa21727db38cb002fllu, 0xb8ada00e5a506a7dllu}, // 10^-176
+    {0xca9cf1d206fdc03bllu, 0xa6d90811f0e4851dllu}, // 10^-175
+    {0xfd442e4688bd304allu, 0x908f4a166d1da664llu}, // 10^-174
+    {0x9e4a9cec15763e2ellu, 0x9a598e4e043287ffllu}, // 10^-173
+    {0xc5dd44271ad3cdballu, 0x40eff1e1853f29fellu}, // 10^-172
+    {0xf7549530e188c128llu, 0xd12bee59e68ef47dllu}, // 10^-171
+    {0x9a94dd3e8cf578b9llu, 0x82bb74f8301958cfllu}, // 10^-170
+    {0xc13a148e3032d6e7llu, 0xe36a52363c1faf02llu}, // 10^-169
+    {0xf18899b1bc3f8ca1llu, 0xdc44e6c3cb279ac2llu}, // 10^-168
+    {0x96f5600f15a7b7e5llu, 0x29ab103a5ef8c0ballu}, // 10^-167
+    {0xbcb2b812db11a5dellu, 0x7415d448f6b6f0e8llu}, // 10^-166
+    {0xebdf661791d60f56llu, 0x111b495b3464ad22llu}, // 10^-165
+    {0x936b9fcebb25c995llu, 0xcab10dd900beec35llu}, // 10^-164
+    {0xb84687c269ef3bfbllu, 0x3d5d514f40eea743llu}, // 10^-163
+    {0xe65829b3046b0afallu, 0x0cb4a5a3112a5113llu}, // 10^-162
+    {0x8ff71a0fe2c2e6dcllu, 0x47f0e785eaba72acllu}, // 10^-161
+    {0xb3f4e093db73a093llu, 0x59ed216765690f57llu}, // 10^-160
+    {0xe0f218b8d25088b8llu, 0x306869c13ec3532dllu}, // 10^-159
+    {0x8c974f7383725573llu, 0x1e414218c73a13fcllu}, // 10^-158
+    {0xafbd2350644eeacfllu, 0xe5d1929ef90898fbllu}, // 10^-157
+    {0xdbac6c247d62a583llu, 0xdf45f746b74abf3allu}, // 10^-156
+    {0x894bc396ce5da772llu, 0x6b8bba8c328eb784llu}, // 10^-155
+    {0xab9eb47c81f5114fllu, 0x066ea92f3f326565llu}, // 10^-154
+    {0xd686619ba27255a2llu, 0xc80a537b0efefebellu}, // 10^-153
+    {0x8613fd0145877585llu, 0xbd06742ce95f5f37llu}, // 10^-152
+    {0xa798fc4196e952e7llu, 0x2c48113823b73705llu}, // 10^-151
+    {0xd17f3b51fca3a7a0llu, 0xf75a15862ca504c6llu}, // 10^-150
+    {0x82ef85133de648c4llu, 0x9a984d73dbe722fcllu}, // 10^-149
+    {0xa3ab66580d5fdaf5llu, 0xc13e60d0d2e0ebbbllu}, // 10^-148
+    {0xcc963fee10b7d1b3llu, 0x318df905079926a9llu}, // 10^-147
+    {0xffbbcfe994e5c61fllu, 0xfdf17746497f7053llu}, // 10^-146
+    {0x9fd561f1fd0f9bd3llu, 0xfeb6ea8bedefa634llu}, // 10^-145
+    {0xc7caba6e7c5382c8llu, 0xfe64a52ee96b8fc1llu}, // 10^-144
+    {0xf9bd690a1b68637bllu, 0x3dfdce7aa3c673b1llu}, // 10^-143
+    {0x9c1661a651213e2dllu, 0x06bea10ca65c084fllu}, // 10^-142
+    {0xc31bfa0fe5698db8llu, 0x486e494fcff30a63llu}, // 10^-141
+    {0xf3e2f893dec3f126llu, 0x5a89dba3c3efccfbllu}, // 10^-140
+    {0x986ddb5c6b3a76b7llu, 0xf89629465a75e01dllu}, // 10^-139
+    {0xbe89523386091465llu, 0xf6bbb397f1135824llu}, // 10^-138
+    {0xee2ba6c0678b597fllu, 0x746aa07ded582e2dllu}, // 10^-137
+    {0x94db483840b717efllu, 0xa8c2a44eb4571cddllu}, // 10^-136
+    {0xba121a4650e4ddebllu, 0x92f34d62616ce414llu}, // 10^-135
+    {0xe896a0d7e51e1566llu, 0x77b020baf9c81d18llu}, // 10^-134
+    {0x915e2486ef32cd60llu, 0x0ace1474dc1d122fllu}, // 10^-133
+    {0xb5b5ada8aaff80b8llu, 0x0d819992132456bbllu}, // 10^-132
+    {0xe3231912d5bf60e6llu, 0x10e1fff697ed6c6allu}, // 10^-131
+    {0x8df5efabc5979c8fllu, 0xca8d3ffa1ef463c2llu}, // 10^-130
+    {0xb1736b96b6fd83b3llu, 0xbd308ff8a6b17cb3llu}, // 10^-129
+    {0xddd0467c64bce4a0llu, 0xac7cb3f6d05ddbdfllu}, // 10^-128
+    {0x8aa22c0dbef60ee4llu, 0x6bcdf07a423aa96cllu}, // 10^-127
+    {0xad4ab7112eb3929dllu, 0x86c16c98d2c953c7llu}, // 10^-126
+    {0xd89d64d57a607744llu, 0xe871c7bf077ba8b8llu}, // 10^-125
+    {0x87625f056c7c4a8bllu, 0x11471cd764ad4973llu}, // 10^-124
+    {0xa93af6c6c79b5d2dllu, 0xd598e40d3dd89bd0llu}, // 10^-123
+    {0xd389b47879823479llu, 0x4aff1d108d4ec2c4llu}, // 10^-122
+    {0x843610cb4bf160cbllu, 0xcedf722a585139bbllu}, // 10^-121
+    {0xa54394fe1eedb8fellu, 0xc2974eb4ee658829llu}, // 10^-120
+    {0xce947a3da6a9273ellu, 0x733d226229feea33llu}, // 10^-119
+    {0x811ccc668829b887llu, 0x0806357d5a3f5260llu}, // 10^-118
+    {0xa163ff802a3426a8llu, 0xca07c2dcb0cf26f8llu}, // 10^-117
+    {0xc9bcff6034c13052llu, 0xfc89b393dd02f0b6llu}, // 10^-116
+    {0xfc2c3f3841f17c67llu, 0xbbac2078d443ace3llu}, // 10^-115
+    {0x9d9ba7832936edc0llu, 0xd54b944b84aa4c0ellu}, // 10^-114
+    {0xc5029163f384a931llu, 0x0a9e795e65d4df12llu}, // 10^-113
+    {0xf64335bcf065d37dllu, 0x4d4617b5ff4a16d6llu}, // 10^-112
+    {0x99ea0196163fa42ellu, 0x504bced1bf8e4e46llu}, // 10^-111
+    {0xc06481fb9bcf8d39llu, 0xe45ec2862f71e1d7llu}, // 10^-110
+    {0xf07da27a82c37088llu, 0x5d767327bb4e5a4dllu}, // 10^-109
+    {0x964e858c91ba2655llu, 0x3a6a07f8d510f870llu}, // 10^-108
+    {0xbbe226efb628afeallu, 0x890489f70a55368cllu}, // 10^-107
+    {0xeadab0aba3b2dbe5llu, 0x2b45ac74ccea842fllu}, // 10^-106
+    {0x92c8ae6b464fc96fllu, 0x3b0b8bc90012929ellu}, // 10^-105
+    {0xb77ada0617e3bbcbllu, 0x09ce6ebb40173745llu}, // 10^-104
+    {0xe55990879ddcaabdllu, 0xcc420a6a101d0516llu}, // 10^-103
+    {0x8f57fa54c2a9eab6llu, 0x9fa946824a12232ellu}, // 10^-102
+    {0xb32df8e9f3546564llu, 0x47939822dc96abfallu}, // 10^-101
+    {0xdff9772470297ebdllu, 0x59787e2b93bc56f8llu}, // 10^-100
+    {0x8bfbea76c619ef36llu, 0x57eb4edb3c55b65bllu}, // 10^-99
+    {0xaefae51477a06b03llu, 0xede622920b6b23f2llu}, // 10^-98
+    {0xdab99e59958885c4llu, 0xe95fab368e45eceellu}, // 10^-97
+    {0x88b402f7fd75539bllu, 0x11dbcb0218ebb415llu}, // 10^-96
+    {0xaae103b5fcd2a881llu, 0xd652bdc29f26a11allu}, // 10^-95
+    {0xd59944a37c0752a2llu, 0x4be76d3346f04960llu}, // 10^-94
+    {0x857fcae62d8493a5llu, 0x6f70a4400c562ddcllu}, // 10^-93
+    {0xa6dfbd9fb8e5b88ellu, 0xcb4ccd500f6bb953llu}, // 10^-92
+    {0xd097ad07a71f26b2llu, 0x7e2000a41346a7a8llu}, // 10^-91
+    {0x825ecc24c873782fllu, 0x8ed400668c0c28c9llu}, // 10^-90
+    {0xa2f67f2dfa90563bllu, 0x728900802f0f32fbllu}, // 10^-89
+    {0xcbb41ef979346bcallu, 0x4f2b40a03ad2ffballu}, // 10^-88
+    {0xfea126b7d78186bcllu, 0xe2f610c84987bfa9llu}, // 10^-87
+    {0x9f24b832e6b0f436llu, 0x0dd9ca7d2df4d7callu}, // 10^-86
+    {0xc6ede63fa05d3143llu, 0x91503d1c79720dbcllu}, // 10^-85
+    {0xf8a95fcf88747d94llu, 0x75a44c6397ce912bllu}, // 10^-84
+    {0x9b69dbe1b548ce7cllu, 0xc986afbe3ee11abbllu}, // 10^-83
+    {0xc24452da229b021bllu, 0xfbe85badce996169llu}, // 10^-82
+    {0xf2d56790ab41c2a2llu, 0xfae27299423fb9c4llu}, // 10^-81
+    {0x97c560ba6b0919a5llu, 0xdccd879fc967d41bllu}, // 10^-80
+    {0xbdb6b8e905cb600fllu, 0x5400e987bbc1c921llu}, // 10^-79
+    {0xed246723473e3813llu, 0x290123e9aab23b69llu}, // 10^-78
+    {0x9436c0760c86e30bllu, 0xf9a0b6720aaf6522llu}, // 10^-77
+    {0xb94470938fa89bcellu, 0xf808e40e8d5b3e6allu}, // 10^-76
+    {0xe7958cb87392c2c2llu, 0xb60b1d1230b20e05llu}, // 10^-75
+    {0x90bd77f3483bb9b9llu, 0xb1c6f22b5e6f48c3llu}, // 10^-74
+    {0xb4ecd5f01a4aa828llu, 0x1e38aeb6360b1af4llu}, // 10^-73
+    {0xe2280b6c20dd5232llu, 0x25c6da63c38de1b1llu}, // 10^-72
+    {0x8d590723948a535fllu, 0x579c487e5a38ad0fllu}, // 10^-71
+    {0xb0af48ec79ace837llu, 0x2d835a9df0c6d852llu}, // 10^-70
+    {0xdcdb1b2798182244llu, 0xf8e431456cf88e66llu}, // 10^-69
+    {0x8a08f0f8bf0f156bllu, 0x1b8e9ecb641b5900llu}, // 10^-68
+    {0xac8b2d36eed2dac5llu, 0xe272467e3d222f40llu}, // 10^-67
+    {0xd7adf884aa879177llu, 0x5b0ed81dcc6abb10llu}, // 10^-66
+    {0x86ccbb52ea94baeallu, 0x98e947129fc2b4eallu}, // 10^-65
+    {0xa87fea27a539e9a5llu, 0x3f2398d747b36225llu}, // 10^-64
+    {0xd29fe4b18e88640ellu, 0x8eec7f0d19a03aaellu}, // 10^-63
+    {0x83a3eeeef9153e89llu, 0x1953cf68300424adllu}, // 10^-62
+    {0xa48ceaaab75a8e2bllu, 0x5fa8c3423c052dd8llu}, // 10^-61
+    {0xcdb02555653131b6llu, 0x3792f412cb06794ellu}, // 10^-60
+    {0x808e17555f3ebf11llu, 0xe2bbd88bbee40bd1llu}, // 10^-59
+    {0xa0b19d2ab70e6ed6llu, 0x5b6aceaeae9d0ec5llu}, // 10^-58
+    {0xc8de047564d20a8bllu, 0xf245825a5a445276llu}, // 10^-57
+    {0xfb158592be068d2ellu, 0xeed6e2f0f0d56713llu}, // 10^-56
+    {0x9ced737bb6c4183dllu, 0x55464dd69685606cllu}, // 10^-55
+    {0xc428d05aa4751e4cllu, 0xaa97e14c3c26b887llu}, // 10^-54
+    {0xf53304714d9265dfllu, 0xd53dd99f4b3066a9llu}, // 10^-53
+    {0x993fe2c6d07b7fabllu, 0xe546a8038efe402allu}, // 10^-52
+    {0xbf8fdb78849a5f96llu, 0xde98520472bdd034llu}, // 10^-51
+    {0xef73d256a5c0f77cllu, 0x963e66858f6d4441llu}, // 10^-50
+    {0x95a8637627989aadllu, 0xdde7001379a44aa9llu}, // 10^-49
+    {0xbb127c53b17ec159llu, 0x5560c018580d5d53llu}, // 10^-48
+    {0xe9d71b689dde71afllu, 0xaab8f01e6e10b4a7llu}, // 10^-47
+    {0x9226712162ab070dllu, 0xcab3961304ca70e9llu}, // 10^-46
+    {0xb6b00d69bb55c8d1llu, 0x3d607b97c5fd0d23llu}, // 10^-45
+    {0xe45c10c42a2b3b05llu, 0x8cb89a7db77c506bllu}, // 10^-44
+    {0x8eb98a7a9a5b04e3llu, 0x77f3608e92adb243llu}, // 10^-43
+    {0xb267ed1940f1c61cllu, 0x55f038b237591ed4llu}, // 10^-42
+    {0xdf01e85f912e37a3llu, 0x6b6c46dec52f6689llu}, // 10^-41
+    {0x8b61313bbabce2c6llu, 0x2323ac4b3b3da016llu}, // 10^-40
+    {0xae397d8aa96c1b77llu, 0xabec975e0a0d081bllu}, // 10^-39
+    {0xd9c7dced53c72255llu, 0x96e7bd358c904a22llu}, // 10^-38
+    {0x881cea14545c7575llu, 0x7e50d64177da2e55llu}, // 10^-37
+    {0xaa242499697392d2llu, 0xdde50bd1d5d0b9eallu}, // 10^-36
+    {0xd4ad2dbfc3d07787llu, 0x955e4ec64b44e865llu}, // 10^-35
+    {0x84ec3c97da624ab4llu, 0xbd5af13bef0b113fllu}, // 10^-34
+    {0xa6274bbdd0fadd61llu, 0xecb1ad8aeacdd58fllu}, // 10^-33
+    {0xcfb11ead453994ballu, 0x67de18eda5814af3llu}, // 10^-32
+    {0x81ceb32c4b43fcf4llu, 0x80eacf948770ced8llu}, // 10^-31
+    {0xa2425ff75e14fc31llu, 0xa1258379a94d028ellu}, // 10^-30
+    {0xcad2f7f5359a3b3ellu, 0x096ee45813a04331llu}, // 10^-29
+    {0xfd87b5f28300ca0dllu, 0x8bca9d6e188853fdllu}, // 10^-28
+    {0x9e74d1b791e07e48llu, 0x775ea264cf55347ellu}, // 10^-27
+    {0xc612062576589ddallu, 0x95364afe032a819ellu}, // 10^-26
+    {0xf79687aed3eec551llu, 0x3a83ddbd83f52205llu}, // 10^-25
+    {0x9abe14cd44753b52llu, 0xc4926a9672793543llu}, // 10^-24
+    {0xc16d9a0095928a27llu, 0x75b7053c0f178294llu}, // 10^-23
+    {0xf1c90080baf72cb1llu, 0x5324c68b12dd6339llu}, // 10^-22
+    {0x971da05074da7beellu, 0xd3f6fc16ebca5e04llu}, // 10^-21
+    {0xbce5086492111aeallu, 0x88f4bb1ca6bcf585llu}, // 10^-20
+    {0xec1e4a7db69561a5llu, 0x2b31e9e3d06c32e6llu}, // 10^-19
+    {0x9392ee8e921d5d07llu, 0x3aff322e62439fd0llu}, // 10^-18
+    {0xb877aa3236a4b449llu, 0x09befeb9fad487c3llu}, // 10^-17
+    {0xe69594bec44de15bllu, 0x4c2ebe687989a9b4llu}, // 10^-16
+    {0x901d7cf73ab0acd9llu, 0x0f9d37014bf60a11llu}, // 10^-15
+    {0xb424dc35095cd80fllu, 0x538484c19ef38c95llu}, // 10^-14
+    {0xe12e13424bb40e13llu, 0x2865a5f206b06fballu}, // 10^-13
+    {0x8cbccc096f5088cbllu, 0xf93f87b7442e45d4llu}, // 10^-12
+    {0xafebff0bcb24aafellu, 0xf78f69a51539d749llu}, // 10^-11
+    {0xdbe6fecebdedd5bellu, 0xb573440e5a884d1cllu}, // 10^-10
+    {0x89705f4136b4a597llu, 0x31680a88f8953031llu}, // 10^-9
+    {0xabcc77118461cefcllu, 0xfdc20d2b36ba7c3ellu}, // 10^-8
+    {0xd6bf94d5e57a42bcllu, 0x3d32907604691b4dllu}, // 10^-7
+    {0x8637bd05af6c69b5llu, 0xa63f9a49c2c1b110llu}, // 10^-6
+    {0xa7c5ac471b478423llu, 0x0fcf80dc33721d54llu}, // 10^-5
+    {0xd1b71758e219652bllu, 0xd3c36113404ea4a9llu}, // 10^-4
+    {0x83126e978d4fdf3bllu, 0x645a1cac083126eallu}, // 10^-3
+    {0xa3d70a3d70a3d70allu, 0x3d70a3d70a3d70a4llu}, // 10^-2
+    {0xccccccccccccccccllu, 0xcccccccccccccccdllu}, // 10^-1
+    {0x8000000000000000llu, 0x0000000000000001llu}, // 10^0
+    {0xa000000000000000llu, 0x0000000000000001llu}, // 10^1
+    {0xc800000000000000llu, 0x0000000000000001llu}, // 10^2
+    {0xfa00000000000000llu, 0x0000000000000001llu}, // 10^3
+    {0x9c40000000000000llu, 0x0000000000000001llu}, // 10^4
+    {0xc350000000000000llu, 0x0000000000000001llu}, // 10^5
+    {0xf424000000000000llu, 0x0000000000000001llu}, // 10^6
+    {0x9896800000000000llu, 0x0000000000000001llu}, // 10^7
+    {0xbebc200000000000llu, 0x0000000000000001llu}, // 10^8
+    {0xee6b280000000000llu, 0x0000000000000001llu}, // 10^9
+    {0x9502f90000000000llu, 0x0000000000000001llu}, // 10^10
+    {0xba43b74000000000llu, 0x0000000000000001llu}, // 10^11
+    {0xe8d4a51000000000llu, 0x0000000000000001llu}, // 10^12
+    {0x9184e72a00000000llu, 0x0000000000000001llu}, // 10^13
+    {0xb5e620f480000000llu, 0x0000000000000001llu}, // 10^14
+    {0xe35fa931a0000000llu, 0x0000000000000001llu}, // 10^15
+    {0x8e1bc9bf04000000llu, 0x0000000000000001llu}, // 10^16
+    {0xb1a2bc2ec5000000llu, 0x0000000000000001llu}, // 10^17
+    {0xde0b6b3a76400000llu, 0x0000000000000001llu}, // 10^18
+    {0x8ac7230489e80000llu, 0x0000000000000001llu}, // 10^19
+    {0xad78ebc5ac620000llu, 0x0000000000000001llu}, // 10^20
+    {0xd8d726b7177a8000llu, 0x0000000000000001llu}, // 10^21
+    {0x878678326eac9000llu, 0x0000000000000001llu}, // 10^22
+    {0xa968163f0a57b400llu, 0x0000000000000001llu}, // 10^23
+    {0xd3c21bcecceda100llu, 0x0000000000000001llu}, // 10^24
+    {0x84595161401484a0llu, 0x0000000000000001llu}, // 10^25
+    {0xa56fa5b99019a5c8llu, 0x0000000000000001llu}, // 10^26
+    {0xcecb8f27f4200f3allu, 0x0000000000000001llu}, // 10^27
+    {0x813f3978f8940984llu, 0x4000000000000001llu}, // 10^28
+    {0xa18f07d736b90be5llu, 0x5000000000000001llu}, // 10^29
+    {0xc9f2c9cd04674edellu, 0xa400000000000001llu}, // 10^30
+    {0xfc6f7c4045812296llu, 0x4d00000000000001llu}, // 10^31
+    {0x9dc5ada82b70b59dllu, 0xf020000000000001llu}, // 10^32
+    {0xc5371912364ce305llu, 0x6c28000000000001llu}, // 10^33
+    {0xf684df56c3e01bc6llu, 0xc732000000000001llu}, // 10^34
+    {0x9a130b963a6c115cllu, 0x3c7f400000000001llu}, // 10^35
+    {0xc097ce7bc90715b3llu, 0x4b9f100000000001llu}, // 10^36
+    {0xf0bdc21abb48db20llu, 0x1e86d40000000001llu}, // 10^37
+    {0x96769950b50d88f4llu, 0x1314448000000001llu}, // 10^38
+    {0xbc143fa4e250eb31llu, 0x17d955a000000001llu}, // 10^39
+    {0xeb194f8e1ae525fdllu, 0x5dcfab0800000001llu}, // 10^40
+    {0x92efd1b8d0cf37bellu, 0x5aa1cae500000001llu}, // 10^41
+    {0xb7abc627050305adllu, 0xf14a3d9e40000001llu}, // 10^42
+    {0xe596b7b0c643c719llu, 0x6d9ccd05d0000001llu}, // 10^43
+    {0x8f7e32ce7bea5c6fllu, 0xe4820023a2000001llu}, // 10^44
+    {0xb35dbf821ae4f38bllu, 0xdda2802c8a800001llu}, // 10^45
+    {0xe0352f62a19e306ellu, 0xd50b2037ad200001llu}, // 10^46
+    {0x8c213d9da502de45llu, 0x4526f422cc340001llu}, // 10^47
+    {0xaf298d050e4395d6llu, 0x9670b12b7f410001llu}, // 10^48
+    {0xdaf3f04651d47b4cllu, 0x3c0cdd765f114001llu}, // 10^49
+    {0x88d8762bf324cd0fllu, 0xa5880a69fb6ac801llu}, // 10^50
+    {0xab0e93b6efee0053llu, 0x8eea0d047a457a01llu}, // 10^51
+    {0xd5d238a4abe98068llu, 0x72a4904598d6d881llu}, // 10^52
+    {0x85a36366eb71f041llu, 0x47a6da2b7f864751llu}, // 10^53
+    {0xa70c3c40a64e6c51llu, 0x999090b65f67d925llu}, // 10^54
+    {0xd0cf4b50cfe20765llu, 0xfff4b4e3f741cf6ellu}, // 10^55
+    {0x82818f1281ed449fllu, 0xbff8f10e7a8921a5llu}, // 10^56
+    {0xa321f2d7226895c7llu, 0xaff72d52192b6a0ellu}, // 10^57
+    {0xcbea6f8ceb02bb39llu, 0x9bf4f8a69f764491llu}, // 10^58
+    {0xfee50b7025c36a08llu, 0x02f236d04753d5b5llu}, // 10^59
+    {0x9f4f2726179a2245llu, 0x01d762422c946591llu}, // 10^60
+    {0xc722f0ef9d80aad6llu, 0x424d3ad2b7b97ef6llu}, // 10^61
+    {0xf8ebad2b84e0d58bllu, 0xd2e0898765a7deb3llu}, // 10^62
+    {0x9b934c3b330c8577llu, 0x63cc55f49f88eb30llu}, // 10^63
+    {0xc2781f49ffcfa6d5llu, 0x3cbf6b71c76b25fcllu}, // 10^64
+    {0xf316271c7fc3908allu, 0x8bef464e3945ef7bllu}, // 10^65
+    {0x97edd871cfda3a56llu, 0x97758bf0e3cbb5adllu}, // 10^66
+    {0xbde94e8e43d0c8ecllu, 0x3d52eeed1cbea318llu}, // 10^67
+    {0xed63a231d4c4fb27llu, 0x4ca7aaa863ee4bdellu}, // 10^68
+    {0x945e455f24fb1cf8llu, 0x8fe8caa93e74ef6bllu}, // 10^69
+    {0xb975d6b6ee39e436llu, 0xb3e2fd538e122b45llu}, // 10^70
+    {0xe7d34c64a9c85d44llu, 0x60dbbca87196b617llu}, // 10^71
+    {0x90e40fbeea1d3a4allu, 0xbc8955e946fe31cellu}, // 10^72
+    {0xb51d13aea4a488ddllu, 0x6babab6398bdbe42llu}, // 10^73
+    {0xe264589a4dcdab14llu, 0xc696963c7eed2dd2llu}, // 10^74
+    {0x8d7eb76070a08aecllu, 0xfc1e1de5cf543ca3llu}, // 10^75
+    {0xb0de65388cc8ada8llu, 0x3b25a55f43294bccllu}, // 10^76
+    {0xdd15fe86affad912llu, 0x49ef0eb713f39ebfllu}, // 10^77
+    {0x8a2dbf142dfcc7abllu, 0x6e3569326c784338llu}, // 10^78
+    {0xacb92ed9397bf996llu, 0x49c2c37f07965405llu}, // 10^79
+    {0xd7e77a8f87daf7fbllu, 0xdc33745ec97be907llu}, // 10^80
+    {0x86f0ac99b4e8dafdllu, 0x69a028bb3ded71a4llu}, // 10^81
+    {0xa8acd7c0222311bcllu, 0xc40832ea0d68ce0dllu}, // 10^82
+    {0xd2d80db02aabd62bllu, 0xf50a3fa490c30191llu}, // 10^83
+    {0x83c7088e1aab65dbllu, 0x792667c6da79e0fbllu}, // 10^84
+    {0xa4b8cab1a1563f52llu, 0x577001b891185939llu}, // 10^85
+    {0xcde6fd5e09abcf26llu, 0xed4c0226b55e6f87llu}, // 10^86
+    {0x80b05e5ac60b6178llu, 0x544f8158315b05b5llu}, // 10^87
+    {0xa0dc75f1778e39d6llu, 0x696361ae3db1c722llu}, // 10^88
+    {0xc913936dd571c84cllu, 0x03bc3a19cd1e38eallu}, // 10^89
+    {0xfb5878494ace3a5fllu, 0x04ab48a04065c724llu}, // 10^90
+    {0x9d174b2dcec0e47bllu, 0x62eb0d64283f9c77llu}, // 10^91
+    {0xc45d1df942711d9allu, 0x3ba5d0bd324f8395llu}, // 10^92
+    {0xf5746577930d6500llu, 0xca8f44ec7ee3647allu}, // 10^93
+    {0x9968bf6abbe85f20llu, 0x7e998b13cf4e1eccllu}, // 10^94
+    {0xbfc2ef456ae276e8llu, 0x9e3fedd8c321a67fllu}, // 10^95
+    {0xefb3ab16c59b14a2llu, 0xc5cfe94ef3ea101fllu}, // 10^96
+    {0x95d04aee3b80ece5llu, 0xbba1f1d158724a13llu}, // 10^97
+    {0xbb445da9ca61281fllu, 0x2a8a6e45ae8edc98llu}, // 10^98
+    {0xea1575143cf97226llu, 0xf52d09d71a3293bellu}, // 10^99
+    {0x924d692ca61be758llu, 0x593c2626705f9c57llu}, // 10^100
+    {0xb6e0c377cfa2e12ellu, 0x6f8b2fb00c77836dllu}, // 10^101
+    {0xe498f455c38b997allu, 0x0b6dfb9c0f956448llu}, // 10^102
+    {0x8edf98b59a373fecllu, 0x4724bd4189bd5eadllu}, // 10^103
+    {0xb2977ee300c50fe7llu, 0x58edec91ec2cb658llu}, // 10^104
+    {0xdf3d5e9bc0f653e1llu, 0x2f2967b66737e3eellu}, // 10^105
+    {0x8b865b215899f46cllu, 0xbd79e0d20082ee75llu}, // 10^106
+    {0xae67f1e9aec07187llu, 0xecd8590680a3aa12llu}, // 10^107
+    {0xda01ee641a708de9llu, 0xe80e6f4820cc9496llu}, // 10^108
+    {0x884134fe908658b2llu, 0x3109058d147fdcdellu}, // 10^109
+    {0xaa51823e34a7eedellu, 0xbd4b46f0599fd416llu}, // 10^110
+    {0xd4e5e2cdc1d1ea96llu, 0x6c9e18ac7007c91bllu}, // 10^111
+    {0x850fadc09923329ellu, 0x03e2cf6bc604ddb1llu}, // 10^112
+    {0xa6539930bf6bff45llu, 0x84db8346b786151dllu}, // 10^113
+    {0xcfe87f7cef46ff16llu, 0xe612641865679a64llu}, // 10^114
+    {0x81f14fae158c5f6ellu, 0x4fcb7e8f3f60c07fllu}, // 10^115
+    {0xa26da3999aef7749llu, 0xe3be5e330f38f09ellu}, // 10^116
+    {0xcb090c8001ab551cllu, 0x5cadf5bfd3072cc6llu}, // 10^117
+    {0xfdcb4fa002162a63llu, 0x73d9732fc7c8f7f7llu}, // 10^118
+    {0x9e9f11c4014dda7ellu, 0x2867e7fddcdd9afbllu}, // 10^119
+    {0xc646d63501a1511dllu, 0xb281e1fd541501b9llu}, // 10^120
+    {0xf7d88bc24209a565llu, 0x1f225a7ca91a4227llu}, // 10^121
+    {0x9ae757596946075fllu, 0x3375788de9b06959llu}, // 10^122
+    {0xc1a12d2fc3978937llu, 0x0052d6b1641c83afllu}, // 10^123
+    {0xf209787bb47d6b84llu, 0xc0678c5dbd23a49bllu}, // 10^124
+    {0x9745eb4d50ce6332llu, 0xf840b7ba963646e1llu}, // 10^125
+    {0xbd176620a501fbffllu, 0xb650e5a93bc3d899llu}, // 10^126
+    {0xec5d3fa8ce427affllu, 0xa3e51f138ab4cebfllu}, // 10^127
+    {0x93ba47c980e98cdfllu, 0xc66f336c36b10138llu}, // 10^128
+    {0xb8a8d9bbe123f017llu, 0xb80b0047445d4185llu}, // 10^129
+    {0xe6d3102ad96cec1dllu, 0xa60dc059157491e6llu}, // 10^130
+    {0x9043ea1ac7e41392llu, 0x87c89837ad68db30llu}, // 10^131
+    {0xb454e4a179dd1877llu, 0x29babe4598c311fcllu}, // 10^132
+    {0xe16a1dc9d8545e94llu, 0xf4296dd6fef3d67bllu}, // 10^133
+    {0x8ce2529e2734bb1dllu, 0x1899e4a65f58660dllu}, // 10^134
+    {0xb01ae745b101e9e4llu, 0x5ec05dcff72e7f90llu}, // 10^135
+    {0xdc21a1171d42645dllu, 0x76707543f4fa1f74llu}, // 10^136
+    {0x899504ae72497eballu, 0x6a06494a791c53a9llu}, // 10^137
+    {0xabfa45da0edbde69llu, 0x0487db9d17636893llu}, // 10^138
+    {0xd6f8d7509292d603llu, 0x45a9d2845d3c42b7llu}, // 10^139
+    {0x865b86925b9bc5c2llu, 0x0b8a2392ba45a9b3llu}, // 10^140
+    {0xa7f26836f282b732llu, 0x8e6cac7768d7141fllu}, // 10^141
+    {0xd1ef0244af2364ffllu, 0x3207d795430cd927llu}, // 10^142
+    {0x8335616aed761f1fllu, 0x7f44e6bd49e807b9llu}, // 10^143
+    {0xa402b9c5a8d3a6e7llu, 0x5f16206c9c6209a7llu}, // 10^144
+    {0xcd036837130890a1llu, 0x36dba887c37a8c10llu}, // 10^145
+    {0x802221226be55a64llu, 0xc2494954da2c978allu}, // 10^146
+    {0xa02aa96b06deb0fdllu, 0xf2db9baa10b7bd6dllu}, // 10^147
+    {0xc83553c5c8965d3dllu, 0x6f92829494e5acc8llu}, // 10^148
+    {0xfa42a8b73abbf48cllu, 0xcb772339ba1f17fallu}, // 10^149
+    {0x9c69a97284b578d7llu, 0xff2a760414536efcllu}, // 10^150
+    {0xc38413cf25e2d70dllu, 0xfef5138519684abbllu}, // 10^151
+    {0xf46518c2ef5b8cd1llu, 0x7eb258665fc25d6allu}, // 10^152
+    {0x98bf2f79d5993802llu, 0xef2f773ffbd97a62llu}, // 10^153
+    {0xbeeefb584aff8603llu, 0xaafb550ffacfd8fbllu}, // 10^154
+    {0xeeaaba2e5dbf6784llu, 0x95ba2a53f983cf39llu}, // 10^155
+    {0x952ab45cfa97a0b2llu, 0xdd945a747bf26184llu}, // 10^156
+    {0xba756174393d88dfllu, 0x94f971119aeef9e5llu}, // 10^157
+    {0xe912b9d1478ceb17llu, 0x7a37cd5601aab85ellu}, // 10^158
+    {0x91abb422ccb812eellu, 0xac62e055c10ab33bllu}, // 10^159
+    {0xb616a12b7fe617aallu, 0x577b986b314d600allu}, // 10^160
+    {0xe39c49765fdf9d94llu, 0xed5a7e85fda0b80cllu}, // 10^161
+    {0x8e41ade9fbebc27dllu, 0x14588f13be847308llu}, // 10^162
+    {0xb1d219647ae6b31cllu, 0x596eb2d8ae258fc9llu}, // 10^163
+    {0xde469fbd99a05fe3llu, 0x6fca5f8ed9aef3bcllu}, // 10^164
+    {0x8aec23d680043beellu, 0x25de7bb9480d5855llu}, // 10^165
+    {0xada72ccc20054ae9llu, 0xaf561aa79a10ae6bllu}, // 10^166
+    {0xd910f7ff28069da4llu, 0x1b2ba1518094da05llu}, // 10^167
+    {0x87aa9aff79042286llu, 0x90fb44d2f05d0843llu}, // 10^168
+    {0xa99541bf57452b28llu, 0x353a1607ac744a54llu}, // 10^169
+    {0xd3fa922f2d1675f2llu, 0x42889b8997915ce9llu}, // 10^170
+    {0x847c9b5d7c2e09b7llu, 0x69956135febada12llu}, // 10^171
+    {0xa59bc234db398c25llu, 0x43fab9837e699096llu}, // 10^172
+    {0xcf02b2c21207ef2ellu, 0x94f967e45e03f4bcllu}, // 10^173
+    {0x8161afb94b44f57dllu, 0x1d1be0eebac278f6llu}, // 10^174
+    {0xa1ba1ba79e1632dcllu, 0x6462d92a69731733llu}, // 10^175
+    {0xca28a291859bbf93llu, 0x7d7b8f7503cfdcffllu}, // 10^176
+    {0xfcb2cb35e702af78llu, 0x5cda735244c3d43fllu}, // 10^177
+    {0x9defbf01b061adabllu, 0x3a0888136afa64a8llu}, // 10^178
+    {0xc56baec21c7a1916llu, 0x088aaa1845b8fdd1llu}, // 10^179
+    {0xf6c69a72a3989f5bllu, 0x8aad549e57273d46llu}, // 10^180
+    {0x9a3c2087a63f6399llu, 0x36ac54e2f678864cllu}, // 10^181
+    {0xc0cb28a98fcf3c7fllu, 0x84576a1bb416a7dellu}, // 10^182
+    {0xf0fdf2d3f3c30b9fllu, 0x656d44a2a11c51d6llu}, // 10^183
+    {0x969eb7c47859e743llu, 0x9f644ae5a4b1b326llu}, // 10^184
+    {0xbc4665b596706114llu, 0x873d5d9f0dde1fefllu}, // 10^185
+    {0xeb57ff22fc0c7959llu, 0xa90cb506d155a7ebllu}, // 10^186
+    {0x9316ff75dd87cbd8llu, 0x09a7f12442d588f3llu}, // 10^187
+    {0xb7dcbf5354e9becellu, 0x0c11ed6d538aeb30llu}, // 10^188
+    {0xe5d3ef282a242e81llu, 0x8f1668c8a86da5fbllu}, // 10^189
+    {0x8fa475791a569d10llu, 0xf96e017d694487bdllu}, // 10^190
+    {0xb38d92d760ec4455llu, 0x37c981dcc395a9adllu}, // 10^191
+    {0xe070f78d3927556allu, 0x85bbe253f47b1418llu}, // 10^192
+    {0x8c469ab843b89562llu, 0x93956d7478ccec8fllu}, // 10^193
+    {0xaf58416654a6babbllu, 0x387ac8d1970027b3llu}, // 10^194
+    {0xdb2e51bfe9d0696allu, 0x06997b05fcc0319fllu}, // 10^195
+    {0x88fcf317f22241e2llu, 0x441fece3bdf81f04llu}, // 10^196
+    {0xab3c2fddeeaad25allu, 0xd527e81cad7626c4llu}, // 10^197
+    {0xd60b3bd56a5586f1llu, 0x8a71e223d8d3b075llu}, // 10^198
+    {0x85c7056562757456llu, 0xf6872d5667844e4allu}, // 10^199
+    {0xa738c6bebb12d16cllu, 0xb428f8ac016561dcllu}, // 10^200
+    {0xd106f86e69d785c7llu, 0xe13336d701beba53llu}, // 10^201
+    {0x82a45b450226b39cllu, 0xecc0024661173474llu}, // 10^202
+    {0xa34d721642b06084llu, 0x27f002d7f95d0191llu}, // 10^203
+    {0xcc20ce9bd35c78a5llu, 0x31ec038df7b441f5llu}, // 10^204
+    {0xff290242c83396cellu, 0x7e67047175a15272llu}, // 10^205
+    {0x9f79a169bd203e41llu, 0x0f0062c6e984d387llu}, // 10^206
+    {0xc75809c42c684dd1llu, 0x52c07b78a3e60869llu}, // 10^207
+    {0xf92e0c3537826145llu, 0xa7709a56ccdf8a83llu}, // 10^208
+    {0x9bbcc7a142b17ccbllu, 0x88a66076400bb692llu}, // 10^209
+    {0xc2abf989935ddbfellu, 0x6acff893d00ea436llu}, // 10^210
+    {0xf356f7ebf83552fellu, 0x0583f6b8c4124d44llu}, // 10^211
+    {0x98165af37b2153dellu, 0xc3727a337a8b704bllu}, // 10^212
+    {0xbe1bf1b059e9a8d6llu, 0x744f18c0592e4c5dllu}, // 10^213
+    {0xeda2ee1c7064130cllu, 0x1162def06f79df74llu}, // 10^214
+    {0x9485d4d1c63e8be7llu, 0x8addcb5645ac2ba9llu}, // 10^215
+    {0xb9a74a0637ce2ee1llu, 0x6d953e2bd7173693llu}, // 10^216
+    {0xe8111c87c5c1ba99llu, 0xc8fa8db6ccdd0438llu}, // 10^217
+    {0x910ab1d4db9914a0llu, 0x1d9c9892400a22a3llu}, // 10^218
+    {0xb54d5e4a127f59c8llu, 0x2503beb6d00cab4cllu}, // 10^219
+    {0xe2a0b5dc971f303allu, 0x2e44ae64840fd61ellu}, // 10^220
+    {0x8da471a9de737e24llu, 0x5ceaecfed289e5d3llu}, // 10^221
+    {0xb10d8e1456105dadllu, 0x7425a83e872c5f48llu}, // 10^222
+    {0xdd50f1996b947518llu, 0xd12f124e28f7771allu}, // 10^223
+    {0x8a5296ffe33cc92fllu, 0x82bd6b70d99aaa70llu}, // 10^224
+    {0xace73cbfdc0bfb7bllu, 0x636cc64d1001550cllu}, // 10^225
+    {0xd8210befd30efa5allu, 0x3c47f7e05401aa4fllu}, // 10^226
+    {0x8714a775e3e95c78llu, 0x65acfaec34810a72llu}, // 10^227
+    {0xa8d9d1535ce3b396llu, 0x7f1839a741a14d0ellu}, // 10^228
+    {0xd31045a8341ca07cllu, 0x1ede48111209a051llu}, // 10^229
+    {0x83ea2b892091e44dllu, 0x934aed0aab460433llu}, // 10^230
+    {0xa4e4b66b68b65d60llu, 0xf81da84d56178540llu}, // 10^231
+    {0xce1de40642e3f4b9llu, 0x36251260ab9d668fllu}, // 10^232
+    {0x80d2ae83e9ce78f3llu, 0xc1d72b7c6b42601allu}, // 10^233
+    {0xa1075a24e4421730llu, 0xb24cf65b8612f820llu}, // 10^234
+    {0xc94930ae1d529cfcllu, 0xdee033f26797b628llu}, // 10^235
+    {0xfb9b7cd9a4a7443cllu, 0x169840ef017da3b2llu}, // 10^236
+    {0x9d412e0806e88aa5llu, 0x8e1f289560ee864fllu}, // 10^237
+    {0xc491798a08a2ad4ellu, 0xf1a6f2bab92a27e3llu}, // 10^238
+    {0xf5b5d7ec8acb58a2llu, 0xae10af696774b1dcllu}, // 10^239
+    {0x9991a6f3d6bf1765llu, 0xacca6da1e0a8ef2allu}, // 10^240
+    {0xbff610b0cc6edd3fllu, 0x17fd090a58d32af4llu}, // 10^241
+    {0xeff394dcff8a948ellu, 0xddfc4b4cef07f5b1llu}, // 10^242
+    {0x95f83d0a1fb69cd9llu, 0x4abdaf101564f98fllu}, // 10^243
+    {0xbb764c4ca7a4440fllu, 0x9d6d1ad41abe37f2llu}, // 10^244
+    {0xea53df5fd18d5513llu, 0x84c86189216dc5eellu}, // 10^245
+    {0x92746b9be2f8552cllu, 0x32fd3cf5b4e49bb5llu}, // 10^246
+    {0xb7118682dbb66a77llu, 0x3fbc8c33221dc2a2llu}, // 10^247
+    {0xe4d5e82392a40515llu, 0x0fabaf3feaa5334bllu}, // 10^248
+    {0x8f05b1163ba6832dllu, 0x29cb4d87f2a7400fllu}, // 10^249
+    {0xb2c71d5bca9023f8llu, 0x743e20e9ef511013llu}, // 10^250
+    {0xdf78e4b2bd342cf6llu, 0x914da9246b255417llu}, // 10^251
+    {0x8bab8eefb6409c1allu, 0x1ad089b6c2f7548fllu}, // 10^252
+    {0xae9672aba3d0c320llu, 0xa184ac2473b529b2llu}, // 10^253
+    {0xda3c0f568cc4f3e8llu, 0xc9e5d72d90a2741fllu}, // 10^254
+    {0x8865899617fb1871llu, 0x7e2fa67c7a658893llu}, // 10^255
+    {0xaa7eebfb9df9de8dllu, 0xddbb901b98feeab8llu}, // 10^256
+    {0xd51ea6fa85785631llu, 0x552a74227f3ea566llu}, // 10^257
+    {0x8533285c936b35dellu, 0xd53a88958f872760llu}, // 10^258
+    {0xa67ff273b8460356llu, 0x8a892abaf368f138llu}, // 10^259
+    {0xd01fef10a657842cllu, 0x2d2b7569b0432d86llu}, // 10^260
+    {0x8213f56a67f6b29bllu, 0x9c3b29620e29fc74llu}, // 10^261
+    {0xa298f2c501f45f42llu, 0x8349f3ba91b47b90llu}, // 10^262
+    {0xcb3f2f7642717713llu, 0x241c70a936219a74llu}, // 10^263
+    {0xfe0efb53d30dd4d7llu, 0xed238cd383aa0111llu}, // 10^264
+    {0x9ec95d1463e8a506llu, 0xf4363804324a40abllu}, // 10^265
+    {0xc67bb4597ce2ce48llu, 0xb143c6053edcd0d6llu}, // 10^266
+    {0xf81aa16fdc1b81dallu, 0xdd94b7868e94050bllu}, // 10^267
+    {0x9b10a4e5e9913128llu, 0xca7cf2b4191c8327llu}, // 10^268
+    {0xc1d4ce1f63f57d72llu, 0xfd1c2f611f63a3f1llu}, // 10^269
+    {0xf24a01a73cf2dccfllu, 0xbc633b39673c8cedllu}, // 10^270
+    {0x976e41088617ca01llu, 0xd5be0503e085d814llu}, // 10^271
+    {0xbd49d14aa79dbc82llu, 0x4b2d8644d8a74e19llu}, // 10^272
+    {0xec9c459d51852ba2llu, 0xddf8e7d60ed1219fllu}, // 10^273
+    {0x93e1ab8252f33b45llu, 0xcabb90e5c942b504llu}, // 10^274
+    {0xb8da1662e7b00a17llu, 0x3d6a751f3b936244llu}, // 10^275
+    {0xe7109bfba19c0c9dllu, 0x0cc512670a783ad5llu}, // 10^276
+    {0x906a617d450187e2llu, 0x27fb2b80668b24c6llu}, // 10^277
+    {0xb484f9dc9641e9dallu, 0xb1f9f660802dedf7llu}, // 10^278
+    {0xe1a63853bbd26451llu, 0x5e7873f8a0396974llu}, // 10^279
+    {0x8d07e33455637eb2llu, 0xdb0b487b6423e1e9llu}, // 10^280
+    {0xb049dc016abc5e5fllu, 0x91ce1a9a3d2cda63llu}, // 10^281
+    {0xdc5c5301c56b75f7llu, 0x7641a140cc7810fcllu}, // 10^282
+    {0x89b9b3e11b6329ballu, 0xa9e904c87fcb0a9ellu}, // 10^283
+    {0xac2820d9623bf429llu, 0x546345fa9fbdcd45llu}, // 10^284
+    {0xd732290fbacaf133llu, 0xa97c177947ad4096llu}, // 10^285
+    {0x867f59a9d4bed6c0llu, 0x49ed8eabcccc485ellu}, // 10^286
+    {0xa81f301449ee8c70llu, 0x5c68f256bfff5a75llu}, // 10^287
+    {0xd226fc195c6a2f8cllu, 0x73832eec6fff3112llu}, // 10^288
+    {0x83585d8fd9c25db7llu, 0xc831fd53c5ff7eacllu}, // 10^289
+    {0xa42e74f3d032f525llu, 0xba3e7ca8b77f5e56llu}, // 10^290
+    {0xcd3a1230c43fb26fllu, 0x28ce1bd2e55f35ecllu}, // 10^291
+    {0x80444b5e7aa7cf85llu, 0x7980d163cf5b81b4llu}, // 10^292
+    {0xa0555e361951c366llu, 0xd7e105bcc3326220llu}, // 10^293
+    {0xc86ab5c39fa63440llu, 0x8dd9472bf3fefaa8llu}, // 10^294
+    {0xfa856334878fc150llu, 0xb14f98f6f0feb952llu}, // 10^295
+    {0x9c935e00d4b9d8d2llu, 0x6ed1bf9a569f33d4llu}, // 10^296
+    {0xc3b8358109e84f07llu, 0x0a862f80ec4700c9llu}, // 10^297
+    {0xf4a642e14c6262c8llu, 0xcd27bb612758c0fbllu}, // 10^298
+    {0x98e7e9cccfbd7dbdllu, 0x8038d51cb897789dllu}, // 10^299
+    {0xbf21e44003acdd2cllu, 0xe0470a63e6bd56c4llu}, // 10^300
+    {0xeeea5d5004981478llu, 0x1858ccfce06cac75llu}, // 10^301
+    {0x95527a5202df0ccbllu, 0x0f37801e0c43ebc9llu}, // 10^302
+    {0xbaa718e68396cffdllu, 0xd30560258f54e6bbllu}, // 10^303
+    {0xe950df20247c83fdllu, 0x47c6b82ef32a206allu}, // 10^304
+    {0x91d28b7416cdd27ellu, 0x4cdc331d57fa5442llu}, // 10^305
+    {0xb6472e511c81471dllu, 0xe0133fe4adf8e953llu}, // 10^306
+    {0xe3d8f9e563a198e5llu, 0x58180fddd97723a7llu}, // 10^307
+    {0x8e679c2f5e44ff8fllu, 0x570f09eaa7ea7649llu}, // 10^308
+    {0xb201833b35d63f73llu, 0x2cd2cc6551e513dbllu}, // 10^309
+    {0xde81e40a034bcf4fllu, 0xf8077f7ea65e58d2llu}, // 10^310
+    {0x8b112e86420f6191llu, 0xfb04afaf27faf783llu}, // 10^311
+    {0xadd57a27d29339f6llu, 0x79c5db9af1f9b564llu}, // 10^312
+    {0xd94ad8b1c7380874llu, 0x18375281ae7822bdllu}, // 10^313
+    {0x87cec76f1c830548llu, 0x8f2293910d0b15b6llu}, // 10^314
+    {0xa9c2794ae3a3c69allu, 0xb2eb3875504ddb23llu}, // 10^315
+    {0xd433179d9c8cb841llu, 0x5fa60692a46151ecllu}, // 10^316
+    {0x849feec281d7f328llu, 0xdbc7c41ba6bcd334llu}, // 10^317
+    {0xa5c7ea73224deff3llu, 0x12b9b522906c0801llu}, // 10^318
+    {0xcf39e50feae16befllu, 0xd768226b34870a01llu}, // 10^319
+    {0x81842f29f2cce375llu, 0xe6a1158300d46641llu}, // 10^320
+    {0xa1e53af46f801c53llu, 0x60495ae3c1097fd1llu}, // 10^321
+    {0xca5e89b18b602368llu, 0x385bb19cb14bdfc5llu}, // 10^322
+    {0xfcf62c1dee382c42llu, 0x46729e03dd9ed7b6llu}, // 10^323
+    {0x9e19db92b4e31ba9llu, 0x6c07a2c26a8346d2llu}, // 10^324
+    {0xc5a05277621be293llu, 0xc7098b7305241886llu}, // 10^325
+    {0xf70867153aa2db38llu, 0xb8cbee4fc66d1ea8llu}, // 10^326
+};
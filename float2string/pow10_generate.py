@@ -0,0 +1,87 @@
+import sys
+
+# Tables of powers of ten for the shortest conversion (see shortest.h).
+#
+# For each k the table holds g = floor(10^k * 2^-e) + 1, where e is
+# chosen so that g has exactly `bits` bits, i.e. 2^(bits-1) <= g < 2^bits:
+#
+#   e = floor(log2(10^k)) + 1 - bits
+#
+# float uses 64-bit values, double 128-bit ones (stored as hi/lo pair).
+
+float_range  = (-31, 45)
+double_range = (-292, 326)
+
+
+def main():
+    lines = []
+    lines.append('// generated by pow10_generate.py, do not edit')
+    lines.append('')
+    lines.extend(generate('pow10_float', float_range, 64))
+    lines.append('')
+    lines.extend(generate('pow10_double', double_range, 128))
+
+    output = '\n'.join(lines) + '\n'
+
+    try:
+        file = open(sys.argv[1], 'wt')
+    except IndexError:
+        file = sys.stdout
+
+    file.write(output)
+
+
+def floor_log2_pow10(k):
+    # exact value, computed on integers
+    if k >= 0:
+        return (10**k).bit_length() - 1
+
+    # floor(log2(1 / 10^-k)) = -ceil(log2(10^-k))
+    d = 10**(-k)
+    n = d.bit_length()
+    if d == 1 << (n - 1):
+        return -(n - 1)
+    return -n
+
+
+def floor_pow10_scaled(k, e):
+    # floor(10^k * 2^-e)
+    if k >= 0:
+        if e >= 0:
+            return 10**k >> e
+        return 10**k << (-e)
+    else:
+        assert e < 0
+        return (1 << (-e)) // 10**(-k)
+
+
+def generate(name, krange, bits):
+    kmin, kmax = krange
+    lines = []
+    lines.append('static const int %s_min = %d;' % (name, kmin))
+    lines.append('static const int %s_max = %d;' % (name, kmax))
+
+    if bits == 64:
+        lines.append('static const uint64_t %s[%d] = {' % (name, kmax - kmin + 1))
+    else:
+        lines.append('static const uint64x2 %s[%d] = {' % (name, kmax - kmin + 1))
+
+    for k in range(kmin, kmax + 1):
+        e = floor_log2_pow10(k) + 1 - bits
+        g = floor_pow10_scaled(k, e) + 1
+        assert (1 << (bits - 1)) <= g < (1 << bits)
+
+        if bits == 64:
+            lines.append('    0x%016xllu, // 10^%d' % (g, k))
+        else:
+            hi = g >> 64
+            lo = g & ((1 << 64) - 1)
+            lines.append('    {0x%016xllu, 0x%016xllu}, // 10^%d' % (hi, lo, k))
+
+    lines.append('};')
+
+    return lines
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,339 @@
+#pragma once
+
+#include "float2string.h"
+
+/*
+    Shortest round-trip conversion of float and double.
+
+    The decimal representation is found with the Schubfach algorithm
+    by Raffaello Giulietti ("The Schubfach way to render doubles", 2020):
+    the rounding interval of a value is scaled by a power of ten taken
+    from a precomputed table (pow10.inl, see pow10_generate.py), using
+    a single wide multiplication per interval boundary. The result is
+    the shortest decimal that rounds back to the same binary value; if
+    there are several, the closest one is chosen.
+
+    Text layout follows ECMAScript Number.prototype.toString: the fixed
+    notation is used when 1e-6 <= |x| < 1e21, otherwise the scientific
+    one ("1.5e-7", "1e+21"). Special values are "nan", "inf" and "-inf".
+*/
+
+namespace fp {
+
+struct uint64x2 {
+    uint64_t hi;
+    uint64_t lo;
+};
+
+namespace shortest_detail {
+
+    #include "pow10.inl"
+
+    __extension__ typedef unsigned __int128 uint128;
+
+    // floor(log10(2^e))
+    inline int floor_log10_pow2(int e) {
+        return (e * 1262611) >> 22;
+    }
+
+    // floor(log10(3/4 * 2^e))
+    inline int floor_log10_three_quarters_pow2(int e) {
+        return (e * 1262611 - 524031) >> 22;
+    }
+
+    // floor(log2(10^e))
+    inline int floor_log2_pow10(int e) {
+        return (e * 1741647) >> 19;
+    }
+
+    template <typename FP_TYPE>
+    struct ops;
+
+    template <>
+    struct ops<float> {
+        using uint_type = uint32_t;
+
+        static uint32_t round_to_odd(uint64_t g, uint32_t cp) {
+            const uint128 p = uint128(g) * cp;
+            const uint32_t y1 = uint32_t(p >> 64);
+            const uint32_t y0 = uint32_t(p >> 32);
+
+            return y1 | (y0 > 1);
+        }
+
+        static uint64_t pow10(int k) {
+            assert(k >= pow10_float_min && k <= pow10_float_max);
+            return pow10_float[k - pow10_float_min];
+        }
+    };
+
+    template <>
+    struct ops<double> {
+        using uint_type = uint64_t;
+
+        static uint64_t round_to_odd(const uint64x2& g, uint64_t cp) {
+            const uint128 x = uint128(g.lo) * cp;
+            const uint128 y = uint128(g.hi) * cp;
+            const uint128 z = y + (x >> 64);
+            const uint64_t z1 = uint64_t(z >> 64);
+            const uint64_t z0 = uint64_t(z);
+
+            return z1 | (z0 > 1);
+        }
+
+        static const uint64x2& pow10(int k) {
+            assert(k >= pow10_double_min && k <= pow10_double_max);
+            return pow10_double[k - pow10_double_min];
+        }
+    };
+
+} // namespace shortest_detail
+
+
+// value = significand * 10^exponent
+template <typename FP_TYPE>
+struct decimal {
+    typename shortest_detail::ops<FP_TYPE>::uint_type significand;
+    int exponent;
+};
+
+
+// Shortest decimal for a finite, positive (the sign is ignored) value.
+// Trailing zeros of significand are not removed.
+template <typename FP_TYPE>
+decimal<FP_TYPE> to_decimal(FP_TYPE v) {
+
+    using namespace shortest_detail;
+    using uint = typename ops<FP_TYPE>::uint_type;
+    using tr   = traits<FP_TYPE>;
+
+    const typename tr::proxy p(v);
+
+    const int  mantissa_bits = tr::mantissa_bits;
+    const int  biased_exp    = p.get_exponent() + tr::exp_shift;
+    const uint mantissa      = p.get_mantissa();
+
+    uint c;
+    int  q;
+    if (biased_exp != 0) {
+        c = p.get_normalized_mantissa();
+        q = biased_exp - tr::exp_shift - mantissa_bits;
+
+        // fast path: small integers
+        if (0 <= -q && -q <= mantissa_bits) {
+            const uint m = c >> -q;
+            if ((m << -q) == c) {
+                return {m, 0};
+            }
+        }
+    } else {
+        // subnormal
+        c = mantissa;
+        q = 1 - tr::exp_shift - mantissa_bits;
+    }
+
+    const bool is_even = (c % 2 == 0);
+
+    // for powers of two the lower neighbour is closer
+    const bool lower_boundary_is_closer = (mantissa == 0 && biased_exp > 1);
+
+    // the rounding interval [cbl, cbr] scaled by 4
+    const uint cbl = 4 * c - 2 + lower_boundary_is_closer;
+    const uint cb  = 4 * c;
+    const uint cbr = 4 * c + 2;
+
+    const int k = lower_boundary_is_closer ? floor_log10_three_quarters_pow2(q)
+                                           : floor_log10_pow2(q);
+    const int h = q + floor_log2_pow10(-k) + 1;
+
+    const auto& g = ops<FP_TYPE>::pow10(-k);
+    const uint vbl = ops<FP_TYPE>::round_to_odd(g, cbl << h);
+    const uint vb  = ops<FP_TYPE>::round_to_odd(g, cb  << h);
+    const uint vbr = ops<FP_TYPE>::round_to_odd(g, cbr << h);
+
+    const uint lower = vbl + !is_even;
+    const uint upper = vbr - !is_even;
+
+    const uint s = vb / 4;
+
+    // try a shorter candidate (one digit less)
+    if (s >= 10) {
+        const uint sp = s / 10;
+        const bool up_inside = lower <= 40 * sp;
+        const bool wp_inside = 40 * sp + 40 <= upper;
+        if (up_inside != wp_inside) {
+            return {uint(sp + wp_inside), k + 1};
+        }
+    }
+
+    const bool u_inside = lower <= 4 * s;
+    const bool w_inside = 4 * s + 4 <= upper;
+    if (u_inside != w_inside) {
+        return {uint(s + w_inside), k};
+    }
+
+    // both candidates are inside, pick the closer one (ties to even)
+    const uint mid = 4 * s + 2;
+    const bool round_up = vb > mid || (vb == mid && (s & 1) != 0);
+
+    return {uint(s + round_up), k};
+}
+
+
+template <typename FP_TYPE>
+struct shortest {
+    /// sign [1], digits [17], "0." and leading zeros [7]  or  exponent [5]
+    static const unsigned min_buffer_size = 32;
+};
+
+
+namespace shortest_detail {
+
+    static const char digit_pairs[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    // writes digits of x at the end of buffer, returns number of digits
+    inline int write_digits(uint64_t x, char* end) {
+        char* p = end;
+        while (x >= 100) {
+            const unsigned pair = unsigned(x % 100);
+            x /= 100;
+            p -= 2;
+            memcpy(p, &digit_pairs[2*pair], 2);
+        }
+
+        if (x >= 10) {
+            p -= 2;
+            memcpy(p, &digit_pairs[2*x], 2);
+        } else {
+            *--p = char('0' + x);
+        }
+
+        return int(end - p);
+    }
+
+} // namespace shortest_detail
+
+
+/// Writes the shortest round-trip representation of v (not terminated
+/// with the null character); returns number of bytes written. Buffer has
+/// to have at least shortest<FP_TYPE>::min_buffer_size bytes.
+template <typename FP_TYPE>
+int to_shortest(FP_TYPE v, char* buffer) {
+
+    const typename traits<FP_TYPE>::proxy p(v);
+    char* dest = buffer;
+
+    switch (std::fpclassify(v)) {
+        case FP_NAN:
+            memcpy(dest, "nan", 3);
+            return 3;
+
+        case FP_INFINITE:
+            if (p.is_negative()) {
+                *dest++ = '-';
+            }
+            memcpy(dest, "inf", 3);
+            return int(dest - buffer) + 3;
+
+        case FP_ZERO:
+            if (p.is_negative()) {
+                *dest++ = '-';
+            }
+            *dest++ = '0';
+            return int(dest - buffer);
+
+        default:
+            break;
+    }
+
+    if (p.is_negative()) {
+        *dest++ = '-';
+    }
+
+    decimal<FP_TYPE> d = to_decimal(v);
+    while (d.significand % 10 == 0) {
+        d.significand /= 10;
+        d.exponent += 1;
+    }
+
+    char tmp[24];
+    char* const tmp_end = tmp + sizeof(tmp);
+    const int digits = shortest_detail::write_digits(d.significand, tmp_end);
+    const char* first = tmp_end - digits;
+
+    // position of decimal dot relative to the first digit
+    const int n = d.exponent + digits;
+
+    if (n >= -5 && n <= 21) {
+        if (n <= 0) {
+            // 0.000ddd
+            *dest++ = '0';
+            *dest++ = '.';
+            for (int i=0; i < -n; i++) {
+                *dest++ = '0';
+            }
+            memcpy(dest, first, digits);
+            dest += digits;
+        } else if (n < digits) {
+            // dd.ddd
+            memcpy(dest, first, n);
+            dest += n;
+            *dest++ = '.';
+            memcpy(dest, first + n, digits - n);
+            dest += digits - n;
+        } else {
+            // ddd000
+            memcpy(dest, first, digits);
+            dest += digits;
+            for (int i=digits; i < n; i++) {
+                *dest++ = '0';
+            }
+        }
+    } else {
+        // d.ddde+xx
+        *dest++ = first[0];
+        if (digits > 1) {
+            *dest++ = '.';
+            memcpy(dest, first + 1, digits - 1);
+            dest += digits - 1;
+        }
+
+        const int e = n - 1;
+        *dest++ = 'e';
+        *dest++ = (e < 0) ? '-' : '+';
+        char exp[4];
+        const int exp_digits = shortest_detail::write_digits(e < 0 ? -e : e, exp + 4);
+        memcpy(dest, exp + 4 - exp_digits, exp_digits);
+        dest += exp_digits;
+    }
+
+    return int(dest - buffer);
+}
+
+
+/// Converts n values, separated with the given character; returns number
+/// of bytes written. Output has to have at least
+/// n * shortest<FP_TYPE>::min_buffer_size bytes.
+template <typename FP_TYPE>
+size_t to_shortest_batch(const FP_TYPE* values, size_t n, char separator, char* output) {
+
+    char* dest = output;
+    for (size_t i=0; i < n; i++) {
+        dest += to_shortest(values[i], dest);
+        *dest++ = separator;
+    }
+
+    return (n > 0) ? size_t(dest - output - 1) : 0;
+}
+
+} // namespace fp
@@ -1,5 +1,8 @@
 #include <cstdio>
-#include "float2string.h"
+#include <charconv>
+#include <random>
+#include <vector>
+#include "shortest.h"
 #include "cmdline.cpp"
 #include "gettime.cpp"
 
@@ -50,9 +53,95 @@ public:
 };
 
 
+// shortest round-trip conversion of arbitrary values
+template <typename FP_TYPE>
+class ShortestTester final {
+
+    std::vector<FP_TYPE> values;
+    std::vector<char> output;
+    const char* sprintf_format;
+
+    double reference_time;
+
+public:
+    ShortestTester(size_t count, const char* format)
+        : output(count * fp::shortest<FP_TYPE>::min_buffer_size)
+        , sprintf_format(format)
+        , reference_time(0.0) {
+
+        using raw_type = decltype(typename fp::traits<FP_TYPE>::proxy(FP_TYPE(0)).raw);
+        std::mt19937_64 rng(0);
+        while (values.size() < count) {
+            const typename fp::traits<FP_TYPE>::proxy p(static_cast<raw_type>(rng()));
+            if (std::isfinite(p.value)) {
+                values.push_back(p.value);
+            }
+        }
+    }
+
+    void run() {
+        measure("sprintf", [this]{
+            char* dest = output.data();
+            for (FP_TYPE v: values) {
+                dest += sprintf(dest, sprintf_format, v);
+            }
+        });
+
+        measure("std::to_chars", [this]{
+            char* dest = output.data();
+            char* end  = dest + output.size();
+            for (FP_TYPE v: values) {
+                dest = std::to_chars(dest, end, v).ptr;
+            }
+        });
+
+        measure("fp::to_shortest", [this]{
+            char* dest = output.data();
+            for (FP_TYPE v: values) {
+                dest += fp::to_shortest(v, dest);
+            }
+        });
+
+        measure("fp::to_shortest_batch", [this]{
+            fp::to_shortest_batch(values.data(), values.size(), ',', output.data());
+        });
+    }
+
+private:
+    template <typename FUN>
+    void measure(const char* name, FUN fun) {
+        printf("%-22s... ", name);
+        fflush(stdout);
+
+        const auto t1 = get_time();
+        fun();
+        const auto t2 = get_time();
+
+        const double time = (t2 - t1)/1000000.0;
+        printf("%0.3fs", time);
+        if (reference_time > 0.0) {
+            printf(" speedup: %0.1f", reference_time/time);
+        } else {
+            reference_time = time;
+        }
+
+        putchar('\n');
+    }
+};
+
+
 int main(int argc, char* argv[]) {
 
     CommandLine cmd(argc, argv);
+
+    if (cmd.has("shortest")) {
+        puts("float (random bit patterns)");
+        ShortestTester<float>(5000000, "%.9g").run();
+        puts("double (random bit patterns)");
+        ShortestTester<double>(5000000, "%.17g").run();
+        return 0;
+    }
+
     Tester test;
 
     const bool test_stdlib = cmd.empty() || cmd.has("stdlib");
@@ -0,0 +1,198 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <charconv>
+#include <random>
+#include "shortest.h"
+#include "cmdline.cpp"
+
+
+// Parse the shortest scientific representation produced by std::to_chars
+// ("d.ddde+xx") into significand and exponent.
+template <typename FP_TYPE>
+fp::decimal<FP_TYPE> reference(FP_TYPE v) {
+    char buffer[64];
+    const auto res = std::to_chars(buffer, buffer + sizeof(buffer), v, std::chars_format::scientific);
+    *res.ptr = 0;
+
+    fp::decimal<FP_TYPE> d;
+    d.significand = 0;
+    int digits_after_dot = 0;
+    bool after_dot = false;
+
+    const char* c = buffer;
+    for (/**/; *c != 'e'; c++) {
+        if (*c == '.') {
+            after_dot = true;
+        } else {
+            d.significand = 10 * d.significand + (*c - '0');
+            digits_after_dot += after_dot;
+        }
+    }
+
+    d.exponent = atoi(c + 1) - digits_after_dot;
+
+    return d;
+}
+
+
+template <typename FP_TYPE>
+bool compare(FP_TYPE v) {
+    const auto expected = reference(std::fabs(v));
+    auto result = fp::to_decimal(v);
+
+    while (result.significand % 10 == 0 && result.significand != expected.significand) {
+        result.significand /= 10;
+        result.exponent += 1;
+    }
+
+    if (result.significand != expected.significand || result.exponent != expected.exponent) {
+        printf("%.17g: expected %lue%d, got %lue%d\n", double(v),
+               uint64_t(expected.significand), expected.exponent,
+               uint64_t(result.significand), result.exponent);
+        return false;
+    }
+
+    return true;
+}
+
+
+template <typename FP_TYPE>
+bool roundtrip(FP_TYPE v) {
+    char buffer[fp::shortest<FP_TYPE>::min_buffer_size + 1];
+    const int n = fp::to_shortest(v, buffer);
+    buffer[n] = 0;
+
+    const FP_TYPE parsed = (sizeof(FP_TYPE) == 4) ? strtof(buffer, nullptr) : strtod(buffer, nullptr);
+    if (memcmp(&parsed, &v, sizeof(v)) != 0) {
+        printf("%.17g: '%s' does not round-trip\n", double(v), buffer);
+        return false;
+    }
+
+    return true;
+}
+
+
+bool verify_float(uint32_t step) {
+    puts("float: comparing with std::to_chars (exhaustive if step = 1)");
+
+    for (uint64_t raw = 0; raw <= 0x7f7fffff; raw += step) {
+        if ((raw & 0x00ffffff) == 0) {
+            printf("%3lu%%\r", 100 * raw / 0x7f7fffff);
+            fflush(stdout);
+        }
+
+        const fp::traits<float>::proxy p(static_cast<uint32_t>(raw));
+        if (p.value == 0.0f) {
+            continue;
+        }
+
+        if (!compare(p.value)) {
+            return false;
+        }
+
+        // strtof is slow, test only a sample
+        if ((raw & 0xff) == 0 || step > 1) {
+            if (!roundtrip(p.value) || !roundtrip(-p.value)) {
+                return false;
+            }
+        }
+    }
+
+    puts("OK  ");
+    return true;
+}
+
+
+bool verify_double(uint64_t count) {
+    printf("double: %lu random values\n", count);
+
+    std::mt19937_64 rng(42);
+    for (uint64_t i=0; i < count; i++) {
+        const fp::traits<double>::proxy p(static_cast<uint64_t>(rng()));
+        if (!std::isfinite(p.value) || p.value == 0.0) {
+            continue;
+        }
+
+        if (!compare(p.value) || !roundtrip(p.value)) {
+            return false;
+        }
+    }
+
+    // boundaries: powers of two, subnormals, extremes
+    for (uint64_t exp = 0; exp < 2047; exp++) {
+        for (uint64_t mantissa: {uint64_t(0), uint64_t(1), uint64_t(2), (uint64_t(1) << 52) - 1}) {
+            fp::traits<double>::proxy p((exp << 52) | mantissa);
+            if (p.value == 0.0) {
+                continue;
+            }
+
+            if (!compare(p.value) || !roundtrip(p.value)) {
+                return false;
+            }
+        }
+    }
+
+    puts("OK");
+    return true;
+}
+
+
+bool verify_format() {
+    struct {
+        double value;
+        const char* expected;
+    } cases[] = {
+        {0.0,       "0"},
+        {-0.0,      "-0"},
+        {1.0,       "1"},
+        {-1.5,      "-1.5"},
+        {0.1,       "0.1"},
+        {123.456,   "123.456"},
+        {1e-6,      "0.000001"},
+        {1.5e-7,    "1.5e-7"},
+        {1e20,      "100000000000000000000"},
+        {1e21,      "1e+21"},
+        {5e-324,    "5e-324"},
+        {1.7976931348623157e308, "1.7976931348623157e+308"},
+        {1.0/0.0,   "inf"},
+        {-1.0/0.0,  "-inf"},
+    };
+
+    char buffer[fp::shortest<double>::min_buffer_size + 1];
+    for (const auto& c: cases) {
+        const int n = fp::to_shortest(c.value, buffer);
+        buffer[n] = 0;
+        if (strcmp(buffer, c.expected) != 0) {
+            printf("expected '%s', got '%s'\n", c.expected, buffer);
+            return false;
+        }
+    }
+
+    const double values[] = {1.0, -0.25, 1e300};
+    char output[3 * fp::shortest<double>::min_buffer_size];
+    const size_t n = fp::to_shortest_batch(values, 3, ',', output);
+    if (n != strlen("1,-0.25,1e+300") || memcmp(output, "1,-0.25,1e+300", n) != 0) {
+        puts("batch conversion failed");
+        return false;
+    }
+
+    puts("format OK");
+    return true;
+}
+
+
+int main(int argc, char* argv[]) {
+
+    CommandLine cmd(argc, argv);
+
+    // "quick" tests every 101st float only
+    const uint32_t step = cmd.has("quick") ? 101 : 1;
+
+    if (verify_format() && verify_double(10000000) && verify_float(step)) {
+        puts("All OK");
+        return EXIT_SUCCESS;
+    }
+
+    return EXIT_FAILURE;
+}
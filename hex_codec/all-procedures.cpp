@@ -0,0 +1,9 @@
+#include "scalar.cpp"
+#include "sse.cpp"
+#include "hexdump.cpp"
+#ifdef HAVE_AVX2
+#   include "avx2.cpp"
+#endif // HAVE_AVX2
+#ifdef HAVE_AVX512BW
+#   include "avx512.cpp"
+#endif // HAVE_AVX512BW
@@ -0,0 +1,73 @@
+#include <immintrin.h>
+
+void hex_encode_avx2(const uint8_t* input, size_t n, char* output, HexCase letters = HexCase::lower) {
+
+    const __m256i lookup = _mm256_broadcastsi128_si256(hex::lookup_sse(letters));
+    const __m256i mask   = _mm256_set1_epi8(0x0f);
+
+    size_t i = 0;
+    for (/**/; i + 32 <= n; i += 32) {
+        // unpack works within 128-bit lanes, qwords are reordered so that
+        // lane 0 holds bytes 0..7 & 16..23 and lane 1 bytes 8..15 & 24..31
+        const __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        const __m256i v = _mm256_permute4x64_epi64(t, _MM_SHUFFLE(3, 1, 2, 0));
+
+        const __m256i lo = _mm256_and_si256(v, mask);
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), mask);
+
+        const __m256i a = _mm256_shuffle_epi8(lookup, _mm256_unpacklo_epi8(hi, lo));
+        const __m256i b = _mm256_shuffle_epi8(lookup, _mm256_unpackhi_epi8(hi, lo));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 2*i + 0), a);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 2*i + 32), b);
+    }
+
+    hex_encode_sse(input + i, n - i, output + 2*i, letters);
+}
+
+
+namespace hex {
+
+    uint32_t decode_nibbles_avx2(const __m256i v, __m256i& nibbles) {
+        const __m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+        const __m256i l = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+
+        const __m256i is_digit  = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+        const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+
+        nibbles = _mm256_or_si256(_mm256_and_si256(is_digit, d),
+                                  _mm256_and_si256(is_letter, _mm256_add_epi8(l, _mm256_set1_epi8(10))));
+
+        return ~uint32_t(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)));
+    }
+
+} // namespace hex
+
+
+size_t hex_decode_avx2(const char* input, size_t n, uint8_t* output) {
+
+    const __m256i merge = _mm256_set1_epi16(0x0110); // bytes: 16, 1
+
+    size_t i = 0;
+    for (/**/; i + 64 <= n; i += 64) {
+        const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i + 0));
+        const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i + 32));
+
+        __m256i n0;
+        __m256i n1;
+        if (hex::decode_nibbles_avx2(v0, n0) | hex::decode_nibbles_avx2(v1, n1)) {
+            break;
+        }
+
+        const __m256i w0 = _mm256_maddubs_epi16(n0, merge);
+        const __m256i w1 = _mm256_maddubs_epi16(n1, merge);
+
+        // packus works within lanes: [w0.lo w1.lo | w0.hi w1.hi]
+        const __m256i packed = _mm256_packus_epi16(w0, w1);
+        const __m256i result = _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i/2), result);
+    }
+
+    return i + hex_decode_sse(input + i, n - i, output + i/2);
+}
@@ -0,0 +1,78 @@
+#include <immintrin.h>
+
+void hex_encode_avx512(const uint8_t* input, size_t n, char* output, HexCase letters = HexCase::lower) {
+
+    const __m512i lookup = _mm512_broadcast_i32x4(hex::lookup_sse(letters));
+    const __m512i mask   = _mm512_set1_epi8(0x0f);
+
+    // lane k gets qwords k and k + 4, see hex_encode_avx2
+    const __m512i order  = _mm512_setr_epi64(0, 4, 1, 5, 2, 6, 3, 7);
+
+    for (size_t i=0; i < n; i += 64) {
+        const size_t k = (n - i < 64) ? n - i : 64;
+
+        // tail is handled with masked loads/stores
+        const __mmask64 load_mask = (k == 64) ? ~__mmask64(0) : ((__mmask64(1) << k) - 1);
+        const __mmask64 mask_a    = (k >= 32) ? ~__mmask64(0) : ((__mmask64(1) << (2*k)) - 1);
+        const __mmask64 mask_b    = (k <= 32) ? 0 : (k == 64) ? ~__mmask64(0) : ((__mmask64(1) << (2*k - 64)) - 1);
+
+        const __m512i t = _mm512_maskz_loadu_epi8(load_mask, input + i);
+        const __m512i v = _mm512_permutexvar_epi64(order, t);
+
+        const __m512i lo = _mm512_and_si512(v, mask);
+        const __m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), mask);
+
+        const __m512i a = _mm512_shuffle_epi8(lookup, _mm512_unpacklo_epi8(hi, lo));
+        const __m512i b = _mm512_shuffle_epi8(lookup, _mm512_unpackhi_epi8(hi, lo));
+
+        _mm512_mask_storeu_epi8(output + 2*i + 0,  mask_a, a);
+        _mm512_mask_storeu_epi8(output + 2*i + 64, mask_b, b);
+    }
+}
+
+
+size_t hex_decode_avx512(const char* input, size_t n, uint8_t* output) {
+
+    const __m512i merge = _mm512_set1_epi16(0x0110); // bytes: 16, 1
+    const __m512i order = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+
+    const __m512i ascii0  = _mm512_set1_epi8('0');
+    const __m512i asciia  = _mm512_set1_epi8('a');
+    const __m512i lower   = _mm512_set1_epi8(0x20);
+    const __m512i nine    = _mm512_set1_epi8(9);
+    const __m512i five    = _mm512_set1_epi8(5);
+    const __m512i ten     = _mm512_set1_epi8(10);
+
+    size_t i = 0;
+    for (/**/; i + 128 <= n; i += 128) {
+        const __m512i v0 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(input + i + 0));
+        const __m512i v1 = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(input + i + 64));
+
+        const __m512i d0 = _mm512_sub_epi8(v0, ascii0);
+        const __m512i d1 = _mm512_sub_epi8(v1, ascii0);
+        const __m512i l0 = _mm512_sub_epi8(_mm512_or_si512(v0, lower), asciia);
+        const __m512i l1 = _mm512_sub_epi8(_mm512_or_si512(v1, lower), asciia);
+
+        const __mmask64 is_digit0  = _mm512_cmple_epu8_mask(d0, nine);
+        const __mmask64 is_digit1  = _mm512_cmple_epu8_mask(d1, nine);
+        const __mmask64 is_letter0 = _mm512_cmple_epu8_mask(l0, five);
+        const __mmask64 is_letter1 = _mm512_cmple_epu8_mask(l1, five);
+
+        if (~(is_digit0 | is_letter0) | ~(is_digit1 | is_letter1)) {
+            break;
+        }
+
+        const __m512i n0 = _mm512_mask_blend_epi8(is_digit0, _mm512_add_epi8(l0, ten), d0);
+        const __m512i n1 = _mm512_mask_blend_epi8(is_digit1, _mm512_add_epi8(l1, ten), d1);
+
+        const __m512i w0 = _mm512_maddubs_epi16(n0, merge);
+        const __m512i w1 = _mm512_maddubs_epi16(n1, merge);
+
+        const __m512i packed = _mm512_packus_epi16(w0, w1);
+        const __m512i result = _mm512_permutexvar_epi64(order, packed);
+
+        _mm512_storeu_si512(reinterpret_cast<__m512i*>(output + i/2), result);
+    }
+
+    return i + hex_decode_avx2(input + i, n - i, output + i/2);
+}
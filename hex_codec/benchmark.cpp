@@ -0,0 +1,94 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "time_utils.h"
+#include "all-procedures.cpp"
+
+
+class Benchmark {
+
+    std::vector<uint8_t> bytes;
+    std::string hex;
+    std::vector<uint8_t> decoded;
+    std::string output;
+    int iterations;
+
+public:
+    Benchmark(size_t size, int iterations_)
+        : bytes(size)
+        , hex(2*size + 64, 0)
+        , decoded(size + 64)
+        , output(hexdump_output_size(size), 0)
+        , iterations(iterations_) {
+
+        for (size_t i=0; i < size; i++) {
+            bytes[i] = uint8_t(rand());
+        }
+
+        hex_encode_scalar(bytes.data(), size, &hex[0]);
+        hex.resize(2*size);
+    }
+
+    void run() {
+        const size_t n = bytes.size();
+        printf("input size %lu bytes, iterations %d\n", n, iterations);
+
+        puts("encode");
+        measure("scalar", n,  [this, n]{hex_encode_scalar(bytes.data(), n, &hex[0]); return hex[0];});
+        measure("SSE",    n,  [this, n]{hex_encode_sse(bytes.data(), n, &hex[0]); return hex[0];});
+#ifdef HAVE_AVX2
+        measure("AVX2",   n,  [this, n]{hex_encode_avx2(bytes.data(), n, &hex[0]); return hex[0];});
+#endif
+#ifdef HAVE_AVX512BW
+        measure("AVX512BW", n, [this, n]{hex_encode_avx512(bytes.data(), n, &hex[0]); return hex[0];});
+#endif
+
+        puts("decode");
+        measure("scalar", n,  [this]{return hex_decode_scalar(hex.data(), hex.size(), decoded.data());});
+        measure("SSE",    n,  [this]{return hex_decode_sse(hex.data(), hex.size(), decoded.data());});
+#ifdef HAVE_AVX2
+        measure("AVX2",   n,  [this]{return hex_decode_avx2(hex.data(), hex.size(), decoded.data());});
+#endif
+#ifdef HAVE_AVX512BW
+        measure("AVX512BW", n, [this]{return hex_decode_avx512(hex.data(), hex.size(), decoded.data());});
+#endif
+
+        puts("hexdump");
+        measure("scalar", n,  [this, n]{return hexdump_scalar(bytes.data(), n, &output[0]);});
+        measure("SSE",    n,  [this, n]{return hexdump_sse(bytes.data(), n, &output[0]);});
+    }
+
+private:
+    template <typename FUN>
+    void measure(const char* name, size_t size, FUN fun) {
+        printf("%-10s: ", name);
+        fflush(stdout);
+
+        const auto t = measure_total_time(fun, iterations);
+        const double bytes_total = double(size) * iterations;
+        printf("%8lu us, %6.3f GB/s\n", t, bytes_total / (t * 1000.0));
+    }
+};
+
+
+int main(int argc, char* argv[]) {
+
+    size_t size = 64*1024;
+    int iterations = 2000;
+
+    if (argc > 1) {
+        size = atoi(argv[1]);
+    }
+
+    if (argc > 2) {
+        iterations = atoi(argv[2]);
+    }
+
+    Benchmark bench(size, iterations);
+    bench.run();
+
+    return EXIT_SUCCESS;
+}
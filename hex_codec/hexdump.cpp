@@ -0,0 +1,175 @@
+// hexdump -C -v style formatter:
+//
+//  00000000  48 65 6c 6c 6f 2c 20 77  6f 72 6c 64 21 0a 00 01  |Hello, world!...|
+//  00000010
+//
+// Each full line has 79 characters (including the newline). The last
+// line contains size of input. Unlike hexdump(1) repeated lines are
+// never collapsed into '*' (as with the option -v).
+
+namespace hexdump {
+
+    const size_t line_size = 79;
+
+    size_t write_offset(uint64_t offset, char* output) {
+        char tmp[32];
+        const int n = snprintf(tmp, sizeof(tmp), "%08llx", static_cast<unsigned long long>(offset));
+        memcpy(output, tmp, n);
+        return n;
+    }
+
+    bool is_printable(uint8_t c) {
+        return c >= 0x20 && c <= 0x7e;
+    }
+
+    // `count` = 1..16 bytes
+    size_t line_scalar(uint64_t offset, const uint8_t* data, size_t count, char* output) {
+        const char* digits = hex::digits(HexCase::lower);
+
+        char* out = output + write_offset(offset, output);
+        *out++ = ' ';
+        for (size_t i=0; i < 16; i++) {
+            if (i == 8) {
+                *out++ = ' ';
+            }
+
+            *out++ = ' ';
+            if (i < count) {
+                *out++ = digits[data[i] >> 4];
+                *out++ = digits[data[i] & 0xf];
+            } else {
+                *out++ = ' ';
+                *out++ = ' ';
+            }
+        }
+
+        *out++ = ' ';
+        *out++ = ' ';
+        *out++ = '|';
+        for (size_t i=0; i < count; i++) {
+            *out++ = is_printable(data[i]) ? char(data[i]) : '.';
+        }
+        *out++ = '|';
+        *out++ = '\n';
+
+        return out - output;
+    }
+
+    size_t last_line(uint64_t offset, char* output) {
+        const size_t n = write_offset(offset, output);
+        output[n] = '\n';
+        return n + 1;
+    }
+
+    // Full line, offset < 2^32. Up to 16 bytes past the line might be
+    // overwritten.
+    //
+    // Layout (column numbers):
+    //   0..7   -- offset
+    //   8, 9   -- spaces
+    //  10..33  -- bytes 0..7 as "xx "
+    //  34      -- space
+    //  35..58  -- bytes 8..15 as "xx "
+    //  59      -- space
+    //  60      -- '|'
+    //  61..76  -- ASCII
+    //  77      -- '|'
+    //  78      -- newline
+    //
+    // Hex columns are written with four overlapping 16-byte stores; each
+    // one is a pshufb of hex digits merged with a constant filler (spaces
+    // and '|'), later stores overwrite garbage left by previous ones.
+    size_t line_sse(uint32_t offset, const uint8_t* data, char* output) {
+
+        const __m128i lookup = hex::lookup_sse(HexCase::lower);
+        const int8_t _ = -1;
+
+        // columns 8..23
+        const __m128i shuf0 = _mm_setr_epi8(_, _, 0, 1, _, 2, 3, _, 4, 5, _, 6, 7, _, 8, 9);
+        // columns 24..39 (35..39 are overwritten later)
+        const __m128i shuf1 = _mm_setr_epi8(_, 10, 11, _, 12, 13, _, 14, 15, _, _, _, _, _, _, _);
+        // columns 35..50
+        const __m128i shuf2 = _mm_setr_epi8(0, 1, _, 2, 3, _, 4, 5, _, 6, 7, _, 8, 9, _, 10);
+        // columns 51..66 (61..66 are overwritten later)
+        const __m128i shuf3 = _mm_setr_epi8(11, _, 12, 13, _, 14, 15, _, _, _, _, _, _, _, _, _);
+
+        const __m128i spaces = _mm_set1_epi8(' ');
+        const __m128i fill3  = _mm_setr_epi8(0, ' ', 0, 0, ' ', 0, 0, ' ', ' ', '|', ' ', ' ', ' ', ' ', ' ', ' ');
+
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+
+        __m128i a;
+        __m128i b;
+        hex::encode_sse(v, lookup, a, b);
+
+        // offset: encode 4 bytes in the big endian order
+        const __m128i off = _mm_cvtsi32_si128(__builtin_bswap32(offset));
+        __m128i off_hex;
+        __m128i unused;
+        hex::encode_sse(off, lookup, off_hex, unused);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output), off_hex);
+
+        // pshufb zeroes bytes for negative indices, filler sets them
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 8),
+                         _mm_or_si128(_mm_shuffle_epi8(a, shuf0), _mm_andnot_si128(_mm_cmpgt_epi8(shuf0, _mm_set1_epi8(-1)), spaces)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 24),
+                         _mm_or_si128(_mm_shuffle_epi8(a, shuf1), _mm_andnot_si128(_mm_cmpgt_epi8(shuf1, _mm_set1_epi8(-1)), spaces)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 35),
+                         _mm_or_si128(_mm_shuffle_epi8(b, shuf2), _mm_andnot_si128(_mm_cmpgt_epi8(shuf2, _mm_set1_epi8(-1)), spaces)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 51),
+                         _mm_or_si128(_mm_shuffle_epi8(b, shuf3), _mm_andnot_si128(_mm_cmpgt_epi8(shuf3, _mm_set1_epi8(-1)), fill3)));
+
+        // ASCII column: bytes outside 0x20..0x7e are replaced with '.'
+        const __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(0x1f)),
+                                                _mm_cmplt_epi8(v, _mm_set1_epi8(0x7f)));
+        const __m128i ascii = _mm_or_si128(_mm_and_si128(printable, v),
+                                           _mm_andnot_si128(printable, _mm_set1_epi8('.')));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 61), ascii);
+        output[77] = '|';
+        output[78] = '\n';
+
+        return line_size;
+    }
+
+} // namespace hexdump
+
+
+// Output must have at least hexdump_output_size(n) bytes; returns the
+// number of bytes written.
+size_t hexdump_output_size(size_t n) {
+    return (n / 16 + 2) * (hexdump::line_size + 16);
+}
+
+
+size_t hexdump_scalar(const uint8_t* input, size_t n, char* output) {
+    char* out = output;
+    for (size_t i=0; i < n; i += 16) {
+        out += hexdump::line_scalar(i, input + i, (n - i < 16) ? n - i : 16, out);
+    }
+
+    if (n > 0) {
+        out += hexdump::last_line(n, out);
+    }
+
+    return out - output;
+}
+
+
+size_t hexdump_sse(const uint8_t* input, size_t n, char* output) {
+    char* out = output;
+    size_t i = 0;
+    for (/**/; i + 16 <= n && i <= 0xffffffffu; i += 16) {
+        out += hexdump::line_sse(uint32_t(i), input + i, out);
+    }
+
+    for (/**/; i < n; i += 16) {
+        out += hexdump::line_scalar(i, input + i, (n - i < 16) ? n - i : 16, out);
+    }
+
+    if (n > 0) {
+        out += hexdump::last_line(n, out);
+    }
+
+    return out - output;
+}
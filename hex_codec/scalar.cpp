@@ -0,0 +1,66 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Hex codec
+//
+// - encode: n bytes => 2*n characters (no terminating null),
+// - decode: n characters => n/2 bytes; both lower and upper case
+//   digits are accepted. Returns n on success, otherwise position of
+//   the first invalid character. When n is odd, the last character
+//   is reported as invalid (after the preceding pairs were decoded).
+
+enum class HexCase {
+    lower,
+    upper
+};
+
+namespace hex {
+
+    const char* digits(HexCase letters) {
+        return (letters == HexCase::lower) ? "0123456789abcdef" : "0123456789ABCDEF";
+    }
+
+    // returns 0..15 or -1
+    int nibble(uint8_t c) {
+        // written without branches on the digit class, which is random:
+        // comparisons yield masks, invalid characters get all bits set
+        const unsigned digit  = unsigned(c) - '0';
+        const unsigned letter = unsigned(c | 0x20) - 'a';
+        const unsigned is_digit  = -unsigned(digit < 10);
+        const unsigned is_letter = -unsigned(letter < 6);
+
+        return int((digit & is_digit) | ((letter + 10) & is_letter) | ~(is_digit | is_letter));
+    }
+
+} // namespace hex
+
+
+void hex_encode_scalar(const uint8_t* input, size_t n, char* output, HexCase letters = HexCase::lower) {
+    const char* digits = hex::digits(letters);
+    for (size_t i=0; i < n; i++) {
+        output[2*i + 0] = digits[input[i] >> 4];
+        output[2*i + 1] = digits[input[i] & 0xf];
+    }
+}
+
+
+size_t hex_decode_scalar(const char* input, size_t n, uint8_t* output) {
+    size_t i = 0;
+    for (/**/; i + 2 <= n; i += 2) {
+        const int hi = hex::nibble(input[i + 0]);
+        if (hi < 0) {
+            return i;
+        }
+
+        const int lo = hex::nibble(input[i + 1]);
+        if (lo < 0) {
+            return i + 1;
+        }
+
+        output[i/2] = uint8_t(hi * 16 + lo);
+    }
+
+    return (i < n) ? i : n;
+}
@@ -0,0 +1,84 @@
+#include <immintrin.h>
+
+namespace hex {
+
+    __m128i lookup_sse(HexCase letters) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits(letters)));
+    }
+
+    // 16 bytes => 32 ASCII chars (a -- bytes 0..7, b -- bytes 8..15)
+    void encode_sse(const __m128i v, const __m128i lookup, __m128i& a, __m128i& b) {
+        const __m128i mask = _mm_set1_epi8(0x0f);
+
+        const __m128i lo = _mm_and_si128(v, mask);
+        const __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), mask);
+
+        a = _mm_shuffle_epi8(lookup, _mm_unpacklo_epi8(hi, lo));
+        b = _mm_shuffle_epi8(lookup, _mm_unpackhi_epi8(hi, lo));
+    }
+
+    // ASCII => nibbles, returns the bitmask of invalid characters
+    uint32_t decode_nibbles_sse(const __m128i v, __m128i& nibbles) {
+        const __m128i d = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+        const __m128i l = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+        // unsigned comparisons d <= 9 and l <= 5
+        const __m128i is_digit  = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+        const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+
+        nibbles = _mm_or_si128(_mm_and_si128(is_digit, d),
+                               _mm_and_si128(is_letter, _mm_add_epi8(l, _mm_set1_epi8(10))));
+
+        return ~_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) & 0xffff;
+    }
+
+} // namespace hex
+
+
+void hex_encode_sse(const uint8_t* input, size_t n, char* output, HexCase letters = HexCase::lower) {
+
+    const __m128i lookup = hex::lookup_sse(letters);
+
+    size_t i = 0;
+    for (/**/; i + 16 <= n; i += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        __m128i a;
+        __m128i b;
+        hex::encode_sse(v, lookup, a, b);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2*i + 0), a);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2*i + 16), b);
+    }
+
+    hex_encode_scalar(input + i, n - i, output + 2*i, letters);
+}
+
+
+size_t hex_decode_sse(const char* input, size_t n, uint8_t* output) {
+
+    // (hi, lo) => hi * 16 + lo
+    const __m128i merge = _mm_setr_epi8(16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1);
+
+    size_t i = 0;
+    for (/**/; i + 32 <= n; i += 32) {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 0));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 16));
+
+        __m128i n0;
+        __m128i n1;
+        const uint32_t invalid = hex::decode_nibbles_sse(v0, n0)
+                               | (hex::decode_nibbles_sse(v1, n1) << 16);
+        if (invalid) {
+            // let the scalar code decode the valid prefix and find the error
+            break;
+        }
+
+        const __m128i w0 = _mm_maddubs_epi16(n0, merge);
+        const __m128i w1 = _mm_maddubs_epi16(n1, merge);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i/2), _mm_packus_epi16(w0, w1));
+    }
+
+    return i + hex_decode_scalar(input + i, n - i, output + i/2);
+}
@@ -0,0 +1,182 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "all-procedures.cpp"
+
+
+class Test {
+
+    std::vector<uint8_t> bytes;
+    bool ok;
+
+public:
+    Test()
+        : bytes(1024)
+        , ok(true) {
+
+        for (size_t i=0; i < bytes.size(); i++) {
+            bytes[i] = uint8_t(rand());
+        }
+    }
+
+    bool all_ok() const {
+        return ok;
+    }
+
+    template <typename ENCODE>
+    void test_encode(const char* name, ENCODE encode);
+
+    template <typename DECODE>
+    void test_decode(const char* name, DECODE decode);
+
+    template <typename HEXDUMP>
+    void test_hexdump(const char* name, HEXDUMP hexdump);
+
+private:
+    void report(const char* name, bool result) {
+        if (result) {
+            printf("%s OK\n", name);
+        } else {
+            ok = false;
+        }
+    }
+};
+
+
+template <typename ENCODE>
+void Test::test_encode(const char* name, ENCODE encode) {
+
+    for (HexCase letters: {HexCase::lower, HexCase::upper}) {
+        for (size_t size=0; size < 300; size++) {
+            std::string expected(2*size, 0);
+            std::string result(2*size + 128, '?');
+
+            hex_encode_scalar(bytes.data(), size, &expected[0], letters);
+            encode(bytes.data(), size, &result[0], letters);
+
+            if (result.compare(0, 2*size, expected) != 0 || result[2*size] != '?') {
+                printf("%s: size = %lu failed\n", name, size);
+                printf("expected: %s\n", expected.c_str());
+                printf("result  : %s\n", result.c_str());
+                report(name, false);
+                return;
+            }
+        }
+    }
+
+    report(name, true);
+}
+
+
+template <typename DECODE>
+void Test::test_decode(const char* name, DECODE decode) {
+
+    for (size_t size=0; size < 300; size++) {
+        std::string input(2*size, 0);
+        hex_encode_scalar(bytes.data(), size, &input[0], (size % 2) ? HexCase::upper : HexCase::lower);
+        if (size % 3 == 0) {
+            // mixed case
+            for (size_t i=0; i < input.size(); i += 3) {
+                input[i] = char(toupper(input[i]));
+            }
+        }
+
+        std::vector<uint8_t> output(size + 1);
+        size_t ret = decode(input.data(), input.size(), output.data());
+        if (ret != input.size() || memcmp(output.data(), bytes.data(), size) != 0) {
+            printf("%s: size = %lu failed (ret = %lu)\n", name, size, ret);
+            report(name, false);
+            return;
+        }
+
+        // odd length: the last, unpaired character is reported
+        if (size > 0) {
+            ret = decode(input.data(), input.size() - 1, output.data());
+            if (ret != input.size() - 2) {
+                printf("%s: odd size = %lu failed (ret = %lu)\n", name, 2*size - 1, ret);
+                report(name, false);
+                return;
+            }
+        }
+
+        // an invalid character at each position
+        for (size_t i=0; i < input.size(); i++) {
+            const char prev = input[i];
+            for (char bad: {'g', 'G', '/', ':', '@', '`', '\0', '\xff', ' '}) {
+                input[i] = bad;
+                ret = decode(input.data(), input.size(), output.data());
+                if (ret != i || memcmp(output.data(), bytes.data(), i/2) != 0) {
+                    printf("%s: size = %lu, bad char 0x%02x at %lu failed (ret = %lu)\n",
+                           name, size, uint8_t(bad), i, ret);
+                    report(name, false);
+                    return;
+                }
+            }
+            input[i] = prev;
+        }
+    }
+
+    report(name, true);
+}
+
+
+template <typename HEXDUMP>
+void Test::test_hexdump(const char* name, HEXDUMP hexdump) {
+
+    // include all byte values, so the ASCII column is fully tested
+    std::vector<uint8_t> input(bytes);
+    for (size_t i=0; i < 256; i++) {
+        input[i] = uint8_t(i);
+    }
+
+    for (size_t size=0; size < input.size(); size += (size < 100) ? 1 : 37) {
+        std::string expected(hexdump_output_size(size), 0);
+        std::string result(hexdump_output_size(size), 0);
+
+        expected.resize(hexdump_scalar(input.data(), size, &expected[0]));
+        result.resize(hexdump(input.data(), size, &result[0]));
+
+        if (result != expected) {
+            printf("%s: size = %lu failed\n", name, size);
+            printf("expected:\n%s\n", expected.c_str());
+            printf("result:\n%s\n", result.c_str());
+            report(name, false);
+            return;
+        }
+    }
+
+    report(name, true);
+}
+
+
+int main() {
+    Test test;
+
+    test.test_encode("encode SSE", hex_encode_sse);
+#ifdef HAVE_AVX2
+    test.test_encode("encode AVX2", hex_encode_avx2);
+#endif
+#ifdef HAVE_AVX512BW
+    test.test_encode("encode AVX512BW", hex_encode_avx512);
+#endif
+
+    test.test_decode("decode scalar", hex_decode_scalar);
+    test.test_decode("decode SSE", hex_decode_sse);
+#ifdef HAVE_AVX2
+    test.test_decode("decode AVX2", hex_decode_avx2);
+#endif
+#ifdef HAVE_AVX512BW
+    test.test_decode("decode AVX512BW", hex_decode_avx512);
+#endif
+
+    test.test_hexdump("hexdump SSE", hexdump_sse);
+
+    if (test.all_ok()) {
+        puts("All OK");
+        return EXIT_SUCCESS;
+    } else {
+        return EXIT_FAILURE;
+    }
+}
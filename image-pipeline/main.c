@@ -0,0 +1,307 @@
+/*
+	Fused image pipeline
+
+	Stages known from other programs in this repository:
+
+	1. decode 16bpp to 32bpp (pixconv16bpp-32bpp),
+	2. lookup tables (lookup_32bpp),
+	3. alpha blending with a foreground image (blend_32bpp),
+	4. crossfading with another image (mix_32bpp),
+	5. box blur (blur)
+
+	run either one after another over full frames, or all together strip
+	by strip (see pipeline.c).  Each stage has a scalar and an AVX2
+	implementation.
+
+	Usage
+	------------------------------------------------------------------------
+
+	$ ./pipeline bench [width height [radius]]
+	$ ./pipeline verify
+
+	Author: Wojciech Muła
+	License: BSD
+*/
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../blur/divisor.c"
+#include "pipeline.c"
+#include "stages_scalar.c"
+#include "stages_avx2.c"
+
+
+typedef enum {
+	SCALAR,
+	AVX2
+} Implementation;
+
+
+static const char* implementation_name[] = {"scalar", "AVX2"};
+
+
+int implementation_available(Implementation impl) {
+#if defined(__AVX2__)
+	(void)impl;
+	return 1;
+#else
+	return impl == SCALAR;
+#endif
+}
+
+
+#if defined(__AVX2__)
+#	define SELECT(impl, name) (((impl) == AVX2) ? name##_avx2 : name##_scalar)
+#else
+#	define SELECT(impl, name) ((void)(impl), name##_scalar)
+#endif
+
+
+//=== test data ============================================================
+
+typedef struct {
+	int width;
+	int height;
+	uint16_t* image16;
+	uint32_t* foreground;
+	uint32_t* mix_image;
+	LutParams lut;
+	DecodeParams decode;
+	BlendParams blend;
+	MixParams mix;
+	BlurParams blur;
+} Frame;
+
+
+void* alloc(size_t size) {
+	void* ptr = NULL;
+	if (posix_memalign(&ptr, 64, size) != 0) {
+		puts("ERROR: out of memory");
+		exit(EXIT_FAILURE);
+	}
+
+	return ptr;
+}
+
+
+static uint32_t seed = 12345;
+
+uint32_t random32(void) {
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) | (seed << 16);
+}
+
+
+void frame_init(Frame* f, int width, int height, int radius) {
+	const size_t n = (size_t)width * height;
+
+	f->width      = width;
+	f->height     = height;
+	f->image16    = (uint16_t*)alloc(n * sizeof(uint16_t));
+	f->foreground = (uint32_t*)alloc(n * sizeof(uint32_t));
+	f->mix_image  = (uint32_t*)alloc(n * sizeof(uint32_t));
+
+	for (size_t i=0; i < n; i++) {
+		f->image16[i]    = random32();
+		f->foreground[i] = random32();
+		f->mix_image[i]  = random32();
+	}
+
+	// gamma-like curves, inverted alpha
+	for (int i=0; i < 256; i++) {
+		f->lut.R[i] = (uint32_t)(i * i / 255);
+		f->lut.G[i] = (uint32_t)(255 - i) << 8;
+		f->lut.B[i] = (uint32_t)(i / 2 + 64) << 16;
+		f->lut.A[i] = (uint32_t)(255 - i) << 24;
+	}
+
+	f->decode.image      = f->image16;
+	f->blend.foreground  = f->foreground;
+	f->mix.image         = f->mix_image;
+	f->mix.alpha         = 100;
+	f->blur.radius       = radius;
+}
+
+
+void frame_free(Frame* f) {
+	free(f->image16);
+	free(f->foreground);
+	free(f->mix_image);
+}
+
+
+// returns number of stages
+int make_stages(Stage* stages, const Frame* f, Implementation impl) {
+	Stage s[] = {
+		{"decode", 0, SELECT(impl, decode), &f->decode, 0},
+		{"lut",    0, SELECT(impl, lut),    &f->lut,    0},
+		{"blend",  0, SELECT(impl, blend),  &f->blend,  0},
+		{"mix",    0, SELECT(impl, mix),    &f->mix,    0},
+		{"blur",   f->blur.radius, SELECT(impl, blur), &f->blur, BLUR_SCRATCH},
+	};
+
+	const int n = sizeof(s)/sizeof(s[0]);
+	memcpy(stages, s, sizeof(s));
+
+	return n;
+}
+
+
+//=== verification =========================================================
+
+// runs all stages on a frame
+void run(const Frame* f, Implementation impl, int strip_rows, uint32_t* output) {
+	Stage stages[MAX_STAGES] = {{NULL, 0, NULL, NULL, 0}};
+	const int n = make_stages(stages, f, impl);
+
+	Pipeline p;
+	if (!pipeline_init(&p, stages, n, f->width, f->height, strip_rows)) {
+		puts("ERROR: out of memory");
+		exit(EXIT_FAILURE);
+	}
+
+	pipeline_run(&p, output);
+	pipeline_free(&p);
+}
+
+
+int verify(void) {
+	const int sizes[][2] = {{1, 1}, {5, 3}, {17, 9}, {64, 64}, {131, 77}};
+	const int radii[] = {0, 1, 3, 10};
+	const int strips[] = {1, 2, 7, 16, 64, 1000};
+
+	int failed = 0;
+	for (size_t s=0; s < sizeof(sizes)/sizeof(sizes[0]); s++) {
+		for (size_t r=0; r < sizeof(radii)/sizeof(radii[0]); r++) {
+			Frame f;
+			frame_init(&f, sizes[s][0], sizes[s][1], radii[r]);
+
+			const size_t n = (size_t)f.width * f.height;
+			uint32_t* expected = (uint32_t*)alloc(n * sizeof(uint32_t));
+			uint32_t* result   = (uint32_t*)alloc(n * sizeof(uint32_t));
+
+			run(&f, SCALAR, f.height, expected);
+
+			for (int impl=SCALAR; impl <= AVX2; impl++) {
+				if (!implementation_available(impl))
+					continue;
+
+				for (size_t k=0; k < sizeof(strips)/sizeof(strips[0]); k++) {
+					memset(result, 0, n * sizeof(uint32_t));
+					run(&f, impl, strips[k], result);
+
+					if (memcmp(expected, result, n * sizeof(uint32_t)) != 0) {
+						printf("FAILED: %dx%d, radius %d, %s, strip %d\n",
+						       f.width, f.height, radii[r], implementation_name[impl], strips[k]);
+						failed = 1;
+					}
+				}
+			}
+
+			free(expected);
+			free(result);
+			frame_free(&f);
+		}
+	}
+
+	puts(failed ? "verification failed" : "all OK");
+	return failed;
+}
+
+
+//=== benchmark ============================================================
+
+double get_time(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+double measure(const Frame* f, Implementation impl, int strip_rows, uint32_t* output, int repeat) {
+	Stage stages[MAX_STAGES] = {{NULL, 0, NULL, NULL, 0}};
+	const int n = make_stages(stages, f, impl);
+
+	Pipeline p;
+	if (!pipeline_init(&p, stages, n, f->width, f->height, strip_rows)) {
+		puts("ERROR: out of memory");
+		exit(EXIT_FAILURE);
+	}
+
+	double best = 1e30;
+	for (int i=0; i < repeat; i++) {
+		const double t1 = get_time();
+		pipeline_run(&p, output);
+		const double t2 = get_time();
+		if (t2 - t1 < best)
+			best = t2 - t1;
+	}
+
+	pipeline_free(&p);
+	return best;
+}
+
+
+int bench(int width, int height, int radius) {
+	const int strips[] = {8, 16, 32, 64, 128, 256};
+	const int repeat = 5;
+
+	Frame f;
+	frame_init(&f, width, height, radius);
+
+	uint32_t* output = (uint32_t*)alloc((size_t)width * height * sizeof(uint32_t));
+	memset(output, 0, (size_t)width * height * sizeof(uint32_t));
+
+	printf("image %d x %d, blur radius %d, best of %d\n", width, height, radius, repeat);
+	for (int impl=SCALAR; impl <= AVX2; impl++) {
+		if (!implementation_available(impl))
+			continue;
+
+		const double full = measure(&f, impl, height, output, repeat);
+		printf("%-6s full frames    : %8.3f ms\n", implementation_name[impl], full * 1000);
+
+		for (size_t k=0; k < sizeof(strips)/sizeof(strips[0]); k++) {
+			const double t = measure(&f, impl, strips[k], output, repeat);
+			printf("%-6s strip %3d rows : %8.3f ms (%.2f)\n",
+			       implementation_name[impl], strips[k], t * 1000, full / t);
+		}
+	}
+
+	free(output);
+	frame_free(&f);
+
+	return 0;
+}
+
+
+int main(int argc, char* argv[]) {
+	if (argc >= 2 && strcmp(argv[1], "verify") == 0)
+		return verify();
+
+	if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+		const int width  = (argc >= 3) ? atoi(argv[2]) : 3840;
+		const int height = (argc >= 4) ? atoi(argv[3]) : 2160;
+		const int radius = (argc >= 5) ? atoi(argv[4]) : 2;
+
+		if (width <= 0 || height <= 0 || radius < 0 || radius > BLUR_MAX_RADIUS) {
+			puts("invalid arguments");
+			return 1;
+		}
+
+		return bench(width, height, radius);
+	}
+
+	puts("pipeline bench [width height [radius]]");
+	puts("pipeline verify");
+	return 1;
+}
+
+/*
+vim: ts=4 sw=4 nowrap noexpandtab
+*/
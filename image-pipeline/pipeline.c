@@ -0,0 +1,153 @@
+//=== tiled pipeline =======================================================
+
+/*
+	A pipeline is a list of stages; each stage transforms 32bpp pixels
+	(the first one produces them from its own source).  Instead of running
+	the first stage over the whole image, then the second one and so on,
+	the image is divided into strips of strip_rows rows and all stages are
+	run for a strip before moving to the next one.  Intermediate results
+	fit in L2 cache and are never written back to memory.
+
+	A stage may need rows around the rows it produces (blur does); then
+	previous stages compute a few extra rows --- the strip is expanded
+	by the sum of halos of all subsequent stages.  Rows outside the image
+	are never produced, stages clamp coordinates themselves.
+
+	When strip_rows equals image height the stages are simply run one
+	after another over full frames.
+
+	Temporary memory of stages (Stage.scratch bytes per pixel of a row)
+	is allocated once by pipeline_init and shared by all stages.
+*/
+
+typedef struct {
+	uint32_t* data;	// row y0
+	int y0, y1;	// rows [y0, y1) of the image
+	int width;	// also stride, in pixels
+	int height;	// of the image
+	uint8_t* scratch;	// temporary memory, see Stage.scratch
+} Strip;
+
+
+static inline uint32_t* strip_row(const Strip* s, int y) {
+	return s->data + (size_t)(y - s->y0) * s->width;
+}
+
+
+typedef struct Stage Stage;
+
+// computes rows [out->y0, out->y1) from in, which contains all required rows
+// (the first stage gets in == NULL)
+typedef void (*stage_function)(const Stage* stage, const Strip* in, Strip* out);
+
+struct Stage {
+	const char* name;
+	int halo;		// extra rows of input required at each side
+	stage_function process;
+	const void* params;
+	int scratch;	// bytes of temporary memory required per pixel of a row
+};
+
+
+#define MAX_STAGES 16
+
+typedef struct {
+	const Stage* stages;
+	int count;
+	int width;
+	int height;
+	int strip_rows;
+	int buffer_rows;
+	uint32_t* buffer[2];	// intermediate strips
+	uint8_t* scratch;
+} Pipeline;
+
+
+int clamp(int x, int lo, int hi) {
+	return (x < lo) ? lo : (x > hi) ? hi : x;
+}
+
+
+int pipeline_init(Pipeline* p, const Stage* stages, int count, int width, int height, int strip_rows) {
+	if (count < 1 || count > MAX_STAGES)
+		return 0;
+
+	p->stages     = stages;
+	p->count      = count;
+	p->width      = width;
+	p->height     = height;
+	p->strip_rows = clamp(strip_rows, 1, height);
+
+	int halo = 0;
+	for (int i=1; i < count; i++)
+		halo += stages[i].halo;
+
+	p->buffer_rows = p->strip_rows + 2 * halo;
+	if (p->buffer_rows > height)
+		p->buffer_rows = height;
+
+	int scratch = 0;
+	for (int i=0; i < count; i++)
+		if (stages[i].scratch > scratch)
+			scratch = stages[i].scratch;
+
+	const size_t size = (size_t)p->buffer_rows * width * sizeof(uint32_t);
+	for (int i=0; i < 2; i++) {
+		void* ptr = NULL;
+		if (posix_memalign(&ptr, 64, size) != 0)
+			return 0;
+
+		p->buffer[i] = (uint32_t*)ptr;
+	}
+
+	p->scratch = NULL;
+	if (scratch > 0) {
+		void* ptr = NULL;
+		if (posix_memalign(&ptr, 64, (size_t)scratch * width) != 0)
+			return 0;
+
+		p->scratch = (uint8_t*)ptr;
+	}
+
+	return 1;
+}
+
+
+void pipeline_free(Pipeline* p) {
+	free(p->buffer[0]);
+	free(p->buffer[1]);
+	free(p->scratch);
+}
+
+
+void pipeline_run(const Pipeline* p, uint32_t* output) {
+	int y0[MAX_STAGES];
+	int y1[MAX_STAGES];
+
+	const int last = p->count - 1;
+	for (int top=0; top < p->height; top += p->strip_rows) {
+
+		// rows each stage has to produce
+		y0[last] = top;
+		y1[last] = clamp(top + p->strip_rows, 0, p->height);
+		for (int i=last; i > 0; i--) {
+			y0[i - 1] = clamp(y0[i] - p->stages[i].halo, 0, p->height);
+			y1[i - 1] = clamp(y1[i] + p->stages[i].halo, 0, p->height);
+		}
+
+		Strip strip[2];
+		Strip* in  = NULL;
+		for (int i=0; i <= last; i++) {
+			Strip* out = &strip[i % 2];
+			out->y0     = y0[i];
+			out->y1     = y1[i];
+			out->width  = p->width;
+			out->height = p->height;
+			out->scratch = p->scratch;
+			out->data   = (i == last) ? output + (size_t)y0[i] * p->width : p->buffer[i % 2];
+
+			p->stages[i].process(&p->stages[i], in, out);
+			in = out;
+		}
+	}
+}
@@ -0,0 +1,214 @@
+//=== stages - AVX2 implementation =========================================
+
+/*
+	The same results as the scalar stages; the last pixels of a row which
+	do not fill a whole vector are processed by the scalar code.
+*/
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+void decode_avx2(const Stage* stage, const Strip* in, Strip* out) {
+	const DecodeParams* params = (const DecodeParams*)stage->params;
+	(void)in;
+
+	const __m256i mask_c0 = _mm256_set1_epi16(0x001f);
+	const __m256i mask_c1 = _mm256_set1_epi16(0x003f);
+	const __m256i alpha   = _mm256_set1_epi16((int16_t)0xff00);
+
+	for (int y=out->y0; y < out->y1; y++) {
+		const uint16_t* src = params->image + (size_t)y * out->width;
+		uint32_t* dst = strip_row(out, y);
+
+		int x = 0;
+		for (/**/; x + 16 <= out->width; x += 16) {
+			// 4-pixel quarters q0 q2 | q1 q3, so that in-lane unpacks keep order
+			const __m256i p = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i*)(src + x)), 0xd8);
+
+			const __m256i c0 = _mm256_slli_epi16(_mm256_and_si256(p, mask_c0), 3);
+			const __m256i c1 = _mm256_slli_epi16(_mm256_and_si256(_mm256_srli_epi16(p, 5), mask_c1), 2);
+			const __m256i c2 = _mm256_slli_epi16(_mm256_srli_epi16(p, 11), 3);
+
+			const __m256i lo = _mm256_or_si256(c0, _mm256_slli_epi16(c1, 8));	// [c1:c0]
+			const __m256i hi = _mm256_or_si256(c2, alpha);				// [ff:c2]
+
+			_mm256_storeu_si256((__m256i*)(dst + x + 0), _mm256_unpacklo_epi16(lo, hi));
+			_mm256_storeu_si256((__m256i*)(dst + x + 8), _mm256_unpackhi_epi16(lo, hi));
+		}
+
+		for (/**/; x < out->width; x++)
+			dst[x] = decode_pixel(src[x]);
+	}
+}
+
+
+void lut_avx2(const Stage* stage, const Strip* in, Strip* out) {
+	const LutParams* lut = (const LutParams*)stage->params;
+
+	const __m256i mask = _mm256_set1_epi32(0xff);
+
+	for (int y=out->y0; y < out->y1; y++) {
+		const uint32_t* src = strip_row(in, y);
+		uint32_t* dst = strip_row(out, y);
+
+		int x = 0;
+		for (/**/; x + 8 <= out->width; x += 8) {
+			const __m256i p = _mm256_loadu_si256((const __m256i*)(src + x));
+
+			const __m256i i0 = _mm256_and_si256(p, mask);
+			const __m256i i1 = _mm256_and_si256(_mm256_srli_epi32(p, 8), mask);
+			const __m256i i2 = _mm256_and_si256(_mm256_srli_epi32(p, 16), mask);
+			const __m256i i3 = _mm256_srli_epi32(p, 24);
+
+			const __m256i v0 = _mm256_i32gather_epi32((const int*)lut->R, i0, 4);
+			const __m256i v1 = _mm256_i32gather_epi32((const int*)lut->G, i1, 4);
+			const __m256i v2 = _mm256_i32gather_epi32((const int*)lut->B, i2, 4);
+			const __m256i v3 = _mm256_i32gather_epi32((const int*)lut->A, i3, 4);
+
+			const __m256i v = _mm256_or_si256(_mm256_or_si256(v0, v1), _mm256_or_si256(v2, v3));
+			_mm256_storeu_si256((__m256i*)(dst + x), v);
+		}
+
+		for (/**/; x < out->width; x++)
+			dst[x] = lut_pixel(src[x], lut);
+	}
+}
+
+
+void blend_avx2(const Stage* stage, const Strip* in, Strip* out) {
+	const BlendParams* params = (const BlendParams*)stage->params;
+
+	// alpha * 256 for R, G, B words, 0 for alpha word (see blend_32bpp)
+	const __m256i populate_alpha_lo = _mm256_setr_epi8(
+		-1, 3, -1, 3, -1, 3, -1, -1, -1, 7, -1, 7, -1, 7, -1, -1,
+		-1, 3, -1, 3, -1, 3, -1, -1, -1, 7, -1, 7, -1, 7, -1, -1);
+	const __m256i populate_alpha_hi = _mm256_setr_epi8(
+		-1, 11, -1, 11, -1, 11, -1, -1, -1, 15, -1, 15, -1, 15, -1, -1,
+		-1, 11, -1, 11, -1, 11, -1, -1, -1, 15, -1, 15, -1, 15, -1, -1);
+	const __m256i zero = _mm256_setzero_si256();
+
+	for (int y=out->y0; y < out->y1; y++) {
+		const uint32_t* src = strip_row(in, y);
+		const uint32_t* fg  = params->foreground + (size_t)y * out->width;
+		uint32_t* dst = strip_row(out, y);
+
+		int x = 0;
+		for (/**/; x + 8 <= out->width; x += 8) {
+			const __m256i b = _mm256_loadu_si256((const __m256i*)(src + x));
+			const __m256i f = _mm256_loadu_si256((const __m256i*)(fg + x));
+
+			const __m256i f_lo = _mm256_unpacklo_epi8(f, zero);
+			const __m256i f_hi = _mm256_unpackhi_epi8(f, zero);
+			const __m256i a_lo = _mm256_shuffle_epi8(f, populate_alpha_lo);
+			const __m256i a_hi = _mm256_shuffle_epi8(f, populate_alpha_hi);
+
+			// (c * alpha * 256) >> 16
+			const __m256i m_lo = _mm256_mulhi_epu16(f_lo, a_lo);
+			const __m256i m_hi = _mm256_mulhi_epu16(f_hi, a_hi);
+
+			const __m256i m = _mm256_packus_epi16(m_lo, m_hi);
+			_mm256_storeu_si256((__m256i*)(dst + x), _mm256_adds_epu8(b, m));
+		}
+
+		for (/**/; x < out->width; x++)
+			dst[x] = blend_pixel(src[x], fg[x]);
+	}
+}
+
+
+void mix_avx2(const Stage* stage, const Strip* in, Strip* out) {
+	const MixParams* params = (const MixParams*)stage->params;
+
+	const __m256i alpha_pos = _mm256_set1_epi16((int16_t)(256 * params->alpha));
+	const __m256i alpha_neg = _mm256_set1_epi16((int16_t)(256 * (255 - params->alpha)));
+	const __m256i zero = _mm256_setzero_si256();
+
+	for (int y=out->y0; y < out->y1; y++) {
+		const uint32_t* src = strip_row(in, y);
+		const uint32_t* img = params->image + (size_t)y * out->width;
+		uint32_t* dst = strip_row(out, y);
+
+		int x = 0;
+		for (/**/; x + 8 <= out->width; x += 8) {
+			const __m256i A = _mm256_loadu_si256((const __m256i*)(src + x));
+			const __m256i B = _mm256_loadu_si256((const __m256i*)(img + x));
+
+			const __m256i A_lo = _mm256_mulhi_epu16(_mm256_unpacklo_epi8(A, zero), alpha_pos);
+			const __m256i A_hi = _mm256_mulhi_epu16(_mm256_unpackhi_epi8(A, zero), alpha_pos);
+			const __m256i B_lo = _mm256_mulhi_epu16(_mm256_unpacklo_epi8(B, zero), alpha_neg);
+			const __m256i B_hi = _mm256_mulhi_epu16(_mm256_unpackhi_epi8(B, zero), alpha_neg);
+
+			const __m256i lo = _mm256_add_epi16(A_lo, B_lo);
+			const __m256i hi = _mm256_add_epi16(A_hi, B_hi);
+
+			_mm256_storeu_si256((__m256i*)(dst + x), _mm256_packus_epi16(lo, hi));
+		}
+
+		for (/**/; x < out->width; x++)
+			dst[x] = mix_pixel(src[x], img[x], params->alpha);
+	}
+}
+
+
+//--- blur -----------------------------------------------------------------
+
+void blur_vertical_avx2(uint32_t* sums, uint8_t* dst, const uint8_t* add, const uint8_t* sub, int n, const Divisor* div) {
+	int i = 0;
+	for (/**/; i + 16 <= n; i += 16) {
+		const __m256i s0 = _mm256_loadu_si256((const __m256i*)(sums + i));
+		const __m256i s1 = _mm256_loadu_si256((const __m256i*)(sums + i + 8));
+
+		const __m256i q0 = avx2_rounded_average(div, s0);
+		const __m256i q1 = avx2_rounded_average(div, s1);
+
+		const __m256i w = _mm256_permute4x64_epi64(_mm256_packus_epi32(q0, q1), 0xd8);
+		const __m256i b = _mm256_permute4x64_epi64(_mm256_packus_epi16(w, w), 0x08);
+		_mm_storeu_si128((__m128i*)(dst + i), _mm256_castsi256_si128(b));
+
+		const __m128i a  = _mm_loadu_si128((const __m128i*)(add + i));
+		const __m128i r  = _mm_loadu_si128((const __m128i*)(sub + i));
+		const __m256i a0 = _mm256_cvtepu8_epi32(a);
+		const __m256i a1 = _mm256_cvtepu8_epi32(_mm_srli_si128(a, 8));
+		const __m256i r0 = _mm256_cvtepu8_epi32(r);
+		const __m256i r1 = _mm256_cvtepu8_epi32(_mm_srli_si128(r, 8));
+
+		_mm256_storeu_si256((__m256i*)(sums + i),     _mm256_sub_epi32(_mm256_add_epi32(s0, a0), r0));
+		_mm256_storeu_si256((__m256i*)(sums + i + 8), _mm256_sub_epi32(_mm256_add_epi32(s1, a1), r1));
+	}
+
+	if (i < n)
+		blur_vertical_scalar(sums + i, dst + i, add + i, sub + i, n - i, div);
+}
+
+
+static inline __m128i load_pixel(const uint8_t* src, int x) {
+	int32_t p;
+	memcpy(&p, src + 4*x, 4);
+
+	return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(p));
+}
+
+
+// all four channels of a pixel at once
+void blur_horizontal_avx2(const uint8_t* src, uint8_t* dst, int width, int radius, const Divisor* div) {
+	__m128i sum = _mm_setzero_si128();
+	for (int k=-radius; k <= radius; k++)
+		sum = _mm_add_epi32(sum, load_pixel(src, clamp(k, 0, width - 1)));
+
+	for (int x=0; x < width; x++) {
+		const __m128i q = sse41_rounded_average(div, sum);
+		const __m128i b = _mm_packus_epi16(_mm_packus_epi32(q, q), q);
+		const int32_t p = _mm_cvtsi128_si32(b);
+		memcpy(dst + 4*x, &p, 4);
+
+		sum = _mm_add_epi32(sum, load_pixel(src, clamp(x + radius + 1, 0, width - 1)));
+		sum = _mm_sub_epi32(sum, load_pixel(src, clamp(x - radius, 0, width - 1)));
+	}
+}
+
+
+void blur_avx2(const Stage* stage, const Strip* in, Strip* out) {
+	blur_strip(stage, in, out, blur_vertical_avx2, blur_horizontal_avx2);
+}
+
+#endif // __AVX2__
@@ -0,0 +1,223 @@
+//=== stages - scalar implementation =======================================
+
+/*
+	Pixels are 32-bit, bytes 0, 1, 2 and 3 are R, G, B and alpha.
+
+	decode --- 16bpp pixels to 32bpp, like convert_naive from
+	           pixconv16bpp-32bpp: bits 0..4, 5..10 and 11..15 go to bytes
+	           0, 1 and 2, scaled to 8 bits; alpha is 255.
+
+	lut    --- each byte replaced with value from its table, tables keep
+	           already shifted values (see lookup_32bpp).
+
+	blend  --- add a foreground image multiplied by its alpha, saturated
+	           (see blend_32bpp); alpha of the background is kept.
+
+	mix    --- crossfade with another image: A*alpha + B*(255 - alpha),
+	           each product divided by 256 (see mix_32bpp).
+
+	blur   --- box blur of given radius, vertical then horizontal pass
+	           (see ../blur/boxblur.c), borders are clamped.
+*/
+
+typedef struct {
+	const uint16_t* image;
+} DecodeParams;
+
+
+typedef struct {
+	uint32_t R[256];
+	uint32_t G[256];
+	uint32_t B[256];
+	uint32_t A[256];
+} LutParams;
+
+
+typedef struct {
+	const uint32_t* foreground;
+} BlendParams;
+
+
+typedef struct {
+	const uint32_t* image;
+	uint8_t alpha;
+} MixParams;
+
+
+typedef struct {
+	int radius;
+} BlurParams;
+
+
+static inline uint32_t decode_pixel(uint16_t p) {
+	const uint32_t c0 = (p & 0x1f) << 3;
+	const uint32_t c1 = ((p >> 5) & 0x3f) << 2;
+	const uint32_t c2 = (p >> 11) << 3;
+
+	return c0 | (c1 << 8) | (c2 << 16) | 0xff000000;
+}
+
+
+static inline uint32_t lut_pixel(uint32_t p, const LutParams* lut) {
+	return lut->R[p & 0xff]
+	     | lut->G[(p >> 8) & 0xff]
+	     | lut->B[(p >> 16) & 0xff]
+	     | lut->A[p >> 24];
+}
+
+
+static inline uint32_t blend_pixel(uint32_t bg, uint32_t fg) {
+	const uint32_t alpha = fg >> 24;
+
+	uint32_t result = bg & 0xff000000;
+	for (int shift=0; shift < 24; shift += 8) {
+		uint32_t c = ((bg >> shift) & 0xff) + ((((fg >> shift) & 0xff) * alpha) >> 8);
+		if (c > 255)
+			c = 255;
+
+		result |= c << shift;
+	}
+
+	return result;
+}
+
+
+static inline uint32_t mix_pixel(uint32_t A, uint32_t B, uint32_t alpha) {
+	uint32_t result = 0;
+	for (int shift=0; shift < 32; shift += 8) {
+		const uint32_t c = ((((A >> shift) & 0xff) * alpha) >> 8)
+		                 + ((((B >> shift) & 0xff) * (255 - alpha)) >> 8);
+
+		result |= c << shift;
+	}
+
+	return result;
+}
+
+
+void decode_scalar(const Stage* stage, const Strip* in, Strip* out) {
+	const DecodeParams* params = (const DecodeParams*)stage->params;
+	(void)in;
+
+	for (int y=out->y0; y < out->y1; y++) {
+		const uint16_t* src = params->image + (size_t)y * out->width;
+		uint32_t* dst = strip_row(out, y);
+
+		for (int x=0; x < out->width; x++)
+			dst[x] = decode_pixel(src[x]);
+	}
+}
+
+
+void lut_scalar(const Stage* stage, const Strip* in, Strip* out) {
+	const LutParams* lut = (const LutParams*)stage->params;
+
+	for (int y=out->y0; y < out->y1; y++) {
+		const uint32_t* src = strip_row(in, y);
+		uint32_t* dst = strip_row(out, y);
+
+		for (int x=0; x < out->width; x++)
+			dst[x] = lut_pixel(src[x], lut);
+	}
+}
+
+
+void blend_scalar(const Stage* stage, const Strip* in, Strip* out) {
+	const BlendParams* params = (const BlendParams*)stage->params;
+
+	for (int y=out->y0; y < out->y1; y++) {
+		const uint32_t* src = strip_row(in, y);
+		const uint32_t* fg  = params->foreground + (size_t)y * out->width;
+		uint32_t* dst = strip_row(out, y);
+
+		for (int x=0; x < out->width; x++)
+			dst[x] = blend_pixel(src[x], fg[x]);
+	}
+}
+
+
+void mix_scalar(const Stage* stage, const Strip* in, Strip* out) {
+	const MixParams* params = (const MixParams*)stage->params;
+
+	for (int y=out->y0; y < out->y1; y++) {
+		const uint32_t* src = strip_row(in, y);
+		const uint32_t* img = params->image + (size_t)y * out->width;
+		uint32_t* dst = strip_row(out, y);
+
+		for (int x=0; x < out->width; x++)
+			dst[x] = mix_pixel(src[x], img[x], params->alpha);
+	}
+}
+
+
+//--- blur -----------------------------------------------------------------
+
+// dst = (sums + d/2)/d, then sums += add - sub; n bytes
+typedef void (*blur_vertical_function)(uint32_t* sums, uint8_t* dst, const uint8_t* add, const uint8_t* sub, int n, const Divisor* div);
+
+// horizontal pass over a row of 32bpp pixels
+typedef void (*blur_horizontal_function)(const uint8_t* src, uint8_t* dst, int width, int radius, const Divisor* div);
+
+// sums and a row after vertical pass, see blur_strip
+#define BLUR_SCRATCH (4 * sizeof(uint32_t) + 4)
+
+
+void blur_vertical_scalar(uint32_t* sums, uint8_t* dst, const uint8_t* add, const uint8_t* sub, int n, const Divisor* div) {
+	for (int i=0; i < n; i++) {
+		const uint32_t s = sums[i];
+		dst[i]  = rounded_average(div, s);
+		sums[i] = s + add[i] - sub[i];
+	}
+}
+
+
+void blur_horizontal_scalar(const uint8_t* src, uint8_t* dst, int width, int radius, const Divisor* div) {
+	for (int c=0; c < 4; c++) {
+		uint32_t sum = 0;
+		for (int k=-radius; k <= radius; k++)
+			sum += src[4 * clamp(k, 0, width - 1) + c];
+
+		for (int x=0; x < width; x++) {
+			dst[4*x + c] = rounded_average(div, sum);
+			sum += src[4 * clamp(x + radius + 1, 0, width - 1) + c];
+			sum -= src[4 * clamp(x - radius, 0, width - 1) + c];
+		}
+	}
+}
+
+
+void blur_strip(const Stage* stage, const Strip* in, Strip* out,
+                blur_vertical_function vertical, blur_horizontal_function horizontal) {
+
+	const BlurParams* params = (const BlurParams*)stage->params;
+	const int r = params->radius;
+	const int n = out->width * 4;
+	const int last = out->height - 1;
+	const Divisor div = divisor(2 * r + 1);
+
+	uint32_t* sums = (uint32_t*)out->scratch;
+	uint8_t*  tmp  = (uint8_t*)(sums + n);
+
+	memset(sums, 0, n * sizeof(uint32_t));
+	for (int k=-r; k <= r; k++) {
+		const uint8_t* row = (const uint8_t*)strip_row(in, clamp(out->y0 + k, 0, last));
+		for (int i=0; i < n; i++)
+			sums[i] += row[i];
+	}
+
+	for (int y=out->y0; y < out->y1; y++) {
+		const uint8_t* sub = (const uint8_t*)strip_row(in, clamp(y - r, 0, last));
+		const uint8_t* add = sub;
+		// sums after the last row are not needed, and the next row may be not in the strip
+		if (y + 1 < out->y1)
+			add = (const uint8_t*)strip_row(in, clamp(y + r + 1, 0, last));
+
+		vertical(sums, tmp, add, sub, n, &div);
+		horizontal(tmp, (uint8_t*)strip_row(out, y), out->width, r, &div);
+	}
+}
+
+
+void blur_scalar(const Stage* stage, const Strip* in, Strip* out) {
+	blur_strip(stage, in, out, blur_vertical_scalar, blur_horizontal_scalar);
+}
@@ -1,3 +1,6 @@
+#include <climits>
+#include <random>
+#include <algorithm>
 #include <sys/time.h>
 
 
@@ -145,3 +148,81 @@ int power(int i, int n, double k) {
 
 
 } // namespace distribution
+
+
+// Sorted arrays of random keys; generator is called with a random engine.
+template <typename Generator>
+ArrayType prepare_random(std::size_t n, Generator generator, unsigned seed = 0) {
+
+    std::mt19937 random(seed);
+
+    ArrayType array(n);
+    for (auto& key: array) {
+        key = generator(random);
+    }
+
+    std::sort(array.begin(), array.end());
+
+    return array;
+}
+
+
+namespace random_keys {
+
+
+struct uniform {
+    int operator()(std::mt19937& random) const {
+        return std::uniform_int_distribution<int>(0, INT_MAX - 1)(random);
+    }
+};
+
+
+// Ranks 1..ranks drawn with probability ~ 1/rank^s, scaled by 1000 (so
+// there are gaps between keys); the most frequent keys repeat many times.
+class zipf {
+    std::vector<double> cdf;
+
+public:
+    zipf(double s, int ranks = 1000000) : cdf(ranks) {
+        double sum = 0.0;
+        for (int r=0; r < ranks; r++) {
+            sum += 1.0 / std::pow(r + 1, s);
+            cdf[r] = sum;
+        }
+
+        for (auto& c: cdf) {
+            c /= sum;
+        }
+    }
+
+    int operator()(std::mt19937& random) const {
+        const double u = std::uniform_real_distribution<double>(0.0, 1.0)(random);
+        const auto rank = std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+
+        return 1000 * int(rank + 1);
+    }
+};
+
+
+// Keys are grouped around a few centers (normal distribution).
+class clustered {
+    std::vector<int> centers;
+    const double spread;
+
+public:
+    clustered(int count, double spread, unsigned seed = 1) : centers(count), spread(spread) {
+        std::mt19937 random(seed);
+        for (auto& c: centers) {
+            c = std::uniform_int_distribution<int>(INT_MAX/16, INT_MAX/16 * 15)(random);
+        }
+    }
+
+    int operator()(std::mt19937& random) const {
+        const auto c = centers[random() % centers.size()];
+
+        return c + int(std::normal_distribution<double>(0.0, spread)(random));
+    }
+};
+
+
+} // namespace random_keys
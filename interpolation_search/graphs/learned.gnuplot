@@ -0,0 +1,15 @@
+set terminal png medium size 800,600
+
+set output "learned.png"
+
+set title "running time - 1M keys, 1M queries"
+set logscale y
+set ylabel "time [s]"
+set style data histogram
+set style histogram clustered
+set style fill solid border -1
+set boxwidth 0.9
+
+plot "learned.results" using 3:xtic(2) title "binary search", \
+     "learned.results" using 4 title "interpolation search", \
+     "learned.results" using 5 title "learned index"
@@ -0,0 +1,25 @@
+def read(file):
+    name = None
+    times = []
+    for line in file:
+        field = line.split()
+        if not field:
+            continue
+
+        if ':' not in line:
+            name = line.strip()
+            times = []
+            continue
+
+        if field[-1] == 'levels':
+            yield name, times[0], times[1], times[2]
+            continue
+
+        # "name: 0.1234s ..."
+        time = line.split(':')[1].split()[0]
+        times.append(float(time[:-1]))
+
+if __name__ == '__main__':
+    import sys
+    for index, item in enumerate(read(sys.stdin)):
+        print('%d "%s" %0.4f %0.4f %0.4f' % ((index,) + item))
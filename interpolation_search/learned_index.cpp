@@ -0,0 +1,251 @@
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+#include <vector>
+#include <immintrin.h>
+
+/*
+    Learned index (PGM-style) over a sorted array.
+
+    The array is split into segments; within a segment the position of
+    key is approximated by a linear function with a bounded error
+    (epsilon). Segments are built greedily (the "shrinking cone": a new
+    segment starts when no line fits all keys seen so far). The first
+    keys of segments are indexed in the same way, recursively, until a
+    level has a few segments --- it is scanned linearly.
+
+    A lookup predicts a position and then counts keys less than the
+    searched key in the window [pred - epsilon, pred + epsilon] with SIMD
+    instructions, there are no data-dependent branches. Prediction uses
+    fixed-point arithmetic (slope is 32.32), there's no FP division.
+
+    Duplicated keys are modelled by their first occurrence. If the searched
+    key falls beyond the window (it may happen for a missing key next to
+    a long run of duplicates), binary search of the rest is used.
+*/
+
+namespace learned {
+
+    __extension__ typedef unsigned __int128 uint128;
+
+    // number of keys < key in the range [first, first + n)
+    inline std::size_t count_less(const KeyType* first, std::size_t n, KeyType key) {
+        std::size_t count = 0;
+        std::size_t i = 0;
+#if defined(__AVX2__)
+        const __m256i x = _mm256_set1_epi32(key);
+        for (/**/; i + 8 <= n; i += 8) {
+            const __m256i v  = _mm256_loadu_si256((const __m256i*)(first + i));
+            const __m256i lt = _mm256_cmpgt_epi32(x, v);
+
+            count += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(lt)));
+        }
+#endif
+        for (/**/; i < n; i++) {
+            count += (first[i] < key);
+        }
+
+        return count;
+    }
+
+    struct Segment {
+        KeyType  key;       // the first key
+        uint32_t pos;       // ... and its position
+        uint64_t slope;     // positions per key unit, 32.32 fixed-point
+
+        // the result is not greater than limit
+        std::size_t predict(KeyType x, std::size_t limit) const {
+            if (x <= key) {
+                return pos;
+            }
+
+            const uint64_t dx = uint64_t(int64_t(x) - int64_t(key));
+            const uint128 dp = (uint128(dx) * slope) >> 32;
+            if (dp >= limit - pos) {
+                return limit;
+            }
+
+            return pos + std::size_t(dp);
+        }
+    };
+
+    // Greedy segmentation of points (keys[i], positions[i]), keys are unique
+    // and sorted; each point is predicted with error at most epsilon.
+    std::vector<Segment> segmentation(const std::vector<KeyType>& keys,
+                                      const std::vector<std::size_t>& positions,
+                                      std::size_t epsilon) {
+
+        std::vector<Segment> result;
+
+        const double eps = double(epsilon);
+
+        std::size_t start = 0;
+        double lo = 0.0;
+        double hi = 1e300;
+
+        auto close = [&]() {
+            // the slope from the middle of cone; for a single point any
+            double slope = (hi >= 1e300) ? 0.0 : (lo + hi) / 2;
+            if (slope < 0) {
+                slope = 0;
+            }
+
+            result.push_back(Segment{keys[start], uint32_t(positions[start]),
+                                     uint64_t(slope * 4294967296.0)});
+        };
+
+        for (std::size_t i=1; i < keys.size(); i++) {
+            const double dx = double(keys[i]) - double(keys[start]);
+            const double dy = double(positions[i]) - double(positions[start]);
+
+            const double l = std::max(lo, (dy - eps) / dx);
+            const double h = std::min(hi, (dy + eps) / dx);
+            if (l <= h) {
+                lo = l;
+                hi = h;
+                continue;
+            }
+
+            close();
+            start = i;
+            lo = 0.0;
+            hi = 1e300;
+        }
+
+        if (!keys.empty()) {
+            close();
+        }
+
+        return result;
+    }
+
+} // namespace learned
+
+
+class LearnedIndex {
+
+    const ArrayType& array;
+    const std::size_t epsilon;
+
+    // levels[0] models array, levels[i] models first keys of levels[i - 1]
+    std::vector<std::vector<learned::Segment>> levels;
+    std::vector<std::vector<KeyType>> level_keys;
+
+    // the top level is scanned linearly when not larger
+    static const std::size_t top_size = 16;
+
+public:
+    LearnedIndex(const ArrayType& array, std::size_t epsilon = 32)
+        : array(array)
+        , epsilon(epsilon) {
+
+        // the first occurrences of keys
+        std::vector<KeyType> keys;
+        std::vector<std::size_t> positions;
+        for (std::size_t i=0; i < array.size(); i++) {
+            if (i == 0 || array[i] != array[i - 1]) {
+                keys.push_back(array[i]);
+                positions.push_back(i);
+            }
+        }
+
+        while (true) {
+            levels.push_back(learned::segmentation(keys, positions, epsilon));
+
+            const auto& segments = levels.back();
+            std::vector<KeyType> first_keys(segments.size());
+            for (std::size_t i=0; i < segments.size(); i++) {
+                first_keys[i] = segments[i].key;
+            }
+            level_keys.push_back(first_keys);
+
+            if (segments.size() <= top_size) {
+                break;
+            }
+
+            keys.swap(first_keys);
+            positions.resize(keys.size());
+            for (std::size_t i=0; i < keys.size(); i++) {
+                positions[i] = i;
+            }
+        }
+    }
+
+    // the index of the first key >= key (array.size() if none)
+    std::size_t lower_bound(KeyType key) const {
+        if (array.empty()) {
+            return 0;
+        }
+
+        // the top level
+        const auto& top = level_keys.back();
+        std::size_t seg = last_not_greater(top.data(), top.size(), key);
+
+        // seg is an index of segment at level l, it gives segment at level l-1
+        for (std::size_t l = levels.size() - 1; l > 0; l--) {
+            const auto& keys = level_keys[l - 1];
+            const std::size_t pred = predict(l, seg, key, keys.size());
+            std::size_t lo, hi;
+            window(pred, keys.size(), lo, hi);
+
+            seg = lo + last_not_greater(keys.data() + lo, hi - lo, key);
+            if ((seg > 0 && keys[seg] > key) || (seg + 1 < keys.size() && keys[seg + 1] <= key)) {
+                // outside the window; keys of upper levels are unique, so
+                // it's only a safety net
+                const auto it = std::upper_bound(keys.begin(), keys.end(), key);
+                seg = (it == keys.begin()) ? 0 : (it - keys.begin() - 1);
+            }
+        }
+
+        const std::size_t pred = predict(0, seg, key, array.size());
+        std::size_t lo, hi;
+        window(pred, array.size(), lo, hi);
+
+        const std::size_t pos = lo + learned::count_less(array.data() + lo, hi - lo, key);
+        if ((lo > 0 && array[lo - 1] >= key) || (pos == hi && hi < array.size() && array[hi] < key)) {
+            return std::lower_bound(array.begin(), array.end(), key) - array.begin();
+        }
+
+        return pos;
+    }
+
+    bool contains(KeyType key) const {
+        const auto pos = lower_bound(key);
+
+        return pos < array.size() && array[pos] == key;
+    }
+
+    std::size_t segments() const {
+        return levels[0].size();
+    }
+
+    std::size_t height() const {
+        return levels.size();
+    }
+
+private:
+    // a key not greater than the first key of the next segment
+    // can't be placed after the first position of that segment
+    std::size_t predict(std::size_t level, std::size_t seg, KeyType key, std::size_t size) const {
+        const auto& segments = levels[level];
+        const std::size_t limit = (seg + 1 < segments.size()) ? segments[seg + 1].pos : size;
+
+        return segments[seg].predict(key, limit);
+    }
+
+    void window(std::size_t pred, std::size_t size, std::size_t& lo, std::size_t& hi) const {
+        // +1: rounding of fixed-point slope
+        lo = (pred > epsilon + 1) ? pred - epsilon - 1 : 0;
+        hi = std::min(pred + epsilon + 2, size);
+        if (lo > hi) {
+            lo = hi;
+        }
+    }
+
+    // index of the last key <= key, 0 if all keys are greater
+    static std::size_t last_not_greater(const KeyType* keys, std::size_t n, KeyType key) {
+        const std::size_t count = (key == INT_MAX) ? n : learned::count_less(keys, n, key + 1);
+
+        return (count > 0) ? count - 1 : 0;
+    }
+};
@@ -1,10 +1,17 @@
 #include <cstdio>
+#include <cstring>
 #include <string>
 #include <cmath>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <memory>
 
 
 #include "search.cpp"
 #include "common.cpp"
+#include "static_index.cpp"
+#include "learned_index.cpp"
 
 
 template <typename Value, typename... Args>
@@ -18,11 +25,388 @@ void test(const std::size_t n, Value value, const std::string& name, Args... arg
 }
 
 
+// Keys 0, 2, 4, ... are searched in random order (half of them is missing),
+// thus --- unlike in test() --- the consecutive searches don't share cache lines.
+template <typename Function>
+measure_item_t speed_random(const std::vector<KeyType>& keys, Function contains, const std::string& name, std::size_t& found) {
+
+    measure_item_t m(name);
+    m.start();
+
+    found = 0;
+    for (auto key: keys) {
+        found += contains(key);
+    }
+
+    m.stop();
+
+    return m;
+}
+
+
+template <typename Function>
+measure_item_t speed_batch(const std::vector<KeyType>& keys, Function contains_batch, const std::string& name, std::size_t& found) {
+
+    std::vector<char> result(keys.size());
+    bool* flags = reinterpret_cast<bool*>(result.data());
+
+    measure_item_t m(name);
+    m.start();
+
+    contains_batch(keys.data(), keys.size(), flags);
+
+    found = 0;
+    for (std::size_t i=0; i < keys.size(); i++) {
+        found += flags[i];
+    }
+
+    m.stop();
+
+    return m;
+}
+
+
+bool test_index(std::size_t n, std::size_t queries) {
+
+    printf("\n%lu keys, %lu queries\n", n, queries);
+
+    const auto array = prepare(n, [](int i, int) {return 2 * i;});
+
+    std::mt19937 random(n);
+    std::uniform_int_distribution<KeyType> dist(0, KeyType(2 * n));
+    std::vector<KeyType> keys(queries);
+    for (auto& key: keys) {
+        key = dist(random);
+    }
+
+    std::vector<std::size_t> found(6);
+    std::vector<measure_item_t> results;
+
+    results.push_back(speed_random(keys, [&](KeyType key) {return search(array, key, bin_middle);},
+                                   "binary search", found[0]));
+    results.push_back(speed_random(keys, [&](KeyType key) {return search(array, key, interpolation_middle);},
+                                   "interpolation search", found[1]));
+    {
+        const EytzingerIndex index(array);
+        results.push_back(speed_random(keys, [&](KeyType key) {return index.contains(key);},
+                                       "Eytzinger", found[2]));
+        results.push_back(speed_batch(keys, [&](const KeyType* k, std::size_t c, bool* f) {index.contains_batch(k, c, f);},
+                                      "Eytzinger (batch)", found[3]));
+    }
+    {
+        const STreeIndex index(array);
+        results.push_back(speed_random(keys, [&](KeyType key) {return index.contains(key);},
+                                       "S-tree", found[4]));
+        results.push_back(speed_batch(keys, [&](const KeyType* k, std::size_t c, bool* f) {index.contains_batch(k, c, f);},
+                                      "S-tree (batch)", found[5]));
+    }
+
+    results[0].print();
+    for (std::size_t i=1; i < results.size(); i++) {
+        results[i].print(results[0]);
+    }
+
+    if (std::count(found.begin(), found.end(), found[0]) != long(found.size())) {
+        puts("results differ!");
+        return false;
+    }
+
+    return true;
+}
+
+
+int main_index(std::size_t max, std::size_t queries) {
+    for (std::size_t n = 1000; n <= max; n *= 10) {
+        if (!test_index(n, queries)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+// Half of queries are keys from array, half are random values from the
+// range of keys.
+std::vector<KeyType> random_queries(const ArrayType& array, std::size_t count) {
+
+    std::mt19937 random(count);
+    std::vector<KeyType> keys(count);
+
+    const auto min = array.front();
+    const auto max = array.back();
+    for (std::size_t i=0; i < count; i++) {
+        if (i % 2 == 0) {
+            keys[i] = array[random() % array.size()];
+        } else {
+            keys[i] = std::uniform_int_distribution<KeyType>(min, max)(random);
+        }
+    }
+
+    return keys;
+}
+
+
+bool test_learned(const ArrayType& array, std::size_t queries, const std::string& name) {
+
+    printf("\n%s\n", name.c_str());
+
+    const auto keys = random_queries(array, queries);
+
+    // interpolation search degrades to linear search on skewed data, it
+    // is run on a sample and the time is scaled
+    const std::size_t sample = std::min(queries, std::size_t(10000));
+    const std::vector<KeyType> sample_keys(keys.begin(), keys.begin() + sample);
+
+    std::size_t found[2];
+    std::size_t found_sample[2];
+
+    const auto binary = speed_random(keys, [&](KeyType key) {return search(array, key, bin_middle);},
+                                     "binary search", found[0]);
+    speed_random(sample_keys, [&](KeyType key) {return search(array, key, bin_middle);},
+                 "", found_sample[0]);
+    const auto interpolation = speed_random(sample_keys, [&](KeyType key) {return search(array, key, interpolation_middle);},
+                                            "interpolation search", found_sample[1]);
+
+    const LearnedIndex index(array);
+    const auto learned = speed_random(keys, [&](KeyType key) {return index.contains(key);},
+                                      "learned index", found[1]);
+
+    const double scaled = interpolation.get_time() * queries / sample;
+
+    binary.print();
+    printf("%20s: %10.4fs (speedup: %0.2f) (%lu queries, scaled)\n", "interpolation search",
+           scaled, binary.get_time()/scaled, sample);
+    learned.print(binary);
+
+    printf("%20s: %lu segments, %lu levels\n", "", index.segments(), index.height());
+
+    if (found[0] != found[1] || found_sample[0] != found_sample[1]) {
+        puts("results differ!");
+        return false;
+    }
+
+    return true;
+}
+
+
+int main_learned(std::size_t n, std::size_t queries) {
+
+    using namespace random_keys;
+
+    const bool ok = test_learned(prepare_random(n, uniform()), queries, "uniform")
+                 && test_learned(prepare_random(n, zipf(1.0)), queries, "zipf 1.0")
+                 && test_learned(prepare_random(n, zipf(1.5)), queries, "zipf 1.5")
+                 && test_learned(prepare_random(n, clustered(100, 10000.0)), queries, "clustered 100")
+                 && test_learned(prepare_random(n, clustered(10, 1000.0)), queries, "clustered 10");
+
+    return ok ? 0 : 1;
+}
+
+
+// extreme values, all keys and their neighbours, random values
+std::vector<KeyType> verify_queries(const ArrayType& array) {
+
+    std::vector<KeyType> queries = {INT_MIN, INT_MIN + 1, -1, 0, 1, INT_MAX - 1, INT_MAX};
+    for (const auto key: array) {
+        queries.push_back(key);
+        if (key > INT_MIN) queries.push_back(key - 1);
+        if (key < INT_MAX) queries.push_back(key + 1);
+    }
+
+    std::mt19937 random(array.size());
+    for (int i=0; i < 1000; i++) {
+        queries.push_back(KeyType(random()));
+    }
+
+    return queries;
+}
+
+
+// LearnedIndex::lower_bound compared with std::lower_bound
+bool verify_learned(const ArrayType& array, const std::string& name) {
+
+    const auto queries = verify_queries(array);
+
+    for (const std::size_t epsilon: {1, 4, 32}) {
+        const LearnedIndex index(array, epsilon);
+        for (const auto key: queries) {
+            const std::size_t expected = std::lower_bound(array.begin(), array.end(), key) - array.begin();
+            const std::size_t result   = index.lower_bound(key);
+            if (result != expected) {
+                printf("%s, epsilon %lu: lower_bound(%d) = %lu, expected %lu\n",
+                       name.c_str(), epsilon, key, result, expected);
+                return false;
+            }
+        }
+    }
+
+    printf("%-30s OK\n", name.c_str());
+    return true;
+}
+
+
+// lower_bound (an index in array), contains and contains_batch compared
+// with std::lower_bound; the number of queries is not a multiple of the
+// batch group
+template <typename Index, typename LowerBound>
+bool verify_index(const ArrayType& array, const std::vector<KeyType>& queries,
+                  const Index& index, LowerBound lower_bound, const std::string& name) {
+
+    std::vector<char> expected_found(queries.size());
+    for (std::size_t i=0; i < queries.size(); i++) {
+        const auto key = queries[i];
+        const auto it  = std::lower_bound(array.begin(), array.end(), key);
+        const std::size_t expected = it - array.begin();
+        const std::size_t result   = lower_bound(key);
+        if (result != expected) {
+            printf("%s: lower_bound(%d) = %lu, expected %lu\n", name.c_str(), key, result, expected);
+            return false;
+        }
+
+        expected_found[i] = (it != array.end() && *it == key);
+        if (index.contains(key) != bool(expected_found[i])) {
+            printf("%s: contains(%d) = %d, expected %d\n", name.c_str(), key, !expected_found[i], expected_found[i]);
+            return false;
+        }
+    }
+
+    for (const std::size_t count: {queries.size(), queries.size() - 1, std::size_t(15), std::size_t(17)}) {
+        const std::size_t c = std::min(count, queries.size());
+        std::unique_ptr<bool[]> found(new bool[c + 1]);
+        found[c] = true;
+        index.contains_batch(queries.data(), c, found.get());
+        for (std::size_t i=0; i < c; i++) {
+            if (found[i] != bool(expected_found[i])) {
+                printf("%s: contains_batch(%lu keys)[%lu] (key %d) = %d, expected %d\n",
+                       name.c_str(), c, i, queries[i], found[i], expected_found[i]);
+                return false;
+            }
+        }
+
+        if (!found[c]) {
+            printf("%s: contains_batch(%lu keys) wrote past the end\n", name.c_str(), c);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+// in-order ranks of EytzingerIndex positions, i.e. indices in array
+std::vector<std::size_t> eytzinger_ranks(std::size_t n) {
+    std::vector<std::size_t> rank(n + 1);
+    std::size_t i = 0;
+
+    std::function<void(std::size_t)> visit = [&](std::size_t k) {
+        if (k <= n) {
+            visit(2 * k);
+            rank[k] = i++;
+            visit(2 * k + 1);
+        }
+    };
+    visit(1);
+
+    rank[0] = n; // no such key
+    return rank;
+}
+
+
+bool verify_static(const ArrayType& array, const std::string& name) {
+
+    const auto queries = verify_queries(array);
+
+    const EytzingerIndex eytzinger(array);
+    const auto rank = eytzinger_ranks(array.size());
+    if (!verify_index(array, queries, eytzinger, [&](KeyType key) {return rank[eytzinger.lower_bound(key)];},
+                      name + ", Eytzinger")) {
+        return false;
+    }
+
+    const STreeIndex stree(array);
+    if (!verify_index(array, queries, stree, [&](KeyType key) {return stree.lower_bound(key);},
+                      name + ", S-tree")) {
+        return false;
+    }
+
+    printf("%-30s OK\n", (name + ", static").c_str());
+    return true;
+}
+
+
+int main_verify() {
+
+    using namespace random_keys;
+
+    std::vector<std::pair<std::string, ArrayType>> cases = {
+        {"empty",               {}},
+        {"single key",          {42}},
+        {"extreme values",      {INT_MIN, INT_MIN, INT_MIN + 1, -1, 0, 0, 1, INT_MAX - 1, INT_MAX, INT_MAX}},
+        {"INT_MIN only",        ArrayType(100, INT_MIN)},
+        {"INT_MAX only",        ArrayType(100, INT_MAX)},
+    };
+
+    // long runs of duplicates, a missing key between them
+    ArrayType runs;
+    for (int k=0; k < 50; k++) {
+        runs.insert(runs.end(), 1 + (k * 37) % 500, 3 * k);
+    }
+    cases.push_back({"runs of duplicates", runs});
+
+    ArrayType full_range;
+    for (int64_t k=INT_MIN; k <= INT_MAX; k += 1 << 20) {
+        full_range.push_back(KeyType(k));
+    }
+    full_range.push_back(INT_MAX);
+    cases.push_back({"full range", full_range});
+
+    for (const std::size_t n: {10, 1000, 100000}) {
+        cases.push_back({"uniform " + std::to_string(n),       prepare_random(n, uniform())});
+        cases.push_back({"zipf 1.5 " + std::to_string(n),      prepare_random(n, zipf(1.5))});
+        cases.push_back({"clustered 10 " + std::to_string(n),  prepare_random(n, clustered(10, 1000.0))});
+    }
+
+    // sizes which are neither powers of two nor multiples of S-tree node;
+    // the largest ones make S-tree with three and four layers
+    for (const std::size_t n: {2, 3, 7, 15, 17, 31, 33, 100, 255, 257, 1023, 1025, 4097, 5000, 100003}) {
+        cases.push_back({"uniform " + std::to_string(n),       prepare_random(n, uniform())});
+    }
+
+    bool ok = true;
+    for (const auto& c: cases) {
+        ok = verify_learned(c.second, c.first) && ok;
+        ok = verify_static(c.second, c.first) && ok;
+    }
+
+    return ok ? 0 : 1;
+}
+
+
 int main(int argc, char* argv[]) {
     if (argc <= 1) {
         return 1;
     }
 
+    if (strcmp(argv[1], "--verify") == 0) {
+        return main_verify();
+    }
+
+    if (strcmp(argv[1], "--index") == 0) {
+        // sizes from 1K up to max keys (default 1G)
+        const std::size_t max     = (argc > 2) ? atol(argv[2]) : 1000000000;
+        const std::size_t queries = (argc > 3) ? atol(argv[3]) : 1000000;
+
+        return main_index(max, queries);
+    }
+
+    if (strcmp(argv[1], "--learned") == 0) {
+        const std::size_t n       = (argc > 2) ? atol(argv[2]) : 1000000;
+        const std::size_t queries = (argc > 3) ? atol(argv[3]) : 1000000;
+
+        return main_learned(n, queries);
+    }
+
     const auto n = atoi(argv[1]);
 
     using namespace distribution;
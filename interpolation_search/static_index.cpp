@@ -0,0 +1,302 @@
+#include <cstdint>
+#include <cstdlib>
+#include <climits>
+#include <new>
+#include <vector>
+#include <immintrin.h>
+
+/*
+    Static search structures built from a sorted array (ArrayType).
+
+    Binary search touches a different cache line in almost every step;
+    here the keys are rearranged, so that the lines needed by subsequent
+    steps are close to each other and can be fetched in advance:
+
+    - EytzingerIndex -- the array stored as a binary heap (BFS order),
+      the node k has children 2k and 2k+1; 16 consecutive descendants four
+      levels below fit in a cache line, it is prefetched.
+
+    - STreeIndex -- a static B+ tree with 16-key nodes (one cache line),
+      each node is searched with AVX2 (or AVX-512) comparison and popcount,
+      without branches.
+
+    Both support batched lookups: a group of keys is searched in lock-step,
+    level by level, thus memory accesses of different searches overlap.
+*/
+
+template <typename T>
+class AlignedArray {
+    T* ptr;
+    std::size_t n;
+
+public:
+    explicit AlignedArray(std::size_t n) : ptr(nullptr), n(n) {
+        if (posix_memalign(reinterpret_cast<void**>(&ptr), 64, n * sizeof(T) + 64) != 0) {
+            throw std::bad_alloc();
+        }
+    }
+
+    ~AlignedArray() {
+        free(ptr);
+    }
+
+    AlignedArray(const AlignedArray&) = delete;
+    AlignedArray& operator=(const AlignedArray&) = delete;
+
+    T& operator[](std::size_t i) {
+        return ptr[i];
+    }
+
+    const T& operator[](std::size_t i) const {
+        return ptr[i];
+    }
+
+    const T* data() const {
+        return ptr;
+    }
+
+    std::size_t size() const {
+        return n;
+    }
+};
+
+
+class EytzingerIndex {
+
+    const std::size_t n;
+    AlignedArray<KeyType> tree; // tree[1..n], tree[0] unused
+    int height;                 // number of levels
+
+public:
+    explicit EytzingerIndex(const ArrayType& array)
+        : n(array.size())
+        , tree(array.size() + 1)
+        , height(64 - __builtin_clzll(array.size() | 1)) {
+
+        tree[0] = INT_MIN;
+        build(array, 0, 1);
+    }
+
+    bool contains(KeyType key) const {
+        const auto k = lower_bound(key);
+
+        return k != 0 && tree[k] == key;
+    }
+
+    // sets found[i] = contains(keys[i])
+    void contains_batch(const KeyType* keys, std::size_t count, bool* found) const {
+
+        const std::size_t group = 16;
+
+        std::size_t i = 0;
+        for (/**/; i + group <= count; i += group) {
+            std::size_t k[group];
+            for (std::size_t j=0; j < group; j++) {
+                k[j] = 1;
+            }
+
+            // The searches run exactly `height` steps; a step below a leaf
+            // goes "right", which doesn't alter the final position.
+            for (int level=0; level < height; level++) {
+                for (std::size_t j=0; j < group; j++) {
+                    __builtin_prefetch(tree.data() + 16 * k[j]);
+
+                    const auto v = tree[k[j] <= n ? k[j] : 0];
+                    k[j] = 2 * k[j] + ((k[j] > n) | (v < keys[i + j]));
+                }
+            }
+
+            for (std::size_t j=0; j < group; j++) {
+                const auto pos = k[j] >> __builtin_ffsll(~k[j]);
+                found[i + j] = (pos != 0) && tree[pos] == keys[i + j];
+            }
+        }
+
+        for (/**/; i < count; i++) {
+            found[i] = contains(keys[i]);
+        }
+    }
+
+    // position in tree of the first key >= key, 0 if there's no such key
+    std::size_t lower_bound(KeyType key) const {
+        std::size_t k = 1;
+        while (k <= n) {
+            __builtin_prefetch(tree.data() + 16 * k);
+            k = 2 * k + (tree[k] < key);
+        }
+
+        return k >> __builtin_ffsll(~k);
+    }
+
+private:
+    // in-order traversal assigns subsequent keys
+    std::size_t build(const ArrayType& array, std::size_t i, std::size_t k) {
+        if (k <= n) {
+            i = build(array, i, 2 * k);
+            tree[k] = array[i++];
+            i = build(array, i, 2 * k + 1);
+        }
+
+        return i;
+    }
+};
+
+
+class STreeIndex {
+
+    static const int B = 16;            // keys in a node
+    static const int children = B + 1;
+
+    const std::size_t n;
+    std::vector<std::size_t> offset;    // the first node of layer, 0 = leaves
+    AlignedArray<KeyType> nodes;
+
+public:
+    explicit STreeIndex(const ArrayType& array)
+        : n(array.size())
+        , offset(layout(array.size()))
+        , nodes(offset.back() * B) {
+
+        build(array);
+    }
+
+    // index of the first key >= key in the source array (size() if none)
+    std::size_t lower_bound(KeyType key) const {
+        std::size_t j = 0;
+        for (int layer = int(offset.size()) - 2; layer > 0; layer--) {
+            j = j * children + count_less(node(layer, j), key);
+        }
+
+        return j * B + count_less(node(0, j), key);
+    }
+
+    bool contains(KeyType key) const {
+        const auto i = lower_bound(key);
+
+        return i < n && nodes[i] == key;
+    }
+
+    void contains_batch(const KeyType* keys, std::size_t count, bool* found) const {
+
+        const std::size_t group = 16;
+
+        std::size_t i = 0;
+        for (/**/; i + group <= count; i += group) {
+            std::size_t j[group];
+            for (std::size_t q=0; q < group; q++) {
+                j[q] = 0;
+            }
+
+            for (int layer = int(offset.size()) - 2; layer > 0; layer--) {
+                for (std::size_t q=0; q < group; q++) {
+                    j[q] = j[q] * children + count_less(node(layer, j[q]), keys[i + q]);
+                    __builtin_prefetch(node(layer - 1, j[q]));
+                }
+            }
+
+            for (std::size_t q=0; q < group; q++) {
+                const auto pos = j[q] * B + count_less(node(0, j[q]), keys[i + q]);
+                found[i + q] = pos < n && nodes[pos] == keys[i + q];
+            }
+        }
+
+        for (/**/; i < count; i++) {
+            found[i] = contains(keys[i]);
+        }
+    }
+
+private:
+    const KeyType* node(int layer, std::size_t j) const {
+        return nodes.data() + (offset[layer] + j) * B;
+    }
+
+    // number of keys in node less than key
+    static int count_less(const KeyType* node, KeyType key) {
+#if defined(__AVX512F__)
+        const __m512i x = _mm512_set1_epi32(key);
+        const __m512i v = _mm512_load_si512((const __m512i*)node);
+
+        return __builtin_popcount(_mm512_cmplt_epi32_mask(v, x));
+#elif defined(__AVX2__)
+        const __m256i x  = _mm256_set1_epi32(key);
+        const __m256i lo = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)node));
+        const __m256i hi = _mm256_cmpgt_epi32(x, _mm256_load_si256((const __m256i*)(node + 8)));
+
+        const uint32_t mask = _mm256_movemask_ps(_mm256_castsi256_ps(lo))
+                            | (_mm256_movemask_ps(_mm256_castsi256_ps(hi)) << 8);
+
+        return __builtin_popcount(mask);
+#else
+        int count = 0;
+        for (int i=0; i < B; i++) {
+            count += (node[i] < key);
+        }
+
+        return count;
+#endif
+    }
+
+    // offsets of layers; the last item is the total number of nodes
+    static std::vector<std::size_t> layout(std::size_t n) {
+        std::vector<std::size_t> result;
+
+        std::size_t total = 0;
+        std::size_t count = (n + B - 1) / B;
+        if (count == 0) {
+            count = 1;
+        }
+
+        while (true) {
+            result.push_back(total);
+            total += count;
+            if (count == 1) {
+                break;
+            }
+
+            count = (count + children - 1) / children;
+        }
+
+        result.push_back(total);
+
+        return result;
+    }
+
+    // Leaves hold the sorted keys (padded with INT_MAX); the i-th key of
+    // an inner node is the maximum key of its i-th child, the maximum of
+    // the last node of a layer is INT_MAX, so a search never leaves tree.
+    void build(const ArrayType& array) {
+
+        const std::size_t leaves = offset[1];
+        for (std::size_t i=0; i < leaves * B; i++) {
+            nodes[i] = (i < n) ? array[i] : INT_MAX;
+        }
+
+        std::vector<KeyType> max(leaves);
+        for (std::size_t j=0; j < leaves; j++) {
+            max[j] = node(0, j)[B - 1];
+        }
+        max.back() = INT_MAX;
+
+        for (std::size_t layer=1; layer + 1 < offset.size(); layer++) {
+            const std::size_t count = offset[layer + 1] - offset[layer];
+            std::vector<KeyType> next(count);
+
+            for (std::size_t j=0; j < count; j++) {
+                KeyType* keys = nodes_at(layer, j);
+                for (int i=0; i < B; i++) {
+                    const std::size_t child = j * children + i;
+                    keys[i] = (child < max.size()) ? max[child] : INT_MAX;
+                }
+
+                const std::size_t last = std::min(j * children + B, max.size() - 1);
+                next[j] = max[last];
+            }
+
+            max.swap(next);
+        }
+    }
+
+    KeyType* nodes_at(std::size_t layer, std::size_t j) {
+        return &nodes[(offset[layer] + j) * B];
+    }
+};
@@ -1,11 +1,15 @@
 #include "scalar.cpp"
 #include "sse.cpp"
 #include "sse.simd-generic.cpp"
+#include "until.scalar.cpp"
+#include "until.sse.cpp"
 #ifdef HAVE_AVX2
 #   include "avx2.cpp"
 #   include "avx2.simd-generic.cpp"
+#   include "until.avx2.cpp"
 #endif // HAVE_AVX2
 #ifdef HAVE_AVX512
 #   include "avx512.cpp"
 #   include "avx512.simd-generic.cpp"
+#   include "until.avx512.cpp"
 #endif // HAVE_AVX512
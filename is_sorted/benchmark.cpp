@@ -4,6 +4,7 @@
 #include <string>
 
 #include <vector>
+#include <algorithm>
 #include "time_utils.h"
 
 #include "all-procedures.cpp"
@@ -71,6 +72,61 @@ public:
         }
     }
 
+    // is_sorted_until: a single violation is placed at the given
+    // fraction of the input, so the early exit gain is visible
+    void run_until() {
+        const double positions[] = {0.01, 0.1, 0.25, 0.5, 1.0};
+
+        for (double position: positions) {
+            const size_t index = size_t(position * (size - 1));
+            const bool violated = (position < 1.0);
+            const int32_t prev = input[index];
+            if (violated) {
+                input[index] = -1;
+            }
+
+            if (csv) {
+                printf("%lu, %d, %0.2f", size, iterations, position);
+            } else {
+                if (violated) {
+                    printf("input size %lu, iterations %d, violation at %lu (%0.0f%%)\n",
+                           size, iterations, index, 100*position);
+                } else {
+                    printf("input size %lu, iterations %d, sorted\n", size, iterations);
+                }
+            }
+
+            has_reference = false;
+
+            measure("std::is_sorted_until",
+                    [this]{return std::is_sorted_until(array, array + size) - array;});
+            measure("scalar",
+                    [this]{return is_sorted_until(array, size);});
+            measure("SSE (is_sorted, unrolled 4 times)",
+                    [this]{return is_sorted_sse_unrolled4(array, size);});
+            measure("SSE (until, chunked)",
+                    [this]{return is_sorted_until_sse(array, size);});
+#ifdef HAVE_AVX2
+            measure("AVX2 (is_sorted, unrolled 4 times)",
+                    [this]{return is_sorted_avx2_unrolled4(array, size);});
+            measure("AVX2 (until, chunked)",
+                    [this]{return is_sorted_until_avx2(array, size);});
+#endif // HAVE_AVX2
+#ifdef HAVE_AVX512
+            measure("AVX512 (is_sorted)",
+                    [this]{return is_sorted_avx512(array, size);});
+            measure("AVX512 (until, chunked)",
+                    [this]{return is_sorted_until_avx512(array, size);});
+#endif // HAVE_AVX512
+
+            if (csv) {
+                putchar('\n');
+            }
+
+            input[index] = prev;
+        }
+    }
+
 private:
     void fill_ascending() {
         input.reserve(size);
@@ -121,18 +177,25 @@ int main(int argc, char* argv[]) {
     }
 
     bool csv = false;
+    bool until = false;
     for (int i=1; i < argc; i++) {
         const std::string arg(argv[i]);
         if ((arg == "csv") || (arg == "--csv")) {
             csv = true;
-            break;
+        }
+        if ((arg == "until") || (arg == "--until")) {
+            until = true;
         }
     }
 
     const int iterations = (tmp > 0) ? tmp : 10;
 
     Benchmark b(size, iterations, csv);
-    b.run_all();
+    if (until) {
+        b.run_until();
+    } else {
+        b.run_all();
+    }
 
     return EXIT_SUCCESS;
 }
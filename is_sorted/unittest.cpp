@@ -1,8 +1,12 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cassert>
+#include <string>
 
 #include <vector>
+#include <algorithm>
+#include <limits>
+#include <type_traits>
 
 #include "all-procedures.cpp"
 
@@ -87,6 +91,166 @@ void Test::test(const char* name, FUNCTION fun) {
 }
 
 
+class TestUntil {
+
+    size_t max_size;
+    bool ok;
+
+public:
+    TestUntil(size_t size_)
+        : max_size(size_)
+        , ok(true) {}
+
+    bool all_ok() const {
+        return ok;
+    }
+
+    template <typename T, typename FUNCTION>
+    void test(const char* name, FUNCTION fun);
+
+private:
+    template <typename T, typename FUNCTION>
+    bool run(FUNCTION fun, SortOrder order, T base);
+
+    template <typename T>
+    static T middle();
+
+    template <typename T>
+    static void fill(std::vector<T>& input, size_t size, SortOrder order, T base);
+
+    template <typename T>
+    static size_t reference(const std::vector<T>& input, size_t size, SortOrder order);
+};
+
+
+// the value where signed and unsigned orders meet: 0x80000000 for uint32_t
+// (the SIMD code flips its sign bit), zero for signed types
+template <typename T>
+T TestUntil::middle() {
+    return std::is_unsigned<T>::value ? T(std::numeric_limits<T>::max()/2 + 1) : T(0);
+}
+
+
+template <typename T>
+void TestUntil::fill(std::vector<T>& input, size_t size, SortOrder order, T base) {
+    // values are kept 10 above base, so unsigned types never wrap
+    input.resize(size);
+    for (size_t i=0; i < size; i++) {
+        switch (order) {
+            case SortOrder::ascending:          input[i] = T(base + 10 + i/2); break;
+            case SortOrder::ascending_strict:   input[i] = T(base + 10 + i); break;
+            case SortOrder::descending:         input[i] = T(base + 10 + (size - i)/2); break;
+            case SortOrder::descending_strict:  input[i] = T(base + 10 + size - i); break;
+        }
+    }
+}
+
+
+template <typename T>
+size_t TestUntil::reference(const std::vector<T>& input, size_t size, SortOrder order) {
+    const auto first = input.begin();
+    const auto last  = input.begin() + size;
+    switch (order) {
+        case SortOrder::ascending:
+            return std::is_sorted_until(first, last) - first;
+        case SortOrder::ascending_strict:
+            return std::is_sorted_until(first, last, std::less_equal<T>()) - first;
+        case SortOrder::descending:
+            return std::is_sorted_until(first, last, std::greater<T>()) - first;
+        case SortOrder::descending_strict:
+        default:
+            return std::is_sorted_until(first, last, std::greater_equal<T>()) - first;
+    }
+}
+
+
+template <typename T, typename FUNCTION>
+bool TestUntil::run(FUNCTION fun, SortOrder order, T base) {
+    std::vector<T> input;
+    for (size_t size=0; size < max_size; size++) {
+        fill(input, size, order, base);
+
+        const size_t expected = reference(input, size, order);
+        const size_t ret = fun(input.data(), size, order);
+        if (ret != expected) {
+            printf("case 1, order = %d, size = %lu, base = %s failed: expected %lu, got %lu\n",
+                   int(order), size, std::to_string(base).c_str(), expected, ret);
+            return false;
+        }
+
+        for (size_t i=0; i < size; i++) {
+            // set a value breaking the order just at the position i, and
+            // then also make the rest of array unsorted
+            const T prev = input[i];
+            const bool asc = (order == SortOrder::ascending || order == SortOrder::ascending_strict);
+            for (int variant=0; variant < 2; variant++) {
+                input[i] = asc ? T(base + 5) : T(base + 10 + 2*size);
+                if (variant == 1) {
+                    input[i] = (i > 0) ? input[i - 1] : prev;
+                }
+
+                const size_t expected = reference(input, size, order);
+                const size_t ret = fun(input.data(), size, order);
+                if (ret != expected) {
+                    printf("case 2, order = %d, size = %lu, base = %s, position = %lu, variant = %d failed: expected %lu, got %lu\n",
+                           int(order), size, std::to_string(base).c_str(), i, variant, expected, ret);
+                    return false;
+                }
+            }
+            input[i] = prev;
+        }
+    }
+
+    return true;
+}
+
+
+template <typename T, typename FUNCTION>
+void TestUntil::test(const char* name, FUNCTION fun) {
+    printf("testing %s", name); fflush(stdout);
+
+    const SortOrder orders[] = {
+        SortOrder::ascending,
+        SortOrder::ascending_strict,
+        SortOrder::descending,
+        SortOrder::descending_strict
+    };
+
+    // small values, and values crossing middle() in arrays longer than max_size/2
+    const T bases[] = {T(0), T(middle<T>() - T(10 + max_size/4))};
+
+    for (SortOrder order: orders) {
+        for (T base: bases) {
+            if (!run<T>(fun, order, base)) {
+                ok = false;
+                return;
+            }
+        }
+    }
+
+    puts(" OK");
+}
+
+
+template <typename T>
+void test_until(TestUntil& test, const char* type) {
+    const std::string suffix = std::string(" [") + type + "]";
+
+    test.test<T>(("until scalar" + suffix).c_str(),
+                 [](const T* a, size_t n, SortOrder order){return is_sorted_until(a, n, order);});
+    test.test<T>(("until SSE" + suffix).c_str(),
+                 [](const T* a, size_t n, SortOrder order){return is_sorted_until_sse(a, n, order);});
+#ifdef HAVE_AVX2
+    test.test<T>(("until AVX2" + suffix).c_str(),
+                 [](const T* a, size_t n, SortOrder order){return is_sorted_until_avx2(a, n, order);});
+#endif // HAVE_AVX2
+#ifdef HAVE_AVX512
+    test.test<T>(("until AVX512" + suffix).c_str(),
+                 [](const T* a, size_t n, SortOrder order){return is_sorted_until_avx512(a, n, order);});
+#endif // HAVE_AVX512
+}
+
+
 int main() {
     Test test(1024);
 
@@ -117,7 +281,14 @@ int main() {
               is_sorted_avx512_generic);
 #endif // HAVE_AVX512
 
-    if (test.all_ok()) {
+    TestUntil test_until_all(200);
+    test_until<int32_t>(test_until_all, "int32_t");
+    test_until<uint32_t>(test_until_all, "uint32_t");
+    test_until<int64_t>(test_until_all, "int64_t");
+    test_until<float>(test_until_all, "float");
+    test_until<double>(test_until_all, "double");
+
+    if (test.all_ok() && test_until_all.all_ok()) {
         puts("All OK");
         return EXIT_SUCCESS;
     } else {
@@ -0,0 +1,102 @@
+#include <immintrin.h>
+
+namespace until_avx2 {
+
+    struct int32 {
+        typedef int32_t type;
+        typedef __m256i vector;
+        static constexpr size_t width = 8;
+        static constexpr uint32_t all_set = 0xff;
+
+        static vector load(const type* ptr) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(a, b)));
+        }
+    };
+
+    struct uint32 {
+        typedef uint32_t type;
+        typedef __m256i vector;
+        static constexpr size_t width = 8;
+        static constexpr uint32_t all_set = 0xff;
+
+        // flipping the sign bit maps the unsigned order onto the signed one
+        static vector load(const type* ptr) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+            return _mm256_xor_si256(v, _mm256_set1_epi32(int32_t(0x80000000)));
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(a, b)));
+        }
+    };
+
+    struct int64 {
+        typedef int64_t type;
+        typedef __m256i vector;
+        static constexpr size_t width = 4;
+        static constexpr uint32_t all_set = 0xf;
+
+        static vector load(const type* ptr) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(a, b)));
+        }
+    };
+
+    struct float32 {
+        typedef float type;
+        typedef __m256 vector;
+        static constexpr size_t width = 8;
+        static constexpr uint32_t all_set = 0xff;
+
+        static vector load(const type* ptr) {
+            return _mm256_loadu_ps(ptr);
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ));
+        }
+    };
+
+    struct float64 {
+        typedef double type;
+        typedef __m256d vector;
+        static constexpr size_t width = 4;
+        static constexpr uint32_t all_set = 0xf;
+
+        static vector load(const type* ptr) {
+            return _mm256_loadu_pd(ptr);
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ));
+        }
+    };
+
+} // namespace until_avx2
+
+size_t is_sorted_until_avx2(const int32_t* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_avx2::int32>(a, n, order);
+}
+
+size_t is_sorted_until_avx2(const uint32_t* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_avx2::uint32>(a, n, order);
+}
+
+size_t is_sorted_until_avx2(const int64_t* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_avx2::int64>(a, n, order);
+}
+
+size_t is_sorted_until_avx2(const float* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_avx2::float32>(a, n, order);
+}
+
+size_t is_sorted_until_avx2(const double* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_avx2::float64>(a, n, order);
+}
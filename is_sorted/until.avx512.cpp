@@ -0,0 +1,103 @@
+#include <immintrin.h>
+
+namespace until_avx512 {
+
+    // AVX512F provides mask comparisons for all types, including unsigned
+    // ones, so no bias tricks are needed here.
+
+    struct int32 {
+        typedef int32_t type;
+        typedef __m512i vector;
+        static constexpr size_t width = 16;
+        static constexpr uint32_t all_set = 0xffff;
+
+        static vector load(const type* ptr) {
+            return _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr));
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm512_cmpgt_epi32_mask(a, b);
+        }
+    };
+
+    struct uint32 {
+        typedef uint32_t type;
+        typedef __m512i vector;
+        static constexpr size_t width = 16;
+        static constexpr uint32_t all_set = 0xffff;
+
+        static vector load(const type* ptr) {
+            return _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr));
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm512_cmpgt_epu32_mask(a, b);
+        }
+    };
+
+    struct int64 {
+        typedef int64_t type;
+        typedef __m512i vector;
+        static constexpr size_t width = 8;
+        static constexpr uint32_t all_set = 0xff;
+
+        static vector load(const type* ptr) {
+            return _mm512_loadu_si512(reinterpret_cast<const __m512i*>(ptr));
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm512_cmpgt_epi64_mask(a, b);
+        }
+    };
+
+    struct float32 {
+        typedef float type;
+        typedef __m512 vector;
+        static constexpr size_t width = 16;
+        static constexpr uint32_t all_set = 0xffff;
+
+        static vector load(const type* ptr) {
+            return _mm512_loadu_ps(ptr);
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+        }
+    };
+
+    struct float64 {
+        typedef double type;
+        typedef __m512d vector;
+        static constexpr size_t width = 8;
+        static constexpr uint32_t all_set = 0xff;
+
+        static vector load(const type* ptr) {
+            return _mm512_loadu_pd(ptr);
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ);
+        }
+    };
+
+} // namespace until_avx512
+
+size_t is_sorted_until_avx512(const int32_t* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_avx512::int32>(a, n, order);
+}
+
+size_t is_sorted_until_avx512(const uint32_t* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_avx512::uint32>(a, n, order);
+}
+
+size_t is_sorted_until_avx512(const int64_t* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_avx512::int64>(a, n, order);
+}
+
+size_t is_sorted_until_avx512(const float* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_avx512::float32>(a, n, order);
+}
+
+size_t is_sorted_until_avx512(const double* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_avx512::float64>(a, n, order);
+}
@@ -0,0 +1,138 @@
+#include <cstddef>
+#include <cstdint>
+
+// is_sorted_until: returns the index of the first element that breaks
+// the order, i.e. the largest k such that a[0..k) is sorted; returns n
+// if the whole array is sorted (the same contract as std::is_sorted_until).
+
+enum class SortOrder {
+    ascending,          // a[i] <= a[i + 1]
+    ascending_strict,   // a[i] <  a[i + 1]
+    descending,         // a[i] >= a[i + 1]
+    descending_strict   // a[i] >  a[i + 1]
+};
+
+// All orders are expressed with the greater-than relation only, as
+// this is the only comparison available for integers in SSE/AVX2.
+// For floating point this also defines the NaN handling: a NaN never
+// breaks the non-strict orders and always breaks the strict ones.
+template <SortOrder order, typename T>
+bool order_violated(T curr, T next) {
+    switch (order) {
+        case SortOrder::ascending:
+            return curr > next;
+        case SortOrder::ascending_strict:
+            return !(next > curr);
+        case SortOrder::descending:
+            return next > curr;
+        case SortOrder::descending_strict:
+        default:
+            return !(curr > next);
+    }
+}
+
+template <SortOrder order, typename T>
+size_t is_sorted_until_scalar(const T* a, size_t i, size_t n) {
+    for (/**/; i + 1 < n; i++) {
+        if (order_violated<order>(a[i], a[i + 1]))
+            return i + 1;
+    }
+
+    return n;
+}
+
+template <typename T>
+size_t is_sorted_until(const T* a, size_t n, SortOrder order = SortOrder::ascending) {
+    switch (order) {
+        case SortOrder::ascending:
+            return is_sorted_until_scalar<SortOrder::ascending>(a, 0, n);
+        case SortOrder::ascending_strict:
+            return is_sorted_until_scalar<SortOrder::ascending_strict>(a, 0, n);
+        case SortOrder::descending:
+            return is_sorted_until_scalar<SortOrder::descending>(a, 0, n);
+        case SortOrder::descending_strict:
+        default:
+            return is_sorted_until_scalar<SortOrder::descending_strict>(a, 0, n);
+    }
+}
+
+// Generic SIMD skeleton, parametrized by ISA-specific traits:
+//
+//  - type     - element type,
+//  - vector   - SIMD register type,
+//  - width    - number of elements in vector,
+//  - all_set  - bitmask with `width` lowest bits set,
+//  - load(ptr)  - unaligned load,
+//  - gt(a, b)   - bitmask of lanes where a > b (bit k for lane k).
+//
+// The array is processed in chunks of four registers (like the
+// unrolled variants). Masks from the whole chunk are or-ed and examined
+// once, so the loop exits as soon as the chunk containing the first
+// violation is reached; only then the exact position is determined.
+template <typename ISA, SortOrder order>
+uint32_t simd_violation_mask(const typename ISA::vector& curr, const typename ISA::vector& next) {
+    switch (order) {
+        case SortOrder::ascending:
+            return ISA::gt(curr, next);
+        case SortOrder::ascending_strict:
+            return ISA::gt(next, curr) ^ ISA::all_set;
+        case SortOrder::descending:
+            return ISA::gt(next, curr);
+        case SortOrder::descending_strict:
+        default:
+            return ISA::gt(curr, next) ^ ISA::all_set;
+    }
+}
+
+template <typename ISA, SortOrder order>
+size_t is_sorted_until_chunked(const typename ISA::type* a, size_t n) {
+
+    typedef typename ISA::vector vector;
+    const size_t W = ISA::width;
+
+    size_t i = 0;
+    if (n > 4*W) {
+        for (/**/; i < n - 4*W; i += 4*W) {
+            const vector curr0 = ISA::load(a + i + 0*W);
+            const vector curr1 = ISA::load(a + i + 1*W);
+            const vector curr2 = ISA::load(a + i + 2*W);
+            const vector curr3 = ISA::load(a + i + 3*W);
+            const vector next0 = ISA::load(a + i + 0*W + 1);
+            const vector next1 = ISA::load(a + i + 1*W + 1);
+            const vector next2 = ISA::load(a + i + 2*W + 1);
+            const vector next3 = ISA::load(a + i + 3*W + 1);
+
+            const uint32_t mask0 = simd_violation_mask<ISA, order>(curr0, next0);
+            const uint32_t mask1 = simd_violation_mask<ISA, order>(curr1, next1);
+            const uint32_t mask2 = simd_violation_mask<ISA, order>(curr2, next2);
+            const uint32_t mask3 = simd_violation_mask<ISA, order>(curr3, next3);
+
+            if ((mask0 | mask1 | mask2 | mask3) != 0) {
+                // the chunk is 4*W elements, thus the combined mask fits in 64 bits
+                const uint64_t mask = uint64_t(mask0)
+                                    | (uint64_t(mask1) << (1*W))
+                                    | (uint64_t(mask2) << (2*W))
+                                    | (uint64_t(mask3) << (3*W));
+
+                return i + __builtin_ctzll(mask) + 1;
+            }
+        }
+    }
+
+    return is_sorted_until_scalar<order>(a, i, n);
+}
+
+template <typename ISA>
+size_t is_sorted_until_dispatch(const typename ISA::type* a, size_t n, SortOrder order) {
+    switch (order) {
+        case SortOrder::ascending:
+            return is_sorted_until_chunked<ISA, SortOrder::ascending>(a, n);
+        case SortOrder::ascending_strict:
+            return is_sorted_until_chunked<ISA, SortOrder::ascending_strict>(a, n);
+        case SortOrder::descending:
+            return is_sorted_until_chunked<ISA, SortOrder::descending>(a, n);
+        case SortOrder::descending_strict:
+        default:
+            return is_sorted_until_chunked<ISA, SortOrder::descending_strict>(a, n);
+    }
+}
@@ -0,0 +1,102 @@
+#include <immintrin.h>
+
+namespace until_sse {
+
+    struct int32 {
+        typedef int32_t type;
+        typedef __m128i vector;
+        static constexpr size_t width = 4;
+        static constexpr uint32_t all_set = 0xf;
+
+        static vector load(const type* ptr) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(a, b)));
+        }
+    };
+
+    struct uint32 {
+        typedef uint32_t type;
+        typedef __m128i vector;
+        static constexpr size_t width = 4;
+        static constexpr uint32_t all_set = 0xf;
+
+        // flipping the sign bit maps the unsigned order onto the signed one
+        static vector load(const type* ptr) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+            return _mm_xor_si128(v, _mm_set1_epi32(int32_t(0x80000000)));
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(a, b)));
+        }
+    };
+
+    struct int64 {
+        typedef int64_t type;
+        typedef __m128i vector;
+        static constexpr size_t width = 2;
+        static constexpr uint32_t all_set = 0x3;
+
+        static vector load(const type* ptr) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(a, b)));
+        }
+    };
+
+    struct float32 {
+        typedef float type;
+        typedef __m128 vector;
+        static constexpr size_t width = 4;
+        static constexpr uint32_t all_set = 0xf;
+
+        static vector load(const type* ptr) {
+            return _mm_loadu_ps(ptr);
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm_movemask_ps(_mm_cmpgt_ps(a, b));
+        }
+    };
+
+    struct float64 {
+        typedef double type;
+        typedef __m128d vector;
+        static constexpr size_t width = 2;
+        static constexpr uint32_t all_set = 0x3;
+
+        static vector load(const type* ptr) {
+            return _mm_loadu_pd(ptr);
+        }
+
+        static uint32_t gt(const vector& a, const vector& b) {
+            return _mm_movemask_pd(_mm_cmpgt_pd(a, b));
+        }
+    };
+
+} // namespace until_sse
+
+size_t is_sorted_until_sse(const int32_t* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_sse::int32>(a, n, order);
+}
+
+size_t is_sorted_until_sse(const uint32_t* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_sse::uint32>(a, n, order);
+}
+
+size_t is_sorted_until_sse(const int64_t* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_sse::int64>(a, n, order);
+}
+
+size_t is_sorted_until_sse(const float* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_sse::float32>(a, n, order);
+}
+
+size_t is_sorted_until_sse(const double* a, size_t n, SortOrder order = SortOrder::ascending) {
+    return is_sorted_until_dispatch<until_sse::float64>(a, n, order);
+}
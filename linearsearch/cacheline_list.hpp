@@ -0,0 +1,284 @@
+#ifndef CACHELINE_LIST_HPP_INCLUDED__
+#define CACHELINE_LIST_HPP_INCLUDED__
+
+#include <cstdint>
+#include <new>
+#include <immintrin.h>
+
+#include "node_pool.hpp"
+
+// Linked arrays, like block_list, but:
+//
+// - a node is aligned to a cache line and contains only keys; values are
+//   stored in a separate block, thus searching touches only the keys,
+// - nodes and value blocks come from pools, not from the global new,
+// - keys are probed with AVX-512 (16 keys at once), AVX2 (8 keys) or SSE2
+//   (4 keys), depending on the target;
+// - items can be removed; the hole is filled with the last item of the
+//   list, so all nodes except the last one are always full.
+//
+// Keys are not checked for uniqueness by add(). Count must be 8, 16, 32 or 64.
+template <typename Value, int Count>
+class cacheline_list {
+
+    static_assert(Count == 8 || Count == 16 || Count == 32 || Count == 64, "Count must be 8, 16, 32 or 64");
+
+    struct value_block {
+        Value values[Count];
+    };
+
+    struct alignas(64) key_block {
+        uint32_t     keys[Count];
+        value_block* block;
+        key_block*   next;
+        key_block*   prev;
+        uint64_t     valid; // bit i set if keys[i] is used
+        int          count;
+    };
+
+    key_block* root;
+    key_block* last;
+    std::size_t items;
+
+    node_pool<key_block>   key_pool;
+    node_pool<value_block> value_pool;
+
+public:
+    cacheline_list()
+        : root(nullptr)
+        , last(nullptr)
+        , items(0) {}
+
+    ~cacheline_list() {
+        for (auto node = root; node != nullptr; node = node->next) {
+            node->block->~value_block();
+        }
+        // memory is returned by pools
+    }
+
+    cacheline_list(const cacheline_list&) = delete;
+    cacheline_list& operator=(const cacheline_list&) = delete;
+
+public:
+    void add(uint32_t key, const Value& value) {
+
+        if (last == nullptr || last->count == Count) {
+            append_node();
+        }
+
+        last->keys[last->count] = key;
+        last->block->values[last->count] = value;
+
+        last->valid |= uint64_t(1) << last->count;
+        last->count += 1;
+        items += 1;
+    }
+
+
+    // position of the key in the iteration order, -1 if not found
+    int find(uint32_t key) const {
+
+        int result = 0;
+        for (auto node = root; node != nullptr; node = node->next) {
+            const auto mask = probe(node, key);
+            if (mask != 0) {
+                return result + __builtin_ctzll(mask);
+            }
+
+            result += Count;
+        }
+
+        return -1;
+    }
+
+
+    Value* lookup(uint32_t key) {
+
+        key_block* node;
+        int index;
+        if (locate(key, node, index)) {
+            return &node->block->values[index];
+        }
+
+        return nullptr;
+    }
+
+
+    bool remove(uint32_t key) {
+
+        key_block* node;
+        int index;
+        if (!locate(key, node, index)) {
+            return false;
+        }
+
+        // move the last item into the hole
+        const int tail = last->count - 1;
+        node->keys[index] = last->keys[tail];
+        node->block->values[index] = last->block->values[tail];
+
+        last->count -= 1;
+        last->valid &= ~(uint64_t(1) << last->count);
+        items -= 1;
+
+        if (last->count == 0) {
+            remove_last_node();
+        }
+
+        return true;
+    }
+
+
+    std::size_t size() const {
+        return items;
+    }
+
+
+    bool empty() const {
+        return items == 0;
+    }
+
+public:
+    struct entry {
+        const uint32_t key;
+        Value&         value;
+    };
+
+    class iterator {
+        key_block* node;
+        int index;
+
+        friend class cacheline_list;
+
+        iterator(key_block* node, int index)
+            : node(node)
+            , index(index) {}
+
+    public:
+        entry operator*() const {
+            return entry{node->keys[index], node->block->values[index]};
+        }
+
+        iterator& operator++() {
+            index += 1;
+            if (index == node->count) {
+                node  = node->next;
+                index = 0;
+            }
+
+            return *this;
+        }
+
+        bool operator==(const iterator& it) const {
+            return node == it.node && index == it.index;
+        }
+
+        bool operator!=(const iterator& it) const {
+            return !(*this == it);
+        }
+    };
+
+    // removing an item invalidates iterators
+    iterator begin() {
+        return iterator(root, 0);
+    }
+
+    iterator end() {
+        return iterator(nullptr, 0);
+    }
+
+private:
+    void append_node() {
+
+        auto node = new (key_pool.allocate()) key_block;
+        node->block = new (value_pool.allocate()) value_block;
+        node->next  = nullptr;
+        node->prev  = last;
+        node->valid = 0;
+        node->count = 0;
+
+        if (last == nullptr) {
+            root = last = node;
+        } else {
+            last->next = node;
+            last = node;
+        }
+    }
+
+
+    void remove_last_node() {
+
+        auto node = last;
+
+        last = node->prev;
+        if (last == nullptr) {
+            root = nullptr;
+        } else {
+            last->next = nullptr;
+        }
+
+        node->block->~value_block();
+        value_pool.release(node->block);
+        key_pool.release(node);
+    }
+
+
+    bool locate(uint32_t key, key_block*& node, int& index) const {
+
+        for (node = root; node != nullptr; node = node->next) {
+            const auto mask = probe(node, key);
+            if (mask != 0) {
+                index = __builtin_ctzll(mask);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    // bit i is set if keys[i] == key, only valid items are considered;
+    // the mask is stored in node, a branch on count was visibly slower
+    static uint64_t probe(const key_block* node, uint32_t key) {
+
+        return compare(node->keys, key) & node->valid;
+    }
+
+
+    static uint64_t compare(const uint32_t* keys, uint32_t key) {
+
+        uint64_t mask = 0;
+#if defined(__AVX512F__)
+        if (Count >= 16) {
+            const __m512i k = _mm512_set1_epi32(key);
+            for (int i=0; i < Count; i += 16) {
+                const __m512i v = _mm512_load_si512((const __m512i*)&keys[i]);
+
+                mask |= uint64_t(_mm512_cmpeq_epi32_mask(v, k)) << i;
+            }
+
+            return mask;
+        }
+#endif
+#if defined(__AVX2__)
+        const __m256i k = _mm256_set1_epi32(key);
+        for (int i=0; i < Count; i += 8) {
+            const __m256i v  = _mm256_load_si256((const __m256i*)&keys[i]);
+            const __m256i eq = _mm256_cmpeq_epi32(v, k);
+
+            mask |= uint64_t(_mm256_movemask_ps(_mm256_castsi256_ps(eq))) << i;
+        }
+#else
+        const __m128i k = _mm_set1_epi32(key);
+        for (int i=0; i < Count; i += 4) {
+            const __m128i v  = _mm_load_si128((const __m128i*)&keys[i]);
+            const __m128i eq = _mm_cmpeq_epi32(v, k);
+
+            mask |= uint64_t(_mm_movemask_ps(_mm_castsi128_ps(eq))) << i;
+        }
+#endif
+        return mask;
+    }
+};
+
+#endif
@@ -1,15 +1,35 @@
 #include <cstdio>
+#include <cstdlib>
 #include <cassert>
 
 #include <string>
+#include <unordered_map>
 #include <sys/time.h>
 
 #include "simple_list.hpp"
 #include "simd_list.hpp"
+#include "cacheline_list.hpp"
 #include "arglist.hpp"
 #include "measure.hpp"
 
 
+// std::unordered_map with the interface of lists
+template <typename Value>
+class unordered_map_list {
+
+    std::unordered_map<uint32_t, Value> map;
+
+public:
+    void add(uint32_t key, const Value& value) {
+        map.emplace(key, value);
+    }
+
+    int find(uint32_t key) const {
+        return map.count(key) ? 0 : -1;
+    }
+};
+
+
 template <typename T>
 void generate(int n, T& collection) {
     for (int i=0; i < n; i++) {
@@ -35,8 +55,10 @@ int find_all(int n, T& collection) {
 }
 
 
+// searches are repeated `rounds` times in a single measurement, so that
+// timings for small collections are measurable
 template <typename Collection>
-int run(Object& m, const std::size_t count, const std::size_t tries) {
+int run(Object& m, const std::size_t count, const std::size_t tries, const std::size_t rounds = 1) {
     m.add("construction");
     m.add("search");
 
@@ -59,7 +81,9 @@ int run(Object& m, const std::size_t count, const std::size_t tries) {
     for (std::size_t i=0; i < tries; i++) {
         auto c = scoped_timer<Timer>(m["search"]);
 
-        result += find_all(count, list);
+        for (std::size_t r=0; r < rounds; r++) {
+            result += find_all(count, list);
+        }
 
         std::putchar('.');
         std::fflush(stdout);
@@ -70,6 +94,73 @@ int run(Object& m, const std::size_t count, const std::size_t tries) {
 }
 
 
+// cacheline_list compared with std::unordered_map after random
+// insertions and removals
+template <int Count>
+bool verify() {
+
+    std::printf("cacheline_list<int, %d>... ", Count);
+    std::fflush(stdout);
+
+    cacheline_list<int, Count> list;
+    std::unordered_map<uint32_t, int> reference;
+
+    srand(Count);
+    for (int i=0; i < 100000; i++) {
+        const uint32_t key = rand() % 1000;
+        if (rand() % 3 == 0) {
+            if (list.remove(key) != (reference.erase(key) == 1)) {
+                std::puts("wrong result of remove");
+                return false;
+            }
+        } else if (reference.count(key) == 0) {
+            list.add(key, i);
+            reference[key] = i;
+        }
+
+        if (list.size() != reference.size()) {
+            std::puts("wrong size");
+            return false;
+        }
+    }
+
+    std::size_t visited = 0;
+    for (auto item: list) {
+        const auto it = reference.find(item.key);
+        if (it == reference.end() || it->second != item.value) {
+            std::printf("wrong item %u\n", item.key);
+            return false;
+        }
+
+        item.value += 1; // values are mutable
+        visited += 1;
+    }
+
+    if (visited != reference.size()) {
+        std::puts("wrong number of items visited");
+        return false;
+    }
+
+    for (uint32_t key=0; key < 1000; key++) {
+        const auto it = reference.find(key);
+        const int* value = list.lookup(key);
+        const int position = list.find(key);
+        if (it == reference.end()) {
+            if (value != nullptr || position != -1) {
+                std::printf("key %u should not be found\n", key);
+                return false;
+            }
+        } else if (value == nullptr || *value != it->second + 1 || position < 0) {
+            std::printf("key %u not found\n", key);
+            return false;
+        }
+    }
+
+    std::puts("OK");
+    return true;
+}
+
+
 void usage() {
     std::puts("usage: program [options]");
     std::puts("");
@@ -79,7 +170,14 @@ void usage() {
     std::puts("    --array8   measure time of linked arrays of size 8");
     std::puts("    --simd4    like --array4 but searched by SIMD code");
     std::puts("    --simd8    like --array8 but searched by SIMD code");
+    std::puts("    --cl8, --cl16, --cl32, --cl64");
+    std::puts("               cache-line aligned linked arrays of given size,");
+    std::puts("               with separate value blocks and pooled nodes");
+    std::puts("    --unordered");
+    std::puts("               measure time of std::unordered_map");
     std::puts("    --all      measure time of all structures");
+    std::puts("    --small    use small collections (64 items), searched many times");
+    std::puts("    --verify   check cacheline_list (find, remove, iteration)");
     std::puts("    --help/-h  show this help");
 }
 
@@ -89,8 +187,10 @@ int main(int argc, char* argv[]) {
     arglist args(argc, argv);
     Measure measure;
 
-    const auto count = 20000;
-    const auto tries = 5;
+    const bool small = args("--small");
+    const std::size_t count  = small ? 64 : 20000;
+    const std::size_t tries  = 5;
+    const std::size_t rounds = small ? 4 * (20000 * 20000) / (count * count) : 1;
 
     volatile int total = 0;
 
@@ -99,29 +199,60 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
+    if (args("--verify")) {
+        const bool ok = verify<8>() && verify<16>() && verify<32>() && verify<64>();
+        std::puts(ok ? "All OK" : "FAILED");
+        return ok ? 0 : 1;
+    }
+
     if (args("--all") || args("--simple")) {
         typedef simple_list<int> list_type;
-        total += run<list_type>(measure.add("list"), count, tries);
+        total += run<list_type>(measure.add("list"), count, tries, rounds);
     }
 
     if (args("--all") || args("--array4")) {
         typedef block_list<int, 4> list_type;
-        total += run<list_type>(measure.add("array list (4)"), count, tries);
+        total += run<list_type>(measure.add("array list (4)"), count, tries, rounds);
     }
 
     if (args("--all") || args("--array8")) {
         typedef block_list<int, 8> list_type;
-        total += run<list_type>(measure.add("array list (8)"), count, tries);
+        total += run<list_type>(measure.add("array list (8)"), count, tries, rounds);
     }
 
     if (args("--all") || args("--simd4")) {
         typedef simd_list<int> list_type;
-        total += run<list_type>(measure.add("SIMD array list (4)"), count, tries);
+        total += run<list_type>(measure.add("SIMD array list (4)"), count, tries, rounds);
     }
 
     if (args("--all") || args("--simd8")) {
         typedef simd2_list<int> list_type;
-        total += run<list_type>(measure.add("SIMD array list (8)"), count, tries);
+        total += run<list_type>(measure.add("SIMD array list (8)"), count, tries, rounds);
+    }
+
+    if (args("--all") || args("--cl8")) {
+        typedef cacheline_list<int, 8> list_type;
+        total += run<list_type>(measure.add("cache-line array list (8)"), count, tries, rounds);
+    }
+
+    if (args("--all") || args("--cl16")) {
+        typedef cacheline_list<int, 16> list_type;
+        total += run<list_type>(measure.add("cache-line array list (16)"), count, tries, rounds);
+    }
+
+    if (args("--all") || args("--cl32")) {
+        typedef cacheline_list<int, 32> list_type;
+        total += run<list_type>(measure.add("cache-line array list (32)"), count, tries, rounds);
+    }
+
+    if (args("--all") || args("--cl64")) {
+        typedef cacheline_list<int, 64> list_type;
+        total += run<list_type>(measure.add("cache-line array list (64)"), count, tries, rounds);
+    }
+
+    if (args("--all") || args("--unordered")) {
+        typedef unordered_map_list<int> list_type;
+        total += run<list_type>(measure.add("std::unordered_map"), count, tries, rounds);
     }
 
     if (measure.has("list")) {
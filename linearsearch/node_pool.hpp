@@ -0,0 +1,95 @@
+#ifndef NODE_POOL_HPP_INCLUDED__
+#define NODE_POOL_HPP_INCLUDED__
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// Fixed-size object pool. Memory is taken from the system in chunks aligned
+// to a cache line (chunk sizes grow geometrically), released objects go to
+// a free list and are reused first. Pool doesn't construct objects, it
+// only hands raw, suitably aligned memory.
+template <typename T, std::size_t Alignment = 64>
+class node_pool {
+
+    static_assert(sizeof(T) >= sizeof(void*), "object must be able to hold a free list pointer");
+    static_assert(Alignment % alignof(T) == 0, "pool alignment must be a multiple of object alignment");
+
+    struct free_item {
+        free_item* next;
+    };
+
+    std::vector<void*> chunks;
+    free_item* free_list;
+
+    char* current;          // unused part of the last chunk
+    std::size_t available;  // ... and number of objects in it
+    std::size_t chunk_size;
+
+    static const std::size_t max_chunk_size = 1024;
+
+public:
+    node_pool()
+        : free_list(nullptr)
+        , current(nullptr)
+        , available(0)
+        , chunk_size(4) {}
+
+    ~node_pool() {
+        for (auto chunk: chunks) {
+            free(chunk);
+        }
+    }
+
+    node_pool(const node_pool&) = delete;
+    node_pool& operator=(const node_pool&) = delete;
+
+public:
+    void* allocate() {
+
+        if (free_list != nullptr) {
+            auto item = free_list;
+            free_list = item->next;
+
+            return item;
+        }
+
+        if (available == 0) {
+            grow();
+        }
+
+        auto result = current;
+        current   += sizeof(T);
+        available -= 1;
+
+        return result;
+    }
+
+
+    void release(void* ptr) {
+
+        auto item = static_cast<free_item*>(ptr);
+        item->next = free_list;
+        free_list  = item;
+    }
+
+private:
+    void grow() {
+
+        void* chunk = nullptr;
+        if (posix_memalign(&chunk, Alignment, chunk_size * sizeof(T)) != 0) {
+            throw std::bad_alloc();
+        }
+
+        chunks.push_back(chunk);
+        current   = static_cast<char*>(chunk);
+        available = chunk_size;
+
+        if (chunk_size < max_chunk_size) {
+            chunk_size *= 2;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,518 @@
+/*
+	Netpbm reader/writer, see netpbm.h
+
+	Author: Wojciech Muła
+	License: BSD
+*/
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "netpbm.h"
+
+#include "../pixconv16bpp-32bpp/pixconv_scalar.c"
+#include "../pixconv16bpp-32bpp/pixconv_ssse3.c"
+#include "../pixconv16bpp-32bpp/pixconv_avx2.c"
+#include "../pixconv16bpp-32bpp/pixconv_avx512.c"
+#include "../pixconv16bpp-32bpp/pixconv_lib.c"
+#include "netpbm_bits.c"
+
+
+const char* netpbm_errormsg[] = {
+	"no error",
+	"can't open file",
+	"can't map file",
+	"not a binary netpbm file (P4, P5 or P6)",
+	"malformed header",
+	"maxval not in range 1..255",
+	"file is truncated",
+	"out of memory",
+	"write error",
+	"invalid argument"
+};
+
+
+//=== kernels =============================================================
+
+static const netpbm_bits_function netpbm_bits_kernels[] = {
+	scalar_expand_bits,
+#if defined(__SSSE3__)
+	ssse3_expand_bits,
+#endif
+#if defined(__AVX2__)
+	avx2_expand_bits,
+#endif
+#if defined(__AVX512BW__)
+	avx512_expand_bits,
+#endif
+};
+
+
+// pixconv_kernels[i] and netpbm_bits_kernels[i] use the same instruction set
+static size_t netpbm_kernels_index = PIXCONV_KERNELS - 1;
+
+
+int netpbm_select_kernels(const char* name) {
+	if (name == NULL) {
+		netpbm_kernels_index = PIXCONV_KERNELS - 1;
+		return NETPBM_OK;
+	}
+
+	for (size_t i=0; i < PIXCONV_KERNELS; i++) {
+		if (strcasecmp(name, pixconv_kernels[i].name) == 0) {
+			netpbm_kernels_index = i;
+			return NETPBM_OK;
+		}
+	}
+
+	return NETPBM_ERR_ARGUMENT;
+}
+
+
+const char* netpbm_kernels_name(void) {
+	return pixconv_kernels[netpbm_kernels_index].name;
+}
+
+
+void netpbm_expand_bits(uint8_t* dst, const uint8_t* src, size_t width) {
+	netpbm_bits_kernels[netpbm_kernels_index](dst, src, width);
+}
+
+
+//=== reading =============================================================
+
+static const uint8_t* skip_whitespace(const uint8_t* p, const uint8_t* end) {
+	while (p < end) {
+		if (*p == '#') {
+			while (p < end && *p != '\n' && *p != '\r')
+				p++;
+		} else if (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' || *p == '\v' || *p == '\f')
+			p++;
+		else
+			break;
+	}
+
+	return p;
+}
+
+
+static const uint8_t* parse_number(const uint8_t* p, const uint8_t* end, int* value) {
+	p = skip_whitespace(p, end);
+	if (p == end || *p < '0' || *p > '9')
+		return NULL;
+
+	long v = 0;
+	while (p < end && *p >= '0' && *p <= '9') {
+		v = 10*v + (*p - '0');
+		if (v > 0x7fffffff / 8)
+			return NULL;
+		p++;
+	}
+
+	*value = (int)v;
+	return p;
+}
+
+
+static size_t row_bytes(NetpbmFormat format, int width) {
+	switch (format) {
+		case NETPBM_P4: return ((size_t)width + 7) / 8;
+		case NETPBM_P5: return (size_t)width;
+		case NETPBM_P6: return 3 * (size_t)width;
+	}
+
+	return 0;
+}
+
+
+int netpbm_parse(NetpbmFile* f, const void* data, size_t size) {
+	const uint8_t* p   = (const uint8_t*)data;
+	const uint8_t* end = p + size;
+
+	memset(f, 0, sizeof(*f));
+
+	if (size < 2 || p[0] != 'P' || p[1] < '4' || p[1] > '6')
+		return NETPBM_ERR_FORMAT;
+
+	const NetpbmFormat format = (NetpbmFormat)(p[1] - '0');
+	p += 2;
+
+	int width, height, maxval = 1;
+	p = parse_number(p, end, &width);
+	if (p) p = parse_number(p, end, &height);
+	if (p && format != NETPBM_P4) p = parse_number(p, end, &maxval);
+	if (p == NULL || p == end || width <= 0 || height <= 0)
+		return NETPBM_ERR_HEADER;
+
+	// exactly one whitespace separates header and pixels
+	if (*p != ' ' && *p != '\t' && *p != '\n' && *p != '\r')
+		return NETPBM_ERR_HEADER;
+	p++;
+
+	if (maxval < 1 || maxval > 255)
+		return NETPBM_ERR_MAXVAL;
+
+	const size_t stride = row_bytes(format, width);
+	if ((size_t)(end - p) / stride < (size_t)height)
+		return NETPBM_ERR_TRUNCATED;
+
+	f->pixels.data   = p;
+	f->pixels.stride = stride;
+	f->pixels.width  = width;
+	f->pixels.height = height;
+	f->pixels.maxval = maxval;
+	f->pixels.format = format;
+	return NETPBM_OK;
+}
+
+
+int netpbm_open(NetpbmFile* f, const char* path) {
+	memset(f, 0, sizeof(*f));
+
+	const int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return NETPBM_ERR_OPEN;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		return NETPBM_ERR_OPEN;
+	}
+
+	if (st.st_size == 0) {
+		close(fd);
+		return NETPBM_ERR_FORMAT;
+	}
+
+	const size_t size = (size_t)st.st_size;
+	void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return NETPBM_ERR_MMAP;
+
+	posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+
+	const int result = netpbm_parse(f, map, size);
+	if (result != NETPBM_OK) {
+		munmap(map, size);
+		return result;
+	}
+
+	f->map      = map;
+	f->map_size = size;
+	return NETPBM_OK;
+}
+
+
+void netpbm_close(NetpbmFile* f) {
+	if (f->map)
+		munmap(f->map, f->map_size);
+
+	memset(f, 0, sizeof(*f));
+}
+
+
+int netpbm_subview(NetpbmView* sub, const NetpbmView* view, int x, int y, int width, int height) {
+	if (x < 0 || y < 0 || width <= 0 || height <= 0
+	    || x + width > view->width || y + height > view->height
+	    || (view->format == NETPBM_P4 && x % 8 != 0))
+		return NETPBM_ERR_ARGUMENT;
+
+	*sub = *view;
+	sub->data   = view->data + (size_t)y * view->stride + row_bytes(view->format, x);
+	sub->width  = width;
+	sub->height = height;
+	return NETPBM_OK;
+}
+
+
+//=== conversions =========================================================
+
+size_t netpbm_bytes_per_pixel(NetpbmPixel format) {
+	switch (format) {
+		case NETPBM_GRAY8:    return 1;
+		case NETPBM_RGBA8888: return 4;
+		case NETPBM_BGRA8888: return 4;
+		case NETPBM_RGB565:   return 2;
+	}
+
+	return 0;
+}
+
+
+static void gray_to_rgba(uint32_t* dst, const uint8_t* src, size_t n) {
+	for (size_t i=0; i < n; i++)
+		dst[i] = 0xff000000u | (0x010101u * src[i]);
+}
+
+
+// ITU-R BT.601 luma
+static void rgb_to_gray(uint8_t* dst, const uint8_t* src, size_t n) {
+	for (size_t i=0; i < n; i++)
+		dst[i] = (77 * src[3*i + 0] + 150 * src[3*i + 1] + 29 * src[3*i + 2] + 128) >> 8;
+}
+
+
+// v * 255/maxval rounded; samples greater than maxval are invalid, they become 255
+static void scale_table(uint8_t* table, int maxval) {
+	for (int v=0; v < 256; v++)
+		table[v] = (v >= maxval) ? 255 : (uint8_t)((v * 255 + maxval / 2) / maxval);
+}
+
+
+static void scale_samples(uint8_t* dst, const uint8_t* src, size_t n, const uint8_t* table) {
+	for (size_t i=0; i < n; i++)
+		dst[i] = table[src[i]];
+}
+
+
+int netpbm_convert(const NetpbmView* view, NetpbmPixel format, void* dst, size_t dst_stride) {
+	const PixconvKernels* k = &pixconv_kernels[netpbm_kernels_index];
+	const size_t width = view->width;
+	const int scale = (view->format != NETPBM_P4 && view->maxval != 255);
+
+	// P4 is expanded to gray rows, RGB565 is packed from RGBA rows,
+	// samples are scaled to a copy of row
+	uint8_t*  gray = NULL;
+	uint32_t* rgba = NULL;
+	uint8_t*  scaled = NULL;
+	if (view->format == NETPBM_P4 && format != NETPBM_GRAY8)
+		gray = (uint8_t*)malloc(width);
+	if (format == NETPBM_RGB565)
+		rgba = (uint32_t*)malloc(4 * width);
+	if (scale)
+		scaled = (uint8_t*)malloc(row_bytes(view->format, width));
+
+	if ((view->format == NETPBM_P4 && format != NETPBM_GRAY8 && gray == NULL)
+	    || (format == NETPBM_RGB565 && rgba == NULL)
+	    || (scale && scaled == NULL)) {
+		free(gray);
+		free(rgba);
+		free(scaled);
+		return NETPBM_ERR_MEMORY;
+	}
+
+	uint8_t table[256];
+	if (scale)
+		scale_table(table, view->maxval);
+
+	for (int y=0; y < view->height; y++) {
+		const uint8_t* src = view->data + (size_t)y * view->stride;
+		uint8_t* out = (uint8_t*)dst + (size_t)y * dst_stride;
+
+		if (scale) {
+			scale_samples(scaled, src, row_bytes(view->format, width), table);
+			src = scaled;
+		}
+
+		if (format == NETPBM_GRAY8) {
+			switch (view->format) {
+				case NETPBM_P4: netpbm_expand_bits(out, src, width); break;
+				case NETPBM_P5: memcpy(out, src, width); break;
+				case NETPBM_P6: rgb_to_gray(out, src, width); break;
+			}
+			continue;
+		}
+
+		if (view->format == NETPBM_P4) {
+			netpbm_expand_bits(gray, src, width);
+			src = gray;
+		}
+
+		uint32_t* row = (format == NETPBM_RGB565) ? rgba : (uint32_t*)out;
+		if (view->format == NETPBM_P6)
+			k->rgb888_to_rgba(row, src, width);
+		else
+			gray_to_rgba(row, src, width);
+
+		if (format == NETPBM_BGRA8888 && view->format == NETPBM_P6)
+			k->swap_rb(row, row, width);
+		else if (format == NETPBM_RGB565)
+			k->rgba_to_rgb565(out, row, width);
+	}
+
+	free(gray);
+	free(rgba);
+	free(scaled);
+	return NETPBM_OK;
+}
+
+
+int netpbm_load(const char* path, NetpbmPixel format, size_t align, NetpbmImage* img) {
+	memset(img, 0, sizeof(*img));
+	if (align < sizeof(void*) || (align & (align - 1)) != 0)
+		return NETPBM_ERR_ARGUMENT;
+
+	NetpbmFile f;
+	int result = netpbm_open(&f, path);
+	if (result != NETPBM_OK)
+		return result;
+
+	const size_t stride = (f.pixels.width * netpbm_bytes_per_pixel(format) + align - 1) & ~(align - 1);
+	void* data;
+	if (posix_memalign(&data, align, stride * f.pixels.height) != 0) {
+		netpbm_close(&f);
+		return NETPBM_ERR_MEMORY;
+	}
+
+	result = netpbm_convert(&f.pixels, format, data, stride);
+	if (result != NETPBM_OK) {
+		free(data);
+		netpbm_close(&f);
+		return result;
+	}
+
+	img->data   = (uint8_t*)data;
+	img->stride = stride;
+	img->width  = f.pixels.width;
+	img->height = f.pixels.height;
+	img->maxval = f.pixels.maxval;
+	img->format = format;
+
+	netpbm_close(&f);
+	return NETPBM_OK;
+}
+
+
+void netpbm_image_free(NetpbmImage* img) {
+	free(img->data);
+	memset(img, 0, sizeof(*img));
+}
+
+
+//=== writing =============================================================
+
+#define NETPBM_WRITE_BUFFER (1 << 20)
+
+int netpbm_writer_open(NetpbmWriter* w, const char* path, NetpbmFormat format, int width, int height) {
+	return netpbm_writer_open_maxval(w, path, format, width, height, 255);
+}
+
+
+int netpbm_writer_open_maxval(NetpbmWriter* w, const char* path, NetpbmFormat format, int width, int height, int maxval) {
+	memset(w, 0, sizeof(*w));
+	if (width <= 0 || height <= 0 || format < NETPBM_P4 || format > NETPBM_P6)
+		return NETPBM_ERR_ARGUMENT;
+	if (format != NETPBM_P4 && (maxval < 1 || maxval > 255))
+		return NETPBM_ERR_MAXVAL;
+
+	w->buffer = (uint8_t*)malloc(row_bytes(format, width));
+	if (w->buffer == NULL)
+		return NETPBM_ERR_MEMORY;
+
+	w->file = fopen(path, "wb");
+	if (w->file == NULL) {
+		free(w->buffer);
+		w->buffer = NULL;
+		return NETPBM_ERR_OPEN;
+	}
+
+	setvbuf(w->file, NULL, _IOFBF, NETPBM_WRITE_BUFFER);
+
+	w->format = format;
+	w->width  = width;
+	w->height = height;
+	w->maxval = (format == NETPBM_P4) ? 1 : maxval;
+
+	if (format == NETPBM_P4)
+		fprintf(w->file, "P4\n%d %d\n", width, height);
+	else
+		fprintf(w->file, "P%d\n%d %d\n%d\n", (int)format, width, height, maxval);
+
+	if (ferror(w->file))
+		w->error = NETPBM_ERR_WRITE;
+
+	return w->error;
+}
+
+
+static int writer_check(NetpbmWriter* w, int count) {
+	if (w->file == NULL || count < 0)
+		return NETPBM_ERR_ARGUMENT;
+
+	if (w->rows + count > w->height)
+		w->error = NETPBM_ERR_ARGUMENT;
+
+	return w->error;
+}
+
+
+static void writer_put(NetpbmWriter* w, const void* row) {
+	if (fwrite(row, row_bytes(w->format, w->width), 1, w->file) != 1)
+		w->error = NETPBM_ERR_WRITE;
+
+	w->rows += 1;
+}
+
+
+int netpbm_write_rows(NetpbmWriter* w, const void* rows, size_t stride, int count) {
+	if (writer_check(w, count) != NETPBM_OK)
+		return w->error;
+
+	for (int y=0; y < count && w->error == NETPBM_OK; y++)
+		writer_put(w, (const uint8_t*)rows + (size_t)y * stride);
+
+	return w->error;
+}
+
+
+int netpbm_write_rows_rgba(NetpbmWriter* w, const uint32_t* rows, size_t stride, int count) {
+	if (writer_check(w, count) != NETPBM_OK)
+		return w->error;
+	if (w->format != NETPBM_P6 || w->maxval != 255)
+		return NETPBM_ERR_ARGUMENT;
+
+	const PixconvKernels* k = &pixconv_kernels[netpbm_kernels_index];
+	for (int y=0; y < count && w->error == NETPBM_OK; y++) {
+		k->rgba_to_rgb888(w->buffer, (const uint8_t*)rows + (size_t)y * stride, w->width);
+		writer_put(w, w->buffer);
+	}
+
+	return w->error;
+}
+
+
+int netpbm_write_rows_gray(NetpbmWriter* w, const uint8_t* rows, size_t stride, int count) {
+	if (w->format != NETPBM_P5 || w->maxval != 255)
+		return NETPBM_ERR_ARGUMENT;
+
+	return netpbm_write_rows(w, rows, stride, count);
+}
+
+
+int netpbm_writer_close(NetpbmWriter* w) {
+	int result = w->error;
+	if (w->file) {
+		if (fclose(w->file) != 0 && result == NETPBM_OK)
+			result = NETPBM_ERR_WRITE;
+		if (w->rows != w->height && result == NETPBM_OK)
+			result = NETPBM_ERR_TRUNCATED;
+	}
+
+	free(w->buffer);
+	memset(w, 0, sizeof(*w));
+	return result;
+}
+
+
+int netpbm_save(const char* path, const NetpbmView* view) {
+	NetpbmWriter w;
+	const int result = netpbm_writer_open_maxval(&w, path, view->format, view->width, view->height, view->maxval);
+	if (result != NETPBM_OK) {
+		netpbm_writer_close(&w);
+		return result;
+	}
+
+	netpbm_write_rows(&w, view->data, view->stride, view->height);
+	return netpbm_writer_close(&w);
+}
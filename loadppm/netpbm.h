@@ -0,0 +1,164 @@
+#ifndef _NETPBM_H_
+#define _NETPBM_H_
+
+/*
+	Reading and writing binary netpbm images: P4 (PBM), P5 (PGM) and P6
+	(PPM) with maxval up to 255.
+
+	Files are memory-mapped; NetpbmView points directly at pixels of the
+	mapping, thus nothing is copied until pixels are converted.  All views
+	and images are stride-aware, so sub-images can be processed without
+	copying as well.
+
+	Conversions scale samples to 0..255 when maxval is less than 255; raw
+	samples are available in views.  Writers keep maxval of the samples.
+
+	Conversions use SIMD: P4 bits are expanded to bytes with SSSE3, AVX2 or
+	AVX512BW, P6 is converted to 32bpp by the pixconv kernels (see
+	../pixconv16bpp-32bpp).
+
+	Author: Wojciech Muła
+	License: BSD
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+	NETPBM_OK = 0,
+	NETPBM_ERR_OPEN = -1,
+	NETPBM_ERR_MMAP = -2,
+	NETPBM_ERR_FORMAT = -3,
+	NETPBM_ERR_HEADER = -4,
+	NETPBM_ERR_MAXVAL = -5,
+	NETPBM_ERR_TRUNCATED = -6,
+	NETPBM_ERR_MEMORY = -7,
+	NETPBM_ERR_WRITE = -8,
+	NETPBM_ERR_ARGUMENT = -9
+} NetpbmError;
+
+// netpbm_errormsg[-error]
+extern const char* netpbm_errormsg[];
+
+
+// file formats
+typedef enum {
+	NETPBM_P4 = 4,	// 1 bit per pixel, 8 pixels per byte (MSB first), 1 is black
+	NETPBM_P5 = 5,	// 1 byte per pixel
+	NETPBM_P6 = 6	// 3 bytes per pixel: R, G, B
+} NetpbmFormat;
+
+
+// in-memory pixel formats
+typedef enum {
+	NETPBM_GRAY8,		// P4 gives 0 (black) and 255 (white)
+	NETPBM_RGBA8888,	// uint32_t, bytes R, G, B, A = 255 (pixconv layout)
+	NETPBM_BGRA8888,	// uint32_t, bytes B, G, R, A = 255 (X11 32bpp)
+	NETPBM_RGB565		// uint16_t
+} NetpbmPixel;
+
+
+// rows of pixels in file format, not owned
+typedef struct {
+	const uint8_t* data;	// the first row
+	size_t stride;			// bytes between rows
+	int width;
+	int height;
+	int maxval;				// samples are 0..maxval; 1 for P4
+	NetpbmFormat format;
+} NetpbmView;
+
+
+typedef struct {
+	NetpbmView pixels;		// view into the mapping
+
+	void*  map;
+	size_t map_size;
+} NetpbmFile;
+
+
+// pixels owned by the structure; rows are padded to alignment
+typedef struct {
+	uint8_t* data;
+	size_t stride;
+	int width;
+	int height;
+	int maxval;				// maxval of the file; pixels are scaled to 0..255
+	NetpbmPixel format;
+} NetpbmImage;
+
+
+//--- reading --------------------------------------------------------------
+
+// maps the file, on error f is zeroed
+int netpbm_open(NetpbmFile* f, const char* path);
+void netpbm_close(NetpbmFile* f);
+
+// parses image kept in memory, f->map is not set
+int netpbm_parse(NetpbmFile* f, const void* data, size_t size);
+
+// sub-image; for P4 x has to be a multiple of 8
+int netpbm_subview(NetpbmView* sub, const NetpbmView* view, int x, int y, int width, int height);
+
+// rows converted to the given pixel format, samples scaled to 0..255;
+// dst has to hold view->width pixels per row
+int netpbm_convert(const NetpbmView* view, NetpbmPixel format, void* dst, size_t dst_stride);
+
+// open + convert to a newly allocated image (stride and data aligned to align, a power of two)
+int netpbm_load(const char* path, NetpbmPixel format, size_t align, NetpbmImage* img);
+void netpbm_image_free(NetpbmImage* img);
+
+size_t netpbm_bytes_per_pixel(NetpbmPixel format);
+
+
+//--- writing --------------------------------------------------------------
+
+// rows are written as they come, nothing is kept in memory
+typedef struct {
+	FILE* file;
+	NetpbmFormat format;
+	int width;
+	int height;
+	int maxval;
+	int rows;		// rows written so far
+	int error;
+	uint8_t* buffer;
+} NetpbmWriter;
+
+// maxval is 255 (ignored for P4)
+int netpbm_writer_open(NetpbmWriter* w, const char* path, NetpbmFormat format, int width, int height);
+int netpbm_writer_open_maxval(NetpbmWriter* w, const char* path, NetpbmFormat format, int width, int height, int maxval);
+
+// rows in the file format
+int netpbm_write_rows(NetpbmWriter* w, const void* rows, size_t stride, int count);
+
+// RGBA8888 rows to P6, GRAY8 rows to P5; maxval has to be 255
+int netpbm_write_rows_rgba(NetpbmWriter* w, const uint32_t* rows, size_t stride, int count);
+int netpbm_write_rows_gray(NetpbmWriter* w, const uint8_t* rows, size_t stride, int count);
+
+// fails if not all rows were written
+int netpbm_writer_close(NetpbmWriter* w);
+
+// writes samples as they are, with view->maxval
+int netpbm_save(const char* path, const NetpbmView* view);
+
+
+//--- kernels --------------------------------------------------------------
+
+// "scalar" or the name of pixconv kernels (SSSE3, AVX2, AVX512BW); NULL selects the best ones
+int netpbm_select_kernels(const char* name);
+const char* netpbm_kernels_name(void);
+
+// P4 row -> bytes: 0 for bit set (black), 255 otherwise
+void netpbm_expand_bits(uint8_t* dst, const uint8_t* src, size_t width);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _NETPBM_H_
@@ -0,0 +1,494 @@
+/*
+	Netpbm reader/writer --- verification and benchmark
+
+	Usage:
+
+	$ ./netpbm_avx512 verify
+	$ ./netpbm_avx512 bench [repeat count [width height]]
+
+	Benchmark writes P4, P5 and P6 images of given size (8K by default) to
+	the current directory and measures load+convert:
+
+	* fread  --- the whole file is read to a buffer, then converted;
+	* mmap   --- pixels are converted directly from the mapping, with scalar
+	             and with the best SIMD kernels.
+
+	Files are in the page cache, thus the disk speed is not measured.
+
+	Author: Wojciech Muła
+	License: BSD
+*/
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "netpbm.h"
+
+
+static uint32_t seed = 1;
+
+uint32_t random32(void) {
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) | (seed << 16);
+}
+
+
+void fill_random(uint8_t* data, size_t size) {
+	for (size_t i=0; i < size; i++)
+		data[i] = random32();
+}
+
+
+static const char* kernels[] = {"scalar", "SSSE3", "AVX2", "AVX512BW"};
+#define KERNELS (int)(sizeof(kernels)/sizeof(kernels[0]))
+
+
+//=== verification =======================================================
+
+int verify_bits(void) {
+	uint8_t src[64];
+	uint8_t expected[512 + 16];
+	uint8_t result[512 + 16];
+
+	int failed = 0;
+	for (int k=1; k < KERNELS; k++) {
+		if (netpbm_select_kernels(kernels[k]) != NETPBM_OK)
+			continue;
+
+		int ok = 1;
+		for (size_t width=1; width <= 512 && ok; width++) {
+			fill_random(src, sizeof(src));
+			memset(expected, 0x5a, sizeof(expected));
+			memset(result, 0x5a, sizeof(result));
+
+			netpbm_select_kernels("scalar");
+			netpbm_expand_bits(expected, src, width);
+			netpbm_select_kernels(kernels[k]);
+			netpbm_expand_bits(result, src, width);
+
+			// bytes past width must not be touched
+			if (memcmp(expected, result, sizeof(result)) != 0) {
+				printf("%s expand bits: FAILED for width %zu\n", kernels[k], width);
+				ok = 0;
+			}
+		}
+
+		if (ok)
+			printf("%s expand bits: OK\n", kernels[k]);
+		else
+			failed = 1;
+	}
+
+	netpbm_select_kernels(NULL);
+	return !failed;
+}
+
+
+int expect(const char* name, const char* text, size_t size, int expected) {
+	NetpbmFile f;
+	const int result = netpbm_parse(&f, text, size);
+	if (result != expected) {
+		printf("header '%s': FAILED, got '%s', expected '%s'\n",
+		       name, netpbm_errormsg[-result], netpbm_errormsg[-expected]);
+		return 0;
+	}
+
+	return 1;
+}
+
+
+int verify_headers(void) {
+	int ok = 1;
+
+	const char p5[] = "P5 # comment\n 3\t# width\n2\r\n255\nabcdef";
+	NetpbmFile f;
+	ok = ok && expect("comments", p5, sizeof(p5) - 1, NETPBM_OK);
+	netpbm_parse(&f, p5, sizeof(p5) - 1);
+	ok = ok && f.pixels.width == 3 && f.pixels.height == 2 && f.pixels.maxval == 255
+	        && f.pixels.stride == 3 && memcmp(f.pixels.data, "abcdef", 6) == 0;
+
+	// the pixel data may start with a whitespace or '#'
+	const char p4[] = "P4\n12 2\n# \n\x01";
+	ok = ok && expect("P4", p4, sizeof(p4) - 1, NETPBM_OK);
+	netpbm_parse(&f, p4, sizeof(p4) - 1);
+	ok = ok && f.pixels.stride == 2 && f.pixels.data[0] == '#' && f.pixels.maxval == 1;
+
+	ok = ok && expect("P6", "P6 1 1 7 rgb", 12, NETPBM_OK);
+	ok = ok && expect("ASCII", "P3 1 1 255 0 0 0", 16, NETPBM_ERR_FORMAT);
+	ok = ok && expect("empty", "", 0, NETPBM_ERR_FORMAT);
+	ok = ok && expect("16-bit", "P5 1 1 65535 xx", 15, NETPBM_ERR_MAXVAL);
+	ok = ok && expect("zero width", "P5 0 1 255 ", 11, NETPBM_ERR_HEADER);
+	ok = ok && expect("no separator", "P5 1 1 255", 10, NETPBM_ERR_HEADER);
+	ok = ok && expect("garbage", "P5 1 x 255 a", 12, NETPBM_ERR_HEADER);
+	ok = ok && expect("truncated", "P6 2 2 255 abcdefghijk", 22, NETPBM_ERR_TRUNCATED);
+	ok = ok && expect("too large", "P5 99999999999 1 255 a", 22, NETPBM_ERR_HEADER);
+
+	printf("headers: %s\n", ok ? "OK" : "FAILED");
+	return ok;
+}
+
+
+// sample scaled to 0..255
+uint32_t model_sample(const NetpbmView* v, uint8_t sample) {
+	return (uint32_t)(sample * 255.0 / v->maxval + 0.5);
+}
+
+
+// scalar model of netpbm_convert
+uint32_t model_rgba(const NetpbmView* v, int x, int y) {
+	const uint8_t* row = v->data + y * v->stride;
+	switch (v->format) {
+		case NETPBM_P4: {
+			const uint32_t g = (row[x / 8] & (0x80 >> (x % 8))) ? 0x00 : 0xff;
+			return 0xff000000 | (g * 0x010101);
+		}
+		case NETPBM_P5:
+			return 0xff000000 | (model_sample(v, row[x]) * 0x010101);
+		case NETPBM_P6:
+			return 0xff000000 | model_sample(v, row[3*x])
+			                  | (model_sample(v, row[3*x + 1]) << 8)
+			                  | (model_sample(v, row[3*x + 2]) << 16);
+	}
+
+	return 0;
+}
+
+
+int verify_file(NetpbmFormat format, int width, int height, int maxval) {
+	const char* path = "verify.pnm";
+
+	const size_t row = (format == NETPBM_P4) ? (width + 7)/8 : (format == NETPBM_P5) ? width : 3 * width;
+	const size_t stride = row + 5;
+	uint8_t* pixels = malloc(stride * height);
+	fill_random(pixels, stride * height);
+	if (format != NETPBM_P4)
+		for (size_t i=0; i < stride * height; i++)
+			pixels[i] %= maxval + 1;
+
+	// write in chunks of rows
+	NetpbmWriter w;
+	int result = netpbm_writer_open_maxval(&w, path, format, width, height, maxval);
+	for (int y=0; y < height && result == NETPBM_OK; y += 3)
+		result = netpbm_write_rows(&w, pixels + y * stride, stride, (y + 3 <= height) ? 3 : height - y);
+	if (result == NETPBM_OK)
+		result = netpbm_writer_close(&w);
+
+	NetpbmFile f;
+	if (result == NETPBM_OK)
+		result = netpbm_open(&f, path);
+
+	int ok = (result == NETPBM_OK) && f.pixels.width == width && f.pixels.height == height
+	         && f.pixels.maxval == ((format == NETPBM_P4) ? 1 : maxval);
+	for (int y=0; y < height && ok; y++)
+		ok = memcmp(f.pixels.data + y * f.pixels.stride, pixels + y * stride, row) == 0;
+
+	// saving keeps samples and maxval
+	NetpbmFile saved;
+	const char* saved_path = "verify_saved.pnm";
+	if (ok && netpbm_save(saved_path, &f.pixels) == NETPBM_OK && netpbm_open(&saved, saved_path) == NETPBM_OK) {
+		ok = saved.pixels.maxval == f.pixels.maxval;
+		for (int y=0; y < height && ok; y++)
+			ok = memcmp(saved.pixels.data + y * saved.pixels.stride, pixels + y * stride, row) == 0;
+
+		netpbm_close(&saved);
+	} else
+		ok = 0;
+	remove(saved_path);
+
+	// conversions of a sub-image, all kernels must give the same result as the model
+	NetpbmView sub;
+	const int x0 = (width > 8) ? 8 : 0;
+	if (ok && netpbm_subview(&sub, &f.pixels, x0, height / 2, width - x0, height - height / 2) != NETPBM_OK)
+		ok = 0;
+
+	const NetpbmPixel formats[] = {NETPBM_GRAY8, NETPBM_RGBA8888, NETPBM_BGRA8888, NETPBM_RGB565};
+	uint8_t* out = malloc(4 * (size_t)width * height + 64);
+	for (int k=0; k < KERNELS && ok; k++) {
+		if (netpbm_select_kernels(kernels[k]) != NETPBM_OK)
+			continue;
+
+		for (int i=0; i < 4 && ok; i++) {
+			const size_t out_stride = sub.width * netpbm_bytes_per_pixel(formats[i]) + 7;
+			netpbm_convert(&sub, formats[i], out, out_stride);
+
+			for (int y=0; y < sub.height && ok; y++) {
+				for (int x=0; x < sub.width && ok; x++) {
+					const uint32_t p = model_rgba(&sub, x, y);
+					const uint8_t* q = out + y * out_stride;
+					const uint32_t r = p & 0xff, g = (p >> 8) & 0xff, b = (p >> 16) & 0xff;
+					switch (formats[i]) {
+						case NETPBM_GRAY8:
+							if (sub.format == NETPBM_P6)
+								ok = q[x] == (77*r + 150*g + 29*b + 128) >> 8;
+							else
+								ok = q[x] == r;
+							break;
+						case NETPBM_RGBA8888:
+							ok = memcmp(q + 4*x, &p, 4) == 0;
+							break;
+						case NETPBM_BGRA8888:
+							ok = q[4*x] == b && q[4*x + 1] == g && q[4*x + 2] == r && q[4*x + 3] == 0xff;
+							break;
+						case NETPBM_RGB565: {
+							const uint16_t expected = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+							ok = memcmp(q + 2*x, &expected, 2) == 0;
+							break;
+						}
+					}
+
+					if (!ok)
+						printf("P%d %d x %d, maxval %d: %s conversion #%d FAILED at (%d, %d)\n",
+						       format, width, height, maxval, kernels[k], i, x, y);
+				}
+			}
+		}
+	}
+
+	netpbm_select_kernels(NULL);
+	netpbm_close(&f);
+	free(pixels);
+	free(out);
+	remove(path);
+
+	if (result != NETPBM_OK)
+		printf("P%d %d x %d, maxval %d: FAILED, %s\n", format, width, height, maxval, netpbm_errormsg[-result]);
+
+	return ok;
+}
+
+
+int verify_writer(void) {
+	const char* path = "verify.pnm";
+	const int width = 77, height = 5;
+	int ok = 1;
+
+	// RGBA -> P6 -> RGBA
+	uint32_t rgba[77 * 5];
+	fill_random((uint8_t*)rgba, sizeof(rgba));
+	for (int i=0; i < width * height; i++)
+		rgba[i] |= 0xff000000;
+
+	NetpbmWriter w;
+	netpbm_writer_open(&w, path, NETPBM_P6, width, height);
+	netpbm_write_rows_rgba(&w, rgba, 4 * width, height);
+	ok = ok && netpbm_writer_close(&w) == NETPBM_OK;
+
+	NetpbmImage img;
+	ok = ok && netpbm_load(path, NETPBM_RGBA8888, 64, &img) == NETPBM_OK;
+	ok = ok && ((uintptr_t)img.data % 64 == 0) && (img.stride % 64 == 0);
+	for (int y=0; y < height && ok; y++)
+		ok = memcmp(img.data + y * img.stride, rgba + y * width, 4 * width) == 0;
+	netpbm_image_free(&img);
+
+	// missing and excess rows
+	netpbm_writer_open(&w, path, NETPBM_P5, width, height);
+	netpbm_write_rows(&w, rgba, width, height - 1);
+	ok = ok && netpbm_writer_close(&w) == NETPBM_ERR_TRUNCATED;
+
+	netpbm_writer_open(&w, path, NETPBM_P5, width, height);
+	ok = ok && netpbm_write_rows(&w, rgba, width, height + 1) == NETPBM_ERR_ARGUMENT;
+	netpbm_writer_close(&w);
+
+	// 8-bit rows can't be written with other maxval
+	ok = ok && netpbm_writer_open_maxval(&w, path, NETPBM_P6, width, height, 0) == NETPBM_ERR_MAXVAL;
+	netpbm_writer_close(&w);
+	ok = ok && netpbm_writer_open_maxval(&w, path, NETPBM_P6, width, height, 15) == NETPBM_OK;
+	ok = ok && netpbm_write_rows_rgba(&w, rgba, 4 * width, height) == NETPBM_ERR_ARGUMENT;
+	netpbm_writer_close(&w);
+
+	ok = ok && netpbm_load(path, NETPBM_GRAY8, 3, &img) == NETPBM_ERR_ARGUMENT;
+	ok = ok && netpbm_load("does/not/exist.ppm", NETPBM_GRAY8, 16, &img) == NETPBM_ERR_OPEN;
+	remove(path);
+
+	printf("writer: %s\n", ok ? "OK" : "FAILED");
+	return ok;
+}
+
+
+int verify(void) {
+	const int sizes[][2] = {{1, 1}, {7, 3}, {8, 2}, {9, 9}, {63, 4}, {64, 3}, {65, 5}, {130, 7}, {257, 3}};
+	const int maxvals[] = {255, 1, 7, 100, 254};
+
+	int ok = verify_bits();
+	ok = verify_headers() && ok;
+	ok = verify_writer() && ok;
+
+	for (int format=NETPBM_P4; format <= NETPBM_P6; format++) {
+		int format_ok = 1;
+		// maxval doesn't apply to P4
+		const size_t maxval_count = (format == NETPBM_P4) ? 1 : sizeof(maxvals)/sizeof(maxvals[0]);
+		for (size_t m=0; m < maxval_count; m++)
+			for (size_t s=0; s < sizeof(sizes)/sizeof(sizes[0]); s++)
+				format_ok = verify_file((NetpbmFormat)format, sizes[s][0], sizes[s][1], maxvals[m]) && format_ok;
+
+		printf("P%d files and conversions: %s\n", format, format_ok ? "OK" : "FAILED");
+		ok = ok && format_ok;
+	}
+
+	puts(ok ? "all OK" : "verification failed");
+	return !ok;
+}
+
+
+//=== benchmark ==========================================================
+
+long get_time_us(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000l + ts.tv_nsec / 1000;
+}
+
+
+// the way ad hoc loaders work: read everything, then convert
+int load_fread(const char* path, NetpbmPixel format, void* dst, size_t dst_stride) {
+	FILE* file = fopen(path, "rb");
+	if (file == NULL)
+		return NETPBM_ERR_OPEN;
+
+	fseek(file, 0, SEEK_END);
+	const size_t size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	uint8_t* data = malloc(size);
+	const int read = fread(data, size, 1, file) == 1;
+	fclose(file);
+
+	NetpbmFile f;
+	int result = read ? netpbm_parse(&f, data, size) : NETPBM_ERR_TRUNCATED;
+	if (result == NETPBM_OK)
+		result = netpbm_convert(&f.pixels, format, dst, dst_stride);
+
+	free(data);
+	return result;
+}
+
+
+int load_mmap(const char* path, NetpbmPixel format, void* dst, size_t dst_stride) {
+	NetpbmFile f;
+	int result = netpbm_open(&f, path);
+	if (result == NETPBM_OK)
+		result = netpbm_convert(&f.pixels, format, dst, dst_stride);
+
+	netpbm_close(&f);
+	return result;
+}
+
+
+typedef int (*load_function)(const char* path, NetpbmPixel format, void* dst, size_t dst_stride);
+
+void measure(const char* name, load_function load, const char* path, NetpbmPixel format,
+             void* dst, size_t dst_stride, int width, int height, int repeat) {
+	long best = -1;
+	for (int i=0; i < repeat; i++) {
+		const long t1 = get_time_us();
+		const int result = load(path, format, dst, dst_stride);
+		const long t2 = get_time_us();
+		if (result != NETPBM_OK) {
+			printf("%s: %s\n", path, netpbm_errormsg[-result]);
+			exit(EXIT_FAILURE);
+		}
+
+		if (best < 0 || t2 - t1 < best)
+			best = t2 - t1;
+	}
+
+	printf("%-30s : %8.2f ms %8.1f Mpix/s\n", name, best / 1000.0, (double)width * height / best);
+}
+
+
+int bench(int repeat, int width, int height) {
+	const struct {
+		NetpbmFormat format;
+		NetpbmPixel  pixel;
+		const char*  path;
+		const char*  name;
+	} cases[] = {
+		{NETPBM_P6, NETPBM_RGBA8888, "bench.ppm", "P6 -> RGBA8888"},
+		{NETPBM_P6, NETPBM_BGRA8888, "bench.ppm", "P6 -> BGRA8888"},
+		{NETPBM_P5, NETPBM_GRAY8,    "bench.pgm", "P5 -> GRAY8"},
+		{NETPBM_P5, NETPBM_RGBA8888, "bench.pgm", "P5 -> RGBA8888"},
+		{NETPBM_P4, NETPBM_GRAY8,    "bench.pbm", "P4 -> GRAY8"},
+	};
+	const int n = sizeof(cases)/sizeof(cases[0]);
+
+	const size_t stride = 4 * (size_t)width;
+	uint8_t* pixels = malloc(stride * height);
+	fill_random(pixels, stride * height);
+
+	// stream writing
+	for (int i=0; i < n; i++) {
+		if (i > 0 && cases[i].format == cases[i - 1].format)
+			continue;
+
+		NetpbmWriter w;
+		const long t1 = get_time_us();
+		netpbm_writer_open(&w, cases[i].path, cases[i].format, width, height);
+		if (cases[i].format == NETPBM_P6)
+			netpbm_write_rows_rgba(&w, (const uint32_t*)pixels, stride, height);
+		else
+			netpbm_write_rows(&w, pixels, stride, height);
+		const int result = netpbm_writer_close(&w);
+		const long t2 = get_time_us();
+		if (result != NETPBM_OK) {
+			printf("%s: %s\n", cases[i].path, netpbm_errormsg[-result]);
+			return EXIT_FAILURE;
+		}
+
+		printf("writing %s %d x %d: %0.2f ms\n", cases[i].path, width, height, (t2 - t1) / 1000.0);
+	}
+
+	printf("load+convert, best of %d\n", repeat);
+	for (int i=0; i < n; i++) {
+		char name[64];
+
+		netpbm_select_kernels(NULL);
+		snprintf(name, sizeof(name), "%s fread", cases[i].name);
+		measure(name, load_fread, cases[i].path, cases[i].pixel, pixels, stride, width, height, repeat);
+
+		netpbm_select_kernels("scalar");
+		snprintf(name, sizeof(name), "%s mmap scalar", cases[i].name);
+		measure(name, load_mmap, cases[i].path, cases[i].pixel, pixels, stride, width, height, repeat);
+
+		netpbm_select_kernels(NULL);
+		snprintf(name, sizeof(name), "%s mmap %s", cases[i].name, netpbm_kernels_name());
+		measure(name, load_mmap, cases[i].path, cases[i].pixel, pixels, stride, width, height, repeat);
+	}
+
+	for (int i=0; i < n; i++)
+		remove(cases[i].path);
+
+	free(pixels);
+	return EXIT_SUCCESS;
+}
+
+
+void help(void) {
+	puts("1. progname verify");
+	puts("2. progname bench [repeat count=10 [width=7680 height=4320]]");
+	exit(1);
+}
+
+
+int main(int argc, char* argv[]) {
+	if (argc < 2)
+		help();
+
+	if (strcmp(argv[1], "verify") == 0)
+		return verify();
+
+	if (strcmp(argv[1], "bench") != 0)
+		help();
+
+	const int repeat = (argc >= 3 && atoi(argv[2]) > 0) ? atoi(argv[2]) : 10;
+	const int width  = (argc >= 5) ? atoi(argv[3]) : 7680;
+	const int height = (argc >= 5) ? atoi(argv[4]) : 4320;
+	if (width <= 0 || height <= 0)
+		help();
+
+	return bench(repeat, width, height);
+}
@@ -0,0 +1,101 @@
+//=== P4: bits -> bytes ===================================================
+
+/*
+	A row of P4 image has (width + 7)/8 bytes, the most significant bit is
+	the leftmost pixel; 1 is black.  Output byte is 0 for black, 255 for
+	white.
+
+	SIMD: source bytes are broadcast, so that each output byte gets the
+	source byte containing its pixel (PSHUFB), then the pixel's bit is
+	isolated by AND with 0x80, 0x40, ..., 0x01 and compared with zero.
+	AVX512BW code uses VPTESTMB and VPMOVM2B instead.
+*/
+
+typedef void (*netpbm_bits_function)(uint8_t* dst, const uint8_t* src, size_t width);
+
+
+void scalar_expand_bits(uint8_t* dst, const uint8_t* src, size_t width) {
+	for (size_t i=0; i < width; i++)
+		dst[i] = (src[i / 8] & (0x80 >> (i % 8))) ? 0x00 : 0xff;
+}
+
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+
+void ssse3_expand_bits(uint8_t* dst, const uint8_t* src, size_t width) {
+	const __m128i index = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+	const __m128i bits  = _mm_setr_epi8(
+		(char)0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+		(char)0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+
+	size_t i = 0;
+	for (/**/; i + 16 <= width; i += 16) {
+		uint16_t word;
+		memcpy(&word, src + i/8, 2);
+
+		const __m128i t = _mm_shuffle_epi8(_mm_cvtsi32_si128(word), index);
+		const __m128i r = _mm_cmpeq_epi8(_mm_and_si128(t, bits), _mm_setzero_si128());
+		_mm_storeu_si128((__m128i*)(dst + i), r);
+	}
+
+	scalar_expand_bits(dst + i, src + i/8, width - i);
+}
+#endif // __SSSE3__
+
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+void avx2_expand_bits(uint8_t* dst, const uint8_t* src, size_t width) {
+	const __m256i index = _mm256_setr_epi8(
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+	const __m256i bits = _mm256_set1_epi64x(0x0102040810204080ll);
+
+	size_t i = 0;
+	for (/**/; i + 32 <= width; i += 32) {
+		uint32_t dword;
+		memcpy(&dword, src + i/8, 4);
+
+		const __m256i t = _mm256_shuffle_epi8(_mm256_set1_epi32(dword), index);
+		const __m256i r = _mm256_cmpeq_epi8(_mm256_and_si256(t, bits), _mm256_setzero_si256());
+		_mm256_storeu_si256((__m256i*)(dst + i), r);
+	}
+
+	scalar_expand_bits(dst + i, src + i/8, width - i);
+}
+#endif // __AVX2__
+
+
+#if defined(__AVX512BW__)
+#include <immintrin.h>
+
+static inline __m512i avx512_expand_bits64(uint64_t qword) {
+	// lane k: bytes 2*k and 2*k + 1 of qword
+	const __m512i index = _mm512_set_epi64(
+		0x0707070707070707ll, 0x0606060606060606ll, 0x0505050505050505ll, 0x0404040404040404ll,
+		0x0303030303030303ll, 0x0202020202020202ll, 0x0101010101010101ll, 0x0000000000000000ll);
+	const __m512i bits = _mm512_set1_epi64(0x0102040810204080ll);
+
+	const __m512i t = _mm512_shuffle_epi8(_mm512_set1_epi64(qword), index);
+	return _mm512_movm_epi8(~_mm512_test_epi8_mask(t, bits));
+}
+
+
+void avx512_expand_bits(uint8_t* dst, const uint8_t* src, size_t width) {
+	size_t i = 0;
+	for (/**/; i + 64 <= width; i += 64) {
+		uint64_t qword;
+		memcpy(&qword, src + i/8, 8);
+		_mm512_storeu_si512((__m512i*)(dst + i), avx512_expand_bits64(qword));
+	}
+
+	if (i < width) {
+		const size_t n = width - i;
+		uint64_t qword = 0;
+		memcpy(&qword, src + i/8, (n + 7) / 8);
+		_mm512_mask_storeu_epi8(dst + i, (~(__mmask64)0) >> (64 - n), avx512_expand_bits64(qword));
+	}
+}
+#endif // __AVX512BW__
@@ -0,0 +1,527 @@
+//=== 3D lookup tables ====================================================
+
+/*
+	3D color LUT: a grid of N x N x N RGB colors (N = 17 or 33 are
+	typical), the input color selects a cube of the grid and the output
+	is interpolated from its corners:
+
+	* trilinear   --- all eight corners, lerps along R, G and B;
+	* tetrahedral --- the cube is split into six tetrahedrons, the one
+	                  containing the point is selected by ordering
+	                  fractions; only four corners are used.
+
+	Alpha is not changed.
+
+	Grid index: i = floor(x * (N-1) / 255), at the upper edge it is
+	N - 2, thus i + 1 is always valid; fraction f = x * (N-1) - 255*i is
+	an integer in range 0..255.  Interpolation is done in single precision;
+	vector implementations perform exactly the same operations, so results
+	are identical.
+*/
+
+typedef struct {
+	int size;		// N
+	uint32_t* table;	// N^3 RGB colors, index = (b*N + g)*N + r
+} Lut3D;
+
+
+// sample color grading: contrast curve, more saturation, warmer colors
+void lut3d_init(Lut3D* lut, int size) {
+	lut->size  = size;
+	lut->table = (uint32_t*)malloc((size_t)size * size * size * sizeof(uint32_t));
+	if (lut->table == NULL) {
+		puts("ERROR: out of memory");
+		exit(EXIT_FAILURE);
+	}
+
+	for (int b=0; b < size; b++)
+		for (int g=0; g < size; g++)
+			for (int r=0; r < size; r++) {
+				float c[3] = {
+					(float)r / (size - 1),
+					(float)g / (size - 1),
+					(float)b / (size - 1)
+				};
+
+				const float luma = 0.299f*c[0] + 0.587f*c[1] + 0.114f*c[2];
+				const float warm[3] = {1.06f, 1.0f, 0.90f};
+
+				uint32_t color = 0;
+				for (int k=0; k < 3; k++) {
+					float v = luma + 1.3f * (c[k] - luma);		// saturation
+					v = v * warm[k];
+					v = v * v * (3.0f - 2.0f * v);			// S-curve
+
+					if (v < 0.0f) v = 0.0f;
+					if (v > 1.0f) v = 1.0f;
+
+					color |= (uint32_t)(v * 255.0f + 0.5f) << (8*k);
+				}
+
+				lut->table[(b*size + g)*size + r] = color;
+			}
+}
+
+
+void lut3d_free(Lut3D* lut) {
+	free(lut->table);
+}
+
+
+static inline void lut3d_coord(int x, int size, int* index, float* frac) {
+	const int pos = x * (size - 1);
+	int i = ((pos * 257 + 257) >> 16);	// pos / 255
+	if (i > size - 2)
+		i = size - 2;
+
+	*index = i;
+	*frac  = (float)(pos - 255 * i) * (1.0f / 255.0f);
+}
+
+
+static inline float lut3d_channel(uint32_t color, int c) {
+	return (float)((color >> (8*c)) & 0xff);
+}
+
+
+static inline uint32_t lut3d_round(float v) {
+	return (uint32_t)(int32_t)(v + 0.5f);
+}
+
+
+void lut3d_trilinear_scalar(const Lut3D* lut, const uint32_t* input, uint32_t* output, size_t n) {
+	const int N  = lut->size;
+	const int dr = 1;
+	const int dg = N;
+	const int db = N*N;
+
+	for (size_t i=0; i < n; i++) {
+		const uint32_t p = input[i];
+
+		int ir, ig, ib;
+		float fr, fg, fb;
+		lut3d_coord(p & 0xff, N, &ir, &fr);
+		lut3d_coord((p >> 8) & 0xff, N, &ig, &fg);
+		lut3d_coord((p >> 16) & 0xff, N, &ib, &fb);
+
+		const uint32_t* T = lut->table + ir*dr + ig*dg + ib*db;
+
+		uint32_t result = p & 0xff000000;
+		for (int c=0; c < 3; c++) {
+			const float c000 = lut3d_channel(T[0], c);
+			const float c100 = lut3d_channel(T[dr], c);
+			const float c010 = lut3d_channel(T[dg], c);
+			const float c110 = lut3d_channel(T[dr + dg], c);
+			const float c001 = lut3d_channel(T[db], c);
+			const float c101 = lut3d_channel(T[dr + db], c);
+			const float c011 = lut3d_channel(T[dg + db], c);
+			const float c111 = lut3d_channel(T[dr + dg + db], c);
+
+			const float x00 = c000 + (c100 - c000) * fr;
+			const float x10 = c010 + (c110 - c010) * fr;
+			const float x01 = c001 + (c101 - c001) * fr;
+			const float x11 = c011 + (c111 - c011) * fr;
+
+			const float y0 = x00 + (x10 - x00) * fg;
+			const float y1 = x01 + (x11 - x01) * fg;
+
+			const float z = y0 + (y1 - y0) * fb;
+
+			result |= lut3d_round(z) << (8*c);
+		}
+
+		output[i] = result;
+	}
+}
+
+
+/*
+	Tetrahedral: with fractions sorted f_max >= f_mid >= f_min, the path
+	from corner 000 goes along the axis of f_max, then the axis of f_mid,
+	then to 111; weights are 1 - f_max, f_max - f_mid, f_mid - f_min and
+	f_min.  Ties give zero weights, so it doesn't matter which axis wins.
+*/
+void lut3d_tetrahedral_scalar(const Lut3D* lut, const uint32_t* input, uint32_t* output, size_t n) {
+	const int N  = lut->size;
+	const int dr = 1;
+	const int dg = N;
+	const int db = N*N;
+
+	for (size_t i=0; i < n; i++) {
+		const uint32_t p = input[i];
+
+		int ir, ig, ib;
+		float fr, fg, fb;
+		lut3d_coord(p & 0xff, N, &ir, &fr);
+		lut3d_coord((p >> 8) & 0xff, N, &ig, &fg);
+		lut3d_coord((p >> 16) & 0xff, N, &ib, &fb);
+
+		const float fmax = fmaxf(fmaxf(fr, fg), fb);
+		const float fmin = fminf(fminf(fr, fg), fb);
+		const float fmid = fmaxf(fminf(fr, fg), fminf(fmaxf(fr, fg), fb));
+
+		// axis of max: R, then G, then B on ties; axis of min: B, then G, then R
+		const int max_r = (fr >= fg) && (fr >= fb);
+		const int max_g = !max_r && (fg >= fb);
+		const int d_max = max_r ? dr : max_g ? dg : db;
+
+		const int min_b = (fb <= fr) && (fb <= fg);
+		const int min_g = !min_b && (fg <= fr);
+		const int d_min = min_b ? db : min_g ? dg : dr;
+
+		const uint32_t* T = lut->table + ir*dr + ig*dg + ib*db;
+		const uint32_t v0 = T[0];
+		const uint32_t v1 = T[d_max];
+		const uint32_t v2 = T[dr + dg + db - d_min];
+		const uint32_t v3 = T[dr + dg + db];
+
+		const float w0 = 1.0f - fmax;
+		const float w1 = fmax - fmid;
+		const float w2 = fmid - fmin;
+		const float w3 = fmin;
+
+		uint32_t result = p & 0xff000000;
+		for (int c=0; c < 3; c++) {
+			float z = lut3d_channel(v0, c) * w0;
+			z = z + lut3d_channel(v1, c) * w1;
+			z = z + lut3d_channel(v2, c) * w2;
+			z = z + lut3d_channel(v3, c) * w3;
+
+			result |= lut3d_round(z) << (8*c);
+		}
+
+		output[i] = result;
+	}
+}
+
+
+#if defined(__AVX2__)
+
+typedef struct {
+	__m256i index;
+	__m256 frac;
+} Avx2Coord;
+
+
+static inline Avx2Coord avx2_lut3d_coord(__m256i x, int size) {
+	const __m256i pos = _mm256_mullo_epi32(x, _mm256_set1_epi32(size - 1));
+
+	__m256i i = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_add_epi32(pos, _mm256_set1_epi32(1)), _mm256_set1_epi32(257)), 16);
+	i = _mm256_min_epi32(i, _mm256_set1_epi32(size - 2));
+
+	const __m256i f = _mm256_sub_epi32(pos, _mm256_mullo_epi32(i, _mm256_set1_epi32(255)));
+
+	Avx2Coord c;
+	c.index = i;
+	c.frac  = _mm256_mul_ps(_mm256_cvtepi32_ps(f), _mm256_set1_ps(1.0f / 255.0f));
+	return c;
+}
+
+
+static inline __m256 avx2_lut3d_channel(__m256i color, int c) {
+	return _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(color, 8*c), _mm256_set1_epi32(0xff)));
+}
+
+
+static inline __m256i avx2_lut3d_round(__m256 v) {
+	return _mm256_cvttps_epi32(_mm256_add_ps(v, _mm256_set1_ps(0.5f)));
+}
+
+
+static inline __m256 avx2_lerp_ps(__m256 a, __m256 b, __m256 f) {
+	return _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), f));
+}
+
+
+#define AVX2_LUT3D_COORDS									\
+	const __m256i mask = _mm256_set1_epi32(0xff);						\
+	const Avx2Coord R = avx2_lut3d_coord(_mm256_and_si256(p, mask), N);			\
+	const Avx2Coord G = avx2_lut3d_coord(_mm256_and_si256(_mm256_srli_epi32(p, 8), mask), N);	\
+	const Avx2Coord B = avx2_lut3d_coord(_mm256_and_si256(_mm256_srli_epi32(p, 16), mask), N);	\
+	const __m256i base = _mm256_add_epi32(R.index,						\
+	                     _mm256_add_epi32(_mm256_mullo_epi32(G.index, _mm256_set1_epi32(dg)),	\
+	                                      _mm256_mullo_epi32(B.index, _mm256_set1_epi32(db))));
+
+
+#define AVX2_GATHER(offset) \
+	_mm256_i32gather_epi32((const int*)lut->table, _mm256_add_epi32(base, _mm256_set1_epi32(offset)), 4)
+
+
+void lut3d_trilinear_avx2(const Lut3D* lut, const uint32_t* input, uint32_t* output, size_t n) {
+	const int N  = lut->size;
+	const int dr = 1;
+	const int dg = N;
+	const int db = N*N;
+
+	size_t i = 0;
+	for (/**/; i + 8 <= n; i += 8) {
+		const __m256i p = _mm256_loadu_si256((const __m256i*)(input + i));
+		AVX2_LUT3D_COORDS
+
+		const __m256i v000 = AVX2_GATHER(0);
+		const __m256i v100 = AVX2_GATHER(dr);
+		const __m256i v010 = AVX2_GATHER(dg);
+		const __m256i v110 = AVX2_GATHER(dr + dg);
+		const __m256i v001 = AVX2_GATHER(db);
+		const __m256i v101 = AVX2_GATHER(dr + db);
+		const __m256i v011 = AVX2_GATHER(dg + db);
+		const __m256i v111 = AVX2_GATHER(dr + dg + db);
+
+		__m256i result = _mm256_and_si256(p, _mm256_set1_epi32(0xff000000));
+		for (int c=0; c < 3; c++) {
+			const __m256 x00 = avx2_lerp_ps(avx2_lut3d_channel(v000, c), avx2_lut3d_channel(v100, c), R.frac);
+			const __m256 x10 = avx2_lerp_ps(avx2_lut3d_channel(v010, c), avx2_lut3d_channel(v110, c), R.frac);
+			const __m256 x01 = avx2_lerp_ps(avx2_lut3d_channel(v001, c), avx2_lut3d_channel(v101, c), R.frac);
+			const __m256 x11 = avx2_lerp_ps(avx2_lut3d_channel(v011, c), avx2_lut3d_channel(v111, c), R.frac);
+
+			const __m256 y0 = avx2_lerp_ps(x00, x10, G.frac);
+			const __m256 y1 = avx2_lerp_ps(x01, x11, G.frac);
+
+			const __m256 z = avx2_lerp_ps(y0, y1, B.frac);
+
+			result = _mm256_or_si256(result, _mm256_slli_epi32(avx2_lut3d_round(z), 8*c));
+		}
+
+		_mm256_storeu_si256((__m256i*)(output + i), result);
+	}
+
+	lut3d_trilinear_scalar(lut, input + i, output + i, n - i);
+}
+
+
+void lut3d_tetrahedral_avx2(const Lut3D* lut, const uint32_t* input, uint32_t* output, size_t n) {
+	const int N  = lut->size;
+	const int dr = 1;
+	const int dg = N;
+	const int db = N*N;
+
+	size_t i = 0;
+	for (/**/; i + 8 <= n; i += 8) {
+		const __m256i p = _mm256_loadu_si256((const __m256i*)(input + i));
+		AVX2_LUT3D_COORDS
+
+		const __m256 fr = R.frac;
+		const __m256 fg = G.frac;
+		const __m256 fb = B.frac;
+
+		const __m256 fmax = _mm256_max_ps(_mm256_max_ps(fr, fg), fb);
+		const __m256 fmin = _mm256_min_ps(_mm256_min_ps(fr, fg), fb);
+		const __m256 fmid = _mm256_max_ps(_mm256_min_ps(fr, fg), _mm256_min_ps(_mm256_max_ps(fr, fg), fb));
+
+		const __m256 max_r = _mm256_and_ps(_mm256_cmp_ps(fr, fg, _CMP_GE_OQ), _mm256_cmp_ps(fr, fb, _CMP_GE_OQ));
+		const __m256 max_g = _mm256_andnot_ps(max_r, _mm256_cmp_ps(fg, fb, _CMP_GE_OQ));
+		const __m256 min_b = _mm256_and_ps(_mm256_cmp_ps(fb, fr, _CMP_LE_OQ), _mm256_cmp_ps(fb, fg, _CMP_LE_OQ));
+		const __m256 min_g = _mm256_andnot_ps(min_b, _mm256_cmp_ps(fg, fr, _CMP_LE_OQ));
+
+		__m256i d_max = _mm256_set1_epi32(db);
+		d_max = _mm256_blendv_epi8(d_max, _mm256_set1_epi32(dg), _mm256_castps_si256(max_g));
+		d_max = _mm256_blendv_epi8(d_max, _mm256_set1_epi32(dr), _mm256_castps_si256(max_r));
+
+		__m256i d_min = _mm256_set1_epi32(dr);
+		d_min = _mm256_blendv_epi8(d_min, _mm256_set1_epi32(dg), _mm256_castps_si256(min_g));
+		d_min = _mm256_blendv_epi8(d_min, _mm256_set1_epi32(db), _mm256_castps_si256(min_b));
+
+		const __m256i all = _mm256_set1_epi32(dr + dg + db);
+		const __m256i v0 = AVX2_GATHER(0);
+		const __m256i v1 = _mm256_i32gather_epi32((const int*)lut->table, _mm256_add_epi32(base, d_max), 4);
+		const __m256i v2 = _mm256_i32gather_epi32((const int*)lut->table, _mm256_add_epi32(base, _mm256_sub_epi32(all, d_min)), 4);
+		const __m256i v3 = AVX2_GATHER(dr + dg + db);
+
+		const __m256 w0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), fmax);
+		const __m256 w1 = _mm256_sub_ps(fmax, fmid);
+		const __m256 w2 = _mm256_sub_ps(fmid, fmin);
+		const __m256 w3 = fmin;
+
+		__m256i result = _mm256_and_si256(p, _mm256_set1_epi32(0xff000000));
+		for (int c=0; c < 3; c++) {
+			__m256 z = _mm256_mul_ps(avx2_lut3d_channel(v0, c), w0);
+			z = _mm256_add_ps(z, _mm256_mul_ps(avx2_lut3d_channel(v1, c), w1));
+			z = _mm256_add_ps(z, _mm256_mul_ps(avx2_lut3d_channel(v2, c), w2));
+			z = _mm256_add_ps(z, _mm256_mul_ps(avx2_lut3d_channel(v3, c), w3));
+
+			result = _mm256_or_si256(result, _mm256_slli_epi32(avx2_lut3d_round(z), 8*c));
+		}
+
+		_mm256_storeu_si256((__m256i*)(output + i), result);
+	}
+
+	lut3d_tetrahedral_scalar(lut, input + i, output + i, n - i);
+}
+
+#undef AVX2_GATHER
+#undef AVX2_LUT3D_COORDS
+
+#endif // __AVX2__
+
+
+#if defined(__AVX512F__)
+
+typedef struct {
+	__m512i index;
+	__m512 frac;
+} Avx512Coord;
+
+
+static inline Avx512Coord avx512_lut3d_coord(__m512i x, int size) {
+	const __m512i pos = _mm512_mullo_epi32(x, _mm512_set1_epi32(size - 1));
+
+	__m512i i = _mm512_srli_epi32(_mm512_mullo_epi32(_mm512_add_epi32(pos, _mm512_set1_epi32(1)), _mm512_set1_epi32(257)), 16);
+	i = _mm512_min_epi32(i, _mm512_set1_epi32(size - 2));
+
+	const __m512i f = _mm512_sub_epi32(pos, _mm512_mullo_epi32(i, _mm512_set1_epi32(255)));
+
+	Avx512Coord c;
+	c.index = i;
+	c.frac  = _mm512_mul_ps(_mm512_cvtepi32_ps(f), _mm512_set1_ps(1.0f / 255.0f));
+	return c;
+}
+
+
+static inline __m512 avx512_lut3d_channel(__m512i color, int c) {
+	return _mm512_cvtepi32_ps(_mm512_and_si512(_mm512_srli_epi32(color, 8*c), _mm512_set1_epi32(0xff)));
+}
+
+
+static inline __m512i avx512_lut3d_round(__m512 v) {
+	return _mm512_cvttps_epi32(_mm512_add_ps(v, _mm512_set1_ps(0.5f)));
+}
+
+
+static inline __m512 avx512_lerp_ps(__m512 a, __m512 b, __m512 f) {
+	return _mm512_add_ps(a, _mm512_mul_ps(_mm512_sub_ps(b, a), f));
+}
+
+
+#define AVX512_LUT3D_COORDS									\
+	const __m512i mask = _mm512_set1_epi32(0xff);						\
+	const Avx512Coord R = avx512_lut3d_coord(_mm512_and_si512(p, mask), N);			\
+	const Avx512Coord G = avx512_lut3d_coord(_mm512_and_si512(_mm512_srli_epi32(p, 8), mask), N);	\
+	const Avx512Coord B = avx512_lut3d_coord(_mm512_and_si512(_mm512_srli_epi32(p, 16), mask), N);	\
+	const __m512i base = _mm512_add_epi32(R.index,						\
+	                     _mm512_add_epi32(_mm512_mullo_epi32(G.index, _mm512_set1_epi32(dg)),	\
+	                                      _mm512_mullo_epi32(B.index, _mm512_set1_epi32(db))));
+
+
+#define AVX512_GATHER(offset) \
+	_mm512_i32gather_epi32(_mm512_add_epi32(base, (offset)), (const int*)lut->table, 4)
+
+
+// the tail is processed with masked load and store (gathers use valid indices of zero pixels)
+#define AVX512_LUT3D_LOOP(kernel)								\
+	size_t i = 0;										\
+	for (/**/; i + 16 <= n; i += 16) {							\
+		const __m512i p = _mm512_loadu_si512((const __m512i*)(input + i));		\
+		_mm512_storeu_si512((__m512i*)(output + i), kernel(lut, p));			\
+	}											\
+												\
+	if (i < n) {										\
+		const __mmask16 m = (__mmask16)((1u << (n - i)) - 1);				\
+		const __m512i p = _mm512_maskz_loadu_epi32(m, input + i);			\
+		_mm512_mask_storeu_epi32(output + i, m, kernel(lut, p));			\
+	}
+
+
+static inline __m512i avx512_trilinear_kernel(const Lut3D* lut, __m512i p) {
+	const int N  = lut->size;
+	const int dr = 1;
+	const int dg = N;
+	const int db = N*N;
+
+	AVX512_LUT3D_COORDS
+
+	const __m512i v000 = AVX512_GATHER(_mm512_set1_epi32(0));
+	const __m512i v100 = AVX512_GATHER(_mm512_set1_epi32(dr));
+	const __m512i v010 = AVX512_GATHER(_mm512_set1_epi32(dg));
+	const __m512i v110 = AVX512_GATHER(_mm512_set1_epi32(dr + dg));
+	const __m512i v001 = AVX512_GATHER(_mm512_set1_epi32(db));
+	const __m512i v101 = AVX512_GATHER(_mm512_set1_epi32(dr + db));
+	const __m512i v011 = AVX512_GATHER(_mm512_set1_epi32(dg + db));
+	const __m512i v111 = AVX512_GATHER(_mm512_set1_epi32(dr + dg + db));
+
+	__m512i result = _mm512_and_si512(p, _mm512_set1_epi32(0xff000000));
+	for (int c=0; c < 3; c++) {
+		const __m512 x00 = avx512_lerp_ps(avx512_lut3d_channel(v000, c), avx512_lut3d_channel(v100, c), R.frac);
+		const __m512 x10 = avx512_lerp_ps(avx512_lut3d_channel(v010, c), avx512_lut3d_channel(v110, c), R.frac);
+		const __m512 x01 = avx512_lerp_ps(avx512_lut3d_channel(v001, c), avx512_lut3d_channel(v101, c), R.frac);
+		const __m512 x11 = avx512_lerp_ps(avx512_lut3d_channel(v011, c), avx512_lut3d_channel(v111, c), R.frac);
+
+		const __m512 y0 = avx512_lerp_ps(x00, x10, G.frac);
+		const __m512 y1 = avx512_lerp_ps(x01, x11, G.frac);
+
+		const __m512 z = avx512_lerp_ps(y0, y1, B.frac);
+
+		result = _mm512_or_si512(result, _mm512_slli_epi32(avx512_lut3d_round(z), 8*c));
+	}
+
+	return result;
+}
+
+
+static inline __m512i avx512_tetrahedral_kernel(const Lut3D* lut, __m512i p) {
+	const int N  = lut->size;
+	const int dr = 1;
+	const int dg = N;
+	const int db = N*N;
+
+	AVX512_LUT3D_COORDS
+
+	const __m512 fr = R.frac;
+	const __m512 fg = G.frac;
+	const __m512 fb = B.frac;
+
+	const __m512 fmax = _mm512_max_ps(_mm512_max_ps(fr, fg), fb);
+	const __m512 fmin = _mm512_min_ps(_mm512_min_ps(fr, fg), fb);
+	const __m512 fmid = _mm512_max_ps(_mm512_min_ps(fr, fg), _mm512_min_ps(_mm512_max_ps(fr, fg), fb));
+
+	const __mmask16 max_r = _mm512_cmp_ps_mask(fr, fg, _CMP_GE_OQ) & _mm512_cmp_ps_mask(fr, fb, _CMP_GE_OQ);
+	const __mmask16 max_g = ~max_r & _mm512_cmp_ps_mask(fg, fb, _CMP_GE_OQ);
+	const __mmask16 min_b = _mm512_cmp_ps_mask(fb, fr, _CMP_LE_OQ) & _mm512_cmp_ps_mask(fb, fg, _CMP_LE_OQ);
+	const __mmask16 min_g = ~min_b & _mm512_cmp_ps_mask(fg, fr, _CMP_LE_OQ);
+
+	__m512i d_max = _mm512_set1_epi32(db);
+	d_max = _mm512_mask_mov_epi32(d_max, max_g, _mm512_set1_epi32(dg));
+	d_max = _mm512_mask_mov_epi32(d_max, max_r, _mm512_set1_epi32(dr));
+
+	__m512i d_min = _mm512_set1_epi32(dr);
+	d_min = _mm512_mask_mov_epi32(d_min, min_g, _mm512_set1_epi32(dg));
+	d_min = _mm512_mask_mov_epi32(d_min, min_b, _mm512_set1_epi32(db));
+
+	const __m512i all = _mm512_set1_epi32(dr + dg + db);
+	const __m512i v0 = AVX512_GATHER(_mm512_setzero_si512());
+	const __m512i v1 = AVX512_GATHER(d_max);
+	const __m512i v2 = AVX512_GATHER(_mm512_sub_epi32(all, d_min));
+	const __m512i v3 = AVX512_GATHER(all);
+
+	const __m512 w0 = _mm512_sub_ps(_mm512_set1_ps(1.0f), fmax);
+	const __m512 w1 = _mm512_sub_ps(fmax, fmid);
+	const __m512 w2 = _mm512_sub_ps(fmid, fmin);
+	const __m512 w3 = fmin;
+
+	__m512i result = _mm512_and_si512(p, _mm512_set1_epi32(0xff000000));
+	for (int c=0; c < 3; c++) {
+		__m512 z = _mm512_mul_ps(avx512_lut3d_channel(v0, c), w0);
+		z = _mm512_add_ps(z, _mm512_mul_ps(avx512_lut3d_channel(v1, c), w1));
+		z = _mm512_add_ps(z, _mm512_mul_ps(avx512_lut3d_channel(v2, c), w2));
+		z = _mm512_add_ps(z, _mm512_mul_ps(avx512_lut3d_channel(v3, c), w3));
+
+		result = _mm512_or_si512(result, _mm512_slli_epi32(avx512_lut3d_round(z), 8*c));
+	}
+
+	return result;
+}
+
+
+void lut3d_trilinear_avx512(const Lut3D* lut, const uint32_t* input, uint32_t* output, size_t n) {
+	AVX512_LUT3D_LOOP(avx512_trilinear_kernel)
+}
+
+
+void lut3d_tetrahedral_avx512(const Lut3D* lut, const uint32_t* input, uint32_t* output, size_t n) {
+	AVX512_LUT3D_LOOP(avx512_tetrahedral_kernel)
+}
+
+#undef AVX512_LUT3D_LOOP
+#undef AVX512_GATHER
+#undef AVX512_LUT3D_COORDS
+
+#endif // __AVX512F__
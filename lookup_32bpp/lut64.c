@@ -0,0 +1,332 @@
+/*
+	Lookup-based 32bpp pixels transformations --- 64-bit code
+
+	* lut_engine.c --- four 1D tables (like lookup_32bpp.c), AVX2 and
+	                   AVX512VBMI implementations choose between byte
+	                   shuffles and gathers for each table;
+	* lut3d.c      --- 3D color lookup tables with trilinear and
+	                   tetrahedral interpolation, AVX2 and AVX512F.
+
+	Usage:
+
+	$ ./lut64_avx512 verify
+	$ ./lut64_avx512 bench [width height]
+
+	Author: Wojciech Muła
+	License: BSD
+*/
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <immintrin.h>
+
+#include "lut_engine.c"
+#include "lut3d.c"
+
+
+typedef void (*lut_function)(const LutEngine* e, const uint32_t* input, uint32_t* output, size_t n);
+typedef void (*lut3d_function)(const Lut3D* lut, const uint32_t* input, uint32_t* output, size_t n);
+
+
+typedef struct {
+	const char* name;
+	lut_function fun;
+	LutMode min_mode;
+	int prefer_gathers;
+} LutVariant;
+
+
+static const LutVariant lut_variants[] = {
+	{"convert", lut_scalar, LUT_IDENTITY, 0},
+#if defined(__AVX2__)
+	{"AVX2", lut_avx2, LUT_IDENTITY, 1},
+	{"AVX2 pshufb", lut_avx2, LUT_IDENTITY, 0},
+	{"AVX2 gather", lut_avx2, LUT_GATHER, 0},
+#endif
+#if defined(__AVX512VBMI__)
+	{"AVX512", lut_avx512, LUT_IDENTITY, 0},
+	{"AVX512 gather", lut_avx512, LUT_GATHER, 0},
+#endif
+};
+
+
+typedef struct {
+	const char* name;
+	lut3d_function fun;
+} Lut3DVariant;
+
+
+static const Lut3DVariant lut3d_variants[] = {
+	{"trilinear scalar",	lut3d_trilinear_scalar},
+	{"tetrahedral scalar",	lut3d_tetrahedral_scalar},
+#if defined(__AVX2__)
+	{"trilinear AVX2",	lut3d_trilinear_avx2},
+	{"tetrahedral AVX2",	lut3d_tetrahedral_avx2},
+#endif
+#if defined(__AVX512F__)
+	{"trilinear AVX512",	lut3d_trilinear_avx512},
+	{"tetrahedral AVX512",	lut3d_tetrahedral_avx512},
+#endif
+};
+
+#define COUNT(array) (sizeof(array)/sizeof(array[0]))
+
+
+//=== sample tables ======================================================
+
+typedef struct {
+	const char* name;
+	uint32_t R[256], G[256], B[256], A[256];
+} Tables;
+
+#define TABLE_SETS 3
+
+
+// 0: gamma for colors, alpha not changed (byte tables and identity)
+// 1: gamma and R/B swap (gathers for R and B)
+// 2: inverted colors and alpha (byte tables)
+void init_tables(Tables* t, int set) {
+	static const char* names[TABLE_SETS] = {"gamma", "gamma+swap", "invert"};
+
+	t->name = names[set];
+	for (uint32_t x=0; x < 256; x++) {
+		const uint32_t gamma = (uint32_t)(255.0 * pow(x / 255.0, 1/2.2) + 0.5);
+		switch (set) {
+			case 0:
+				t->R[x] = gamma;
+				t->G[x] = gamma << 8;
+				t->B[x] = gamma << 16;
+				t->A[x] = x << 24;
+				break;
+			case 1:
+				t->R[x] = gamma << 16;
+				t->G[x] = gamma << 8;
+				t->B[x] = gamma;
+				t->A[x] = x << 24;
+				break;
+			case 2:
+				t->R[x] = 255 - x;
+				t->G[x] = (255 - x) << 8;
+				t->B[x] = (255 - x) << 16;
+				t->A[x] = (255 - x) << 24;
+				break;
+		}
+	}
+}
+
+
+void* alloc(size_t size) {
+	void* ptr = NULL;
+	if (posix_memalign(&ptr, 64, size) != 0) {
+		puts("ERROR: out of memory");
+		exit(EXIT_FAILURE);
+	}
+
+	return ptr;
+}
+
+
+static uint32_t seed = 1;
+
+uint32_t random32(void) {
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) | (seed << 16);
+}
+
+
+//=== verification =======================================================
+
+int verify(void) {
+	const size_t size = 4096;
+	uint32_t* input    = (uint32_t*)alloc(size * 4);
+	uint32_t* expected = (uint32_t*)alloc(size * 4);
+	uint32_t* result   = (uint32_t*)alloc(size * 4);
+
+	for (size_t i=0; i < size; i++)
+		input[i] = random32();
+
+	int failed = 0;
+
+	// 1D
+	for (int set=0; set < TABLE_SETS; set++) {
+		Tables t;
+		init_tables(&t, set);
+
+		for (size_t v=1; v < COUNT(lut_variants); v++) {
+			LutEngine e;
+			lut_engine_init(&e, t.R, t.G, t.B, t.A, lut_variants[v].min_mode);
+			if (lut_variants[v].prefer_gathers)
+				lut_engine_prefer_gathers(&e);
+
+			int ok = 1;
+			for (size_t n=0; n <= 100 && ok; n++) {
+				for (size_t ofs=0; ofs < 8 && ok; ofs++) {
+					lut_scalar(&e, input + ofs, expected, n);
+					memset(result, 0, n * 4);
+					lut_variants[v].fun(&e, input + ofs, result, n);
+
+					if (memcmp(expected, result, n * 4) != 0)
+						ok = 0;
+				}
+			}
+
+			lut_scalar(&e, input, expected, size);
+			lut_variants[v].fun(&e, input, result, size);
+			if (memcmp(expected, result, size * 4) != 0)
+				ok = 0;
+
+			printf("%-10s %-14s %s [%s %s %s %s]\n", t.name, lut_variants[v].name, ok ? "OK" : "FAILED",
+			       lut_mode_name[e.mode[0]], lut_mode_name[e.mode[1]],
+			       lut_mode_name[e.mode[2]], lut_mode_name[e.mode[3]]);
+
+			failed |= !ok;
+		}
+	}
+
+	// 3D: all colors
+	const int sizes[] = {2, 17, 33};
+	for (size_t s=0; s < COUNT(sizes); s++) {
+		Lut3D lut;
+		lut3d_init(&lut, sizes[s]);
+
+		for (size_t v=2; v < COUNT(lut3d_variants); v++) {
+			const lut3d_function reference = lut3d_variants[v % 2].fun;
+
+			int ok = 1;
+			for (uint32_t color=0; color < (1u << 24) && ok; color += size) {
+				for (size_t i=0; i < size; i++)
+					input[i] = (color + i) | (random32() & 0xff000000);
+
+				reference(&lut, input, expected, size);
+				lut3d_variants[v].fun(&lut, input, result, size);
+
+				if (memcmp(expected, result, size * 4) != 0)
+					ok = 0;
+			}
+
+			// tails
+			for (size_t n=0; n <= 40 && ok; n++) {
+				memset(result, 0, size * 4);
+				reference(&lut, input, expected, n);
+				lut3d_variants[v].fun(&lut, input, result, n);
+				if (memcmp(expected, result, n * 4) != 0 || result[n] != 0)
+					ok = 0;
+			}
+
+			printf("3D LUT %2d^3 %-18s %s\n", sizes[s], lut3d_variants[v].name, ok ? "OK" : "FAILED");
+			failed |= !ok;
+		}
+
+		lut3d_free(&lut);
+	}
+
+	free(input);
+	free(expected);
+	free(result);
+
+	puts(failed ? "verification failed" : "all OK");
+	return failed;
+}
+
+
+//=== benchmark ==========================================================
+
+double get_time(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+#define REPEAT 5
+
+int bench(int width, int height) {
+	const size_t n = (size_t)width * height;
+	uint32_t* input  = (uint32_t*)alloc(n * 4);
+	uint32_t* output = (uint32_t*)alloc(n * 4);
+
+	for (size_t i=0; i < n; i++)
+		input[i] = random32();
+	memset(output, 0, n * 4);
+
+	printf("image %d x %d, Mpix/s\n", width, height);
+
+	for (int set=0; set < TABLE_SETS; set++) {
+		Tables t;
+		init_tables(&t, set);
+
+		double base = 0.0;
+		for (size_t v=0; v < COUNT(lut_variants); v++) {
+			LutEngine e;
+			lut_engine_init(&e, t.R, t.G, t.B, t.A, lut_variants[v].min_mode);
+			if (lut_variants[v].prefer_gathers)
+				lut_engine_prefer_gathers(&e);
+
+			double best = 1e30;
+			for (int k=0; k < REPEAT; k++) {
+				const double t1 = get_time();
+				lut_variants[v].fun(&e, input, output, n);
+				const double t2 = get_time();
+				if (t2 - t1 < best)
+					best = t2 - t1;
+			}
+
+			if (v == 0)
+				base = best;
+
+			printf("1D %-10s %-14s %8.1f  (%.2f)\n", t.name, lut_variants[v].name, n / best / 1e6, base / best);
+		}
+	}
+
+	const int sizes[] = {17, 33};
+	for (size_t s=0; s < COUNT(sizes); s++) {
+		Lut3D lut;
+		lut3d_init(&lut, sizes[s]);
+
+		for (size_t v=0; v < COUNT(lut3d_variants); v++) {
+			double best = 1e30;
+			for (int k=0; k < REPEAT; k++) {
+				const double t1 = get_time();
+				lut3d_variants[v].fun(&lut, input, output, n);
+				const double t2 = get_time();
+				if (t2 - t1 < best)
+					best = t2 - t1;
+			}
+
+			printf("3D %2d^3 %-18s %8.1f\n", sizes[s], lut3d_variants[v].name, n / best / 1e6);
+		}
+
+		lut3d_free(&lut);
+	}
+
+	free(input);
+	free(output);
+	return 0;
+}
+
+
+int main(int argc, char* argv[]) {
+	if (argc >= 2 && strcmp(argv[1], "verify") == 0)
+		return verify();
+
+	if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+		const int width  = (argc >= 3) ? atoi(argv[2]) : 1024;
+		const int height = (argc >= 4) ? atoi(argv[3]) : 768;
+		if (width <= 0 || height <= 0) {
+			puts("invalid image size");
+			return 1;
+		}
+
+		return bench(width, height);
+	}
+
+	puts("1. progname verify");
+	puts("2. progname bench [width height]");
+	return 1;
+}
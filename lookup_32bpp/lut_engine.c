@@ -0,0 +1,280 @@
+//=== 1D lookup tables ====================================================
+
+/*
+	The transformation from lookup_32bpp.c, i.e.
+
+		output = LUT_R[R] | LUT_G[G] | LUT_B[B] | LUT_A[A]
+
+	Tables are examined once, each gets one of modes:
+
+	* identity --- LUT_c[x] == x << 8c, the byte is copied;
+	* byte     --- LUT_c[x] has no bits outside byte c, thus the table
+	               is in fact a 256-byte table and can be looked up with
+	               byte shuffles (VPERMB, PSHUFB);
+	* gather   --- any other table (a value can affect other channels),
+	               32-bit values are fetched with gathers.
+*/
+
+typedef enum {
+	LUT_IDENTITY,
+	LUT_BYTE,
+	LUT_GATHER
+} LutMode;
+
+
+static const char* lut_mode_name[] = {"identity", "byte", "gather"};
+
+
+typedef struct {
+	uint8_t bytes[4][256] __attribute__((aligned(64)));	// tables in byte mode
+	const uint32_t* table[4];
+	LutMode mode[4];
+} LutEngine;
+
+
+// min_mode = LUT_GATHER forces gathers for all tables
+void lut_engine_init(LutEngine* e, const uint32_t* R, const uint32_t* G, const uint32_t* B, const uint32_t* A,
+                     LutMode min_mode) {
+	const uint32_t* tables[4] = {R, G, B, A};
+
+	for (int c=0; c < 4; c++) {
+		const int shift = 8 * c;
+		int identity = 1;
+		int bytes = 1;
+		for (int x=0; x < 256; x++) {
+			const uint32_t v = tables[c][x];
+			identity = identity && (v == ((uint32_t)x << shift));
+			bytes    = bytes && ((v & ~(0xffu << shift)) == 0);
+
+			e->bytes[c][x] = v >> shift;
+		}
+
+		e->table[c] = tables[c];
+		e->mode[c]  = identity ? LUT_IDENTITY : bytes ? LUT_BYTE : LUT_GATHER;
+		if (e->mode[c] < min_mode)
+			e->mode[c] = min_mode;
+	}
+}
+
+
+// On AVX2 PSHUFB-based lookup of 256-byte table (16 shuffles) is slower
+// than a gather, thus this is the policy for lut_avx2.
+void lut_engine_prefer_gathers(LutEngine* e) {
+	for (int c=0; c < 4; c++)
+		if (e->mode[c] == LUT_BYTE)
+			e->mode[c] = LUT_GATHER;
+}
+
+
+// the same as convert()
+void lut_scalar(const LutEngine* e, const uint32_t* input, uint32_t* output, size_t n) {
+	for (size_t i=0; i < n; i++) {
+		const uint32_t p = input[i];
+		output[i] = e->table[0][p & 0xff]
+		          | e->table[1][(p >> 8) & 0xff]
+		          | e->table[2][(p >> 16) & 0xff]
+		          | e->table[3][p >> 24];
+	}
+}
+
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+/*
+	AVX2: 32 pixels are split into four vectors of single channel (an
+	in-lane byte shuffle and a 4x4 transposition of dwords, both are
+	inverted at the end).  A byte table is looked up as 16 tables of 16
+	bytes: PSHUFB with the lower nibble, the result is kept for bytes
+	with matching higher nibble.
+*/
+
+static inline __m256i avx2_lookup256(__m256i x, const uint8_t* table) {
+	const __m256i lo = _mm256_and_si256(x, _mm256_set1_epi8(0x0f));
+	const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), _mm256_set1_epi8(0x0f));
+
+	__m256i result = _mm256_setzero_si256();
+	for (int k=0; k < 16; k++) {
+		const __m256i t = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)(table + 16*k)));
+		const __m256i m = _mm256_cmpeq_epi8(hi, _mm256_set1_epi8(k));
+		result = _mm256_or_si256(result, _mm256_and_si256(_mm256_shuffle_epi8(t, lo), m));
+	}
+
+	return result;
+}
+
+
+static inline void avx2_transpose4x4_epi32(__m256i* a, __m256i* b, __m256i* c, __m256i* d) {
+	const __m256i t0 = _mm256_unpacklo_epi32(*a, *b);
+	const __m256i t1 = _mm256_unpackhi_epi32(*a, *b);
+	const __m256i t2 = _mm256_unpacklo_epi32(*c, *d);
+	const __m256i t3 = _mm256_unpackhi_epi32(*c, *d);
+
+	*a = _mm256_unpacklo_epi64(t0, t2);
+	*b = _mm256_unpackhi_epi64(t0, t2);
+	*c = _mm256_unpacklo_epi64(t1, t3);
+	*d = _mm256_unpackhi_epi64(t1, t3);
+}
+
+
+static inline __m256i avx2_gather_channel(__m256i p, const uint32_t* table, int c) {
+	const __m256i idx = _mm256_and_si256(_mm256_srli_epi32(p, 8*c), _mm256_set1_epi32(0xff));
+	return _mm256_i32gather_epi32((const int*)table, idx, 4);
+}
+
+
+void lut_avx2(const LutEngine* e, const uint32_t* input, uint32_t* output, size_t n) {
+	// r0 r1 r2 r3 g0 g1 ... => [r0 r1 r2 r3] [g0 g1 g2 g3] ...
+	const __m256i group = _mm256_setr_epi8(
+		0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+		0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+	const __m256i ungroup = group;	// the permutation is an involution
+
+	int any_bytes = 0;
+	int any_gather = 0;
+	for (int c=0; c < 4; c++) {
+		any_bytes  |= (e->mode[c] == LUT_BYTE);
+		any_gather |= (e->mode[c] == LUT_GATHER);
+	}
+
+	size_t i = 0;
+	for (/**/; i + 32 <= n; i += 32) {
+		__m256i v[4];
+		for (int k=0; k < 4; k++)
+			v[k] = _mm256_loadu_si256((const __m256i*)(input + i + 8*k));
+
+		__m256i result[4];
+		if (any_bytes) {
+			__m256i plane[4];
+			for (int k=0; k < 4; k++)
+				plane[k] = _mm256_shuffle_epi8(v[k], group);
+
+			avx2_transpose4x4_epi32(&plane[0], &plane[1], &plane[2], &plane[3]);
+
+			for (int c=0; c < 4; c++) {
+				switch (e->mode[c]) {
+					case LUT_IDENTITY:
+						break;
+					case LUT_BYTE:
+						plane[c] = avx2_lookup256(plane[c], e->bytes[c]);
+						break;
+					case LUT_GATHER:
+						plane[c] = _mm256_setzero_si256();
+						break;
+				}
+			}
+
+			avx2_transpose4x4_epi32(&plane[0], &plane[1], &plane[2], &plane[3]);
+			for (int k=0; k < 4; k++)
+				result[k] = _mm256_shuffle_epi8(plane[k], ungroup);
+		} else {
+			// only identities and gathers
+			uint32_t keep = 0;
+			for (int c=0; c < 4; c++)
+				if (e->mode[c] == LUT_IDENTITY)
+					keep |= 0xffu << (8*c);
+
+			for (int k=0; k < 4; k++)
+				result[k] = _mm256_and_si256(v[k], _mm256_set1_epi32(keep));
+		}
+
+		if (any_gather) {
+			for (int c=0; c < 4; c++) {
+				if (e->mode[c] != LUT_GATHER)
+					continue;
+
+				for (int k=0; k < 4; k++)
+					result[k] = _mm256_or_si256(result[k], avx2_gather_channel(v[k], e->table[c], c));
+			}
+		}
+
+		for (int k=0; k < 4; k++)
+			_mm256_storeu_si256((__m256i*)(output + i + 8*k), result[k]);
+	}
+
+	lut_scalar(e, input + i, output + i, n - i);
+}
+
+#endif // __AVX2__
+
+
+#if defined(__AVX512VBMI__)
+
+/*
+	AVX512VBMI: a byte table occupies four registers; VPERMI2B looks up
+	128-byte halves, the 7th bit of index selects the half.  Results are
+	merged only into bytes of the given channel.  The tail is processed
+	with masked load and store.
+*/
+
+typedef struct {
+	__m512i t[4][4];	// byte tables
+	__m512i keep;		// bytes copied (identity tables)
+	int any_bytes;
+	int any_gather;
+} Avx512Lut;
+
+
+static inline __m512i avx512_lut_pixels(const LutEngine* e, const Avx512Lut* L, __m512i v) {
+	__m512i result = _mm512_and_si512(v, L->keep);
+
+	if (L->any_bytes) {
+		const __mmask64 upper = _mm512_movepi8_mask(v);
+		for (int c=0; c < 4; c++) {
+			if (e->mode[c] != LUT_BYTE)
+				continue;
+
+			const __mmask64 channel = 0x1111111111111111llu << c;
+			const __m512i lo = _mm512_permutex2var_epi8(L->t[c][0], v, L->t[c][1]);
+			const __m512i hi = _mm512_permutex2var_epi8(L->t[c][2], v, L->t[c][3]);
+			result = _mm512_mask_mov_epi8(result, channel & ~upper, lo);
+			result = _mm512_mask_mov_epi8(result, channel & upper, hi);
+		}
+	}
+
+	if (L->any_gather) {
+		for (int c=0; c < 4; c++) {
+			if (e->mode[c] != LUT_GATHER)
+				continue;
+
+			const __m512i idx = _mm512_and_si512(_mm512_srli_epi32(v, 8*c), _mm512_set1_epi32(0xff));
+			result = _mm512_or_si512(result, _mm512_i32gather_epi32(idx, (const int*)e->table[c], 4));
+		}
+	}
+
+	return result;
+}
+
+
+void lut_avx512(const LutEngine* e, const uint32_t* input, uint32_t* output, size_t n) {
+	Avx512Lut L;
+
+	uint32_t keep = 0;
+	L.any_bytes  = 0;
+	L.any_gather = 0;
+	for (int c=0; c < 4; c++) {
+		for (int k=0; k < 4; k++)
+			L.t[c][k] = _mm512_load_si512((const __m512i*)(e->bytes[c] + 64*k));
+
+		if (e->mode[c] == LUT_IDENTITY)
+			keep |= 0xffu << (8*c);
+
+		L.any_bytes  |= (e->mode[c] == LUT_BYTE);
+		L.any_gather |= (e->mode[c] == LUT_GATHER);
+	}
+	L.keep = _mm512_set1_epi32(keep);
+
+	size_t i = 0;
+	for (/**/; i + 16 <= n; i += 16) {
+		const __m512i v = _mm512_loadu_si512((const __m512i*)(input + i));
+		_mm512_storeu_si512((__m512i*)(output + i), avx512_lut_pixels(e, &L, v));
+	}
+
+	if (i < n) {
+		const __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+		const __m512i v = _mm512_maskz_loadu_epi32(m, input + i);
+		_mm512_mask_storeu_epi32(output + i, m, avx512_lut_pixels(e, &L, v));
+	}
+}
+
+#endif // __AVX512VBMI__
@@ -0,0 +1,30 @@
+#!/bin/bash
+
+_1MB=1048576
+_10MB=10485760
+_100MB=104857600
+
+TOTAL_SIZE="$_1MB $_10MB $_100MB"
+ALLOC_RANGE="16:64 16:512 1:2048"
+ALLOCATOR="glibc slab"
+PATTERN="leak random fifo"
+THREADS="1 4"
+
+for total_size in ${TOTAL_SIZE}
+do
+    for range in ${ALLOC_RANGE}
+    do
+        min=${range%:*}
+        max=${range#*:}
+        for pattern in ${PATTERN}
+        do
+            for threads in ${THREADS}
+            do
+                for allocator in ${ALLOCATOR}
+                do
+                    ./test ${total_size} ${min} ${max} ${allocator} ${pattern} ${threads}
+                done
+            done
+        done
+    done
+done
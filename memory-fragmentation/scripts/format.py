@@ -27,7 +27,7 @@ def render(data):
                 format(record.malloc_waste_perc, '.2f'),
             ])
 
-    print table
+    print(table)
 
 
 if __name__ == '__main__':
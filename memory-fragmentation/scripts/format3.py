@@ -0,0 +1,36 @@
+import sys
+from parse import load
+from table import Table
+
+def main():
+    d = load(sys.argv[1])
+    render(d)
+
+
+def render(data):
+    table = Table()
+    table.add_header([("allocations", 6), ("result", 4)])
+    table.add_header(["allocator", "pattern", "threads", "min [B]", "max [B]", "live [B]",
+                      "ops/s", "RSS [B]", "RSS/live", "waste [%]"])
+
+    for size in sorted(data):
+        table.add_row([("approx target memory usage: %s" % format(size, ',d'), 10)])
+        for record in data[size]:
+            table.add_row([
+                record.allocator,
+                record.pattern,
+                str(record.threads),
+                format(record.min_alloc, ',d'),
+                format(record.max_alloc, ',d'),
+                format(record.sum_allocated, ',d'),
+                format(record.ops_per_sec, ',d'),
+                format(record.rss, ',d'),
+                format(float(record.rss) / record.sum_allocated, '.2f'),
+                format(record.malloc_waste_perc, '.2f'),
+            ])
+
+    print(table)
+
+
+if __name__ == '__main__':
+    main()
@@ -6,15 +6,31 @@ def load_raw(path):
     result = []
     with open(path, 'rt') as f:
         for line in f:
-            F = map(int, line.split())
+            F = line.split()
+            N = list(map(int, F[:10]))
             r = Record()
-            r.memory_usage_limit = F[0]
-            r.min_alloc = F[1]
-            r.max_alloc = F[2]
-            r.sum_allocated = F[3]
-            r.malloc_calls = F[4]
-            r.malloc_allocated = F[5]
-            r.malloc_free = F[6]
+            r.memory_usage_limit = N[0]
+            r.min_alloc = N[1]
+            r.max_alloc = N[2]
+            r.sum_allocated = N[3]
+            r.malloc_calls = N[4]
+            r.malloc_allocated = N[5]
+            r.malloc_free = N[6]
+            if len(F) >= 12:
+                r.free_calls = N[7]
+                r.ops_per_sec = N[8]
+                r.rss = N[9]
+                r.allocator = F[10]
+                r.pattern = F[11]
+                r.threads = int(F[12]) if len(F) >= 13 else 1
+            else:
+                r.free_calls = 0
+                r.ops_per_sec = 0
+                r.rss = 0
+                r.allocator = 'glibc'
+                r.pattern = 'leak'
+                r.threads = 1
+
             r.malloc_waste = r.malloc_allocated - (r.malloc_free + r.sum_allocated)
             r.malloc_waste_perc = 100.0 * r.malloc_waste / r.malloc_allocated
             result.append(r)
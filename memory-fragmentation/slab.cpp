@@ -0,0 +1,320 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/*
+    Size-class slab allocator.
+
+    Sizes are rounded up to a size class: multiples of 16 up to 256 bytes,
+    then eight classes per power of two (288, 320, ..., 512, 576, ...) up to
+    max_size; larger requests go to malloc. The rounding wastes at most 12.5%
+    for blocks larger than 256 bytes.
+
+    Memory is taken from the system in 2 MB chunks; blocks of all classes
+    are bump-allocated from the current chunk. A freed block goes to the
+    free list of its class and is reused by the next allocation of that
+    class --- blocks are never split or merged, thus a chunk cannot be
+    fragmented by blocks of other classes.
+
+    Each thread uses its own SlabAllocator::Cache, which keeps short free
+    lists per class and exchanges batches of blocks with the shared
+    allocator (one lock per batch). A batch is at most batch_bytes long
+    (and at most 32 blocks), so refills of large classes don't take much
+    more memory than needed. All memory is returned at once by
+    release_all(); there's no per-block cleanup needed.
+
+    The size of a block must be given to deallocate (like sized delete).
+*/
+
+class SlabAllocator {
+
+public:
+    static const size_t chunk_size = 2 * 1024 * 1024;
+    static const size_t max_size   = 32 * 1024;
+    static const size_t max_batch   = 32;          // blocks moved between cache and allocator
+    static const size_t batch_bytes = 8 * 1024;    // ... but not more bytes than this
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    // singly-linked list with its length
+    struct FreeList {
+        FreeBlock* head = nullptr;
+        size_t     count = 0;
+
+        void push(void* ptr) {
+            auto block = static_cast<FreeBlock*>(ptr);
+            block->next = head;
+            head = block;
+            count += 1;
+        }
+
+        void* pop() {
+            auto block = head;
+            head = block->next;
+            count -= 1;
+
+            return block;
+        }
+    };
+
+    std::mutex mutex;
+    std::vector<FreeList> free_lists;   // per class
+    std::vector<char*> chunks;
+    char*  bump;                        // free space in the last chunk
+    size_t bump_left;
+    size_t bytes_used;                  // bump-allocated from chunks
+    std::atomic<size_t> large_bytes;
+    std::atomic<unsigned> generation;   // incremented by release_all
+
+public:
+    SlabAllocator()
+        : free_lists(class_count())
+        , bump(nullptr)
+        , bump_left(0)
+        , bytes_used(0)
+        , large_bytes(0)
+        , generation(0) {}
+
+    ~SlabAllocator() {
+        release_all();
+    }
+
+    SlabAllocator(const SlabAllocator&) = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+public:
+    // --- size classes ---
+
+    static size_t class_count() {
+        return size_class(max_size) + 1;
+    }
+
+    static size_t size_class(size_t size) {
+        if (size <= 256) {
+            return (size == 0) ? 0 : (size - 1) / 16;
+        }
+
+        // 8 classes per power of two, starting at (256, 512]
+        const int log2  = 63 - __builtin_clzll(size - 1);   // size in (2^log2, 2^(log2+1)]
+        const size_t step = size_t(1) << (log2 - 3);
+        const size_t sub  = (size - 1 - (size_t(1) << log2)) / step;
+
+        return 16 + (log2 - 8) * 8 + sub;
+    }
+
+    static size_t class_size(size_t cls) {
+        if (cls < 16) {
+            return (cls + 1) * 16;
+        }
+
+        const size_t log2 = (cls - 16) / 8 + 8;
+        const size_t sub  = (cls - 16) % 8;
+
+        return (size_t(1) << log2) + (sub + 1) * (size_t(1) << (log2 - 3));
+    }
+
+    // size actually used by a block of given size
+    static size_t rounded_size(size_t size) {
+        return (size > max_size) ? size : class_size(size_class(size));
+    }
+
+    // number of blocks moved at once: 32 for classes up to 256 bytes,
+    // a single block for classes larger than batch_bytes/2
+    static size_t batch(size_t cls) {
+        const size_t count = batch_bytes / class_size(cls);
+        if (count == 0) {
+            return 1;
+        }
+
+        return (count < max_batch) ? count : max_batch;
+    }
+
+    // --- statistics ---
+
+    // memory taken from the system
+    size_t reserved() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return chunks.size() * chunk_size + large_bytes;
+    }
+
+    // memory of blocks ever handed out (live or in free lists)
+    size_t used() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return bytes_used + large_bytes;
+    }
+
+    // Frees all chunks; blocks allocated so far become invalid, blocks kept
+    // in caches are dropped by caches themselves.
+    void release_all() {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (auto chunk: chunks) {
+            free(chunk);
+        }
+
+        chunks.clear();
+        for (auto& list: free_lists) {
+            list = FreeList();
+        }
+
+        bump = nullptr;
+        bump_left = 0;
+        bytes_used = 0;
+        generation += 1;
+    }
+
+public:
+    class Cache {
+        SlabAllocator& parent;
+        std::vector<FreeList> lists;
+        unsigned generation;
+
+    public:
+        explicit Cache(SlabAllocator& parent)
+            : parent(parent)
+            , lists(class_count())
+            , generation(parent.generation) {}
+
+        ~Cache() {
+            flush();
+        }
+
+        Cache(const Cache&) = delete;
+        Cache& operator=(const Cache&) = delete;
+
+        void* allocate(size_t size) {
+            if (size > max_size) {
+                return parent.allocate_large(size);
+            }
+
+            check_generation();
+
+            const size_t cls = size_class(size);
+            FreeList& list = lists[cls];
+            if (list.head == nullptr) {
+                parent.refill(cls, list);
+            }
+
+            return list.pop();
+        }
+
+        void deallocate(void* ptr, size_t size) {
+            if (size > max_size) {
+                parent.deallocate_large(ptr, size);
+                return;
+            }
+
+            check_generation();
+
+            const size_t cls = size_class(size);
+            FreeList& list = lists[cls];
+            list.push(ptr);
+            const size_t n = batch(cls);
+            if (list.count >= 2 * n) {
+                parent.take_back(cls, list, n);
+            }
+        }
+
+        // returns all cached blocks to allocator
+        void flush() {
+            if (generation != parent.generation) {
+                return;
+            }
+
+            for (size_t cls=0; cls < lists.size(); cls++) {
+                if (lists[cls].count > 0) {
+                    parent.take_back(cls, lists[cls], lists[cls].count);
+                }
+            }
+        }
+
+    private:
+        void check_generation() {
+            const unsigned current = parent.generation;
+            if (generation != current) {
+                // the blocks were freed by release_all
+                for (auto& list: lists) {
+                    list = FreeList();
+                }
+                generation = current;
+            }
+        }
+    };
+
+private:
+    // moves up to batch(cls) blocks of class cls to list
+    void refill(size_t cls, FreeList& list) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const size_t n = batch(cls);
+        FreeList& global = free_lists[cls];
+        while (global.head != nullptr && list.count < n) {
+            list.push(global.pop());
+        }
+
+        if (list.count > 0) {
+            return;
+        }
+
+        // bump allocation; a new chunk if the rest of current one is too small
+        const size_t size = class_size(cls);
+        size_t count = n;
+        if (bump_left < size) {
+            new_chunk();
+        }
+
+        if (count * size > bump_left) {
+            count = bump_left / size;
+        }
+
+        for (size_t i=0; i < count; i++) {
+            list.push(bump);
+            bump      += size;
+            bump_left -= size;
+        }
+
+        bytes_used += count * size;
+    }
+
+    void take_back(size_t cls, FreeList& list, size_t count) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        FreeList& global = free_lists[cls];
+        for (size_t i=0; i < count; i++) {
+            global.push(list.pop());
+        }
+    }
+
+    void new_chunk() {
+        void* chunk = nullptr;
+        if (posix_memalign(&chunk, chunk_size, chunk_size) != 0) {
+            throw std::bad_alloc();
+        }
+
+        chunks.push_back(static_cast<char*>(chunk));
+        bump = static_cast<char*>(chunk);
+        bump_left = chunk_size;
+    }
+
+    void* allocate_large(size_t size) {
+        void* ptr = malloc(size);
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+
+        large_bytes += size;
+        return ptr;
+    }
+
+    void deallocate_large(void* ptr, size_t size) {
+        large_bytes -= size;
+        free(ptr);
+    }
+};
@@ -3,70 +3,402 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cassert>
+#include <cstring>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
 
+#include <unistd.h>
 
+#include "slab.cpp"
+
+
+enum class AllocatorKind {
+    glibc,
+    slab
+};
+
+
+// leak   -- blocks are allocated until the limit is reached, never freed;
+// random -- after reaching the limit, random blocks are freed and replaced
+//           by new blocks of random sizes;
+// fifo   -- like random, but the oldest block is freed.
+enum class Pattern {
+    leak,
+    random,
+    fifo
+};
+
+
+// Each thread has its own allocator object; Shared is what they have in common.
+struct GlibcAllocator {
+    struct Shared {};
+
+    explicit GlibcAllocator(Shared&) {}
+
+    static const char* name() {
+        return "glibc";
+    }
+
+    void* allocate(size_t size) {
+        return malloc(size);
+    }
+
+    void deallocate(void* ptr, size_t /*size*/) {
+        free(ptr);
+    }
+
+    // memory obtained from the system and free memory inside it
+    void usage(size_t& allocated, size_t& free, size_t /*live_rounded*/) {
+#if __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+        struct mallinfo2 mi = mallinfo2();
+#else
+        struct mallinfo mi = mallinfo();
+#endif
+
+        allocated = mi.uordblks;
+        free      = mi.fordblks;
+    }
+
+    void release_all(std::vector<std::pair<void*, size_t>>& blocks) {
+        for (const auto& block: blocks) {
+            ::free(block.first);
+        }
+    }
+};
+
+
+struct SlabAllocatorAdaptor {
+    typedef SlabAllocator Shared;
+
+    SlabAllocator& slab;
+    SlabAllocator::Cache cache;
+
+    explicit SlabAllocatorAdaptor(SlabAllocator& slab_) : slab(slab_), cache(slab_) {}
+
+    static const char* name() {
+        return "slab";
+    }
+
+    void* allocate(size_t size) {
+        return cache.allocate(size);
+    }
+
+    void deallocate(void* ptr, size_t size) {
+        cache.deallocate(ptr, size);
+    }
+
+    void usage(size_t& allocated, size_t& free, size_t live_rounded) {
+        allocated = slab.used();
+        free      = allocated - live_rounded;
+    }
+
+    // the shared allocator releases chunks once all threads are done
+    void release_all(std::vector<std::pair<void*, size_t>>& blocks) {
+        // large blocks are not kept in chunks
+        for (const auto& block: blocks) {
+            if (block.second > SlabAllocator::max_size) {
+                cache.deallocate(block.first, block.second);
+            }
+        }
+    }
+};
+
+
+// Allocated memory is written (one byte per page), like a real program
+// would do; otherwise untouched pages wouldn't be counted in RSS.
+void touch(void* ptr, size_t size) {
+    volatile char* p = static_cast<char*>(ptr);
+    for (size_t offset = 0; offset < size; offset += 4096) {
+        p[offset] = 0;
+    }
+    p[size - 1] = 0;
+}
+
+
+size_t resident_memory() {
+    long pages = 0;
+    long resident = 0;
+
+    FILE* f = fopen("/proc/self/statm", "r");
+    if (f != NULL) {
+        if (fscanf(f, "%ld %ld", &pages, &resident) != 2) {
+            resident = 0;
+        }
+        fclose(f);
+    }
+
+    return resident * sysconf(_SC_PAGESIZE);
+}
+
+
+const char* pattern_name(Pattern pattern) {
+    switch (pattern) {
+        case Pattern::leak:   return "leak";
+        case Pattern::random: return "random";
+        case Pattern::fifo:   return "fifo";
+    }
+
+    return "?";
+}
+
+
+// Allocations made by a single thread; each worker has its own allocator
+// object (for slab: own cache) and its own random generator.
+template <typename Allocator>
+class Worker {
+public:
+    typedef std::pair<void*, size_t> Block;
+
+    Allocator allocator;
+    std::vector<Block> blocks;
+    size_t sum_allocated;
+    size_t malloc_calls;
+    size_t free_calls;
+    size_t live_rounded;
+
+private:
+    const size_t memory_usage_limit;
+    const size_t min_alloc;
+    const size_t max_alloc;
+    const Pattern pattern;
+    unsigned seed;
+
+public:
+    Worker(typename Allocator::Shared& shared,
+           size_t memory_usage_limit_, size_t min_alloc_, size_t max_alloc_,
+           Pattern pattern_, unsigned seed_)
+        : allocator(shared)
+        , sum_allocated(0)
+        , malloc_calls(0)
+        , free_calls(0)
+        , live_rounded(0)
+        , memory_usage_limit(memory_usage_limit_)
+        , min_alloc(min_alloc_)
+        , max_alloc(max_alloc_)
+        , pattern(pattern_)
+        , seed(seed_) {}
+
+    void run() {
+        switch (pattern) {
+            case Pattern::leak:
+                leak();
+                break;
+
+            case Pattern::random:
+            case Pattern::fifo:
+                churn();
+                break;
+        }
+    }
+
+private:
+    void leak() {
+        // The blocks are leaked by glibc (as in the first version of this
+        // program); slab keeps all its memory in chunks and doesn't need them.
+        while (sum_allocated < memory_usage_limit) {
+            const size_t s = get_size();
+            void* ptr = allocator.allocate(s);
+            if (ptr == NULL) {
+                sum_allocated = 0;
+                malloc_calls = 0;
+                continue;
+            }
+            touch(ptr, s);
+
+            if (s > SlabAllocator::max_size) {
+                blocks.push_back(Block(ptr, s));
+            }
+
+            sum_allocated += s;
+            live_rounded  += SlabAllocator::rounded_size(s);
+            malloc_calls += 1;
+        }
+    }
+
+    // The limit is reached, then each block is replaced twice on average;
+    // each free is followed by allocation.
+    void churn() {
+        while (sum_allocated < memory_usage_limit) {
+            allocate();
+        }
+
+        const size_t replacements = 2 * blocks.size();
+        std::deque<size_t> order; // for fifo: indices in allocation order
+
+        if (pattern == Pattern::fifo) {
+            for (size_t i=0; i < blocks.size(); i++) {
+                order.push_back(i);
+            }
+        }
+
+        for (size_t i=0; i < replacements; i++) {
+            size_t index;
+            if (pattern == Pattern::fifo) {
+                index = order.front();
+                order.pop_front();
+                order.push_back(index);
+            } else {
+                index = rand_r(&seed) % blocks.size();
+            }
+
+            Block& block = blocks[index];
+            allocator.deallocate(block.first, block.second);
+            sum_allocated -= block.second;
+            live_rounded  -= SlabAllocator::rounded_size(block.second);
+            free_calls += 1;
+
+            const size_t s = get_size();
+            block = Block(allocator.allocate(s), s);
+            touch(block.first, s);
+            sum_allocated += s;
+            live_rounded  += SlabAllocator::rounded_size(s);
+            malloc_calls += 1;
+        }
+    }
+
+    void allocate() {
+        const size_t s = get_size();
+        blocks.push_back(Block(allocator.allocate(s), s));
+        touch(blocks.back().first, s);
+
+        sum_allocated += s;
+        live_rounded  += SlabAllocator::rounded_size(s);
+        malloc_calls += 1;
+    }
+
+    size_t get_size() {
+        return rand_r(&seed) % (max_alloc - min_alloc + 1) + min_alloc;
+    }
+};
+
+
+// The limit is split evenly between threads.
 class Application {
     const size_t memory_usage_limit;
     const size_t min_alloc;
     const size_t max_alloc;
-    size_t sum_allocated;
-    size_t malloc_calls;
+    const AllocatorKind kind;
+    const Pattern pattern;
+    const size_t threads;
 
 public:
-    Application(size_t memory_usage_limit_, size_t min_alloc_, size_t max_alloc_)
+    Application(size_t memory_usage_limit_, size_t min_alloc_, size_t max_alloc_,
+                AllocatorKind kind_, Pattern pattern_, size_t threads_)
         : memory_usage_limit(memory_usage_limit_)
         , min_alloc(min_alloc_)
-        , max_alloc(max_alloc_) 
-        , sum_allocated(0)
-        , malloc_calls(0) {
+        , max_alloc(max_alloc_)
+        , kind(kind_)
+        , pattern(pattern_)
+        , threads(threads_) {
     
         assert(memory_usage_limit > 0);
         assert(min_alloc > 0);
         assert(max_alloc > 0);
         assert(min_alloc <= max_alloc);
-        assert(memory_usage_limit > max_alloc);
+        assert(threads > 0);
+        assert(memory_usage_limit / threads > max_alloc);
     }
 
     void run() {
-        perform_allocations();
-        struct mallinfo mi = mallinfo();
+        if (kind == AllocatorKind::glibc) {
+            GlibcAllocator::Shared shared;
+            run<GlibcAllocator>(shared);
+        } else {
+            SlabAllocator slab;
+            run<SlabAllocatorAdaptor>(slab);
+            slab.release_all();
+        }
+    }
+
+private:
+    template <typename Allocator>
+    void run(typename Allocator::Shared& shared) {
+        const size_t rss_before = resident_memory();
+
+        std::vector<std::unique_ptr<Worker<Allocator>>> workers;
+        for (size_t i=0; i < threads; i++) {
+            workers.emplace_back(new Worker<Allocator>(shared, memory_usage_limit / threads,
+                                                       min_alloc, max_alloc, pattern, i + 1));
+        }
+
+        const auto t1 = std::chrono::steady_clock::now();
+        if (threads == 1) {
+            workers[0]->run();
+        } else {
+            std::vector<std::thread> running;
+            for (auto& worker: workers) {
+                running.emplace_back(&Worker<Allocator>::run, worker.get());
+            }
+
+            for (auto& thread: running) {
+                thread.join();
+            }
+        }
+        const auto t2 = std::chrono::steady_clock::now();
+        const double seconds = std::chrono::duration<double>(t2 - t1).count();
+
+        size_t sum_allocated = 0;
+        size_t malloc_calls = 0;
+        size_t free_calls = 0;
+        size_t live_rounded = 0;
+        size_t bookkeeping = 0;
+        for (const auto& worker: workers) {
+            sum_allocated += worker->sum_allocated;
+            malloc_calls  += worker->malloc_calls;
+            free_calls    += worker->free_calls;
+            live_rounded  += worker->live_rounded;
+            // bookkeeping of this program is not a part of allocator's usage
+            bookkeeping   += worker->blocks.capacity() * sizeof(typename Worker<Allocator>::Block);
+        }
+
+        const size_t rss_after = resident_memory();
+        const size_t rss = (rss_after > rss_before + bookkeeping) ? rss_after - rss_before - bookkeeping : 0;
+
+        size_t allocated;
+        size_t free;
+        workers[0]->allocator.usage(allocated, free, live_rounded);
 
-        const int allocated = mi.uordblks;
-        const int free      = mi.fordblks;
+        const double ops_per_second = (malloc_calls + free_calls) / seconds;
 
-        printf("%lu %lu %lu %lu %lu %d %d\n",
+        // sum_allocated is the number of live bytes
+        printf("%lu %lu %lu %lu %lu %lu %lu %lu %lu %lu %s %s %lu\n",
                 memory_usage_limit,
                 min_alloc,
                 max_alloc,
                 sum_allocated,
                 malloc_calls,
                 allocated,
-                free);
-    }
+                free,
+                free_calls,
+                size_t(ops_per_second),
+                rss,
+                Allocator::name(),
+                pattern_name(pattern),
+                threads);
 
-private:
-    void perform_allocations() {
-        while (sum_allocated < memory_usage_limit) {
-            const size_t s = get_size();
-            if (malloc(s) == NULL) {
-                sum_allocated = 0;
-                malloc_calls = 0;
-            }
-            sum_allocated += s;
-            malloc_calls += 1;
+        for (auto& worker: workers) {
+            worker->allocator.release_all(worker->blocks);
         }
     }
-
-    size_t get_size() const {
-        return rand() % (max_alloc - min_alloc + 1) + min_alloc;
-    }
 };
 
+
+void usage() {
+    puts("usage: test [total [min_alloc [max_alloc [glibc|slab [leak|random|fifo [threads]]]]]]");
+}
+
+
 int main(int argc, char* argv[]) {
 
     size_t memory_usage_limit = 1024 * 1024;
     size_t min_alloc = 32;
     size_t max_alloc = 64;
+    AllocatorKind kind = AllocatorKind::glibc;
+    Pattern pattern = Pattern::leak;
+    size_t threads = 1;
 
     if (argc > 1) {
         memory_usage_limit = atoi(argv[1]);
@@ -81,6 +413,38 @@ int main(int argc, char* argv[]) {
         max_alloc = atoi(argv[3]);
     }
 
-    Application app(memory_usage_limit, min_alloc, max_alloc);
+    if (argc > 4) {
+        if (strcmp(argv[4], "glibc") == 0) {
+            kind = AllocatorKind::glibc;
+        } else if (strcmp(argv[4], "slab") == 0) {
+            kind = AllocatorKind::slab;
+        } else {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (argc > 5) {
+        if (strcmp(argv[5], "leak") == 0) {
+            pattern = Pattern::leak;
+        } else if (strcmp(argv[5], "random") == 0) {
+            pattern = Pattern::random;
+        } else if (strcmp(argv[5], "fifo") == 0) {
+            pattern = Pattern::fifo;
+        } else {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (argc > 6) {
+        threads = atoi(argv[6]);
+        if (threads == 0) {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    Application app(memory_usage_limit, min_alloc, max_alloc, kind, pattern, threads);
     app.run();
 }
@@ -33,7 +33,7 @@
 #include <emmintrin.h>
 
 #include "../Xscr/Xscr.h"
-#include "../loadppm/load_ppm.h"
+#include "../loadppm/netpbm.h"
 
 
 //=== global variables ===================================================
@@ -188,50 +188,36 @@ void keyboard(
 
 
 void view(const char* file1, const char* file2) {
-	FILE *f;
+	NetpbmImage A, B;
 	int err;
 
-	int w1, h1, w2, h2;
-
-	f = fopen(file1, "rb");
-	if (f == NULL)
-		die("Can't open %s", file1);
-	err = ppm_load_32bpp(f, &w1, &h1, &maxval, &imgA, 32);
-	if (err < 0)
-		die("Can't read %s: %s", file1, PPM_errormsg[-err]);
-	else
-	if ((((uintptr_t)imgA) & 0x0f) != 0x00)
-		die("Compile load_ppm library with -DPPM_ALIGN_MALLOC=16.");
-	fclose(f);
-
-	f = fopen(file2, "rb");
-	if (f == NULL)
-		die("Can't open %s", file2);
-	ppm_load_32bpp(f, &w2, &h2, &maxval, &imgB, 32);
+	err = netpbm_load(file1, NETPBM_BGRA8888, 16, &A);
 	if (err < 0)
-		die("Can't read %s: %s", file2, PPM_errormsg[-err]);
-	else
-	if ((((uintptr_t)imgB) & 0x0f) != 0x00)
-		die("Compile load_ppm library with -DPPM_ALIGN_MALLOC=16.");
-	fclose(f);
+		die("Can't read %s: %s", file1, netpbm_errormsg[-err]);
 
+	err = netpbm_load(file2, NETPBM_BGRA8888, 16, &B);
+	if (err < 0)
+		die("Can't read %s: %s", file2, netpbm_errormsg[-err]);
 
 	printf("imgA = %d(%d) x %d, imgB = %d(%d) x %d\n",
-		w1,
-		ppm_bytes_per_line(w1, 4, 32),
-		h1,
-		w2,
-		ppm_bytes_per_line(w2, 4, 32),
-		h2
+		A.width,
+		(int)A.stride,
+		A.height,
+		B.width,
+		(int)B.stride,
+		B.height
 	);
 
 
-	if (ppm_bytes_per_line(w1, 4, 32) != ppm_bytes_per_line(w2, 4, 32)) {
+	if (A.stride != B.stride) {
 		die("Images should have similar width.");
 	}
 
-	width  = ppm_bytes_per_line(w1, 4, 16)/4;
-	height = h1 < h2 ? h1 : h2;
+	imgA   = A.data;
+	imgB   = B.data;
+	maxval = A.maxval;
+	width  = A.stride/4;
+	height = A.height < B.height ? A.height : B.height;
 
 	printf("%d x %d\n", width, height);
 
@@ -271,8 +257,8 @@ void view(const char* file1, const char* file2) {
 		}
 	}
 
-	free(imgA);
-	free(imgB);
+	netpbm_image_free(&A);
+	netpbm_image_free(&B);
 	free(data);
 }
 
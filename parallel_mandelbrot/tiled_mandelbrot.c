@@ -0,0 +1,660 @@
+/*
+	Multithread Mandelbrot set generator --- dynamic tile scheduler
+
+	License: BSD
+
+	----------------------------------------------------------------------
+
+	Image is split into a grid of square tiles; each tile is rendered by
+	one of the vectorized procedures from ../sse4-mandelbrot (SSE, AVX2,
+	AVX512F, AVX512F+FMA) into a thread-local buffer and then copied into
+	the image.
+
+	Scheduling:
+
+	- Tiles of the grid are claimed with an atomic counter (fetch-and-add),
+	  there are no locks.
+
+	- Before rendering a tile its cost is estimated by iterating a few
+	  sample points; an expensive tile (i.e. mostly inside the set) is
+	  split into four subtiles, until the minimum tile size is reached.
+	  The decision depends only on the tile, thus the image doesn't depend
+	  on number of threads.
+
+	- Subtiles are pushed to the thread's own deque (Chase-Lev); the owner
+	  pops from the bottom, when there's nothing to pop and nothing left
+	  in the grid a thread steals from the top of other deques.
+
+	The program reports per-thread busy time, load imbalance (max busy
+	time / average busy time) and with --scaling the speedup for 1 to N
+	threads.
+
+	Compilation: see Makefile, variants with AVX2 and AVX512F kernels
+	are built as separate programs.
+
+	Usage: run with --help.
+
+*/
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+
+
+#include "../sse4-mandelbrot/fpu-proc.c"
+#include "../sse4-mandelbrot/sse4-proc-64-bit.c"
+#if defined(AVX2)
+#	include "../sse4-mandelbrot/avx2-proc-64-bit.c"
+#endif
+#if defined(AVX512F)
+#	include "../sse4-mandelbrot/avx512-proc-64-bit.c"
+#	include "../sse4-mandelbrot/avx512-fma-proc-64-bit.c"
+#endif
+
+
+typedef void (*kernel_t)(float, float, float, float, float, int, int, int, uint8_t*);
+
+typedef struct {
+	const char* name;
+	kernel_t    function;
+} Kernel;
+
+// the last one is the default
+const Kernel kernels[] = {
+	{"FPU",         FPU_mandelbrot},
+	{"SSE",         SSE_mandelbrot},
+#if defined(AVX2)
+	{"AVX2",        AVX2_mandelbrot},
+#endif
+#if defined(AVX512F)
+	{"AVX512F",     AVX512F_mandelbrot},
+	{"AVX512F+FMA", AVX512F_FMA_mandelbrot},
+#endif
+};
+
+#define KERNELS_COUNT ((int)(sizeof(kernels)/sizeof(kernels[0])))
+
+// procedures process 16 pixels at once (AVX512F)
+#define PIXEL_ALIGN 16
+
+
+//=== parameters =========================================================
+
+typedef struct {
+	int width, height;
+	float Re_min, Im_min, Re_max, Im_max;
+	float threshold;
+	int maxiters;
+
+	int tile_size;		// tiles of the initial grid
+	int min_tile_size;	// subdivision limit
+	double split_cost;	// split when sampled average iterations > split_cost * maxiters
+
+	int threads;
+	int scaling;		// if > 0 run with 1..scaling threads
+	const Kernel* kernel;
+	const char* output;
+} Params;
+
+
+//=== work-stealing deque (Chase-Lev, fixed capacity) ====================
+
+typedef struct {
+	int x, y;
+	int width, height;
+} Tile;
+
+#define DEQUE_CAPACITY 256
+
+typedef struct {
+	long top;		// steal end
+	long bottom;	// owner end
+	Tile items[DEQUE_CAPACITY];
+} __attribute__((aligned(64))) Deque;
+
+
+void deque_init(Deque* d) {
+	d->top = 0;
+	d->bottom = 0;
+}
+
+
+// owner only; returns 0 if deque is full
+int deque_push(Deque* d, const Tile* tile) {
+	const long b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED);
+	const long t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+	if (b - t >= DEQUE_CAPACITY)
+		return 0;
+
+	d->items[b % DEQUE_CAPACITY] = *tile;
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	__atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+
+	return 1;
+}
+
+
+// owner only
+int deque_pop(Deque* d, Tile* tile) {
+	const long b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED) - 1;
+	__atomic_store_n(&d->bottom, b, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	long t = __atomic_load_n(&d->top, __ATOMIC_RELAXED);
+
+	if (t > b) {
+		// empty
+		__atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+		return 0;
+	}
+
+	*tile = d->items[b % DEQUE_CAPACITY];
+	if (t < b)
+		return 1;
+
+	// the last item, race with thieves
+	const int won = __atomic_compare_exchange_n(&d->top, &t, t + 1, 0,
+	                                            __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+	__atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+
+	return won;
+}
+
+
+// any thread
+int deque_steal(Deque* d, Tile* tile) {
+	long t = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	const long b = __atomic_load_n(&d->bottom, __ATOMIC_ACQUIRE);
+
+	if (t >= b)
+		return 0;
+
+	const Tile item = d->items[t % DEQUE_CAPACITY];
+	if (!__atomic_compare_exchange_n(&d->top, &t, t + 1, 0,
+	                                 __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+		return 0;
+
+	*tile = item;
+	return 1;
+}
+
+
+//=== scheduler ==========================================================
+
+typedef struct {
+	uint64_t busy_ns;	// time spent on rendering and estimation
+	int tiles;
+	int pixels;
+	int splits;
+	int steals;
+} __attribute__((aligned(64))) ThreadStats;
+
+
+typedef struct {
+	const Params* params;
+	uint8_t* image;
+
+	int grid_columns;
+	int grid_count;
+	int next_tile;		// atomic: next tile of the grid
+	int pending;		// atomic: tiles not rendered yet (including subtiles)
+
+	Deque* deques;
+	ThreadStats* stats;
+} Scheduler;
+
+
+typedef struct {
+	Scheduler* scheduler;
+	int id;
+	uint8_t* buffer;	// tile_size x tile_size
+} Worker;
+
+
+uint64_t get_time_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+
+int claim_tile(Scheduler* s, Tile* tile) {
+	// a cheap check first, the counter is not incremented past the end forever
+	if (__atomic_load_n(&s->next_tile, __ATOMIC_RELAXED) >= s->grid_count)
+		return 0;
+
+	const int k = __atomic_fetch_add(&s->next_tile, 1, __ATOMIC_RELAXED);
+	if (k >= s->grid_count)
+		return 0;
+
+	const Params* p = s->params;
+
+	tile->x = (k % s->grid_columns) * p->tile_size;
+	tile->y = (k / s->grid_columns) * p->tile_size;
+	tile->width  = p->tile_size;
+	tile->height = p->tile_size;
+	if (tile->x + tile->width > p->width)
+		tile->width = p->width - tile->x;
+	if (tile->y + tile->height > p->height)
+		tile->height = p->height - tile->y;
+
+	return 1;
+}
+
+
+int steal_tile(Worker* w, Tile* tile) {
+	Scheduler* s = w->scheduler;
+	const int n = s->params->threads;
+
+	for (int i=1; i < n; i++) {
+		const int victim = (w->id + i) % n;
+		if (deque_steal(&s->deques[victim], tile)) {
+			s->stats[w->id].steals += 1;
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+
+float pixel_re(const Params* p, int x) {
+	return p->Re_min + x * ((p->Re_max - p->Re_min)/p->width);
+}
+
+
+float pixel_im(const Params* p, int y) {
+	return p->Im_min + y * ((p->Im_max - p->Im_min)/p->height);
+}
+
+
+// average number of iterations of 4x4 sample points
+double estimate_cost(const Params* p, const Tile* tile) {
+	int total = 0;
+	for (int sy=0; sy < 4; sy++) {
+		const float Cim = pixel_im(p, tile->y + (2*sy + 1) * tile->height / 8);
+		for (int sx=0; sx < 4; sx++) {
+			const float Cre = pixel_re(p, tile->x + (2*sx + 1) * tile->width / 8);
+
+			float Xre = 0.0, Xim = 0.0;
+			int i;
+			for (i=0; i < p->maxiters; i++) {
+				const float Tre = Xre*Xre - Xim*Xim + Cre;
+				const float Tim = 2*Xre*Xim + Cim;
+				if (Tre*Tre + Tim*Tim > p->threshold)
+					break;
+
+				Xre = Tre;
+				Xim = Tim;
+			}
+
+			total += i;
+		}
+	}
+
+	return total / 16.0;
+}
+
+
+void render_tile(Worker* w, const Tile* tile) {
+	Scheduler* s = w->scheduler;
+	const Params* p = s->params;
+
+	p->kernel->function(
+		pixel_re(p, tile->x), pixel_re(p, tile->x + tile->width),
+		pixel_im(p, tile->y), pixel_im(p, tile->y + tile->height),
+		p->threshold, p->maxiters,
+		tile->width, tile->height,
+		w->buffer
+	);
+
+	// writes from different threads do not overlap
+	for (int y=0; y < tile->height; y++) {
+		memcpy(s->image + (size_t)(tile->y + y) * p->width + tile->x,
+		       w->buffer + y * tile->width,
+		       tile->width);
+	}
+
+	s->stats[w->id].tiles  += 1;
+	s->stats[w->id].pixels += tile->width * tile->height;
+	__atomic_fetch_sub(&s->pending, 1, __ATOMIC_RELEASE);
+}
+
+
+int can_split(const Params* p, const Tile* tile) {
+	return p->split_cost > 0.0
+	    && tile->width  >= 2 * p->min_tile_size
+	    && tile->height >= 2 * p->min_tile_size;
+}
+
+
+void process_tile(Worker* w, const Tile* tile) {
+	Scheduler* s = w->scheduler;
+	const Params* p = s->params;
+
+	const uint64_t t1 = get_time_ns();
+
+	if (can_split(p, tile) && estimate_cost(p, tile) > p->split_cost * p->maxiters) {
+		// widths must remain multiplies of PIXEL_ALIGN
+		const int w1 = (tile->width / 2) & ~(PIXEL_ALIGN - 1);
+		const int h1 = tile->height / 2;
+		const Tile sub[4] = {
+			{tile->x,      tile->y,      w1,               h1},
+			{tile->x + w1, tile->y,      tile->width - w1, h1},
+			{tile->x,      tile->y + h1, w1,               tile->height - h1},
+			{tile->x + w1, tile->y + h1, tile->width - w1, tile->height - h1},
+		};
+
+		// one tile replaced by four; increment before subtiles are visible
+		__atomic_fetch_add(&s->pending, 3, __ATOMIC_RELAXED);
+		s->stats[w->id].splits += 1;
+
+		for (int i=0; i < 4; i++) {
+			if (!deque_push(&s->deques[w->id], &sub[i]))
+				render_tile(w, &sub[i]);
+		}
+	} else {
+		render_tile(w, tile);
+	}
+
+	s->stats[w->id].busy_ns += get_time_ns() - t1;
+}
+
+
+void* worker_thread(void* arg) {
+	Worker* w = (Worker*)arg;
+	Scheduler* s = w->scheduler;
+
+	Tile tile;
+	while (__atomic_load_n(&s->pending, __ATOMIC_ACQUIRE) > 0) {
+		if (deque_pop(&s->deques[w->id], &tile)
+		 || claim_tile(s, &tile)
+		 || steal_tile(w, &tile)) {
+			process_tile(w, &tile);
+		} else {
+			// other threads are about to push subtiles
+			sched_yield();
+		}
+	}
+
+	return NULL;
+}
+
+
+typedef struct {
+	double seconds;
+	double imbalance;
+	int tiles;
+	int splits;
+	int steals;
+} RunResult;
+
+
+RunResult render(const Params* p, uint8_t* image, int verbose) {
+	Scheduler s;
+	s.params = p;
+	s.image  = image;
+	s.grid_columns = (p->width  + p->tile_size - 1) / p->tile_size;
+	s.grid_count   = s.grid_columns * ((p->height + p->tile_size - 1) / p->tile_size);
+	s.next_tile = 0;
+	s.pending   = s.grid_count;
+
+	const int n = p->threads;
+	s.deques = aligned_alloc(64, n * sizeof(Deque));
+	s.stats  = aligned_alloc(64, n * sizeof(ThreadStats));
+	pthread_t* threads = malloc(n * sizeof(pthread_t));
+	Worker* workers    = malloc(n * sizeof(Worker));
+	if (s.deques == NULL || s.stats == NULL || threads == NULL || workers == NULL) {
+		puts("ERROR: out of memory");
+		exit(EXIT_FAILURE);
+	}
+
+	for (int i=0; i < n; i++) {
+		deque_init(&s.deques[i]);
+		memset(&s.stats[i], 0, sizeof(ThreadStats));
+
+		workers[i].scheduler = &s;
+		workers[i].id = i;
+		workers[i].buffer = aligned_alloc(64, (size_t)p->tile_size * p->tile_size);
+		if (workers[i].buffer == NULL) {
+			puts("ERROR: out of memory");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	const uint64_t t1 = get_time_ns();
+
+	for (int i=1; i < n; i++) {
+		const int status = pthread_create(&threads[i], NULL, worker_thread, &workers[i]);
+		if (status != 0) {
+			printf("ERROR: can't create thread: %s\n", strerror(status));
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	worker_thread(&workers[0]);
+
+	for (int i=1; i < n; i++)
+		pthread_join(threads[i], NULL);
+
+	const uint64_t t2 = get_time_ns();
+
+	RunResult result;
+	memset(&result, 0, sizeof(result));
+	result.seconds = (t2 - t1) / 1e9;
+
+	uint64_t max_busy = 0;
+	uint64_t sum_busy = 0;
+	for (int i=0; i < n; i++) {
+		const ThreadStats* st = &s.stats[i];
+		if (st->busy_ns > max_busy)
+			max_busy = st->busy_ns;
+		sum_busy += st->busy_ns;
+
+		result.tiles  += st->tiles;
+		result.splits += st->splits;
+		result.steals += st->steals;
+
+		if (verbose) {
+			printf("thread #%-3d busy %8.3f ms, tiles %6d, pixels %9d, splits %5d, steals %5d\n",
+			       i, st->busy_ns / 1e6, st->tiles, st->pixels, st->splits, st->steals);
+		}
+	}
+
+	result.imbalance = (sum_busy > 0) ? max_busy / ((double)sum_busy / n) : 1.0;
+
+	for (int i=0; i < n; i++)
+		free(workers[i].buffer);
+
+	free(workers);
+	free(threads);
+	free(s.stats);
+	free(s.deques);
+
+	return result;
+}
+
+
+uint32_t checksum(const uint8_t* image, size_t size) {
+	// FNV-1a
+	uint32_t h = 2166136261u;
+	for (size_t i=0; i < size; i++)
+		h = (h ^ image[i]) * 16777619u;
+
+	return h;
+}
+
+
+//=== main program =======================================================
+
+void die(const char* msg) {
+	printf("ERROR: %s\n", msg);
+	exit(EXIT_FAILURE);
+}
+
+
+void help(const char* progname) {
+	printf("%s [options]\n", progname);
+	puts("");
+	puts("--threads N           number of threads; default: number of CPUs");
+	puts("--size W H            image size, W must be a multiply of 16; default 4096 4096");
+	puts("--area Remin Immin Remax Immax");
+	puts("                      area of calculations; default -2.0 -1.0 0.5 1.0");
+	puts("--threshold T         max radius; default 20.0");
+	puts("--maxiters N          max number of iterations (1..255); default 255");
+	puts("--tile N              tile size, a multiply of 16; default 128");
+	puts("--min-tile N          the smallest subtile; default 32");
+	puts("--split-cost F        split a tile when the average sampled number of");
+	puts("                      iterations is greater than F * maxiters; default 0.25");
+	puts("--no-split            don't split tiles");
+	printf("--kernel NAME         procedure:");
+	for (int i=0; i < KERNELS_COUNT; i++)
+		printf(" %s", kernels[i].name);
+	printf("; default %s\n", kernels[KERNELS_COUNT - 1].name);
+	puts("--scaling N           run with 1, 2, ..., N threads and report speedup");
+	puts("--output FILE         save image (PGM)");
+	exit(EXIT_FAILURE);
+}
+
+
+int main(int argc, char* argv[]) {
+	Params p;
+	p.width  = 4096;
+	p.height = 4096;
+	p.Re_min = -2.0;
+	p.Im_min = -1.0;
+	p.Re_max =  0.5;
+	p.Im_max =  1.0;
+	p.threshold = 20.0;
+	p.maxiters  = 255;
+	p.tile_size = 128;
+	p.min_tile_size = 32;
+	p.split_cost = 0.25;
+	p.threads = sysconf(_SC_NPROCESSORS_ONLN);
+	p.scaling = 0;
+	p.kernel  = &kernels[KERNELS_COUNT - 1];
+	p.output  = NULL;
+
+	// parse command line
+	for (int i=1; i < argc; i++) {
+		const char* opt = argv[i];
+		const int left = argc - i - 1;
+
+#define ARG(k) ((left >= (k)) ? argv[i + (k)] : (die("missing argument"), ""))
+		if (strcmp(opt, "--threads") == 0) {
+			p.threads = atoi(ARG(1));
+			i += 1;
+		} else if (strcmp(opt, "--size") == 0) {
+			p.width  = atoi(ARG(1));
+			p.height = atoi(ARG(2));
+			i += 2;
+		} else if (strcmp(opt, "--area") == 0) {
+			p.Re_min = strtod(ARG(1), NULL);
+			p.Im_min = strtod(ARG(2), NULL);
+			p.Re_max = strtod(ARG(3), NULL);
+			p.Im_max = strtod(ARG(4), NULL);
+			i += 4;
+		} else if (strcmp(opt, "--threshold") == 0) {
+			p.threshold = strtod(ARG(1), NULL);
+			i += 1;
+		} else if (strcmp(opt, "--maxiters") == 0) {
+			p.maxiters = atoi(ARG(1));
+			i += 1;
+		} else if (strcmp(opt, "--tile") == 0) {
+			p.tile_size = atoi(ARG(1));
+			i += 1;
+		} else if (strcmp(opt, "--min-tile") == 0) {
+			p.min_tile_size = atoi(ARG(1));
+			i += 1;
+		} else if (strcmp(opt, "--split-cost") == 0) {
+			p.split_cost = strtod(ARG(1), NULL);
+			i += 1;
+		} else if (strcmp(opt, "--no-split") == 0) {
+			p.split_cost = 0.0;
+		} else if (strcmp(opt, "--kernel") == 0) {
+			const char* name = ARG(1);
+			p.kernel = NULL;
+			for (int k=0; k < KERNELS_COUNT; k++)
+				if (strcasecmp(name, kernels[k].name) == 0)
+					p.kernel = &kernels[k];
+
+			if (p.kernel == NULL)
+				die("unknown kernel");
+			i += 1;
+		} else if (strcmp(opt, "--scaling") == 0) {
+			p.scaling = atoi(ARG(1));
+			i += 1;
+		} else if (strcmp(opt, "--output") == 0) {
+			p.output = ARG(1);
+			i += 1;
+		} else {
+			help(argv[0]);
+		}
+#undef ARG
+	}
+
+	if (p.width <= 0 || p.height <= 0 || p.width % PIXEL_ALIGN != 0)
+		die("width must be a positive multiply of 16");
+	if (p.tile_size <= 0 || p.tile_size % PIXEL_ALIGN != 0)
+		die("tile size must be a positive multiply of 16");
+	if (p.min_tile_size < PIXEL_ALIGN)
+		p.min_tile_size = PIXEL_ALIGN;
+	if (p.threads <= 0 || p.scaling < 0)
+		die("number of threads must be greater than 0");
+	if (p.maxiters <= 0 || p.maxiters > 255)
+		die("maxiters must be in range 1..255");
+	if (p.threshold <= 0)
+		die("threshold must be greater than 0");
+
+	uint8_t* image = aligned_alloc(64, (size_t)p.width * p.height);
+	if (image == NULL)
+		die("can't allocate image");
+
+	printf("image %d x %d, tiles %d x %d (min %d x %d), procedure %s\n",
+		p.width, p.height, p.tile_size, p.tile_size,
+		p.min_tile_size, p.min_tile_size, p.kernel->name);
+
+	if (p.scaling > 0) {
+		puts("threads  time [s]  speedup  imbalance  tiles  splits  steals  checksum");
+
+		double base = 0.0;
+		for (int n=1; n <= p.scaling; n++) {
+			p.threads = n;
+			const RunResult r = render(&p, image, 0);
+			if (n == 1)
+				base = r.seconds;
+
+			printf("%7d  %8.3f  %7.2f  %9.3f  %5d  %6d  %6d  %08x\n",
+				n, r.seconds, base / r.seconds, r.imbalance,
+				r.tiles, r.splits, r.steals,
+				checksum(image, (size_t)p.width * p.height));
+		}
+	} else {
+		printf("%d thread(s)\n", p.threads);
+		const RunResult r = render(&p, image, 1);
+		printf("finished after %0.3fs, imbalance %0.3f, tiles %d, splits %d, steals %d\n",
+			r.seconds, r.imbalance, r.tiles, r.splits, r.steals);
+	}
+
+	if (p.output != NULL) {
+		FILE* f = fopen(p.output, "wb");
+		if (f == NULL)
+			die("can't open file for writing");
+
+		fprintf(f, "P5\n%d %d 255\n", p.width, p.height);
+		fwrite(image, (size_t)p.width * p.height, 1, f);
+		fclose(f);
+	}
+
+	free(image);
+
+	return 0;
+}
+
+// eof
@@ -0,0 +1,337 @@
+/*
+	Pixel format conversions --- 64-bit code
+
+	Library (pixconv_*.c) converting between RGBA8888 and RGB565, RGB555,
+	RGB888, BGRA8888, YUV 4:2:0 (I420 and NV12).  Images may have any size
+	and strides.  Each conversion has a scalar reference and SSSE3, AVX2
+	and AVX512BW implementations, which give exactly the same results.
+
+	Usage:
+
+	$ ./pixconv_avx512 verify
+	$ ./pixconv_avx512 kernels:conversion [repeat count [width height]]
+
+	for example "./pixconv_avx512 AVX2:rgb565_to_rgba 100 1024 768"; the
+	output is compatible with pixconv16bpp-32bpp.c, see pixconv16bpp-32bpp.sh.
+
+	Author: Wojciech Muła
+	License: BSD
+*/
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#include "pixconv_scalar.c"
+#include "pixconv_ssse3.c"
+#include "pixconv_avx2.c"
+#include "pixconv_avx512.c"
+#include "pixconv_lib.c"
+
+
+static const char* conversion_name[] = {
+	"rgb565_to_rgba",
+	"rgba_to_rgb565",
+	"rgb555_to_rgba",
+	"rgba_to_rgb555",
+	"rgb888_to_rgba",
+	"rgba_to_rgb888",
+	"swap_rb",
+	"rgba_to_i420",
+	"rgba_to_nv12",
+	"i420_to_rgba",
+	"nv12_to_rgba",
+};
+
+#define CONVERSIONS (int)(sizeof(conversion_name)/sizeof(conversion_name[0]))
+
+
+// an image in all formats; rows are padded
+typedef struct {
+	int width;
+	int height;
+
+	uint32_t* rgba;
+	uint16_t* p16;
+	uint8_t*  p24;
+	size_t rgba_stride;
+	size_t p16_stride;
+	size_t p24_stride;
+
+	YuvImage yuv;
+
+	uint8_t* memory;
+	size_t size;
+} Images;
+
+
+void images_init(Images* img, int width, int height, size_t padding) {
+	const int cw = (width + 1) / 2;
+	const int ch = (height + 1) / 2;
+
+	img->width  = width;
+	img->height = height;
+	img->rgba_stride   = 4 * width + padding;
+	img->p16_stride    = 2 * width + padding;
+	img->p24_stride    = 3 * width + padding;
+	img->yuv.y_stride  = width + padding;
+	img->yuv.uv_stride = 2 * cw + padding;
+
+	const size_t sizes[] = {
+		img->rgba_stride * height,
+		img->p16_stride * height,
+		img->p24_stride * height,
+		img->yuv.y_stride * height,
+		img->yuv.uv_stride * ch,
+		img->yuv.uv_stride * ch
+	};
+
+	img->size = 0;
+	for (int i=0; i < 6; i++)
+		img->size += sizes[i];
+
+	if (posix_memalign((void**)&img->memory, 64, img->size + 64) != 0) {
+		puts("ERROR: out of memory");
+		exit(EXIT_FAILURE);
+	}
+
+	// odd offsets --- no alignment is assumed
+	uint8_t* p = img->memory + 1;
+	img->rgba  = (uint32_t*)p; p += sizes[0];
+	img->p16   = (uint16_t*)p; p += sizes[1];
+	img->p24   = p;            p += sizes[2];
+	img->yuv.y = p;            p += sizes[3];
+	img->yuv.u = p;            p += sizes[4];
+	img->yuv.v = p;
+}
+
+
+void images_free(Images* img) {
+	free(img->memory);
+}
+
+
+static uint32_t seed = 1;
+
+uint32_t random32(void) {
+	seed = seed * 1103515245 + 12345;
+	return (seed >> 16) | (seed << 16);
+}
+
+
+void images_fill(Images* img) {
+	for (size_t i=0; i < img->size + 64; i++)
+		img->memory[i] = random32();
+}
+
+
+void convert(const PixconvKernels* k, int conversion, Images* dst, const Images* src) {
+	const int w = src->width;
+	const int h = src->height;
+
+	switch (conversion) {
+		case 0: pixconv_image(k->rgb565_to_rgba, dst->rgba, dst->rgba_stride, src->p16, src->p16_stride, w, h); break;
+		case 1: pixconv_image(k->rgba_to_rgb565, dst->p16, dst->p16_stride, src->rgba, src->rgba_stride, w, h); break;
+		case 2: pixconv_image(k->rgb555_to_rgba, dst->rgba, dst->rgba_stride, src->p16, src->p16_stride, w, h); break;
+		case 3: pixconv_image(k->rgba_to_rgb555, dst->p16, dst->p16_stride, src->rgba, src->rgba_stride, w, h); break;
+		case 4: pixconv_image(k->rgb888_to_rgba, dst->rgba, dst->rgba_stride, src->p24, src->p24_stride, w, h); break;
+		case 5: pixconv_image(k->rgba_to_rgb888, dst->p24, dst->p24_stride, src->rgba, src->rgba_stride, w, h); break;
+		case 6: pixconv_image(k->swap_rb, dst->rgba, dst->rgba_stride, src->rgba, src->rgba_stride, w, h); break;
+		case 7: pixconv_rgba_to_i420(k, &dst->yuv, src->rgba, src->rgba_stride, w, h); break;
+		case 8: pixconv_rgba_to_nv12(k, &dst->yuv, src->rgba, src->rgba_stride, w, h); break;
+		case 9: pixconv_i420_to_rgba(k, dst->rgba, dst->rgba_stride, &src->yuv, w, h); break;
+		case 10: pixconv_nv12_to_rgba(k, dst->rgba, dst->rgba_stride, &src->yuv, w, h); break;
+	}
+}
+
+
+//=== verification =======================================================
+
+// conversions to RGBA and back must give the input
+int verify_roundtrip(void) {
+	const int w = 300;
+	Images a, b;
+	images_init(&a, w, 1, 0);
+	images_init(&b, w, 1, 0);
+	images_fill(&a);
+
+	int ok = 1;
+	for (int fmt=0; fmt < 3; fmt++) {
+		for (int i=0; i < w; i++) {
+			a.p16[i] = random32();
+			if (fmt == 1)
+				a.p16[i] &= 0x7fff;
+		}
+
+		switch (fmt) {
+			case 0:
+				scalar_rgb565_to_rgba(b.rgba, a.p16, w);
+				scalar_rgba_to_rgb565(b.p16, b.rgba, w);
+				break;
+			case 1:
+				scalar_rgb555_to_rgba(b.rgba, a.p16, w);
+				scalar_rgba_to_rgb555(b.p16, b.rgba, w);
+				break;
+			case 2:
+				scalar_rgb888_to_rgba(b.rgba, a.p24, w);
+				scalar_rgba_to_rgb888(b.p24, b.rgba, w);
+				break;
+		}
+
+		if (fmt < 2)
+			ok = ok && (memcmp(a.p16, b.p16, 2 * w) == 0);
+		else
+			ok = ok && (memcmp(a.p24, b.p24, 3 * w) == 0);
+	}
+
+	// extremes of 5 and 6 bit fields
+	uint16_t white = 0xffff;
+	uint32_t pixel = 0;
+	scalar_rgb565_to_rgba(&pixel, &white, 1);
+	ok = ok && (pixel == 0xffffffff);
+
+	// gray stays gray
+	uint32_t gray[2] = {0xff808080, 0xff808080};
+	uint8_t y[2], u, v;
+	scalar_rgba_to_i420(y, y, &u, &v, gray, gray, 2);
+	ok = ok && (u == 128) && (v == 128);
+
+	images_free(&a);
+	images_free(&b);
+
+	printf("scalar round trips: %s\n", ok ? "OK" : "FAILED");
+	return ok;
+}
+
+
+int verify(void) {
+	const int sizes[][2] = {
+		{1, 1}, {2, 2}, {3, 3}, {7, 5}, {15, 2}, {16, 2}, {17, 3}, {31, 1}, {32, 4},
+		{33, 3}, {47, 2}, {48, 2}, {63, 3}, {64, 2}, {65, 5}, {100, 7}, {257, 3}
+	};
+
+	int failed = !verify_roundtrip();
+
+	for (size_t impl=1; impl < PIXCONV_KERNELS; impl++) {
+		const PixconvKernels* K = &pixconv_kernels[impl];
+
+		for (int c=0; c < CONVERSIONS; c++) {
+			int ok = 1;
+			for (size_t s=0; s < sizeof(sizes)/sizeof(sizes[0]) && ok; s++) {
+				for (size_t padding=0; padding < 8 && ok; padding += 3) {
+					Images src, expected, result;
+					images_init(&src, sizes[s][0], sizes[s][1], padding);
+					images_init(&expected, sizes[s][0], sizes[s][1], padding);
+					images_init(&result, sizes[s][0], sizes[s][1], padding);
+
+					images_fill(&src);
+					images_fill(&expected);
+					memcpy(result.memory, expected.memory, expected.size + 64);
+
+					convert(&pixconv_kernels[0], c, &expected, &src);
+					convert(K, c, &result, &src);
+
+					// also checks that padding is not touched
+					if (memcmp(expected.memory, result.memory, expected.size + 64) != 0) {
+						printf("%s %s: FAILED for %d x %d, padding %zu\n",
+						       K->name, conversion_name[c], sizes[s][0], sizes[s][1], padding);
+						ok = 0;
+					}
+
+					images_free(&src);
+					images_free(&expected);
+					images_free(&result);
+				}
+			}
+
+			if (ok)
+				printf("%s %s: OK\n", K->name, conversion_name[c]);
+			else
+				failed = 1;
+		}
+	}
+
+	puts(failed ? "verification failed" : "all OK");
+	return failed;
+}
+
+
+//=== benchmark ==========================================================
+
+long get_time_us(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000l + ts.tv_nsec / 1000;
+}
+
+
+void help(void) {
+	puts("1. progname verify");
+	printf("2. progname kernels:conversion [repeat count=100 [width=1024 height=768]]\n");
+	printf("   kernels: %s", pixconv_kernels[0].name);
+	for (size_t i=1; i < PIXCONV_KERNELS; i++)
+		printf("|%s", pixconv_kernels[i].name);
+
+	printf("\n   conversion: %s", conversion_name[0]);
+	for (int i=1; i < CONVERSIONS; i++)
+		printf("|%s", conversion_name[i]);
+
+	putchar('\n');
+	exit(1);
+}
+
+
+int main(int argc, char* argv[]) {
+	if (argc < 2)
+		help();
+
+	if (strcmp(argv[1], "verify") == 0)
+		return verify();
+
+	const char* colon = strchr(argv[1], ':');
+	if (colon == NULL)
+		help();
+
+	const PixconvKernels* K = NULL;
+	for (size_t i=0; i < PIXCONV_KERNELS; i++)
+		if (strncasecmp(argv[1], pixconv_kernels[i].name, colon - argv[1]) == 0
+		    && pixconv_kernels[i].name[colon - argv[1]] == 0)
+			K = &pixconv_kernels[i];
+
+	int conversion = -1;
+	for (int i=0; i < CONVERSIONS; i++)
+		if (strcasecmp(colon + 1, conversion_name[i]) == 0)
+			conversion = i;
+
+	if (K == NULL || conversion < 0)
+		help();
+
+	const int repeatcount = (argc >= 3 && atoi(argv[2]) > 0) ? atoi(argv[2]) : 100;
+	const int width  = (argc >= 5) ? atoi(argv[3]) : 1024;
+	const int height = (argc >= 5) ? atoi(argv[4]) : 768;
+	if (width <= 0 || height <= 0)
+		help();
+
+	Images src, dst;
+	images_init(&src, width, height, 0);
+	images_init(&dst, width, height, 0);
+	images_fill(&src);
+	images_fill(&dst);
+
+	printf("running %s %s %d times on image %d x %d\n", K->name, conversion_name[conversion], repeatcount, width, height);
+	const long t1 = get_time_us();
+	for (int i=0; i < repeatcount; i++)
+		convert(K, conversion, &dst, &src);
+	const long t2 = get_time_us();
+
+	printf("time = %ld microseconds\n", t2 - t1);
+
+	images_free(&src);
+	images_free(&dst);
+	return 0;
+}
@@ -47,7 +47,8 @@ static uint32_t lookup16[256*256] __attribute__((aligned(64)));
 #endif
 
 static uint16_t image_16bpp[HEIGHT+1][WIDTH] __attribute__((aligned(16)));
-static uint32_t image_32bpp[HEIGHT+1][WIDTH] __attribute__((aligned(16)));
+// not static: otherwise GCC removes conversions, as the result is never read
+uint32_t image_32bpp[HEIGHT+1][WIDTH] __attribute__((aligned(16)));
 
 
 void prepare_lookups() {
@@ -1,5 +1,11 @@
 #!/bin/sh
 
+# usage: pixconv16bpp-32bpp.sh program [pixconv-program width height]
+#
+# The second program (see pixconv.c) is run for the same image size;
+# its results are appended to the same log, so the new conversions can be
+# compared with lookup16 and SSE22 (convert_lookup16, convert_SSE2_2).
+
 opts="lookup8 lookup82 lookup16 naive MMX SSE2 SSE22"
 iters=100
 program=$1
@@ -23,3 +29,36 @@ do
     echo -n "$opt " >> $programlog
     cat $log | awk '$1 == "time" {print $3}' | sort -n | head -n 1 >> $programlog
 done
+
+pixconv=$2
+width=$3
+height=$4
+if [ -z "$pixconv" ]
+then
+    exit 0
+fi
+
+kernels="scalar SSSE3 AVX2 AVX512BW"
+conversions="rgb565_to_rgba rgba_to_rgb565 rgb555_to_rgba rgba_to_rgb555 rgb888_to_rgba rgba_to_rgb888 swap_rb rgba_to_i420 rgba_to_nv12 i420_to_rgba nv12_to_rgba"
+runs=10
+
+for conversion in $conversions
+do
+    for k in $kernels
+    do
+        opt=$k:$conversion
+        log=$program-$k-$conversion.log
+        rm $log 2> /dev/null
+        echo -n "$opt ["
+        for i in `seq $runs`
+        do
+            echo -n "."
+            ./$pixconv $opt $iters $width $height >> $log
+        done
+
+        echo "]"
+
+        echo -n "$opt " >> $programlog
+        cat $log | awk '$1 == "time" {print $3}' | sort -n | head -n 1 >> $programlog
+    done
+done
@@ -0,0 +1,344 @@
+//=== AVX2 implementation =================================================
+
+/*
+	The same methods as in SSSE3 code, but the lane-crossing has to be
+	taken into account: 16-bit pixels are permuted before unpacking and
+	RGB888 rows are loaded as two overlapping halves.
+
+	YUV is calculated on 32-bit words with PMADDWD; each 32-bit word holds
+	two 16-bit values, thus a single PMADDWD calculates for example
+	298*C + 409*E.  All intermediate values are exactly the same as in the
+	scalar code.  Chroma of 2x2 block: rows are added, then pixels are
+	added to their horizontal neighbours --- even 32-bit words hold the
+	sums, U is placed there and V goes to odd words, giving NV12 layout.
+*/
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+// 32-bit word with two 16-bit coefficients for PMADDWD
+#define AVX2_COEF(lo, hi) _mm256_set1_epi32((int32_t)(((uint32_t)(uint16_t)(hi) << 16) | (uint16_t)(lo)))
+
+
+static inline void avx2_expand16(__m256i w, int is565, __m256i* lo, __m256i* hi) {
+	const __m256i m03 = _mm256_set1_epi16(0x03);
+	const __m256i m07 = _mm256_set1_epi16(0x07);
+	const __m256i mf8 = _mm256_set1_epi16(0xf8);
+	const __m256i mfc = _mm256_set1_epi16(0xfc);
+
+	// pixels 0..3, 8..11 | 4..7, 12..15 --- unpacking yields pixels in order
+	w = _mm256_permute4x64_epi64(w, _MM_SHUFFLE(3, 1, 2, 0));
+
+	__m256i r, g;
+	if (is565) {
+		r = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(w, 8), mf8), _mm256_srli_epi16(w, 13));
+		g = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(w, 3), mfc), _mm256_and_si256(_mm256_srli_epi16(w, 9), m03));
+	} else {
+		r = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(w, 7), mf8), _mm256_and_si256(_mm256_srli_epi16(w, 12), m07));
+		g = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(w, 2), mf8), _mm256_and_si256(_mm256_srli_epi16(w, 7), m07));
+	}
+	const __m256i b = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(w, 3), mf8),
+	                                  _mm256_and_si256(_mm256_srli_epi16(w, 2), m07));
+
+	const __m256i rg = _mm256_or_si256(r, _mm256_slli_epi16(g, 8));
+	const __m256i ba = _mm256_or_si256(b, _mm256_set1_epi16((int16_t)0xff00));
+
+	*lo = _mm256_unpacklo_epi16(rg, ba);
+	*hi = _mm256_unpackhi_epi16(rg, ba);
+}
+
+
+static inline __m256i avx2_pack16(__m256i p, int is565) {
+	if (is565)
+		return _mm256_or_si256(_mm256_or_si256(
+			_mm256_and_si256(_mm256_slli_epi32(p, 8), _mm256_set1_epi32(0xf800)),
+			_mm256_and_si256(_mm256_srli_epi32(p, 5), _mm256_set1_epi32(0x07e0))),
+			_mm256_and_si256(_mm256_srli_epi32(p, 19), _mm256_set1_epi32(0x001f)));
+	else
+		return _mm256_or_si256(_mm256_or_si256(
+			_mm256_and_si256(_mm256_slli_epi32(p, 7), _mm256_set1_epi32(0x7c00)),
+			_mm256_and_si256(_mm256_srli_epi32(p, 6), _mm256_set1_epi32(0x03e0))),
+			_mm256_and_si256(_mm256_srli_epi32(p, 19), _mm256_set1_epi32(0x001f)));
+}
+
+
+static inline void avx2_from16(uint32_t* d, const uint16_t* s, size_t n, int is565) {
+	size_t i = 0;
+	for (/**/; i + 16 <= n; i += 16) {
+		__m256i lo, hi;
+		avx2_expand16(_mm256_loadu_si256((const __m256i*)(s + i)), is565, &lo, &hi);
+		_mm256_storeu_si256((__m256i*)(d + i + 0), lo);
+		_mm256_storeu_si256((__m256i*)(d + i + 8), hi);
+	}
+
+	if (is565)
+		scalar_rgb565_to_rgba(d + i, s + i, n - i);
+	else
+		scalar_rgb555_to_rgba(d + i, s + i, n - i);
+}
+
+
+static inline void avx2_to16(uint16_t* d, const uint32_t* s, size_t n, int is565) {
+	size_t i = 0;
+	for (/**/; i + 16 <= n; i += 16) {
+		const __m256i a = avx2_pack16(_mm256_loadu_si256((const __m256i*)(s + i + 0)), is565);
+		const __m256i b = avx2_pack16(_mm256_loadu_si256((const __m256i*)(s + i + 8)), is565);
+		const __m256i w = _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256((__m256i*)(d + i), w);
+	}
+
+	if (is565)
+		scalar_rgba_to_rgb565(d + i, s + i, n - i);
+	else
+		scalar_rgba_to_rgb555(d + i, s + i, n - i);
+}
+
+
+void avx2_rgb565_to_rgba(void* dst, const void* src, size_t n) {
+	avx2_from16((uint32_t*)dst, (const uint16_t*)src, n, 1);
+}
+
+
+void avx2_rgba_to_rgb565(void* dst, const void* src, size_t n) {
+	avx2_to16((uint16_t*)dst, (const uint32_t*)src, n, 1);
+}
+
+
+void avx2_rgb555_to_rgba(void* dst, const void* src, size_t n) {
+	avx2_from16((uint32_t*)dst, (const uint16_t*)src, n, 0);
+}
+
+
+void avx2_rgba_to_rgb555(void* dst, const void* src, size_t n) {
+	avx2_to16((uint16_t*)dst, (const uint32_t*)src, n, 0);
+}
+
+
+void avx2_rgb888_to_rgba(void* dst, const void* src, size_t n) {
+	const uint8_t* s = (const uint8_t*)src;
+	uint32_t* d = (uint32_t*)dst;
+
+	// lower lane: bytes 0..15, pixels 0..3; upper lane: bytes 8..23, pixels 4..7
+	const __m256i expand = _mm256_setr_epi8(
+		0, 1,  2, -1, 3,  4,  5, -1,  6,  7,  8, -1,  9, 10, 11, -1,
+		4, 5,  6, -1, 7,  8,  9, -1, 10, 11, 12, -1, 13, 14, 15, -1);
+	const __m256i alpha = _mm256_set1_epi32(0xff000000);
+
+	size_t i = 0;
+	for (/**/; i + 8 <= n; i += 8) {
+		const __m256i in = _mm256_inserti128_si256(
+			_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(s + 3*i))),
+			_mm_loadu_si128((const __m128i*)(s + 3*i + 8)), 1);
+
+		_mm256_storeu_si256((__m256i*)(d + i), _mm256_or_si256(_mm256_shuffle_epi8(in, expand), alpha));
+	}
+
+	scalar_rgb888_to_rgba(d + i, s + 3*i, n - i);
+}
+
+
+void avx2_rgba_to_rgb888(void* dst, const void* src, size_t n) {
+	const uint32_t* s = (const uint32_t*)src;
+	uint8_t* d = (uint8_t*)dst;
+
+	const __m256i compact = _mm256_setr_epi8(
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+	// 24 bytes of the first vector, then 8 + 16 bytes of the second one
+	const __m256i idx_a = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+	const __m256i idx_b = _mm256_setr_epi32(2, 4, 5, 6, 0, 0, 0, 1);
+
+	size_t i = 0;
+	for (/**/; i + 16 <= n; i += 16) {
+		const __m256i a = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(s + i + 0)), compact);
+		const __m256i b = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(s + i + 8)), compact);
+
+		const __m256i pa = _mm256_permutevar8x32_epi32(a, idx_a);
+		const __m256i pb = _mm256_permutevar8x32_epi32(b, idx_b);
+
+		_mm256_storeu_si256((__m256i*)(d + 3*i), _mm256_blend_epi32(pa, pb, 0xc0));
+		_mm_storeu_si128((__m128i*)(d + 3*i + 32), _mm256_castsi256_si128(pb));
+	}
+
+	scalar_rgba_to_rgb888(d + 3*i, s + i, n - i);
+}
+
+
+void avx2_swap_rb(void* dst, const void* src, size_t n) {
+	const uint32_t* s = (const uint32_t*)src;
+	uint32_t* d = (uint32_t*)dst;
+
+	const __m256i swap = _mm256_setr_epi8(
+		2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+		2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+	size_t i = 0;
+	for (/**/; i + 8 <= n; i += 8) {
+		const __m256i p = _mm256_loadu_si256((const __m256i*)(s + i));
+		_mm256_storeu_si256((__m256i*)(d + i), _mm256_shuffle_epi8(p, swap));
+	}
+
+	scalar_swap_rb(d + i, s + i, n - i);
+}
+
+
+//--- YUV ------------------------------------------------------------------
+
+static inline __m256i avx2_rgba_y(__m256i p) {
+	const __m256i mask = _mm256_set1_epi32(0x00ff00ff);
+	const __m256i rb = _mm256_and_si256(p, mask);
+	const __m256i ga = _mm256_and_si256(_mm256_srli_epi32(p, 8), mask);
+
+	const __m256i t = _mm256_add_epi32(_mm256_madd_epi16(rb, AVX2_COEF(66, 25)),
+	                                   _mm256_madd_epi16(ga, AVX2_COEF(129, 0)));
+
+	return _mm256_add_epi32(_mm256_srli_epi32(_mm256_add_epi32(t, _mm256_set1_epi32(128)), 8), _mm256_set1_epi32(16));
+}
+
+
+// two rows of 8 pixels -> 4 x (U, V)
+static inline __m256i avx2_rgba_uv(__m256i p0, __m256i p1) {
+	const __m256i mask = _mm256_set1_epi32(0x00ff00ff);
+
+	__m256i rb = _mm256_add_epi16(_mm256_and_si256(p0, mask), _mm256_and_si256(p1, mask));
+	__m256i ga = _mm256_add_epi16(_mm256_and_si256(_mm256_srli_epi32(p0, 8), mask),
+	                              _mm256_and_si256(_mm256_srli_epi32(p1, 8), mask));
+
+	rb = _mm256_add_epi16(rb, _mm256_shuffle_epi32(rb, _MM_SHUFFLE(2, 3, 0, 1)));
+	ga = _mm256_add_epi16(ga, _mm256_shuffle_epi32(ga, _MM_SHUFFLE(2, 3, 0, 1)));
+
+	rb = _mm256_srli_epi16(_mm256_add_epi16(rb, _mm256_set1_epi16(2)), 2);
+	ga = _mm256_srli_epi16(_mm256_add_epi16(ga, _mm256_set1_epi16(2)), 2);
+
+	const __m256i round = _mm256_set1_epi32(128);
+	__m256i u = _mm256_add_epi32(_mm256_madd_epi16(rb, AVX2_COEF(-38, 112)), _mm256_madd_epi16(ga, AVX2_COEF(-74, 0)));
+	__m256i v = _mm256_add_epi32(_mm256_madd_epi16(rb, AVX2_COEF(112, -18)), _mm256_madd_epi16(ga, AVX2_COEF(-94, 0)));
+
+	u = _mm256_add_epi32(_mm256_srai_epi32(_mm256_add_epi32(u, round), 8), round);
+	v = _mm256_add_epi32(_mm256_srai_epi32(_mm256_add_epi32(v, round), 8), round);
+
+	return _mm256_blend_epi32(u, _mm256_slli_epi64(v, 32), 0xaa);
+}
+
+
+// 16 dwords (values 0..255) -> 16 bytes
+static inline __m128i avx2_pack_bytes(__m256i a, __m256i b) {
+	const __m256i w = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+	return _mm_packus_epi16(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+}
+
+
+static inline size_t avx2_rgba_to_yuv420(uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v, uint8_t* uv,
+                                         const uint32_t* s0, const uint32_t* s1, size_t width) {
+	const __m128i deinterleave = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+
+	size_t x = 0;
+	for (/**/; x + 16 <= width; x += 16) {
+		const __m256i a0 = _mm256_loadu_si256((const __m256i*)(s0 + x + 0));
+		const __m256i b0 = _mm256_loadu_si256((const __m256i*)(s0 + x + 8));
+		const __m256i a1 = _mm256_loadu_si256((const __m256i*)(s1 + x + 0));
+		const __m256i b1 = _mm256_loadu_si256((const __m256i*)(s1 + x + 8));
+
+		_mm_storeu_si128((__m128i*)(y0 + x), avx2_pack_bytes(avx2_rgba_y(a0), avx2_rgba_y(b0)));
+		_mm_storeu_si128((__m128i*)(y1 + x), avx2_pack_bytes(avx2_rgba_y(a1), avx2_rgba_y(b1)));
+
+		const __m128i c = avx2_pack_bytes(avx2_rgba_uv(a0, a1), avx2_rgba_uv(b0, b1));
+		if (uv != NULL)
+			_mm_storeu_si128((__m128i*)(uv + x), c);
+		else {
+			const __m128i t = _mm_shuffle_epi8(c, deinterleave);
+			_mm_storel_epi64((__m128i*)(u + x/2), t);
+			_mm_storel_epi64((__m128i*)(v + x/2), _mm_unpackhi_epi64(t, t));
+		}
+	}
+
+	return x;
+}
+
+
+void avx2_rgba_to_i420(uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v,
+                       const uint32_t* s0, const uint32_t* s1, size_t width) {
+	const size_t x = avx2_rgba_to_yuv420(y0, y1, u, v, NULL, s0, s1, width);
+	scalar_rgba_to_i420(y0 + x, y1 + x, u + x/2, v + x/2, s0 + x, s1 + x, width - x);
+}
+
+
+void avx2_rgba_to_nv12(uint8_t* y0, uint8_t* y1, uint8_t* uv,
+                       const uint32_t* s0, const uint32_t* s1, size_t width) {
+	const size_t x = avx2_rgba_to_yuv420(y0, y1, NULL, NULL, uv, s0, s1, width);
+	scalar_rgba_to_nv12(y0 + x, y1 + x, uv + x, s0 + x, s1 + x, width - x);
+}
+
+
+// 8 x Y, U, V in 32-bit words -> 8 x RGBA
+static inline __m256i avx2_yuv_to_rgba(__m256i y, __m256i u, __m256i v) {
+	const __m256i C = _mm256_sub_epi32(y, _mm256_set1_epi32(16));
+	const __m256i D = _mm256_sub_epi32(u, _mm256_set1_epi32(128));
+	const __m256i E = _mm256_sub_epi32(v, _mm256_set1_epi32(128));
+
+	const __m256i ce = _mm256_or_si256(_mm256_and_si256(C, _mm256_set1_epi32(0xffff)), _mm256_slli_epi32(E, 16));
+	const __m256i d1 = _mm256_or_si256(_mm256_and_si256(D, _mm256_set1_epi32(0xffff)), _mm256_set1_epi32(0x10000));
+
+	__m256i r = _mm256_add_epi32(_mm256_madd_epi16(ce, AVX2_COEF(298, 409)), _mm256_set1_epi32(128));
+	__m256i g = _mm256_add_epi32(_mm256_madd_epi16(ce, AVX2_COEF(298, -208)), _mm256_madd_epi16(d1, AVX2_COEF(-100, 128)));
+	__m256i b = _mm256_add_epi32(_mm256_madd_epi16(ce, AVX2_COEF(298, 0)), _mm256_madd_epi16(d1, AVX2_COEF(516, 128)));
+
+	r = _mm256_srai_epi32(r, 8);
+	g = _mm256_srai_epi32(g, 8);
+	b = _mm256_srai_epi32(b, 8);
+
+	// saturating packs clamp to 0..255; each lane: R0..R3 G0..G3 B0..B3 A0..A3
+	const __m256i rg = _mm256_packs_epi32(r, g);
+	const __m256i ba = _mm256_packs_epi32(b, _mm256_set1_epi32(255));
+	const __m256i t  = _mm256_packus_epi16(rg, ba);
+
+	const __m256i transpose = _mm256_setr_epi8(
+		0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+		0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+
+	return _mm256_shuffle_epi8(t, transpose);
+}
+
+
+static inline __m256i avx2_load_y(const uint8_t* y) {
+	return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)y));
+}
+
+
+void avx2_i420_to_rgba(uint32_t* dst, const uint8_t* y, const uint8_t* u, const uint8_t* v, size_t width) {
+	const __m256i dup = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+
+	size_t x = 0;
+	for (/**/; x + 8 <= width; x += 8) {
+		uint32_t u4, v4;
+		memcpy(&u4, u + x/2, 4);
+		memcpy(&v4, v + x/2, 4);
+
+		const __m256i U = _mm256_permutevar8x32_epi32(_mm256_cvtepu8_epi32(_mm_cvtsi32_si128(u4)), dup);
+		const __m256i V = _mm256_permutevar8x32_epi32(_mm256_cvtepu8_epi32(_mm_cvtsi32_si128(v4)), dup);
+
+		_mm256_storeu_si256((__m256i*)(dst + x), avx2_yuv_to_rgba(avx2_load_y(y + x), U, V));
+	}
+
+	scalar_i420_to_rgba(dst + x, y + x, u + x/2, v + x/2, width - x);
+}
+
+
+void avx2_nv12_to_rgba(uint32_t* dst, const uint8_t* y, const uint8_t* uv, size_t width) {
+	const __m256i dup_u = _mm256_setr_epi32(0, 0, 2, 2, 4, 4, 6, 6);
+	const __m256i dup_v = _mm256_setr_epi32(1, 1, 3, 3, 5, 5, 7, 7);
+
+	size_t x = 0;
+	for (/**/; x + 8 <= width; x += 8) {
+		const __m256i c = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(uv + x)));
+		const __m256i U = _mm256_permutevar8x32_epi32(c, dup_u);
+		const __m256i V = _mm256_permutevar8x32_epi32(c, dup_v);
+
+		_mm256_storeu_si256((__m256i*)(dst + x), avx2_yuv_to_rgba(avx2_load_y(y + x), U, V));
+	}
+
+	scalar_nv12_to_rgba(dst + x, y + x, uv + x, width - x);
+}
+
+#endif // __AVX2__
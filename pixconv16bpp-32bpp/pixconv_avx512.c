@@ -0,0 +1,312 @@
+//=== AVX512BW implementation =============================================
+
+/*
+	The same algorithms as in AVX2 code.  Lane crossing is done with
+	VPERMQ/VPERMD, down-conversions with VPMOVDW/VPMOVDB.  Packed formats
+	process tails with masked loads and stores, YUV tails are processed by
+	scalar code.
+*/
+
+#if defined(__AVX512BW__)
+#include <immintrin.h>
+
+#define AVX512_COEF(lo, hi) _mm512_set1_epi32((int32_t)(((uint32_t)(uint16_t)(hi) << 16) | (uint16_t)(lo)))
+
+
+static inline void avx512_expand16(__m512i w, int is565, __m512i* lo, __m512i* hi) {
+	const __m512i m03 = _mm512_set1_epi16(0x03);
+	const __m512i m07 = _mm512_set1_epi16(0x07);
+	const __m512i mf8 = _mm512_set1_epi16(0xf8);
+	const __m512i mfc = _mm512_set1_epi16(0xfc);
+
+	// lane k gets quad-words k and k + 4, unpacking yields pixels in order
+	w = _mm512_permutexvar_epi64(_mm512_setr_epi64(0, 4, 1, 5, 2, 6, 3, 7), w);
+
+	__m512i r, g;
+	if (is565) {
+		r = _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi16(w, 8), mf8), _mm512_srli_epi16(w, 13));
+		g = _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi16(w, 3), mfc), _mm512_and_si512(_mm512_srli_epi16(w, 9), m03));
+	} else {
+		r = _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi16(w, 7), mf8), _mm512_and_si512(_mm512_srli_epi16(w, 12), m07));
+		g = _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi16(w, 2), mf8), _mm512_and_si512(_mm512_srli_epi16(w, 7), m07));
+	}
+	const __m512i b = _mm512_or_si512(_mm512_and_si512(_mm512_slli_epi16(w, 3), mf8),
+	                                  _mm512_and_si512(_mm512_srli_epi16(w, 2), m07));
+
+	const __m512i rg = _mm512_or_si512(r, _mm512_slli_epi16(g, 8));
+	const __m512i ba = _mm512_or_si512(b, _mm512_set1_epi16((int16_t)0xff00));
+
+	*lo = _mm512_unpacklo_epi16(rg, ba);
+	*hi = _mm512_unpackhi_epi16(rg, ba);
+}
+
+
+static inline __m512i avx512_pack16(__m512i p, int is565) {
+	if (is565)
+		return _mm512_or_si512(_mm512_or_si512(
+			_mm512_and_si512(_mm512_slli_epi32(p, 8), _mm512_set1_epi32(0xf800)),
+			_mm512_and_si512(_mm512_srli_epi32(p, 5), _mm512_set1_epi32(0x07e0))),
+			_mm512_and_si512(_mm512_srli_epi32(p, 19), _mm512_set1_epi32(0x001f)));
+	else
+		return _mm512_or_si512(_mm512_or_si512(
+			_mm512_and_si512(_mm512_slli_epi32(p, 7), _mm512_set1_epi32(0x7c00)),
+			_mm512_and_si512(_mm512_srli_epi32(p, 6), _mm512_set1_epi32(0x03e0))),
+			_mm512_and_si512(_mm512_srli_epi32(p, 19), _mm512_set1_epi32(0x001f)));
+}
+
+
+static inline void avx512_from16(uint32_t* d, const uint16_t* s, size_t n, int is565) {
+	__m512i lo, hi;
+
+	size_t i = 0;
+	for (/**/; i + 32 <= n; i += 32) {
+		avx512_expand16(_mm512_loadu_si512((const __m512i*)(s + i)), is565, &lo, &hi);
+		_mm512_storeu_si512((__m512i*)(d + i +  0), lo);
+		_mm512_storeu_si512((__m512i*)(d + i + 16), hi);
+	}
+
+	if (i < n) {
+		const size_t k = n - i;
+		const __mmask32 m = (__mmask32)((1llu << k) - 1);
+
+		avx512_expand16(_mm512_maskz_loadu_epi16(m, s + i), is565, &lo, &hi);
+		_mm512_mask_storeu_epi32(d + i, (__mmask16)m, lo);
+		if (k > 16)
+			_mm512_mask_storeu_epi32(d + i + 16, (__mmask16)(m >> 16), hi);
+	}
+}
+
+
+static inline void avx512_to16(uint16_t* d, const uint32_t* s, size_t n, int is565) {
+	size_t i = 0;
+	for (/**/; i + 16 <= n; i += 16) {
+		const __m512i p = avx512_pack16(_mm512_loadu_si512((const __m512i*)(s + i)), is565);
+		_mm256_storeu_si256((__m256i*)(d + i), _mm512_cvtepi32_epi16(p));
+	}
+
+	if (i < n) {
+		const __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+		const __m512i p = avx512_pack16(_mm512_maskz_loadu_epi32(m, s + i), is565);
+		_mm512_mask_cvtepi32_storeu_epi16(d + i, m, p);
+	}
+}
+
+
+void avx512_rgb565_to_rgba(void* dst, const void* src, size_t n) {
+	avx512_from16((uint32_t*)dst, (const uint16_t*)src, n, 1);
+}
+
+
+void avx512_rgba_to_rgb565(void* dst, const void* src, size_t n) {
+	avx512_to16((uint16_t*)dst, (const uint32_t*)src, n, 1);
+}
+
+
+void avx512_rgb555_to_rgba(void* dst, const void* src, size_t n) {
+	avx512_from16((uint32_t*)dst, (const uint16_t*)src, n, 0);
+}
+
+
+void avx512_rgba_to_rgb555(void* dst, const void* src, size_t n) {
+	avx512_to16((uint16_t*)dst, (const uint32_t*)src, n, 0);
+}
+
+
+void avx512_rgb888_to_rgba(void* dst, const void* src, size_t n) {
+	const uint8_t* s = (const uint8_t*)src;
+	uint32_t* d = (uint32_t*)dst;
+
+	// lane k gets bytes 12*k .. 12*k + 15
+	const __m512i spread = _mm512_setr_epi32(0, 1, 2, 3, 3, 4, 5, 6, 6, 7, 8, 9, 9, 10, 11, 12);
+	const __m512i expand = _mm512_broadcast_i32x4(
+		_mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1));
+	const __m512i alpha = _mm512_set1_epi32(0xff000000);
+
+	for (size_t i=0; i < n; i += 16) {
+		const size_t k = (n - i < 16) ? n - i : 16;
+		const __mmask64 mb = (1llu << (3*k)) - 1;
+		const __mmask16 mp = (__mmask16)((1u << k) - 1);
+
+		const __m512i in = _mm512_permutexvar_epi32(spread, _mm512_maskz_loadu_epi8(mb, s + 3*i));
+		const __m512i p  = _mm512_or_si512(_mm512_shuffle_epi8(in, expand), alpha);
+		_mm512_mask_storeu_epi32(d + i, mp, p);
+	}
+}
+
+
+void avx512_rgba_to_rgb888(void* dst, const void* src, size_t n) {
+	const uint32_t* s = (const uint32_t*)src;
+	uint8_t* d = (uint8_t*)dst;
+
+	const __m512i compact = _mm512_broadcast_i32x4(
+		_mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1));
+	const __m512i gather = _mm512_setr_epi32(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 15, 15, 15);
+
+	for (size_t i=0; i < n; i += 16) {
+		const size_t k = (n - i < 16) ? n - i : 16;
+		const __mmask64 mb = (1llu << (3*k)) - 1;
+		const __mmask16 mp = (__mmask16)((1u << k) - 1);
+
+		const __m512i p = _mm512_shuffle_epi8(_mm512_maskz_loadu_epi32(mp, s + i), compact);
+		_mm512_mask_storeu_epi8(d + 3*i, mb, _mm512_permutexvar_epi32(gather, p));
+	}
+}
+
+
+void avx512_swap_rb(void* dst, const void* src, size_t n) {
+	const uint32_t* s = (const uint32_t*)src;
+	uint32_t* d = (uint32_t*)dst;
+
+	const __m512i swap = _mm512_broadcast_i32x4(
+		_mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15));
+
+	for (size_t i=0; i < n; i += 16) {
+		const size_t k = (n - i < 16) ? n - i : 16;
+		const __mmask16 m = (__mmask16)((1u << k) - 1);
+
+		const __m512i p = _mm512_maskz_loadu_epi32(m, s + i);
+		_mm512_mask_storeu_epi32(d + i, m, _mm512_shuffle_epi8(p, swap));
+	}
+}
+
+
+//--- YUV ------------------------------------------------------------------
+
+static inline __m512i avx512_rgba_y(__m512i p) {
+	const __m512i mask = _mm512_set1_epi32(0x00ff00ff);
+	const __m512i rb = _mm512_and_si512(p, mask);
+	const __m512i ga = _mm512_and_si512(_mm512_srli_epi32(p, 8), mask);
+
+	const __m512i t = _mm512_add_epi32(_mm512_madd_epi16(rb, AVX512_COEF(66, 25)),
+	                                   _mm512_madd_epi16(ga, AVX512_COEF(129, 0)));
+
+	return _mm512_add_epi32(_mm512_srli_epi32(_mm512_add_epi32(t, _mm512_set1_epi32(128)), 8), _mm512_set1_epi32(16));
+}
+
+
+// two rows of 16 pixels -> 8 x (U, V)
+static inline __m512i avx512_rgba_uv(__m512i p0, __m512i p1) {
+	const __m512i mask = _mm512_set1_epi32(0x00ff00ff);
+
+	__m512i rb = _mm512_add_epi16(_mm512_and_si512(p0, mask), _mm512_and_si512(p1, mask));
+	__m512i ga = _mm512_add_epi16(_mm512_and_si512(_mm512_srli_epi32(p0, 8), mask),
+	                              _mm512_and_si512(_mm512_srli_epi32(p1, 8), mask));
+
+	rb = _mm512_add_epi16(rb, _mm512_shuffle_epi32(rb, _MM_PERM_CDAB));
+	ga = _mm512_add_epi16(ga, _mm512_shuffle_epi32(ga, _MM_PERM_CDAB));
+
+	rb = _mm512_srli_epi16(_mm512_add_epi16(rb, _mm512_set1_epi16(2)), 2);
+	ga = _mm512_srli_epi16(_mm512_add_epi16(ga, _mm512_set1_epi16(2)), 2);
+
+	const __m512i round = _mm512_set1_epi32(128);
+	__m512i u = _mm512_add_epi32(_mm512_madd_epi16(rb, AVX512_COEF(-38, 112)), _mm512_madd_epi16(ga, AVX512_COEF(-74, 0)));
+	__m512i v = _mm512_add_epi32(_mm512_madd_epi16(rb, AVX512_COEF(112, -18)), _mm512_madd_epi16(ga, AVX512_COEF(-94, 0)));
+
+	u = _mm512_add_epi32(_mm512_srai_epi32(_mm512_add_epi32(u, round), 8), round);
+	v = _mm512_add_epi32(_mm512_srai_epi32(_mm512_add_epi32(v, round), 8), round);
+
+	return _mm512_mask_blend_epi32(0xaaaa, u, _mm512_slli_epi64(v, 32));
+}
+
+
+static inline size_t avx512_rgba_to_yuv420(uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v, uint8_t* uv,
+                                           const uint32_t* s0, const uint32_t* s1, size_t width) {
+	const __m128i deinterleave = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+
+	size_t x = 0;
+	for (/**/; x + 16 <= width; x += 16) {
+		const __m512i a0 = _mm512_loadu_si512((const __m512i*)(s0 + x));
+		const __m512i a1 = _mm512_loadu_si512((const __m512i*)(s1 + x));
+
+		_mm_storeu_si128((__m128i*)(y0 + x), _mm512_cvtepi32_epi8(avx512_rgba_y(a0)));
+		_mm_storeu_si128((__m128i*)(y1 + x), _mm512_cvtepi32_epi8(avx512_rgba_y(a1)));
+
+		const __m128i c = _mm512_cvtepi32_epi8(avx512_rgba_uv(a0, a1));
+		if (uv != NULL)
+			_mm_storeu_si128((__m128i*)(uv + x), c);
+		else {
+			const __m128i t = _mm_shuffle_epi8(c, deinterleave);
+			_mm_storel_epi64((__m128i*)(u + x/2), t);
+			_mm_storel_epi64((__m128i*)(v + x/2), _mm_unpackhi_epi64(t, t));
+		}
+	}
+
+	return x;
+}
+
+
+void avx512_rgba_to_i420(uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v,
+                         const uint32_t* s0, const uint32_t* s1, size_t width) {
+	const size_t x = avx512_rgba_to_yuv420(y0, y1, u, v, NULL, s0, s1, width);
+	scalar_rgba_to_i420(y0 + x, y1 + x, u + x/2, v + x/2, s0 + x, s1 + x, width - x);
+}
+
+
+void avx512_rgba_to_nv12(uint8_t* y0, uint8_t* y1, uint8_t* uv,
+                         const uint32_t* s0, const uint32_t* s1, size_t width) {
+	const size_t x = avx512_rgba_to_yuv420(y0, y1, NULL, NULL, uv, s0, s1, width);
+	scalar_rgba_to_nv12(y0 + x, y1 + x, uv + x, s0 + x, s1 + x, width - x);
+}
+
+
+// 16 x Y, U, V in 32-bit words -> 16 x RGBA
+static inline __m512i avx512_yuv_to_rgba(__m512i y, __m512i u, __m512i v) {
+	const __m512i C = _mm512_sub_epi32(y, _mm512_set1_epi32(16));
+	const __m512i D = _mm512_sub_epi32(u, _mm512_set1_epi32(128));
+	const __m512i E = _mm512_sub_epi32(v, _mm512_set1_epi32(128));
+
+	const __m512i ce = _mm512_or_si512(_mm512_and_si512(C, _mm512_set1_epi32(0xffff)), _mm512_slli_epi32(E, 16));
+	const __m512i d1 = _mm512_or_si512(_mm512_and_si512(D, _mm512_set1_epi32(0xffff)), _mm512_set1_epi32(0x10000));
+
+	__m512i r = _mm512_add_epi32(_mm512_madd_epi16(ce, AVX512_COEF(298, 409)), _mm512_set1_epi32(128));
+	__m512i g = _mm512_add_epi32(_mm512_madd_epi16(ce, AVX512_COEF(298, -208)), _mm512_madd_epi16(d1, AVX512_COEF(-100, 128)));
+	__m512i b = _mm512_add_epi32(_mm512_madd_epi16(ce, AVX512_COEF(298, 0)), _mm512_madd_epi16(d1, AVX512_COEF(516, 128)));
+
+	r = _mm512_srai_epi32(r, 8);
+	g = _mm512_srai_epi32(g, 8);
+	b = _mm512_srai_epi32(b, 8);
+
+	const __m512i rg = _mm512_packs_epi32(r, g);
+	const __m512i ba = _mm512_packs_epi32(b, _mm512_set1_epi32(255));
+	const __m512i t  = _mm512_packus_epi16(rg, ba);
+
+	const __m512i transpose = _mm512_broadcast_i32x4(
+		_mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15));
+
+	return _mm512_shuffle_epi8(t, transpose);
+}
+
+
+void avx512_i420_to_rgba(uint32_t* dst, const uint8_t* y, const uint8_t* u, const uint8_t* v, size_t width) {
+	const __m512i dup = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+
+	size_t x = 0;
+	for (/**/; x + 16 <= width; x += 16) {
+		const __m512i Y = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(y + x)));
+		const __m512i U = _mm512_permutexvar_epi32(dup, _mm512_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(u + x/2))));
+		const __m512i V = _mm512_permutexvar_epi32(dup, _mm512_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(v + x/2))));
+
+		_mm512_storeu_si512((__m512i*)(dst + x), avx512_yuv_to_rgba(Y, U, V));
+	}
+
+	scalar_i420_to_rgba(dst + x, y + x, u + x/2, v + x/2, width - x);
+}
+
+
+void avx512_nv12_to_rgba(uint32_t* dst, const uint8_t* y, const uint8_t* uv, size_t width) {
+	const __m512i dup_u = _mm512_setr_epi32(0, 0, 2, 2, 4, 4, 6, 6, 8, 8, 10, 10, 12, 12, 14, 14);
+	const __m512i dup_v = _mm512_setr_epi32(1, 1, 3, 3, 5, 5, 7, 7, 9, 9, 11, 11, 13, 13, 15, 15);
+
+	size_t x = 0;
+	for (/**/; x + 16 <= width; x += 16) {
+		const __m512i Y = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(y + x)));
+		const __m512i c = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(uv + x)));
+
+		_mm512_storeu_si512((__m512i*)(dst + x),
+			avx512_yuv_to_rgba(Y, _mm512_permutexvar_epi32(dup_u, c), _mm512_permutexvar_epi32(dup_v, c)));
+	}
+
+	scalar_nv12_to_rgba(dst + x, y + x, uv + x, width - x);
+}
+
+#endif // __AVX512BW__
@@ -0,0 +1,143 @@
+//=== images with arbitrary strides =======================================
+
+/*
+	Row procedures convert n pixels; procedures below apply them to whole
+	images.  Strides are given in bytes and may be larger than a row
+	(padding, sub-images) --- no alignment is required.
+*/
+
+typedef void (*pixconv_row_function)(void* dst, const void* src, size_t n);
+
+typedef void (*pixconv_to_i420_function)(uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v,
+                                         const uint32_t* s0, const uint32_t* s1, size_t width);
+typedef void (*pixconv_to_nv12_function)(uint8_t* y0, uint8_t* y1, uint8_t* uv,
+                                         const uint32_t* s0, const uint32_t* s1, size_t width);
+typedef void (*pixconv_from_i420_function)(uint32_t* dst, const uint8_t* y, const uint8_t* u, const uint8_t* v,
+                                           size_t width);
+typedef void (*pixconv_from_nv12_function)(uint32_t* dst, const uint8_t* y, const uint8_t* uv, size_t width);
+
+
+typedef struct {
+	const char* name;
+	pixconv_row_function rgb565_to_rgba;
+	pixconv_row_function rgba_to_rgb565;
+	pixconv_row_function rgb555_to_rgba;
+	pixconv_row_function rgba_to_rgb555;
+	pixconv_row_function rgb888_to_rgba;
+	pixconv_row_function rgba_to_rgb888;
+	pixconv_row_function swap_rb;
+	pixconv_to_i420_function   rgba_to_i420;
+	pixconv_to_nv12_function   rgba_to_nv12;
+	pixconv_from_i420_function i420_to_rgba;
+	pixconv_from_nv12_function nv12_to_rgba;
+} PixconvKernels;
+
+
+static const PixconvKernels pixconv_kernels[] = {
+	{"scalar",
+		scalar_rgb565_to_rgba, scalar_rgba_to_rgb565, scalar_rgb555_to_rgba, scalar_rgba_to_rgb555,
+		scalar_rgb888_to_rgba, scalar_rgba_to_rgb888, scalar_swap_rb,
+		scalar_rgba_to_i420, scalar_rgba_to_nv12, scalar_i420_to_rgba, scalar_nv12_to_rgba},
+#if defined(__SSSE3__)
+	{"SSSE3",
+		ssse3_rgb565_to_rgba, ssse3_rgba_to_rgb565, ssse3_rgb555_to_rgba, ssse3_rgba_to_rgb555,
+		ssse3_rgb888_to_rgba, ssse3_rgba_to_rgb888, ssse3_swap_rb,
+		ssse3_rgba_to_i420, ssse3_rgba_to_nv12, ssse3_i420_to_rgba, ssse3_nv12_to_rgba},
+#endif
+#if defined(__AVX2__)
+	{"AVX2",
+		avx2_rgb565_to_rgba, avx2_rgba_to_rgb565, avx2_rgb555_to_rgba, avx2_rgba_to_rgb555,
+		avx2_rgb888_to_rgba, avx2_rgba_to_rgb888, avx2_swap_rb,
+		avx2_rgba_to_i420, avx2_rgba_to_nv12, avx2_i420_to_rgba, avx2_nv12_to_rgba},
+#endif
+#if defined(__AVX512BW__)
+	{"AVX512BW",
+		avx512_rgb565_to_rgba, avx512_rgba_to_rgb565, avx512_rgb555_to_rgba, avx512_rgba_to_rgb555,
+		avx512_rgb888_to_rgba, avx512_rgba_to_rgb888, avx512_swap_rb,
+		avx512_rgba_to_i420, avx512_rgba_to_nv12, avx512_i420_to_rgba, avx512_nv12_to_rgba},
+#endif
+};
+
+#define PIXCONV_KERNELS (sizeof(pixconv_kernels)/sizeof(pixconv_kernels[0]))
+
+
+// the best kernels available in this build
+static inline const PixconvKernels* pixconv_best(void) {
+	return &pixconv_kernels[PIXCONV_KERNELS - 1];
+}
+
+
+#define ROW(type, base, stride, y) ((type)((uint8_t*)(base) + (size_t)(y) * (stride)))
+#define CROW(type, base, stride, y) ((type)((const uint8_t*)(base) + (size_t)(y) * (stride)))
+
+
+void pixconv_image(pixconv_row_function row,
+                   void* dst, size_t dst_stride,
+                   const void* src, size_t src_stride,
+                   int width, int height) {
+	for (int y=0; y < height; y++)
+		row(ROW(void*, dst, dst_stride, y), CROW(const void*, src, src_stride, y), width);
+}
+
+
+// YUV 4:2:0 image; for NV12 plane u holds interleaved U and V, v is not used
+typedef struct {
+	uint8_t* y;
+	uint8_t* u;
+	uint8_t* v;
+	size_t y_stride;
+	size_t uv_stride;
+} YuvImage;
+
+
+void pixconv_rgba_to_i420(const PixconvKernels* k, const YuvImage* dst,
+                          const uint32_t* src, size_t src_stride, int width, int height) {
+	for (int y=0; y < height; y += 2) {
+		const int y1 = (y + 1 < height) ? y + 1 : y;	// the last row is replicated
+		k->rgba_to_i420(ROW(uint8_t*, dst->y, dst->y_stride, y),
+		                ROW(uint8_t*, dst->y, dst->y_stride, y1),
+		                ROW(uint8_t*, dst->u, dst->uv_stride, y/2),
+		                ROW(uint8_t*, dst->v, dst->uv_stride, y/2),
+		                CROW(const uint32_t*, src, src_stride, y),
+		                CROW(const uint32_t*, src, src_stride, y1),
+		                width);
+	}
+}
+
+
+void pixconv_rgba_to_nv12(const PixconvKernels* k, const YuvImage* dst,
+                          const uint32_t* src, size_t src_stride, int width, int height) {
+	for (int y=0; y < height; y += 2) {
+		const int y1 = (y + 1 < height) ? y + 1 : y;
+		k->rgba_to_nv12(ROW(uint8_t*, dst->y, dst->y_stride, y),
+		                ROW(uint8_t*, dst->y, dst->y_stride, y1),
+		                ROW(uint8_t*, dst->u, dst->uv_stride, y/2),
+		                CROW(const uint32_t*, src, src_stride, y),
+		                CROW(const uint32_t*, src, src_stride, y1),
+		                width);
+	}
+}
+
+
+void pixconv_i420_to_rgba(const PixconvKernels* k, uint32_t* dst, size_t dst_stride,
+                          const YuvImage* src, int width, int height) {
+	for (int y=0; y < height; y++)
+		k->i420_to_rgba(ROW(uint32_t*, dst, dst_stride, y),
+		                CROW(const uint8_t*, src->y, src->y_stride, y),
+		                CROW(const uint8_t*, src->u, src->uv_stride, y/2),
+		                CROW(const uint8_t*, src->v, src->uv_stride, y/2),
+		                width);
+}
+
+
+void pixconv_nv12_to_rgba(const PixconvKernels* k, uint32_t* dst, size_t dst_stride,
+                          const YuvImage* src, int width, int height) {
+	for (int y=0; y < height; y++)
+		k->nv12_to_rgba(ROW(uint32_t*, dst, dst_stride, y),
+		                CROW(const uint8_t*, src->y, src->y_stride, y),
+		                CROW(const uint8_t*, src->u, src->uv_stride, y/2),
+		                width);
+}
+
+#undef ROW
+#undef CROW
@@ -0,0 +1,209 @@
+//=== scalar (reference) implementation ===================================
+
+/*
+	Formats (memory layout, little endian):
+
+	* RGBA8888 --- uint32_t, bytes R, G, B, A;
+	* BGRA8888 --- uint32_t, bytes B, G, R, A;
+	* RGB888   --- 3 bytes R, G, B;
+	* RGB565   --- uint16_t, R in bits 11..15, G in 5..10, B in 0..4;
+	* RGB555   --- uint16_t, R in bits 10..14, G in 5..9, B in 0..4,
+	               bit 15 is ignored on input and cleared on output;
+	* I420     --- planes Y, U and V, chroma subsampled 2x2;
+	* NV12     --- plane Y and plane of interleaved U, V, subsampled 2x2.
+
+	Narrow fields are expanded by bit replication (i.e. 5 bits -> 8 bits
+	gives exactly 0 and 255 for extreme values), wide fields are truncated.
+	When alpha is not present in source, it is set to 255.
+
+	YUV uses BT.601 limited range with 8-bit fixed point coefficients;
+	chroma of a 2x2 block is calculated from the average color of block.
+	For odd widths and heights the last column/row is replicated.
+*/
+
+static inline uint32_t expand5(uint32_t x) {
+	return (x << 3) | (x >> 2);
+}
+
+
+static inline uint32_t expand6(uint32_t x) {
+	return (x << 2) | (x >> 4);
+}
+
+
+static inline uint32_t rgba(uint32_t r, uint32_t g, uint32_t b, uint32_t a) {
+	return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+
+void scalar_rgb565_to_rgba(void* dst, const void* src, size_t n) {
+	const uint16_t* s = (const uint16_t*)src;
+	uint32_t* d = (uint32_t*)dst;
+
+	for (size_t i=0; i < n; i++) {
+		const uint32_t w = s[i];
+		d[i] = rgba(expand5(w >> 11), expand6((w >> 5) & 0x3f), expand5(w & 0x1f), 0xff);
+	}
+}
+
+
+void scalar_rgba_to_rgb565(void* dst, const void* src, size_t n) {
+	const uint32_t* s = (const uint32_t*)src;
+	uint16_t* d = (uint16_t*)dst;
+
+	for (size_t i=0; i < n; i++) {
+		const uint32_t p = s[i];
+		const uint32_t r = p & 0xff;
+		const uint32_t g = (p >> 8) & 0xff;
+		const uint32_t b = (p >> 16) & 0xff;
+		d[i] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+	}
+}
+
+
+void scalar_rgb555_to_rgba(void* dst, const void* src, size_t n) {
+	const uint16_t* s = (const uint16_t*)src;
+	uint32_t* d = (uint32_t*)dst;
+
+	for (size_t i=0; i < n; i++) {
+		const uint32_t w = s[i];
+		d[i] = rgba(expand5((w >> 10) & 0x1f), expand5((w >> 5) & 0x1f), expand5(w & 0x1f), 0xff);
+	}
+}
+
+
+void scalar_rgba_to_rgb555(void* dst, const void* src, size_t n) {
+	const uint32_t* s = (const uint32_t*)src;
+	uint16_t* d = (uint16_t*)dst;
+
+	for (size_t i=0; i < n; i++) {
+		const uint32_t p = s[i];
+		const uint32_t r = p & 0xff;
+		const uint32_t g = (p >> 8) & 0xff;
+		const uint32_t b = (p >> 16) & 0xff;
+		d[i] = ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+	}
+}
+
+
+void scalar_rgb888_to_rgba(void* dst, const void* src, size_t n) {
+	const uint8_t* s = (const uint8_t*)src;
+	uint32_t* d = (uint32_t*)dst;
+
+	for (size_t i=0; i < n; i++)
+		d[i] = rgba(s[3*i + 0], s[3*i + 1], s[3*i + 2], 0xff);
+}
+
+
+void scalar_rgba_to_rgb888(void* dst, const void* src, size_t n) {
+	const uint32_t* s = (const uint32_t*)src;
+	uint8_t* d = (uint8_t*)dst;
+
+	for (size_t i=0; i < n; i++) {
+		d[3*i + 0] = s[i];
+		d[3*i + 1] = s[i] >> 8;
+		d[3*i + 2] = s[i] >> 16;
+	}
+}
+
+
+// RGBA <-> BGRA, the same procedure works in both directions
+void scalar_swap_rb(void* dst, const void* src, size_t n) {
+	const uint32_t* s = (const uint32_t*)src;
+	uint32_t* d = (uint32_t*)dst;
+
+	for (size_t i=0; i < n; i++) {
+		const uint32_t p = s[i];
+		d[i] = (p & 0xff00ff00) | ((p >> 16) & 0xff) | ((p & 0xff) << 16);
+	}
+}
+
+
+//--- YUV ------------------------------------------------------------------
+
+static inline uint8_t rgb_to_y(int r, int g, int b) {
+	return ((66*r + 129*g + 25*b + 128) >> 8) + 16;
+}
+
+
+static inline uint8_t rgb_to_u(int r, int g, int b) {
+	return ((-38*r - 74*g + 112*b + 128) >> 8) + 128;
+}
+
+
+static inline uint8_t rgb_to_v(int r, int g, int b) {
+	return ((112*r - 94*g - 18*b + 128) >> 8) + 128;
+}
+
+
+static inline uint8_t clamp255(int x) {
+	return (x < 0) ? 0 : (x > 255) ? 255 : x;
+}
+
+
+static inline uint32_t yuv_to_rgba(int y, int u, int v) {
+	const int C = y - 16;
+	const int D = u - 128;
+	const int E = v - 128;
+
+	const int r = (298*C + 409*E + 128) >> 8;
+	const int g = (298*C - 100*D - 208*E + 128) >> 8;
+	const int b = (298*C + 516*D + 128) >> 8;
+
+	return rgba(clamp255(r), clamp255(g), clamp255(b), 0xff);
+}
+
+
+// two rows of RGBA -> two rows of Y, one row of U and V; when uv_step == 2
+// U and V are interleaved (NV12)
+static inline void scalar_rgba_to_yuv420(uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v, int uv_step,
+                                         const uint32_t* s0, const uint32_t* s1, size_t width) {
+	for (size_t x=0; x < width; x += 2) {
+		const size_t x1 = (x + 1 < width) ? x + 1 : x;
+		const uint32_t p[4] = {s0[x], s0[x1], s1[x], s1[x1]};
+
+		int r = 2, g = 2, b = 2;
+		for (int k=0; k < 4; k++) {
+			r += p[k] & 0xff;
+			g += (p[k] >> 8) & 0xff;
+			b += (p[k] >> 16) & 0xff;
+		}
+		r >>= 2;
+		g >>= 2;
+		b >>= 2;
+
+		y0[x] = rgb_to_y(p[0] & 0xff, (p[0] >> 8) & 0xff, (p[0] >> 16) & 0xff);
+		y1[x] = rgb_to_y(p[2] & 0xff, (p[2] >> 8) & 0xff, (p[2] >> 16) & 0xff);
+		if (x + 1 < width) {
+			y0[x + 1] = rgb_to_y(p[1] & 0xff, (p[1] >> 8) & 0xff, (p[1] >> 16) & 0xff);
+			y1[x + 1] = rgb_to_y(p[3] & 0xff, (p[3] >> 8) & 0xff, (p[3] >> 16) & 0xff);
+		}
+
+		u[(x/2) * uv_step] = rgb_to_u(r, g, b);
+		v[(x/2) * uv_step] = rgb_to_v(r, g, b);
+	}
+}
+
+
+void scalar_rgba_to_i420(uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v,
+                         const uint32_t* s0, const uint32_t* s1, size_t width) {
+	scalar_rgba_to_yuv420(y0, y1, u, v, 1, s0, s1, width);
+}
+
+
+void scalar_rgba_to_nv12(uint8_t* y0, uint8_t* y1, uint8_t* uv,
+                         const uint32_t* s0, const uint32_t* s1, size_t width) {
+	scalar_rgba_to_yuv420(y0, y1, uv, uv + 1, 2, s0, s1, width);
+}
+
+
+void scalar_i420_to_rgba(uint32_t* dst, const uint8_t* y, const uint8_t* u, const uint8_t* v, size_t width) {
+	for (size_t x=0; x < width; x++)
+		dst[x] = yuv_to_rgba(y[x], u[x/2], v[x/2]);
+}
+
+
+void scalar_nv12_to_rgba(uint32_t* dst, const uint8_t* y, const uint8_t* uv, size_t width) {
+	for (size_t x=0; x < width; x++)
+		dst[x] = yuv_to_rgba(y[x], uv[2*(x/2)], uv[2*(x/2) + 1]);
+}
@@ -0,0 +1,348 @@
+//=== SSSE3 implementation ================================================
+
+/*
+	16-bit formats: fields are isolated with shifts and masks on 16-bit
+	words (see sse_expand16), then bytes are interleaved to pixels.  In
+	the opposite direction a pixel is packed within 32-bit word and PSHUFB
+	gathers lower words.
+
+	RGB888: PSHUFB expands 4 pixels (12 bytes) at once, PALIGNR forms
+	windows of 12 bytes from 48 bytes loaded.
+
+	YUV: the same arithmetic as AVX2 code on 4 pixels.  There's no PMOVZX,
+	bytes are zero-extended to dwords with PSHUFB; results are clamped by
+	saturating packs.
+
+	Vector loops don't require any alignment; tails are processed by scalar
+	code.
+*/
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+
+// two 16-bit coefficients for PMADDWD
+#define SSE_COEF(lo, hi) _mm_set1_epi32((int32_t)(((uint32_t)(uint16_t)(hi) << 16) | (uint16_t)(lo)))
+
+static inline void sse_expand16(__m128i w, int is565, __m128i* lo, __m128i* hi) {
+	const __m128i m03 = _mm_set1_epi16(0x03);
+	const __m128i m07 = _mm_set1_epi16(0x07);
+	const __m128i mf8 = _mm_set1_epi16(0xf8);
+	const __m128i mfc = _mm_set1_epi16(0xfc);
+
+	__m128i r, g;
+	if (is565) {
+		r = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(w, 8), mf8), _mm_srli_epi16(w, 13));
+		g = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(w, 3), mfc), _mm_and_si128(_mm_srli_epi16(w, 9), m03));
+	} else {
+		r = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(w, 7), mf8), _mm_and_si128(_mm_srli_epi16(w, 12), m07));
+		g = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(w, 2), mf8), _mm_and_si128(_mm_srli_epi16(w, 7), m07));
+	}
+	const __m128i b = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(w, 3), mf8), _mm_and_si128(_mm_srli_epi16(w, 2), m07));
+
+	const __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+	const __m128i ba = _mm_or_si128(b, _mm_set1_epi16((int16_t)0xff00));
+
+	*lo = _mm_unpacklo_epi16(rg, ba);
+	*hi = _mm_unpackhi_epi16(rg, ba);
+}
+
+
+// a 16-bit pixel in the lower word of each 32-bit word
+static inline __m128i sse_pack16(__m128i p, int is565) {
+	if (is565)
+		return _mm_or_si128(_mm_or_si128(
+			_mm_and_si128(_mm_slli_epi32(p, 8), _mm_set1_epi32(0xf800)),
+			_mm_and_si128(_mm_srli_epi32(p, 5), _mm_set1_epi32(0x07e0))),
+			_mm_and_si128(_mm_srli_epi32(p, 19), _mm_set1_epi32(0x001f)));
+	else
+		return _mm_or_si128(_mm_or_si128(
+			_mm_and_si128(_mm_slli_epi32(p, 7), _mm_set1_epi32(0x7c00)),
+			_mm_and_si128(_mm_srli_epi32(p, 6), _mm_set1_epi32(0x03e0))),
+			_mm_and_si128(_mm_srli_epi32(p, 19), _mm_set1_epi32(0x001f)));
+}
+
+
+static inline void ssse3_from16(uint32_t* d, const uint16_t* s, size_t n, int is565) {
+	size_t i = 0;
+	for (/**/; i + 8 <= n; i += 8) {
+		__m128i lo, hi;
+		sse_expand16(_mm_loadu_si128((const __m128i*)(s + i)), is565, &lo, &hi);
+		_mm_storeu_si128((__m128i*)(d + i + 0), lo);
+		_mm_storeu_si128((__m128i*)(d + i + 4), hi);
+	}
+
+	if (is565)
+		scalar_rgb565_to_rgba(d + i, s + i, n - i);
+	else
+		scalar_rgb555_to_rgba(d + i, s + i, n - i);
+}
+
+
+static inline void ssse3_to16(uint16_t* d, const uint32_t* s, size_t n, int is565) {
+	const __m128i lower_words = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+
+	size_t i = 0;
+	for (/**/; i + 8 <= n; i += 8) {
+		const __m128i a = sse_pack16(_mm_loadu_si128((const __m128i*)(s + i + 0)), is565);
+		const __m128i b = sse_pack16(_mm_loadu_si128((const __m128i*)(s + i + 4)), is565);
+		const __m128i w = _mm_unpacklo_epi64(_mm_shuffle_epi8(a, lower_words), _mm_shuffle_epi8(b, lower_words));
+		_mm_storeu_si128((__m128i*)(d + i), w);
+	}
+
+	if (is565)
+		scalar_rgba_to_rgb565(d + i, s + i, n - i);
+	else
+		scalar_rgba_to_rgb555(d + i, s + i, n - i);
+}
+
+
+void ssse3_rgb565_to_rgba(void* dst, const void* src, size_t n) {
+	ssse3_from16((uint32_t*)dst, (const uint16_t*)src, n, 1);
+}
+
+
+void ssse3_rgba_to_rgb565(void* dst, const void* src, size_t n) {
+	ssse3_to16((uint16_t*)dst, (const uint32_t*)src, n, 1);
+}
+
+
+void ssse3_rgb555_to_rgba(void* dst, const void* src, size_t n) {
+	ssse3_from16((uint32_t*)dst, (const uint16_t*)src, n, 0);
+}
+
+
+void ssse3_rgba_to_rgb555(void* dst, const void* src, size_t n) {
+	ssse3_to16((uint16_t*)dst, (const uint32_t*)src, n, 0);
+}
+
+
+void ssse3_rgb888_to_rgba(void* dst, const void* src, size_t n) {
+	const uint8_t* s = (const uint8_t*)src;
+	uint32_t* d = (uint32_t*)dst;
+
+	const __m128i expand = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+	const __m128i alpha  = _mm_set1_epi32(0xff000000);
+
+	size_t i = 0;
+	for (/**/; i + 16 <= n; i += 16) {
+		const __m128i in0 = _mm_loadu_si128((const __m128i*)(s + 3*i +  0));
+		const __m128i in1 = _mm_loadu_si128((const __m128i*)(s + 3*i + 16));
+		const __m128i in2 = _mm_loadu_si128((const __m128i*)(s + 3*i + 32));
+
+		const __m128i p0 = in0;
+		const __m128i p1 = _mm_alignr_epi8(in1, in0, 12);
+		const __m128i p2 = _mm_alignr_epi8(in2, in1, 8);
+		const __m128i p3 = _mm_srli_si128(in2, 4);
+
+		_mm_storeu_si128((__m128i*)(d + i +  0), _mm_or_si128(_mm_shuffle_epi8(p0, expand), alpha));
+		_mm_storeu_si128((__m128i*)(d + i +  4), _mm_or_si128(_mm_shuffle_epi8(p1, expand), alpha));
+		_mm_storeu_si128((__m128i*)(d + i +  8), _mm_or_si128(_mm_shuffle_epi8(p2, expand), alpha));
+		_mm_storeu_si128((__m128i*)(d + i + 12), _mm_or_si128(_mm_shuffle_epi8(p3, expand), alpha));
+	}
+
+	scalar_rgb888_to_rgba(d + i, s + 3*i, n - i);
+}
+
+
+void ssse3_rgba_to_rgb888(void* dst, const void* src, size_t n) {
+	const uint32_t* s = (const uint32_t*)src;
+	uint8_t* d = (uint8_t*)dst;
+
+	const __m128i compact = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+	size_t i = 0;
+	for (/**/; i + 16 <= n; i += 16) {
+		const __m128i p0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(s + i +  0)), compact);
+		const __m128i p1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(s + i +  4)), compact);
+		const __m128i p2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(s + i +  8)), compact);
+		const __m128i p3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(s + i + 12)), compact);
+
+		_mm_storeu_si128((__m128i*)(d + 3*i +  0), _mm_or_si128(p0, _mm_slli_si128(p1, 12)));
+		_mm_storeu_si128((__m128i*)(d + 3*i + 16), _mm_or_si128(_mm_srli_si128(p1, 4), _mm_slli_si128(p2, 8)));
+		_mm_storeu_si128((__m128i*)(d + 3*i + 32), _mm_or_si128(_mm_srli_si128(p2, 8), _mm_slli_si128(p3, 4)));
+	}
+
+	scalar_rgba_to_rgb888(d + 3*i, s + i, n - i);
+}
+
+
+void ssse3_swap_rb(void* dst, const void* src, size_t n) {
+	const uint32_t* s = (const uint32_t*)src;
+	uint32_t* d = (uint32_t*)dst;
+
+	const __m128i swap = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+	size_t i = 0;
+	for (/**/; i + 4 <= n; i += 4) {
+		const __m128i p = _mm_loadu_si128((const __m128i*)(s + i));
+		_mm_storeu_si128((__m128i*)(d + i), _mm_shuffle_epi8(p, swap));
+	}
+
+	scalar_swap_rb(d + i, s + i, n - i);
+}
+
+
+//--- YUV ------------------------------------------------------------------
+
+static inline __m128i sse_rgba_y(__m128i p) {
+	const __m128i mask = _mm_set1_epi32(0x00ff00ff);
+	const __m128i rb = _mm_and_si128(p, mask);
+	const __m128i ga = _mm_and_si128(_mm_srli_epi32(p, 8), mask);
+
+	const __m128i t = _mm_add_epi32(_mm_madd_epi16(rb, SSE_COEF(66, 25)),
+	                                _mm_madd_epi16(ga, SSE_COEF(129, 0)));
+
+	return _mm_add_epi32(_mm_srli_epi32(_mm_add_epi32(t, _mm_set1_epi32(128)), 8), _mm_set1_epi32(16));
+}
+
+
+// two rows of 4 pixels -> 2 x (U, V)
+static inline __m128i sse_rgba_uv(__m128i p0, __m128i p1) {
+	const __m128i mask = _mm_set1_epi32(0x00ff00ff);
+
+	__m128i rb = _mm_add_epi16(_mm_and_si128(p0, mask), _mm_and_si128(p1, mask));
+	__m128i ga = _mm_add_epi16(_mm_and_si128(_mm_srli_epi32(p0, 8), mask),
+	                           _mm_and_si128(_mm_srli_epi32(p1, 8), mask));
+
+	rb = _mm_add_epi16(rb, _mm_shuffle_epi32(rb, _MM_SHUFFLE(2, 3, 0, 1)));
+	ga = _mm_add_epi16(ga, _mm_shuffle_epi32(ga, _MM_SHUFFLE(2, 3, 0, 1)));
+
+	rb = _mm_srli_epi16(_mm_add_epi16(rb, _mm_set1_epi16(2)), 2);
+	ga = _mm_srli_epi16(_mm_add_epi16(ga, _mm_set1_epi16(2)), 2);
+
+	const __m128i round = _mm_set1_epi32(128);
+	__m128i u = _mm_add_epi32(_mm_madd_epi16(rb, SSE_COEF(-38, 112)), _mm_madd_epi16(ga, SSE_COEF(-74, 0)));
+	__m128i v = _mm_add_epi32(_mm_madd_epi16(rb, SSE_COEF(112, -18)), _mm_madd_epi16(ga, SSE_COEF(-94, 0)));
+
+	u = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(u, round), 8), round);
+	v = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(v, round), 8), round);
+
+	// U from even dwords, V moved to odd ones
+	return _mm_or_si128(_mm_and_si128(u, _mm_set_epi32(0, -1, 0, -1)), _mm_slli_epi64(v, 32));
+}
+
+
+// 16 dwords (values 0..255) -> 16 bytes
+static inline __m128i sse_pack_bytes(__m128i a, __m128i b, __m128i c, __m128i d) {
+	return _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+}
+
+
+static inline size_t ssse3_rgba_to_yuv420(uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v, uint8_t* uv,
+                                          const uint32_t* s0, const uint32_t* s1, size_t width) {
+	const __m128i deinterleave = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+
+	size_t x = 0;
+	for (/**/; x + 16 <= width; x += 16) {
+		__m128i a[4], b[4];
+		for (int i=0; i < 4; i++) {
+			a[i] = _mm_loadu_si128((const __m128i*)(s0 + x + 4*i));
+			b[i] = _mm_loadu_si128((const __m128i*)(s1 + x + 4*i));
+		}
+
+		_mm_storeu_si128((__m128i*)(y0 + x), sse_pack_bytes(sse_rgba_y(a[0]), sse_rgba_y(a[1]), sse_rgba_y(a[2]), sse_rgba_y(a[3])));
+		_mm_storeu_si128((__m128i*)(y1 + x), sse_pack_bytes(sse_rgba_y(b[0]), sse_rgba_y(b[1]), sse_rgba_y(b[2]), sse_rgba_y(b[3])));
+
+		const __m128i c = sse_pack_bytes(sse_rgba_uv(a[0], b[0]), sse_rgba_uv(a[1], b[1]),
+		                                 sse_rgba_uv(a[2], b[2]), sse_rgba_uv(a[3], b[3]));
+		if (uv != NULL)
+			_mm_storeu_si128((__m128i*)(uv + x), c);
+		else {
+			const __m128i t = _mm_shuffle_epi8(c, deinterleave);
+			_mm_storel_epi64((__m128i*)(u + x/2), t);
+			_mm_storel_epi64((__m128i*)(v + x/2), _mm_unpackhi_epi64(t, t));
+		}
+	}
+
+	return x;
+}
+
+
+void ssse3_rgba_to_i420(uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v,
+                        const uint32_t* s0, const uint32_t* s1, size_t width) {
+	const size_t x = ssse3_rgba_to_yuv420(y0, y1, u, v, NULL, s0, s1, width);
+	scalar_rgba_to_i420(y0 + x, y1 + x, u + x/2, v + x/2, s0 + x, s1 + x, width - x);
+}
+
+
+void ssse3_rgba_to_nv12(uint8_t* y0, uint8_t* y1, uint8_t* uv,
+                        const uint32_t* s0, const uint32_t* s1, size_t width) {
+	const size_t x = ssse3_rgba_to_yuv420(y0, y1, NULL, NULL, uv, s0, s1, width);
+	scalar_rgba_to_nv12(y0 + x, y1 + x, uv + x, s0 + x, s1 + x, width - x);
+}
+
+
+// 4 x Y, U, V in 32-bit words -> 4 x RGBA
+static inline __m128i sse_yuv_to_rgba(__m128i y, __m128i u, __m128i v) {
+	const __m128i C = _mm_sub_epi32(y, _mm_set1_epi32(16));
+	const __m128i D = _mm_sub_epi32(u, _mm_set1_epi32(128));
+	const __m128i E = _mm_sub_epi32(v, _mm_set1_epi32(128));
+
+	const __m128i ce = _mm_or_si128(_mm_and_si128(C, _mm_set1_epi32(0xffff)), _mm_slli_epi32(E, 16));
+	const __m128i d1 = _mm_or_si128(_mm_and_si128(D, _mm_set1_epi32(0xffff)), _mm_set1_epi32(0x10000));
+
+	__m128i r = _mm_add_epi32(_mm_madd_epi16(ce, SSE_COEF(298, 409)), _mm_set1_epi32(128));
+	__m128i g = _mm_add_epi32(_mm_madd_epi16(ce, SSE_COEF(298, -208)), _mm_madd_epi16(d1, SSE_COEF(-100, 128)));
+	__m128i b = _mm_add_epi32(_mm_madd_epi16(ce, SSE_COEF(298, 0)), _mm_madd_epi16(d1, SSE_COEF(516, 128)));
+
+	r = _mm_srai_epi32(r, 8);
+	g = _mm_srai_epi32(g, 8);
+	b = _mm_srai_epi32(b, 8);
+
+	// saturating packs clamp to 0..255: R0..R3 G0..G3 B0..B3 A0..A3
+	const __m128i rg = _mm_packs_epi32(r, g);
+	const __m128i ba = _mm_packs_epi32(b, _mm_set1_epi32(255));
+	const __m128i t  = _mm_packus_epi16(rg, ba);
+
+	const __m128i transpose = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+
+	return _mm_shuffle_epi8(t, transpose);
+}
+
+
+// zero-extends bytes a, b, c, d to dwords
+#define SSE_DWORDS(a, b, c, d) _mm_setr_epi8(a, -1, -1, -1, b, -1, -1, -1, c, -1, -1, -1, d, -1, -1, -1)
+
+
+static inline void ssse3_yuv_to_rgba8(uint32_t* dst, __m128i y, __m128i u, __m128i v,
+                                      __m128i u_lo, __m128i u_hi, __m128i v_lo, __m128i v_hi) {
+	const __m128i y_lo = _mm_shuffle_epi8(y, SSE_DWORDS(0, 1, 2, 3));
+	const __m128i y_hi = _mm_shuffle_epi8(y, SSE_DWORDS(4, 5, 6, 7));
+
+	_mm_storeu_si128((__m128i*)(dst + 0), sse_yuv_to_rgba(y_lo, _mm_shuffle_epi8(u, u_lo), _mm_shuffle_epi8(v, v_lo)));
+	_mm_storeu_si128((__m128i*)(dst + 4), sse_yuv_to_rgba(y_hi, _mm_shuffle_epi8(u, u_hi), _mm_shuffle_epi8(v, v_hi)));
+}
+
+
+void ssse3_i420_to_rgba(uint32_t* dst, const uint8_t* y, const uint8_t* u, const uint8_t* v, size_t width) {
+	const __m128i lo = SSE_DWORDS(0, 0, 1, 1);
+	const __m128i hi = SSE_DWORDS(2, 2, 3, 3);
+
+	size_t x = 0;
+	for (/**/; x + 8 <= width; x += 8) {
+		uint32_t u4, v4;
+		memcpy(&u4, u + x/2, 4);
+		memcpy(&v4, v + x/2, 4);
+
+		ssse3_yuv_to_rgba8(dst + x, _mm_loadl_epi64((const __m128i*)(y + x)),
+		                   _mm_cvtsi32_si128(u4), _mm_cvtsi32_si128(v4), lo, hi, lo, hi);
+	}
+
+	scalar_i420_to_rgba(dst + x, y + x, u + x/2, v + x/2, width - x);
+}
+
+
+void ssse3_nv12_to_rgba(uint32_t* dst, const uint8_t* y, const uint8_t* uv, size_t width) {
+	size_t x = 0;
+	for (/**/; x + 8 <= width; x += 8) {
+		const __m128i c = _mm_loadl_epi64((const __m128i*)(uv + x));
+
+		ssse3_yuv_to_rgba8(dst + x, _mm_loadl_epi64((const __m128i*)(y + x)), c, c,
+		                   SSE_DWORDS(0, 0, 2, 2), SSE_DWORDS(4, 4, 6, 6),
+		                   SSE_DWORDS(1, 1, 3, 3), SSE_DWORDS(5, 5, 7, 7));
+	}
+
+	scalar_nv12_to_rgba(dst + x, y + x, uv + x, width - x);
+}
+
+#endif // __SSSE3__
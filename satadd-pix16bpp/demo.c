@@ -32,7 +32,7 @@
 #include <strings.h>
 #include <errno.h>
 
-#include "load_ppm.h"
+#include "netpbm.h"
 #include "Xscr.h"
 
 #include "x86.c"
@@ -137,10 +137,8 @@ int main(int argc, char* argv[]) {
 	}
 
 	int result;
-	int img_width, img_height, img_bits;
-	uint8_t *img;
+	NetpbmImage img;
 
-	FILE* file;
 	if (strcasecmp(argv[1], "mmx") == 0) MMX = 1; else
 	if (strcasecmp(argv[1], "x86") == 0) MMX = 0;
 	else {
@@ -148,24 +146,18 @@ int main(int argc, char* argv[]) {
 		exit(EXIT_FAILURE);
 	}
 
-	file = fopen(argv[2], "rb");
-	if (!file)
-		die("Can't read %s", argv[2]);
-	result = ppm_load_16bpp(file, &img_width, &img_height, &img_bits, &img, 0);
-	fclose(file);
+	result = netpbm_load(argv[2], NETPBM_RGB565, 2, &img);
 
 	if (result < 0)
-		die("PPM file error: %s", PPM_errormsg[-result]);
-	if (img_width != SIZEX || img_height != SIZEY)
+		die("PPM file error: %s", netpbm_errormsg[-result]);
+	if (img.width != SIZEX || img.height != SIZEY)
 		die("Wrong dimensions of image: %dx%d, required 640x480",
-		    img_width, img_height);
-	if (img_bits != 255)
-		die("PPM max value is %d, required 255", img_bits);
-
-	memcpy( (void*)&image1[0][0], (void*)img, SIZEX*SIZEY*2);
-	memcpy( (void*)&image2[0][0], (void*)img, SIZEX*SIZEY*2);
-	memcpy( (void*)&image3[0][0], (void*)img, SIZEX*SIZEY*2);
-	free(img);
+		    img.width, img.height);
+
+	memcpy( (void*)&image1[0][0], (void*)img.data, SIZEX*SIZEY*2);
+	memcpy( (void*)&image2[0][0], (void*)img.data, SIZEX*SIZEY*2);
+	memcpy( (void*)&image3[0][0], (void*)img.data, SIZEX*SIZEY*2);
+	netpbm_image_free(&img);
 
 
 	puts(short_help);
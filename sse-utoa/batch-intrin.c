@@ -0,0 +1,278 @@
+//----------------------------------------------------------------------
+//--- batch conversion -------------------------------------------------
+//----------------------------------------------------------------------
+
+// Procedures convert arrays of numbers and write them, separated with
+// the given character, into a caller-supplied buffer. They don't use
+// any static storage, thus are reentrant. The number of bytes written
+// is returned; no terminating zero is stored.
+//
+// The output buffer must have at least UTOA_BATCH_OUTPUT_SIZE(n) bytes:
+// numbers are written with 16-byte stores, so a few bytes past the
+// returned length might be modified.
+//
+// The core is the algorithm from utoa64_sse: two 8-digit numbers are
+// converted in parallel. A 32-bit number is split into 2 + 8 digits,
+// a 64-bit one into at most 4 + 8 + 8 digits; the highest part of
+// 64-bit number (if non-zero) is converted with scalar code.
+
+#define UTOA_BATCH_OUTPUT_SIZE(n) ((n) * 21 + 32)
+
+#define POW10_8  100000000u
+#define POW10_16 10000000000000000llu
+
+// 16 digits (bytes 0..9) of two 8-digit numbers: abcdefgh ijklmnop
+static inline __m128i batch_digits_sse(uint32_t a, uint32_t b) {
+
+    const __m128i div_10000 = _mm_set1_epi32(DIV_10000);
+    const __m128i mul_10000 = _mm_set1_epi32(10000);
+    const int div_10000_shift = 45;
+
+    const __m128i div_100   = _mm_set1_epi16(DIV_100);
+    const __m128i mul_100   = _mm_set1_epi16(100);
+    const int div_100_shift = 3;
+
+    const __m128i div_10    = _mm_set1_epi16(DIV_10);
+    const __m128i mul_10    = _mm_set1_epi16(10);
+
+    // see utoa64_sse for description of steps
+    const __m128i x = _mm_set_epi64x(b, a);
+
+    __m128i x_div_10000;
+    x_div_10000 = _mm_mul_epu32(x, div_10000);
+    x_div_10000 = _mm_srli_epi64(x_div_10000, div_10000_shift);
+
+    __m128i x_mod_10000;
+    x_mod_10000 = _mm_mul_epu32(x_div_10000, mul_10000);
+    x_mod_10000 = _mm_sub_epi32(x, x_mod_10000);
+
+    const __m128i y = _mm_or_si128(x_div_10000, _mm_slli_epi64(x_mod_10000, 32));
+
+    __m128i y_div_100;
+    y_div_100 = _mm_mulhi_epu16(y, div_100);
+    y_div_100 = _mm_srli_epi16(y_div_100, div_100_shift);
+
+    __m128i y_mod_100;
+    y_mod_100 = _mm_mullo_epi16(y_div_100, mul_100);
+    y_mod_100 = _mm_sub_epi16(y, y_mod_100);
+
+    const __m128i z = _mm_or_si128(y_div_100, _mm_slli_epi32(y_mod_100, 16));
+
+    const __m128i z_div_10 = _mm_mulhi_epu16(z, div_10);
+
+    __m128i z_mod_10;
+    z_mod_10 = _mm_mullo_epi16(z_div_10, mul_10);
+    z_mod_10 = _mm_sub_epi16(z, z_mod_10);
+
+    return _mm_or_si128(z_div_10, _mm_slli_epi16(z_mod_10, 8));
+}
+
+
+// Store digits as ASCII; if strip is non-zero then leading zeros are
+// skipped (but at least one digit is always written).
+static inline char* batch_store_sse(char* out, __m128i digits, int strip) {
+
+    const __m128i ascii0 = _mm_set1_epi8('0');
+    const __m128i iota   = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    uint32_t offset = 0;
+    if (strip) {
+        const uint16_t mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(digits, _mm_setzero_si128()));
+        offset = __builtin_ctz(mask | 0x8000);
+    }
+
+    // shift out leading zeros; bytes past the number are garbage, they
+    // will be overwritten by the following numbers
+    const __m128i shift = _mm_add_epi8(iota, _mm_set1_epi8(offset));
+    const __m128i ascii = _mm_shuffle_epi8(_mm_add_epi8(digits, ascii0), shift);
+
+    _mm_storeu_si128((__m128i*)out, ascii);
+
+    return out + 16 - offset;
+}
+
+
+// 1 .. 9999
+static inline char* batch_store_small(char* out, uint32_t x) {
+
+    const uint32_t d0 = x / 1000;
+    const uint32_t d1 = (x / 100) % 10;
+    const uint32_t d2 = (x / 10) % 10;
+    const uint32_t d3 = x % 10;
+
+    const int len = (x >= 1000) ? 4 : (x >= 100) ? 3 : (x >= 10) ? 2 : 1;
+
+    const uint32_t word = (d0 | (d1 << 8) | (d2 << 16) | (d3 << 24)) + 0x30303030;
+    const uint32_t shifted = word >> (8 * (4 - len));
+    memcpy(out, &shifted, 4);
+
+    return out + len;
+}
+
+
+static inline char* batch_store_sign(char* out, int negative) {
+    *out = '-';
+    return out + negative;
+}
+
+
+static inline char* batch_write_sse(char* out, uint64_t v) {
+    uint32_t hi = 0;
+    if (v >= POW10_16) {
+        hi = v / POW10_16;
+        v  = v % POW10_16;
+        out = batch_store_small(out, hi);
+    }
+
+    const __m128i digits = batch_digits_sse(v / POW10_8, v % POW10_8);
+
+    return batch_store_sse(out, digits, hi == 0);
+}
+
+
+#define BATCH_LOOP_SSE(values, n, separator, output, magnitude, negative) \
+    char* out = output; \
+    for (size_t i=0; i < n; i++) { \
+        out = batch_store_sign(out, negative(values[i])); \
+        out = batch_write_sse(out, magnitude(values[i])); \
+        *out++ = separator; \
+    } \
+    return (n > 0) ? (size_t)(out - output - 1) : 0;
+
+#define BATCH_UNSIGNED_MAGNITUDE(x) ((uint64_t)(x))
+#define BATCH_UNSIGNED_NEGATIVE(x)  0
+#define BATCH_SIGNED_MAGNITUDE(x)   (((x) < 0) ? (uint64_t)0 - (uint64_t)(x) : (uint64_t)(x))
+#define BATCH_SIGNED_NEGATIVE(x)    ((x) < 0)
+
+size_t utoa32_batch_sse(const uint32_t* values, size_t n, char separator, char* output) {
+    BATCH_LOOP_SSE(values, n, separator, output, BATCH_UNSIGNED_MAGNITUDE, BATCH_UNSIGNED_NEGATIVE)
+}
+
+size_t utoa64_batch_sse(const uint64_t* values, size_t n, char separator, char* output) {
+    BATCH_LOOP_SSE(values, n, separator, output, BATCH_UNSIGNED_MAGNITUDE, BATCH_UNSIGNED_NEGATIVE)
+}
+
+size_t itoa32_batch_sse(const int32_t* values, size_t n, char separator, char* output) {
+    BATCH_LOOP_SSE(values, n, separator, output, BATCH_SIGNED_MAGNITUDE, BATCH_SIGNED_NEGATIVE)
+}
+
+size_t itoa64_batch_sse(const int64_t* values, size_t n, char separator, char* output) {
+    BATCH_LOOP_SSE(values, n, separator, output, BATCH_SIGNED_MAGNITUDE, BATCH_SIGNED_NEGATIVE)
+}
+
+#ifdef __AVX2__
+
+// Like batch_digits_sse, but for two pairs of 8-digit numbers, each
+// pair in separate 128-bit lane.
+static inline __m256i batch_digits_avx2(uint32_t a1, uint32_t b1, uint32_t a2, uint32_t b2) {
+
+    const __m256i div_10000 = _mm256_set1_epi32(DIV_10000);
+    const __m256i mul_10000 = _mm256_set1_epi32(10000);
+    const int div_10000_shift = 45;
+
+    const __m256i div_100   = _mm256_set1_epi16(DIV_100);
+    const __m256i mul_100   = _mm256_set1_epi16(100);
+    const int div_100_shift = 3;
+
+    const __m256i div_10    = _mm256_set1_epi16(DIV_10);
+    const __m256i mul_10    = _mm256_set1_epi16(10);
+
+    const __m256i x = _mm256_set_epi64x(b2, a2, b1, a1);
+
+    __m256i x_div_10000;
+    x_div_10000 = _mm256_mul_epu32(x, div_10000);
+    x_div_10000 = _mm256_srli_epi64(x_div_10000, div_10000_shift);
+
+    __m256i x_mod_10000;
+    x_mod_10000 = _mm256_mul_epu32(x_div_10000, mul_10000);
+    x_mod_10000 = _mm256_sub_epi32(x, x_mod_10000);
+
+    const __m256i y = _mm256_or_si256(x_div_10000, _mm256_slli_epi64(x_mod_10000, 32));
+
+    __m256i y_div_100;
+    y_div_100 = _mm256_mulhi_epu16(y, div_100);
+    y_div_100 = _mm256_srli_epi16(y_div_100, div_100_shift);
+
+    __m256i y_mod_100;
+    y_mod_100 = _mm256_mullo_epi16(y_div_100, mul_100);
+    y_mod_100 = _mm256_sub_epi16(y, y_mod_100);
+
+    const __m256i z = _mm256_or_si256(y_div_100, _mm256_slli_epi32(y_mod_100, 16));
+
+    const __m256i z_div_10 = _mm256_mulhi_epu16(z, div_10);
+
+    __m256i z_mod_10;
+    z_mod_10 = _mm256_mullo_epi16(z_div_10, mul_10);
+    z_mod_10 = _mm256_sub_epi16(z, z_mod_10);
+
+    return _mm256_or_si256(z_div_10, _mm256_slli_epi16(z_mod_10, 8));
+}
+
+
+static inline char* batch_write_pair_avx2(char* out, char separator,
+                                          uint64_t v1, int negative1,
+                                          uint64_t v2, int negative2) {
+    uint32_t hi1 = 0;
+    uint32_t hi2 = 0;
+    if (v1 >= POW10_16) {
+        hi1 = v1 / POW10_16;
+        v1  = v1 % POW10_16;
+    }
+    if (v2 >= POW10_16) {
+        hi2 = v2 / POW10_16;
+        v2  = v2 % POW10_16;
+    }
+
+    const __m256i digits = batch_digits_avx2(v1 / POW10_8, v1 % POW10_8,
+                                             v2 / POW10_8, v2 % POW10_8);
+
+    out = batch_store_sign(out, negative1);
+    if (hi1) {
+        out = batch_store_small(out, hi1);
+    }
+    out = batch_store_sse(out, _mm256_castsi256_si128(digits), hi1 == 0);
+    *out++ = separator;
+
+    out = batch_store_sign(out, negative2);
+    if (hi2) {
+        out = batch_store_small(out, hi2);
+    }
+    out = batch_store_sse(out, _mm256_extracti128_si256(digits, 1), hi2 == 0);
+    *out++ = separator;
+
+    return out;
+}
+
+
+#define BATCH_LOOP_AVX2(values, n, separator, output, magnitude, negative) \
+    char* out = output; \
+    size_t i = 0; \
+    for (/**/; i + 2 <= n; i += 2) { \
+        out = batch_write_pair_avx2(out, separator, \
+                                    magnitude(values[i + 0]), negative(values[i + 0]), \
+                                    magnitude(values[i + 1]), negative(values[i + 1])); \
+    } \
+    if (i < n) { \
+        out = batch_store_sign(out, negative(values[i])); \
+        out = batch_write_sse(out, magnitude(values[i])); \
+        *out++ = separator; \
+    } \
+    return (n > 0) ? (size_t)(out - output - 1) : 0;
+
+size_t utoa32_batch_avx2(const uint32_t* values, size_t n, char separator, char* output) {
+    BATCH_LOOP_AVX2(values, n, separator, output, BATCH_UNSIGNED_MAGNITUDE, BATCH_UNSIGNED_NEGATIVE)
+}
+
+size_t utoa64_batch_avx2(const uint64_t* values, size_t n, char separator, char* output) {
+    BATCH_LOOP_AVX2(values, n, separator, output, BATCH_UNSIGNED_MAGNITUDE, BATCH_UNSIGNED_NEGATIVE)
+}
+
+size_t itoa32_batch_avx2(const int32_t* values, size_t n, char separator, char* output) {
+    BATCH_LOOP_AVX2(values, n, separator, output, BATCH_SIGNED_MAGNITUDE, BATCH_SIGNED_NEGATIVE)
+}
+
+size_t itoa64_batch_avx2(const int64_t* values, size_t n, char separator, char* output) {
+    BATCH_LOOP_AVX2(values, n, separator, output, BATCH_SIGNED_MAGNITUDE, BATCH_SIGNED_NEGATIVE)
+}
+
+#endif // __AVX2__
@@ -14,6 +14,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <strings.h>
 
 #include <sys/time.h>
@@ -68,6 +69,7 @@ struct Procedure procedures[] = {
 
 void usage() {
 	puts("usage: progname min max count [functions]");
+	puts("       progname batch [count]");
 	puts("");
 	puts("where function is:");
     struct Procedure* item;
@@ -91,8 +93,107 @@ int is_keyword(const char* keyword, int argc, char* argv[]) {
     return 0;
 }
 
+//--- batch conversion -------------------------------------------------
+
+size_t utoa32_batch_to_chars(const uint32_t* values, size_t n, char separator, char* output, size_t size);
+size_t utoa64_batch_to_chars(const uint64_t* values, size_t n, char separator, char* output, size_t size);
+size_t itoa32_batch_to_chars(const int32_t* values, size_t n, char separator, char* output, size_t size);
+size_t itoa64_batch_to_chars(const int64_t* values, size_t n, char separator, char* output, size_t size);
+
+#define BATCH_SPRINTF(type, format) \
+size_t type##_batch_sprintf(const type* values, size_t n, char separator, char* output) { \
+    char* out = output; \
+    for (size_t i=0; i < n; i++) { \
+        out += sprintf(out, format, values[i]); \
+        *out++ = separator; \
+    } \
+    return (n > 0) ? (size_t)(out - output - 1) : 0; \
+}
+
+BATCH_SPRINTF(uint32_t, "%u")
+BATCH_SPRINTF(uint64_t, "%lu")
+
+void batch_report(const char* name, unsigned time, size_t bytes, unsigned reference_time) {
+    printf("%-20s %6u ms, %8.1f MB/s", name, time, bytes / (1024.0 * 1024.0) / (time / 1000.0));
+    if (reference_time != 0) {
+        printf(" (%0.2f)", ((float)reference_time)/time);
+    }
+    putchar('\n');
+}
+
+#define MEASURE_BATCH(name, call, reference) { \
+    const unsigned t1 = gettime(); \
+    const size_t bytes = call; \
+    const unsigned t2 = gettime(); \
+    batch_report(name, t2 - t1, bytes, reference); \
+    if (reference == 0) reference = t2 - t1; \
+}
+
+// serialize `count` random integers to CSV
+void batch_benchmark(size_t count) {
+
+    uint32_t* values32 = malloc(count * sizeof(uint32_t));
+    uint64_t* values64 = malloc(count * sizeof(uint64_t));
+    const size_t size  = UTOA_BATCH_OUTPUT_SIZE(count);
+    char* output = malloc(size);
+
+    for (size_t i=0; i < count; i++) {
+        values32[i] = rand();
+        values64[i] = ((uint64_t)rand() << 33) ^ ((uint64_t)rand() << 16) ^ rand();
+    }
+
+    // touch the output buffer
+    memset(output, 0, size);
+
+    unsigned reference;
+
+    printf("uint32_t, %lu numbers\n", count);
+    reference = 0;
+    MEASURE_BATCH("sprintf",        uint32_t_batch_sprintf(values32, count, ',', output), reference);
+    MEASURE_BATCH("std::to_chars",  utoa32_batch_to_chars(values32, count, ',', output, size), reference);
+    MEASURE_BATCH("SSE",            utoa32_batch_sse(values32, count, ',', output), reference);
+#ifdef __AVX2__
+    MEASURE_BATCH("AVX2",           utoa32_batch_avx2(values32, count, ',', output), reference);
+#endif
+
+    printf("int32_t, %lu numbers\n", count);
+    reference = 0;
+    MEASURE_BATCH("std::to_chars",  itoa32_batch_to_chars((int32_t*)values32, count, ',', output, size), reference);
+    MEASURE_BATCH("SSE",            itoa32_batch_sse((int32_t*)values32, count, ',', output), reference);
+#ifdef __AVX2__
+    MEASURE_BATCH("AVX2",           itoa32_batch_avx2((int32_t*)values32, count, ',', output), reference);
+#endif
+
+    printf("uint64_t, %lu numbers\n", count);
+    reference = 0;
+    MEASURE_BATCH("sprintf",        uint64_t_batch_sprintf(values64, count, ',', output), reference);
+    MEASURE_BATCH("std::to_chars",  utoa64_batch_to_chars(values64, count, ',', output, size), reference);
+    MEASURE_BATCH("SSE",            utoa64_batch_sse(values64, count, ',', output), reference);
+#ifdef __AVX2__
+    MEASURE_BATCH("AVX2",           utoa64_batch_avx2(values64, count, ',', output), reference);
+#endif
+
+    printf("int64_t, %lu numbers\n", count);
+    reference = 0;
+    MEASURE_BATCH("std::to_chars",  itoa64_batch_to_chars((int64_t*)values64, count, ',', output, size), reference);
+    MEASURE_BATCH("SSE",            itoa64_batch_sse((int64_t*)values64, count, ',', output), reference);
+#ifdef __AVX2__
+    MEASURE_BATCH("AVX2",           itoa64_batch_avx2((int64_t*)values64, count, ',', output), reference);
+#endif
+
+    free(values32);
+    free(values64);
+    free(output);
+}
+
 int main(int argc, char* argv[]) {
 
+    if (argc >= 2 && strcasecmp(argv[1], "batch") == 0) {
+        const size_t count = (argc > 2) ? (size_t)atol(argv[2]) : 10000000;
+        batch_benchmark(count);
+        return EXIT_SUCCESS;
+    }
+
 	if (argc < 4)
 		usage();
 
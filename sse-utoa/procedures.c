@@ -30,3 +30,8 @@ static char utoa_buffer[32] SIMD_ALIGN;
 #include "sse64-intrin.c"
 
 #endif
+
+//---- reentrant batch procedures --------------------------------------
+#include <string.h>
+#include <immintrin.h>
+#include "batch-intrin.c"
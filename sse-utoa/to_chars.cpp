@@ -0,0 +1,36 @@
+// std::to_chars counterparts of batch procedures, used by benchmark.c
+#include <charconv>
+#include <cstdint>
+#include <cstddef>
+
+template <typename T>
+static size_t to_chars_batch(const T* values, size_t n, char separator, char* output, size_t size) {
+    char* out = output;
+    char* end = output + size;
+    for (size_t i=0; i < n; i++) {
+        out = std::to_chars(out, end, values[i]).ptr;
+        *out++ = separator;
+    }
+
+    return (n > 0) ? size_t(out - output - 1) : 0;
+}
+
+extern "C" {
+
+size_t utoa32_batch_to_chars(const uint32_t* values, size_t n, char separator, char* output, size_t size) {
+    return to_chars_batch(values, n, separator, output, size);
+}
+
+size_t utoa64_batch_to_chars(const uint64_t* values, size_t n, char separator, char* output, size_t size) {
+    return to_chars_batch(values, n, separator, output, size);
+}
+
+size_t itoa32_batch_to_chars(const int32_t* values, size_t n, char separator, char* output, size_t size) {
+    return to_chars_batch(values, n, separator, output, size);
+}
+
+size_t itoa64_batch_to_chars(const int64_t* values, size_t n, char separator, char* output, size_t size) {
+    return to_chars_batch(values, n, separator, output, size);
+}
+
+}
@@ -44,7 +44,61 @@ void verify32() {
     putchar('\n');
 }
 
+// batch procedures
+// ------------------------------------------------------------------------
+
+#define BATCH_SIZE 1000
+
+uint64_t random64() {
+    // random magnitude, so numbers of all lengths appear
+    const uint64_t x = ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+    return x >> (rand() % 64);
+}
+
+#define VERIFY_BATCH(type, format, fun, count, special) { \
+    type values[BATCH_SIZE]; \
+    static char expected[UTOA_BATCH_OUTPUT_SIZE(BATCH_SIZE)]; \
+    static char result[UTOA_BATCH_OUTPUT_SIZE(BATCH_SIZE)]; \
+    const type special_values[] = special; \
+    const size_t special_count = sizeof(special_values)/sizeof(special_values[0]); \
+    for (size_t i=0; i < count; i++) { \
+        values[i] = (i < special_count) ? special_values[i] : (type)random64(); \
+    } \
+    size_t len = 0; \
+    for (size_t i=0; i < count; i++) { \
+        len += sprintf(expected + len, (i == 0) ? format : ";" format, values[i]); \
+    } \
+    const size_t ret = fun(values, count, ';', result); \
+    if (ret != len || memcmp(expected, result, len) != 0) { \
+        result[ret] = 0; \
+        printf(#fun " failed, count = %lu\nexpected = '%s'\nresult   = '%s'\n", (size_t)count, expected, result); \
+        exit(1); \
+    } \
+}
+
+#define LIST(...) {__VA_ARGS__}
+
+void verify_batch() {
+    for (int iteration=0; iteration < 2000; iteration++) {
+        const size_t count = iteration % BATCH_SIZE;
+
+        VERIFY_BATCH(uint32_t, "%u",   utoa32_batch_sse, count, LIST(0, 1, 9, 10, 99999999, 100000000, UINT32_MAX))
+        VERIFY_BATCH(int32_t,  "%d",   itoa32_batch_sse, count, LIST(0, -1, 1, INT32_MIN, INT32_MAX))
+        VERIFY_BATCH(uint64_t, "%lu",  utoa64_batch_sse, count, LIST(0, 9999999999999999llu, 10000000000000000llu, UINT64_MAX))
+        VERIFY_BATCH(int64_t,  "%ld",  itoa64_batch_sse, count, LIST(0, -1, INT64_MIN, INT64_MAX))
+#ifdef __AVX2__
+        VERIFY_BATCH(uint32_t, "%u",   utoa32_batch_avx2, count, LIST(0, 1, 9, 10, 99999999, 100000000, UINT32_MAX))
+        VERIFY_BATCH(int32_t,  "%d",   itoa32_batch_avx2, count, LIST(0, -1, 1, INT32_MIN, INT32_MAX))
+        VERIFY_BATCH(uint64_t, "%lu",  utoa64_batch_avx2, count, LIST(0, 9999999999999999llu, 10000000000000000llu, UINT64_MAX))
+        VERIFY_BATCH(int64_t,  "%ld",  itoa64_batch_avx2, count, LIST(0, -1, INT64_MIN, INT64_MAX))
+#endif
+    }
+
+    puts("batch procedures OK");
+}
+
 int main() {
+    verify_batch();
     verify32();
     puts("All OK");
     return 0;
@@ -0,0 +1,187 @@
+//=== AVX2 implementation with lane refill - 64-bit code ==================
+#include <immintrin.h>
+
+/*
+	The same algorithm as AVX512F_refill_mandelbrot (see
+	avx512-refill-proc-64-bit.c): finished lanes get next pixels, points
+	inside the main cardioid and the period-2 bulb are not iterated, and
+	periodic orbits are detected.
+
+	AVX2 lacks compress/expand instructions, thus lanes are refilled in
+	a scalar loop over bits of the finished-lanes mask; the lane state is
+	kept in memory only for that time.
+
+	Coordinates are the same as in AVX2_mandelbrot (see
+	refill-coordinates.c), thus images are the same, except points
+	detected as periodic.
+*/
+
+#ifndef REFILL_EPSILON
+#	define REFILL_EPSILON 1e-6f
+#endif
+
+#ifndef REFILL_BLOCK
+#	define REFILL_BLOCK 8
+#endif
+
+#ifndef REFILL_MIN_AVX2
+#	define REFILL_MIN_AVX2 4
+#endif
+
+
+static int in_main_components(float x, float y) {
+	const float xq = x - 0.25f;
+	const float y2 = y*y;
+	const float q  = xq*xq + y2;
+	const float xb = x + 1.0f;
+
+	return (q * (q + xq) <= 0.25f * y2) || (xb*xb + y2 <= 1.0f/16);
+}
+
+
+void AVX2_refill_mandelbrot(
+	float Re_min, float Re_max,
+	float Im_min, float Im_max,
+	float threshold,
+	int maxiters,
+	int width, int height,
+	uint8_t *data)
+
+{
+	float* const re_table = refill_coordinates(Re_min, Re_max, Im_min, Im_max, width, height, 8);
+	if (re_table == NULL)
+		return;
+
+	const float* const im_table = re_table + width;
+
+	const int total = width * height;
+
+	const __m256i vec_maxiters  = _mm256_set1_epi32(maxiters);
+	const __m256  vec_threshold = _mm256_set1_ps(threshold);
+	const __m256  vec_epsilon   = _mm256_set1_ps(REFILL_EPSILON);
+	const __m256  abs_mask      = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+
+	// lane state, in memory only during refill
+	int32_t index_mem[8], iter_mem[8], mark_mem[8], running_mem[8];
+	float   Cre_mem[8], Cim_mem[8], Xre_mem[8], Xim_mem[8], Sre_mem[8], Sim_mem[8];
+
+	__m256i iter = _mm256_setzero_si256();
+	__m256i mark = _mm256_setzero_si256();
+	__m256i running = _mm256_setzero_si256();	// neither escaped, nor finished
+	__m256  Cre  = _mm256_setzero_ps();
+	__m256  Cim  = _mm256_setzero_ps();
+	__m256  Xre  = _mm256_setzero_ps();
+	__m256  Xim  = _mm256_setzero_ps();
+	__m256  Sre  = _mm256_setzero_ps();
+	__m256  Sim  = _mm256_setzero_ps();
+
+	unsigned valid = 0;	// lanes having a pixel
+	unsigned done  = 0xff;	// lanes to refill
+	int next = 0;		// the next pixel to load
+
+	while (1) {
+		if (done) {
+			_mm256_storeu_si256((__m256i*)iter_mem, iter);
+			_mm256_storeu_si256((__m256i*)mark_mem, mark);
+			_mm256_storeu_si256((__m256i*)running_mem, running);
+			_mm256_storeu_ps(Cre_mem, Cre);
+			_mm256_storeu_ps(Cim_mem, Cim);
+			_mm256_storeu_ps(Xre_mem, Xre);
+			_mm256_storeu_ps(Xim_mem, Xim);
+			_mm256_storeu_ps(Sre_mem, Sre);
+			_mm256_storeu_ps(Sim_mem, Sim);
+
+			while (done) {
+				const int k = __builtin_ctz(done);
+				done &= done - 1;
+
+				if (valid & (1 << k))
+					data[index_mem[k]] = iter_mem[k];
+
+				if (next == total) {
+					valid &= ~(1 << k);
+					running_mem[k] = 0;
+					continue;
+				}
+
+				const int x = next % width;
+				const int y = next / width;
+				const float re = re_table[x];
+				const float im = im_table[y];
+				const int skip = in_main_components(re, im);
+
+				index_mem[k] = next++;
+				iter_mem[k]  = skip ? maxiters : 0;
+				running_mem[k] = skip ? 0 : -1;
+				mark_mem[k]  = REFILL_BLOCK;
+				Cre_mem[k]   = re;
+				Cim_mem[k]   = im;
+				Xre_mem[k]   = 0.0f;
+				Xim_mem[k]   = 0.0f;
+				Sre_mem[k]   = 0.0f;
+				Sim_mem[k]   = 0.0f;
+				valid |= 1 << k;
+			}
+
+			if (valid == 0)
+				break;
+
+			iter = _mm256_loadu_si256((const __m256i*)iter_mem);
+			mark = _mm256_loadu_si256((const __m256i*)mark_mem);
+			running = _mm256_loadu_si256((const __m256i*)running_mem);
+			Cre  = _mm256_loadu_ps(Cre_mem);
+			Cim  = _mm256_loadu_ps(Cim_mem);
+			Xre  = _mm256_loadu_ps(Xre_mem);
+			Xim  = _mm256_loadu_ps(Xim_mem);
+			Sre  = _mm256_loadu_ps(Sre_mem);
+			Sim  = _mm256_loadu_ps(Sim_mem);
+		}
+
+		// REFILL_BLOCK iterations without branches; finished lanes are
+		// frozen, also the escaped ones which wait for refill
+		for (int k=0; k < REFILL_BLOCK; k++) {
+			// Tre = Xre^2 - Xim^2 + Cre
+			const __m256 Xre2 = _mm256_mul_ps(Xre, Xre);
+			const __m256 Xim2 = _mm256_mul_ps(Xim, Xim);
+			const __m256 Tre  = _mm256_add_ps(Cre, _mm256_sub_ps(Xre2, Xim2));
+
+			// Tim = 2*Xre*Xim + Cim
+			const __m256 t1  = _mm256_mul_ps(Xre, Xim);
+			const __m256 Tim = _mm256_add_ps(Cim, _mm256_add_ps(t1, t1));
+
+			// sqr_dist = Tre^2 + Tim^2
+			const __m256 sqr_dist = _mm256_add_ps(_mm256_mul_ps(Tre, Tre), _mm256_mul_ps(Tim, Tim));
+
+			const __m256i inside = _mm256_and_si256(running,
+				_mm256_castps_si256(_mm256_cmp_ps(sqr_dist, vec_threshold, _CMP_LE_OS)));
+
+			iter = _mm256_sub_epi32(iter, inside);
+			running = _mm256_and_si256(inside, _mm256_cmpgt_epi32(vec_maxiters, iter));
+
+			Xre = Tre;
+			Xim = Tim;
+		}
+
+		// periodicity check, only at the block end
+		const __m256 dx = _mm256_and_ps(_mm256_sub_ps(Xre, Sre), abs_mask);
+		const __m256 dy = _mm256_and_ps(_mm256_sub_ps(Xim, Sim), abs_mask);
+		const __m256i periodic = _mm256_and_si256(running, _mm256_castps_si256(_mm256_and_ps(
+			_mm256_cmp_ps(dx, vec_epsilon, _CMP_LE_OQ),
+			_mm256_cmp_ps(dy, vec_epsilon, _CMP_LE_OQ))));
+		iter = _mm256_blendv_epi8(iter, vec_maxiters, periodic);
+		running = _mm256_andnot_si256(periodic, running);
+
+		const __m256i save = _mm256_and_si256(running, _mm256_cmpeq_epi32(iter, mark));
+		Sre  = _mm256_blendv_ps(Sre, Xre, _mm256_castsi256_ps(save));
+		Sim  = _mm256_blendv_ps(Sim, Xim, _mm256_castsi256_ps(save));
+		mark = _mm256_add_epi32(mark, _mm256_and_si256(mark, save));
+
+		// escaped, reached maxiters or periodic
+		const unsigned still = _mm256_movemask_ps(_mm256_castsi256_ps(running));
+		done = valid & ~still;
+		if (__builtin_popcount(done) < REFILL_MIN_AVX2 && still != 0)
+			done = 0;
+	}
+
+	free(re_table);
+}
@@ -53,8 +53,8 @@ void AVX512F_FMA_mandelbrot(
             for (i=0; i < maxiters; i++) {
 
                 // Tre = Xre^2 - Xim^2 + Cre
-                const __m512 t1  = _mm512_fmadd_ps(Xim, Xim, Cre); // Xim^2 + Cre
-                const __m512 Tre = _mm512_fmsub_ps(Xre, Xre, t1);  // Xre^2 - t1
+                const __m512 t1  = _mm512_fnmadd_ps(Xim, Xim, Cre); // Cre - Xim^2
+                const __m512 Tre = _mm512_fmadd_ps(Xre, Xre, t1);   // Xre^2 + t1
 
                 // Tim = 2*Xre*Xim + Cim = (Xre + Xre)*Xim + Cim;
                 const __m512 t2  = _mm512_add_ps(Xre, Xre);
@@ -0,0 +1,204 @@
+//=== AVX512F + FMA implementation with lane refill - 64-bit code =========
+#include <immintrin.h>
+
+/*
+	Lanes are not bound to fixed pixels. When a lane finishes (its point
+	escaped, reached maxiters or the orbit turned out to be periodic),
+	the result is written and the next pixel is loaded into that lane
+	(VPEXPANDD of pixel indices), thus a slow pixel doesn't stall whole
+	vector.
+
+	Points inside the main cardioid and the period-2 bulb are not iterated
+	at all, they get maxiters.
+
+	Lanes are checked every REFILL_BLOCK iterations; within a block lanes
+	which have finished are masked out, so their counters are exact. Lanes
+	are refilled when at least REFILL_MIN of them have finished.
+
+	Periodicity is detected Brent-style: the orbit point is saved at
+	iterations B, 2B, 4B, 8B, ... (B = REFILL_BLOCK) and compared at block
+	ends; if the orbit comes back to the saved point (within REFILL_EPSILON)
+	the point is in the set.
+
+	Coordinates are the same as in AVX512F_FMA_mandelbrot (see
+	refill-coordinates.c), thus images are the same, except points
+	detected as periodic.
+*/
+
+#ifndef REFILL_EPSILON
+#	define REFILL_EPSILON 1e-6f
+#endif
+
+// iterations between checks (a misprediction per finished lane is costly)
+#ifndef REFILL_BLOCK
+#	define REFILL_BLOCK 8
+#endif
+
+// the minimum number of finished lanes to refill
+#ifndef REFILL_MIN
+#	define REFILL_MIN 8
+#endif
+
+
+// mask of points inside the main cardioid or the period-2 bulb
+static __mmask16 AVX512F_in_main_components(__m512 x, __m512 y) {
+
+	// cardioid: q = (x - 1/4)^2 + y^2, q * (q + (x - 1/4)) <= y^2/4
+	const __m512 xq  = _mm512_sub_ps(x, _mm512_set1_ps(0.25f));
+	const __m512 y2  = _mm512_mul_ps(y, y);
+	const __m512 q   = _mm512_fmadd_ps(xq, xq, y2);
+	const __m512 lhs = _mm512_mul_ps(q, _mm512_add_ps(q, xq));
+	const __m512 rhs = _mm512_mul_ps(y2, _mm512_set1_ps(0.25f));
+
+	// bulb: (x + 1)^2 + y^2 <= 1/16
+	const __m512 xb = _mm512_add_ps(x, _mm512_set1_ps(1.0f));
+	const __m512 b  = _mm512_fmadd_ps(xb, xb, y2);
+
+	return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LE_OQ)
+	     | _mm512_cmp_ps_mask(b, _mm512_set1_ps(1.0f/16), _CMP_LE_OQ);
+}
+
+
+void AVX512F_refill_mandelbrot(
+	float Re_min, float Re_max,
+	float Im_min, float Im_max,
+	float threshold,
+	int maxiters,
+	int width, int height,
+	uint8_t *data)
+
+{
+	float* const re_table = refill_coordinates(Re_min, Re_max, Im_min, Im_max, width, height, 16);
+	if (re_table == NULL)
+		return;
+
+	const float* const im_table = re_table + width;
+
+	const int total = width * height;
+
+	const __m512i iota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m512i one  = _mm512_set1_epi32(1);
+	const __m512i vec_total    = _mm512_set1_epi32(total);
+	const __m512i vec_width    = _mm512_set1_epi32(width);
+	const __m512i vec_maxiters = _mm512_set1_epi32(maxiters);
+	const __m512  vec_threshold = _mm512_set1_ps(threshold);
+	const __m512  vec_epsilon   = _mm512_set1_ps(REFILL_EPSILON);
+	const __m512  vec_inv_width = _mm512_set1_ps(1.0f / width);
+
+	// lane state
+	__m512i index = _mm512_setzero_si512();	// pixel index
+	__m512i iter  = _mm512_setzero_si512();
+	__m512i mark  = _mm512_setzero_si512();	// iteration at which orbit point is saved
+	__m512  Cre   = _mm512_setzero_ps();
+	__m512  Cim   = _mm512_setzero_ps();
+	__m512  Xre   = _mm512_setzero_ps();
+	__m512  Xim   = _mm512_setzero_ps();
+	__m512  Sre   = _mm512_setzero_ps();	// saved orbit point
+	__m512  Sim   = _mm512_setzero_ps();
+
+	__mmask16 valid   = 0;		// lanes having a pixel
+	__mmask16 running = 0;		// neither escaped, nor finished
+	__mmask16 done  = 0xffff;	// lanes to refill
+	int next = 0;			// the next pixel to load
+
+	int32_t retired_index[16];
+	int32_t retired_iter[16];
+
+	while (1) {
+		if (done) {
+			// 1. write results of finished lanes
+			const __mmask16 finished = done & valid;
+			_mm512_mask_compressstoreu_epi32(retired_index, finished, index);
+			_mm512_mask_compressstoreu_epi32(retired_iter,  finished, iter);
+
+			const int n = __builtin_popcount(finished);
+			for (int k=0; k < n; k++)
+				data[retired_index[k]] = retired_iter[k];
+
+			// 2. load next pixels
+			index = _mm512_mask_expand_epi32(index, done, _mm512_add_epi32(_mm512_set1_epi32(next), iota));
+			next += __builtin_popcount(done);
+
+			valid = (valid | done) & _mm512_cmplt_epi32_mask(index, vec_total);
+			if (valid == 0)
+				break;
+
+			const __mmask16 loaded = done & valid;
+
+			// index => (x, y); the quotient computed with float may be off by one
+			__m512i y = _mm512_cvttps_epi32(_mm512_mul_ps(_mm512_cvtepi32_ps(index), vec_inv_width));
+			__m512i x = _mm512_sub_epi32(index, _mm512_mullo_epi32(y, vec_width));
+
+			const __mmask16 under = _mm512_cmplt_epi32_mask(x, _mm512_setzero_si512());
+			y = _mm512_mask_sub_epi32(y, under, y, one);
+			x = _mm512_mask_add_epi32(x, under, x, vec_width);
+
+			const __mmask16 over = _mm512_cmpge_epi32_mask(x, vec_width);
+			y = _mm512_mask_add_epi32(y, over, y, one);
+			x = _mm512_mask_sub_epi32(x, over, x, vec_width);
+
+			const __m512 re = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), loaded, x, re_table, 4);
+			const __m512 im = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), loaded, y, im_table, 4);
+
+			Cre  = _mm512_mask_mov_ps(Cre, loaded, re);
+			Cim  = _mm512_mask_mov_ps(Cim, loaded, im);
+			Xre  = _mm512_mask_mov_ps(Xre, loaded, _mm512_setzero_ps());
+			Xim  = _mm512_mask_mov_ps(Xim, loaded, _mm512_setzero_ps());
+			Sre  = _mm512_mask_mov_ps(Sre, loaded, _mm512_setzero_ps());
+			Sim  = _mm512_mask_mov_ps(Sim, loaded, _mm512_setzero_ps());
+			mark = _mm512_mask_mov_epi32(mark, loaded, _mm512_set1_epi32(REFILL_BLOCK));
+			iter = _mm512_mask_mov_epi32(iter, loaded, _mm512_setzero_si512());
+
+			// these are finished immediately
+			const __mmask16 skip = loaded & AVX512F_in_main_components(re, im);
+			iter = _mm512_mask_mov_epi32(iter, skip, vec_maxiters);
+
+			running = (running & valid) | (loaded & ~skip);
+		}
+
+		// REFILL_BLOCK iterations without branches; finished lanes are
+		// frozen, also the escaped ones which wait for refill
+		for (int k=0; k < REFILL_BLOCK; k++) {
+			// Tre = Xre^2 - Xim^2 + Cre
+			const __m512 t1  = _mm512_fnmadd_ps(Xim, Xim, Cre);	// Cre - Xim^2
+			const __m512 Tre = _mm512_fmadd_ps(Xre, Xre, t1);
+
+			// Tim = 2*Xre*Xim + Cim
+			const __m512 t2  = _mm512_add_ps(Xre, Xre);
+			const __m512 Tim = _mm512_fmadd_ps(t2, Xim, Cim);
+
+			// sqr_dist = Tre^2 + Tim^2
+			const __m512 Tre2     = _mm512_mul_ps(Tre, Tre);
+			const __m512 sqr_dist = _mm512_fmadd_ps(Tim, Tim, Tre2);
+
+			const __mmask16 inside = running & _mm512_cmp_ps_mask(sqr_dist, vec_threshold, _CMP_LE_OS);
+			iter = _mm512_mask_add_epi32(iter, inside, iter, one);
+			running = inside & _mm512_cmplt_epi32_mask(iter, vec_maxiters);
+
+			Xre = Tre;
+			Xim = Tim;
+		}
+
+		// periodicity check, only at the block end
+		const __m512 dx = _mm512_abs_ps(_mm512_sub_ps(Xre, Sre));
+		const __m512 dy = _mm512_abs_ps(_mm512_sub_ps(Xim, Sim));
+		const __mmask16 periodic = running
+		                         & _mm512_cmp_ps_mask(dx, vec_epsilon, _CMP_LE_OQ)
+		                         & _mm512_cmp_ps_mask(dy, vec_epsilon, _CMP_LE_OQ);
+		iter = _mm512_mask_mov_epi32(iter, periodic, vec_maxiters);
+		running &= ~periodic;
+
+		const __mmask16 save = running & _mm512_cmpeq_epi32_mask(iter, mark);
+		Sre  = _mm512_mask_mov_ps(Sre, save, Xre);
+		Sim  = _mm512_mask_mov_ps(Sim, save, Xim);
+		mark = _mm512_mask_slli_epi32(mark, save, mark, 1);
+
+		// escaped, reached maxiters or periodic; refilling a single lane
+		// costs more than a few idle lanes
+		done = valid & ~running;
+		if (__builtin_popcount(done) < REFILL_MIN && running != 0)
+			done = 0;
+	}
+
+	free(re_table);
+}
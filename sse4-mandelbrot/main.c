@@ -27,6 +27,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
+#include <strings.h>
 #include <sys/time.h>
 #include <stdarg.h>
 
@@ -62,12 +64,17 @@ void die(const char* fmt, ...) {
 #if defined(VERSION32BIT)
 #   include "sse4-proc-32-bit.c"
 #elif defined(VERSION64BIT)
+#   if defined(AVX2) || defined(AVX512F)
+#       include "refill-coordinates.c"
+#   endif
 #   if defined(AVX2)
 #       include "avx2-proc-64-bit.c"
+#       include "avx2-refill-proc-64-bit.c"
 #   endif
 #   if defined(AVX512F)
 #       include "avx512-proc-64-bit.c"
 #       include "avx512-fma-proc-64-bit.c"
+#       include "avx512-refill-proc-64-bit.c"
 #   endif
 #   if defined(AVX512BW)
 #       include "avx512bw-proc-64-bit.c"
@@ -81,6 +88,25 @@ void die(const char* fmt, ...) {
 #define HEIGHT (512*4)
 
 uint8_t image[WIDTH][HEIGHT];
+uint8_t reference[WIDTH][HEIGHT];	// for --verify
+
+
+// predefined areas for --zoom, deeper zooms need more iterations
+typedef struct {
+	const char* name;
+	float Re_min, Im_min, Re_max, Im_max;
+	int maxiters;
+} ZoomPreset;
+
+const ZoomPreset zoom_presets[] = {
+	{"full",     -2.0,       -1.25,      0.5,        1.25,      255},
+	{"seahorse", -0.7503,     0.1077,   -0.7403,     0.1177,   1000},
+	{"elephant",  0.2800,     0.0065,    0.2900,     0.0165,   1000},
+	{"minibrot", -1.7700,    -0.0150,   -1.7400,     0.0150,   1000},
+	{"spiral",   -0.761774,  -0.0849596, -0.761374, -0.0845596, 2000},
+};
+
+#define ZOOM_PRESETS_COUNT ((int)(sizeof(zoom_presets)/sizeof(zoom_presets[0])))
 
 
 void help(char* progname) {
@@ -106,10 +132,12 @@ void help(char* progname) {
 #endif
 #if defined(AVX2)
     puts("AVX2 - select AVX2 procedure");
+    puts("AVX2+refill - select AVX2 procedure with lane refill and cardioid/periodicity checks");
 #endif
 #if defined(AVX512F)
     puts("AVX512F - select AVX512F procedure");
     puts("AVX512F+FMA - select AVX512F using FMA instructions");
+    puts("AVX512F+refill - select AVX512F+FMA with lane refill and cardioid/periodicity checks");
 #endif
 #if defined(AVX512BW)
     puts("AVX512BW - select AVX512BW procedure");
@@ -123,6 +151,12 @@ void help(char* progname) {
     puts("Options:");
     puts("");
     puts("--dry-run - do not save any file");
+    puts("--verify  - compare image with the procedure without refill (or FPU)");
+    printf("--zoom NAME - predefined area and maxiters:");
+    for (int i=0; i < ZOOM_PRESETS_COUNT; i++) {
+        printf(" %s", zoom_presets[i].name);
+    }
+    putchar('\n');
 	exit(EXIT_FAILURE);
 }
 
@@ -146,13 +180,44 @@ int main(int argc, char* argv[]) {
         AVX2procedure,
         AVX512procedure,
         AVX512F_FMA_procedure,
-        AVX512BW_procedure
+        AVX512BW_procedure,
+        AVX2_refill_procedure,
+        AVX512F_refill_procedure
     } function;
 
 	function = None;
 
-	// parse command line
+	// parse command line; options are removed from argv
 	char *err;
+    char dry_run = 0;
+    char verify  = 0;
+    const ZoomPreset* zoom = NULL;
+    char* args[8];
+    int   nargs = 0;
+    for (int i=0; i < argc; i++) {
+        if (strcmp(argv[i], "--dry-run") == 0) {
+            dry_run = 1;
+        } else if (strcmp(argv[i], "--verify") == 0) {
+            verify = 1;
+        } else if (strcmp(argv[i], "--zoom") == 0) {
+            if (i + 1 == argc) die("--zoom requires a name");
+
+            i += 1;
+            for (int k=0; k < ZOOM_PRESETS_COUNT; k++) {
+                if (strcasecmp(argv[i], zoom_presets[k].name) == 0) {
+                    zoom = &zoom_presets[k];
+                }
+            }
+
+            if (zoom == NULL) die("Unknown zoom preset '%s'", argv[i]);
+        } else if (nargs < 8) {
+            args[nargs++] = argv[i];
+        }
+    }
+
+    argc = nargs;
+    argv = args;
+
 	if (argc == 1) {
 		help(argv[0]);
     }
@@ -167,12 +232,16 @@ int main(int argc, char* argv[]) {
 #if defined(AVX2)
 	if (strcasecmp(argv[1], "AVX2") == 0)
 		function = AVX2procedure;
+	if (strcasecmp(argv[1], "AVX2+refill") == 0)
+		function = AVX2_refill_procedure;
 #endif
 #if defined(AVX512F)
 	if (strcasecmp(argv[1], "AVX512F") == 0)
 		function = AVX512procedure;
 	if (strcasecmp(argv[1], "AVX512F+FMA") == 0)
 		function = AVX512F_FMA_procedure;
+	if (strcasecmp(argv[1], "AVX512F+refill") == 0)
+		function = AVX512F_refill_procedure;
 #endif
 #if defined(AVX512BW)
 	if (strcasecmp(argv[1], "AVX512BW") == 0)
@@ -185,6 +254,14 @@ int main(int argc, char* argv[]) {
 
 
 	// 2. optional area of calculations
+    if (zoom) {
+        Re_min = zoom->Re_min;
+        Im_min = zoom->Im_min;
+        Re_max = zoom->Re_max;
+        Im_max = zoom->Im_max;
+        maxiters = zoom->maxiters;
+    }
+
 	if (argc >= 6) {
 		Re_min = strtod(argv[2], &err);
 		if (*err != '\0') die("Invalid Remin value");
@@ -216,16 +293,6 @@ int main(int argc, char* argv[]) {
 	}
 
 
-    // check for options
-    char dry_run = 0;
-    for (int i=1; i < argc; i++) {
-        if (strcmp(argv[i], "--dry-run") == 0) {
-            dry_run = 1;
-            break;
-        }
-    }
-
-
 	// print summary
 	printf("Image %d x %d, Area [(%0.5f,%0.5f), (%0.5f, %0.5f)], thresold=%0.2f, maxiters=%d\n",
 		WIDTH, HEIGHT,
@@ -313,7 +380,7 @@ int main(int argc, char* argv[]) {
             printf("AVX512F ");
 			fflush(stdout);
 			t1 = get_time();
-			AVX512F_FMA_mandelbrot(
+			AVX512F_mandelbrot(
 				Re_min, Re_max,
 				Im_min, Im_max,
 				threshold, maxiters,
@@ -334,7 +401,7 @@ int main(int argc, char* argv[]) {
             printf("AVX512F+FMA ");
 			fflush(stdout);
 			t1 = get_time();
-			AVX512F_mandelbrot(
+			AVX512F_FMA_mandelbrot(
 				Re_min, Re_max,
 				Im_min, Im_max,
 				threshold, maxiters,
@@ -348,13 +415,14 @@ int main(int argc, char* argv[]) {
 			    f = fopen("avx512f+fma.pgm", "wb");
             }
 #endif
+			break;
 
 		case AVX512BW_procedure:
 #if defined(AVX512BW)
             printf("AVX512BW ");
 			fflush(stdout);
 			t1 = get_time();
-			AVX512F_mandelbrot(
+			AVX512BW_mandelbrot(
 				Re_min, Re_max,
 				Im_min, Im_max,
 				threshold, maxiters,
@@ -367,10 +435,91 @@ int main(int argc, char* argv[]) {
             if (!dry_run) {
 			    f = fopen("avx512bw.pgm", "wb");
             }
+#endif
+			break;
+
+		case AVX2_refill_procedure:
+#if defined(AVX2)
+            printf("AVX2+refill ");
+			fflush(stdout);
+			t1 = get_time();
+			AVX2_refill_mandelbrot(
+				Re_min, Re_max,
+				Im_min, Im_max,
+				threshold, maxiters,
+				WIDTH, HEIGHT,
+				&image[0][0]
+			);
+			t2 = get_time();
+			printf("%d us\n", t2-t1);
+
+            if (!dry_run) {
+			    f = fopen("avx2+refill.pgm", "wb");
+            }
+#endif
+			break;
+
+		case AVX512F_refill_procedure:
+#if defined(AVX512F)
+            printf("AVX512F+refill ");
+			fflush(stdout);
+			t1 = get_time();
+			AVX512F_refill_mandelbrot(
+				Re_min, Re_max,
+				Im_min, Im_max,
+				threshold, maxiters,
+				WIDTH, HEIGHT,
+				&image[0][0]
+			);
+			t2 = get_time();
+			printf("%d us\n", t2-t1);
+
+            if (!dry_run) {
+			    f = fopen("avx512f+refill.pgm", "wb");
+            }
 #endif
 			break;
 	}
 
+    if (verify) {
+        // refill procedures are compared with their plain counterparts
+        void (*procedure)(float, float, float, float, float, int, int, int, uint8_t*) = FPU_mandelbrot;
+        const char* name = "FPU";
+#if defined(AVX2)
+        if (function == AVX2_refill_procedure) {
+            procedure = AVX2_mandelbrot;
+            name = "AVX2";
+        }
+#endif
+#if defined(AVX512F)
+        if (function == AVX512F_refill_procedure) {
+            procedure = AVX512F_FMA_mandelbrot;
+            name = "AVX512F+FMA";
+        }
+#endif
+        printf("%s ", name);
+        fflush(stdout);
+        t1 = get_time();
+        procedure(
+            Re_min, Re_max,
+            Im_min, Im_max,
+            threshold, maxiters,
+            WIDTH, HEIGHT,
+            &reference[0][0]
+        );
+        t2 = get_time();
+        printf("%d us\n", t2-t1);
+
+        int different = 0;
+        for (int y=0; y < HEIGHT; y++) {
+            for (int x=0; x < WIDTH; x++) {
+                different += (image[y][x] != reference[y][x]);
+            }
+        }
+
+        printf("%d pixel(s) differ (%0.4f%%)\n", different, 100.0 * different / (WIDTH * HEIGHT));
+    }
+
 	// save image
 	if (f) {
 		fprintf(f, "P5\n%d %d\n255\n", WIDTH, HEIGHT);
@@ -0,0 +1,46 @@
+//=== pixel coordinates for refill procedures =============================
+
+/*
+	Procedures with lane refill load pixels in any order, thus can't
+	advance coordinates as the plain procedures do.  To get exactly the
+	same points (and images) coordinates are precomputed to tables with
+	the same sequence of float operations as in the plain procedure with
+	given vector width: lane j starts at Re_min + j*dRe and advances by
+	lanes*dRe, Im is advanced by dIm every row.
+
+	Returns NULL if there's no memory; re has width items, im height items.
+*/
+
+float* refill_coordinates(
+	float Re_min, float Re_max,
+	float Im_min, float Im_max,
+	int width, int height,
+	int lanes)
+
+{
+	const float dRe = (Re_max - Re_min)/width;
+	const float dIm = (Im_max - Im_min)/height;
+
+	float* re = (float*)malloc((width + height) * sizeof(float));
+	if (re == NULL)
+		return NULL;
+
+	float* im = re + width;
+
+	const float step = lanes*dRe;
+	for (int j=0; j < lanes && j < width; j++) {
+		float Cre = Re_min + j*dRe;
+		for (int x=j; x < width; x += lanes) {
+			re[x] = Cre;
+			Cre = Cre + step;
+		}
+	}
+
+	float Cim = Im_min;
+	for (int y=0; y < height; y++) {
+		im[y] = Cim;
+		Cim = Cim + dIm;
+	}
+
+	return re;
+}